@@ -0,0 +1,195 @@
+/*!
+ * \file BurnFront.c
+ *
+ * \author Marco Morais
+ * \date 2000-2001
+ *
+ *	HFire (Highly Optmized Tolerance Fire Spread Model) Library
+ *	Copyright (C) 2001 Marco Morais
+ *
+ *	This library is free software; you can redistribute it and/or
+ *	modify it under the terms of the GNU Lesser General Public
+ *	License as published by the Free Software Foundation; either
+ *	version 2.1 of the License, or (at your option) any later version.
+ *
+ *	This library is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *	Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public
+ *	License along with this library; if not, write to the Free Software
+ *	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "BurnFront.h"
+
+static int BurnFrontGrow(BurnFront * bf);
+static void * BurnFrontRealloc(void * ptr, size_t sz, int * status);
+
+BurnFront * InitBurnFront(int nrows, int ncols)	{
+	BurnFront * bf = NULL;
+
+	/* check args */
+	if ( nrows < 1 || ncols < 1 )	{
+		ERR_ERROR_CONTINUE("Size of domain supplied to BurnFront invalid. \n", ERR_EINVAL);
+		return bf;
+		}
+
+	if ( (bf = (BurnFront *) calloc(1, sizeof(BurnFront))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to allocate memory for BurnFront. \n", ERR_ENOMEM);
+		return bf;
+		}
+	bf->nrows = nrows;
+	bf->ncols = ncols;
+
+	/* calloc leaves every cell of map not burning */
+	if ( (bf->map = (int *) calloc((size_t) nrows * ncols, sizeof(int))) == NULL
+			|| BurnFrontGrow(bf) )	{
+		FreeBurnFront(bf);
+		ERR_ERROR_CONTINUE("Unable to allocate memory for BurnFront. \n", ERR_ENOMEM);
+		return NULL;
+		}
+
+	return bf;
+	}
+
+int BurnFrontAdd(BurnFront * bf, int i, int j)	{
+	int idx, k;
+
+	if ( bf->size == bf->cap && BurnFrontGrow(bf) )	{
+		ERR_ERROR_CONTINUE("Unable to allocate memory for BurnFront cell. \n", ERR_ENOMEM);
+		return -1;
+		}
+
+	idx = bf->size++;
+	bf->i[idx] = i;
+	bf->j[idx] = j;
+	bf->max_rosmps[idx] = 0.0;
+	bf->max_ros_az[idx] = 0;
+	bf->eccen[idx] = 0.0f;
+	bf->ign_secs[idx] = 0.0;
+	for(k = idx * EIGHTNBR_NUM_NBR_CELLS; k < (idx + 1) * EIGHTNBR_NUM_NBR_CELLS; k++)	{
+		bf->rosmps[k] = 0.0;
+		bf->distm[k] = 0.0;
+		bf->dist2ctrm[k] = 0.0;
+		}
+	bf->map[i * bf->ncols + j] = idx + 1;
+
+	return idx;
+	}
+
+void BurnFrontRemove(BurnFront * bf, int idx)	{
+	if ( !BURN_FRONT_IS_REMOVED(bf, idx) )	{
+		/* map may already refer to a later ignition of the same cell */
+		if ( bf->map[bf->i[idx] * bf->ncols + bf->j[idx]] == idx + 1 )	{
+			bf->map[bf->i[idx] * bf->ncols + bf->j[idx]] = 0;
+			}
+		bf->i[idx] = BURN_FRONT_REMOVED;
+		}
+	return;
+	}
+
+void BurnFrontCompact(BurnFront * bf)	{
+	int r, w;
+
+	for(r = 0, w = 0; r < bf->size; r++)	{
+		if ( BURN_FRONT_IS_REMOVED(bf, r) )	{
+			continue;
+			}
+		if ( r != w )	{
+			bf->i[w] = bf->i[r];
+			bf->j[w] = bf->j[r];
+			bf->max_rosmps[w] = bf->max_rosmps[r];
+			bf->max_ros_az[w] = bf->max_ros_az[r];
+			bf->eccen[w] = bf->eccen[r];
+			bf->ign_secs[w] = bf->ign_secs[r];
+			memcpy(BURN_FRONT_NBR_ARRAY(bf, rosmps, w), BURN_FRONT_NBR_ARRAY(bf, rosmps, r), sizeof(double) * EIGHTNBR_NUM_NBR_CELLS);
+			memcpy(BURN_FRONT_NBR_ARRAY(bf, distm, w), BURN_FRONT_NBR_ARRAY(bf, distm, r), sizeof(double) * EIGHTNBR_NUM_NBR_CELLS);
+			memcpy(BURN_FRONT_NBR_ARRAY(bf, dist2ctrm, w), BURN_FRONT_NBR_ARRAY(bf, dist2ctrm, r), sizeof(double) * EIGHTNBR_NUM_NBR_CELLS);
+			if ( bf->map[bf->i[w] * bf->ncols + bf->j[w]] == r + 1 )	{
+				bf->map[bf->i[w] * bf->ncols + bf->j[w]] = w + 1;
+				}
+			}
+		w++;
+		}
+	bf->size = w;
+
+	return;
+	}
+
+void ResetBurnFront(BurnFront * bf)	{
+	int idx;
+
+	for(idx = 0; idx < bf->size; idx++)	{
+		BurnFrontRemove(bf, idx);
+		}
+	bf->size = 0;
+
+	return;
+	}
+
+void FreeBurnFront(void * vptr)	{
+	BurnFront * bf = NULL;
+
+	if ( vptr != NULL )	{
+		bf = (BurnFront *) vptr;
+		if ( bf->map != NULL )			free(bf->map);
+		if ( bf->i != NULL )			free(bf->i);
+		if ( bf->j != NULL )			free(bf->j);
+		if ( bf->max_rosmps != NULL )	free(bf->max_rosmps);
+		if ( bf->max_ros_az != NULL )	free(bf->max_ros_az);
+		if ( bf->eccen != NULL )		free(bf->eccen);
+		if ( bf->rosmps != NULL )		free(bf->rosmps);
+		if ( bf->distm != NULL )		free(bf->distm);
+		if ( bf->dist2ctrm != NULL )	free(bf->dist2ctrm);
+		if ( bf->ign_secs != NULL )		free(bf->ign_secs);
+		free(bf);
+		}
+	bf = NULL;
+	return;
+	}
+
+/*
+ * Doubles the capacity of every member array, arrays already grown keep their new size if a
+ * later allocation fails.
+ */
+int BurnFrontGrow(BurnFront * bf)	{
+	int status = ERR_SUCCESS;
+	size_t cap = (bf->cap > 0) ? (size_t) bf->cap * 2 : BURN_FRONT_INI_CAPACITY;
+
+	bf->i = (int *) BurnFrontRealloc(bf->i, sizeof(int) * cap, &status);
+	bf->j = (int *) BurnFrontRealloc(bf->j, sizeof(int) * cap, &status);
+	bf->max_rosmps = (double *) BurnFrontRealloc(bf->max_rosmps, sizeof(double) * cap, &status);
+	bf->max_ros_az = (unsigned char *) BurnFrontRealloc(bf->max_ros_az, sizeof(unsigned char) * cap, &status);
+	bf->eccen = (float *) BurnFrontRealloc(bf->eccen, sizeof(float) * cap, &status);
+	bf->rosmps = (double *) BurnFrontRealloc(bf->rosmps, sizeof(double) * EIGHTNBR_NUM_NBR_CELLS * cap, &status);
+	bf->distm = (double *) BurnFrontRealloc(bf->distm, sizeof(double) * EIGHTNBR_NUM_NBR_CELLS * cap, &status);
+	bf->dist2ctrm = (double *) BurnFrontRealloc(bf->dist2ctrm, sizeof(double) * EIGHTNBR_NUM_NBR_CELLS * cap, &status);
+	bf->ign_secs = (double *) BurnFrontRealloc(bf->ign_secs, sizeof(double) * cap, &status);
+	if ( status != ERR_SUCCESS )	{
+		return status;
+		}
+	bf->cap = (int) cap;
+
+	return ERR_SUCCESS;
+	}
+
+/*
+ * Reallocates ptr to sz bytes, on failure ptr is returned unchanged and status is set.
+ */
+void * BurnFrontRealloc(void * ptr, size_t sz, int * status)	{
+	void * nptr = NULL;
+
+	if ( *status != ERR_SUCCESS )	{
+		return ptr;
+		}
+	if ( (nptr = realloc(ptr, sz)) == NULL )	{
+		*status = ERR_ENOMEM;
+		return ptr;
+		}
+
+	return nptr;
+	}
+
+/* end of BurnFront.c */
@@ -0,0 +1,186 @@
+/*!
+ * \file BurnFront.h
+ * \brief Pooled storage of the parameters of burning cells.
+ *
+ * \author Marco Morais
+ * \date 2000-2001
+ *
+ *	HFire (Highly Optmized Tolerance Fire Spread Model) Library
+ *	Copyright (C) 2001 Marco Morais
+ *
+ *	This library is free software; you can redistribute it and/or
+ *	modify it under the terms of the GNU Lesser General Public
+ *	License as published by the Free Software Foundation; either
+ *	version 2.1 of the License, or (at your option) any later version.
+ *
+ *	This library is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *	Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public
+ *	License along with this library; if not, write to the Free Software
+ *	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef	BurnFront_H
+#define BurnFront_H
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "EightNbr.h"
+#include "Err.h"
+
+/*
+ *********************************************************
+ * DEFINES, ENUMS
+ *********************************************************
+ */
+
+/*! \def BURN_FRONT_INI_CAPACITY
+ *	\brief number of burning cells allocated when the front is initialized
+ */
+#define BURN_FRONT_INI_CAPACITY				(1024)
+
+/*! \def BURN_FRONT_REMOVED
+ *	\brief row index marking a burning cell removed from the front but not yet compacted
+ */
+#define BURN_FRONT_REMOVED					(-1)
+
+/*
+ *********************************************************
+ * STRUCTS, TYPEDEFS
+ *********************************************************
+ */
+
+/*! Type name for BurnFront_
+ *	\sa For a list of members goto BurnFront_
+ */
+typedef struct BurnFront_ BurnFront;
+
+/*! \struct BurnFront_ BurnFront.h "BurnFront.h"
+ *	\brief burning cells stored as parallel arrays in the order they were ignited
+ *
+ *	Each member array holds one value per burning cell, and the per-neighbor arrays hold
+ *	EIGHTNBR_NUM_NBR_CELLS consecutive values per burning cell.  Cells are removed by marking
+ *	them with BurnFrontRemove and squeezing them out with BurnFrontCompact, which preserves the
+ *	order of the remaining cells.  The index of the burning cell at each row and column of the
+ *	domain is kept in map, offset by one so that zero identifies cells which are not burning.
+ */
+struct BurnFront_	{
+	/*! number of burning cells, including those removed since the last compaction */
+	int size;
+	/*! number of burning cells allocated */
+	int cap;
+	/*! number of rows in domain */
+	int nrows;
+	/*! number of columns in domain */
+	int ncols;
+	/*! 1 + index of burning cell at each cell in domain, 0 if not burning */
+	int * map;
+	/*! cell row, BURN_FRONT_REMOVED if removed */
+	int * i;
+	/*! cell col */
+	int * j;
+	/*! maximum rate of spread, in m/s */
+	double * max_rosmps;
+	/*! azimuth of maximum rate of spread as EightNbr index */
+	unsigned char * max_ros_az;
+	/*! eccentricity of fire */
+	float * eccen;
+	/*! rate of spread in direction of neighbor, in m/s */
+	double * rosmps;
+	/*! distance spread in direction of neighbor, in m */
+	double * distm;
+	/*! distance to neighboring cell center, in m */
+	double * dist2ctrm;
+	/*! time within the current timestep at which cell ignited, in s */
+	double * ign_secs;
+	};
+
+/*
+ *********************************************************
+ * MACROS
+ *********************************************************
+ */
+
+/*! \def BURN_FRONT_SIZE
+ *	\brief number of burning cells in front
+ */
+#define BURN_FRONT_SIZE(bf)					((bf)->size)
+
+/*! \def BURN_FRONT_INDEX_AT
+ *	\brief index of burning cell at row and column, -1 if cell not burning
+ */
+#define BURN_FRONT_INDEX_AT(bf, row, col)	((bf)->map[(row) * (bf)->ncols + (col)] - 1)
+
+/*! \def BURN_FRONT_NBR_ARRAY
+ *	\brief ptr to the EIGHTNBR_NUM_NBR_CELLS values of a per-neighbor member of burning cell idx
+ */
+#define BURN_FRONT_NBR_ARRAY(bf, member, idx)	((bf)->member + (idx) * EIGHTNBR_NUM_NBR_CELLS)
+
+/*! \def BURN_FRONT_IS_REMOVED
+ *	\brief 1 if burning cell idx has been removed from front, 0 otherwise
+ */
+#define BURN_FRONT_IS_REMOVED(bf, idx)		((bf)->i[(idx)] == BURN_FRONT_REMOVED)
+
+/*
+ *********************************************************
+ * PUBLIC FUNCTIONS
+ *********************************************************
+ */
+
+/*! \fn BurnFront * InitBurnFront(int nrows, int ncols)
+ * 	\brief Initializes an empty front for a domain of the supplied size.
+ *
+ * 	\param nrows number of rows in domain
+ * 	\param ncols number of columns in domain
+ * 	\retval BurnFront* Ptr to BurnFront, or NULL if unable to initialize
+ */
+BurnFront * InitBurnFront(int nrows, int ncols);
+
+/*! \fn int BurnFrontAdd(BurnFront * bf, int i, int j)
+ * 	\brief Appends a burning cell with all parameters set to zero.
+ *
+ *	Storage grows by doubling, so cells are never allocated individually.
+ * 	\param bf BurnFront
+ * 	\param i cell row
+ * 	\param j cell col
+ * 	\retval int index of the new burning cell, or -1 if unable to allocate memory
+ */
+int BurnFrontAdd(BurnFront * bf, int i, int j);
+
+/*! \fn void BurnFrontRemove(BurnFront * bf, int idx)
+ * 	\brief Marks burning cell idx as removed and clears its entry in the map.
+ *
+ *	The cell keeps its slot until BurnFrontCompact is called, so indices of other cells are unchanged.
+ * 	\param bf BurnFront
+ * 	\param idx index of burning cell
+ */
+void BurnFrontRemove(BurnFront * bf, int idx);
+
+/*! \fn void BurnFrontCompact(BurnFront * bf)
+ * 	\brief Squeezes removed cells out of the front in a single pass, preserving the order of remaining cells.
+ *
+ * 	\param bf BurnFront
+ */
+void BurnFrontCompact(BurnFront * bf);
+
+/*! \fn void ResetBurnFront(BurnFront * bf)
+ * 	\brief Empties the front for a new year, keeping the storage allocated.
+ *
+ *	Only entries of the map referring to cells of the front are cleared.
+ * 	\param bf BurnFront
+ */
+void ResetBurnFront(BurnFront * bf);
+
+/*! \fn void FreeBurnFront(void * vptr)
+ * 	\brief Frees memory associated with BurnFront structure.
+ *
+ *	\sa BurnFront
+ * 	\param vptr ptr to BurnFront
+ */
+void FreeBurnFront(void * vptr);
+
+#endif BurnFront_H		/* end of BurnFront.h */
@@ -0,0 +1,74 @@
+/*!
+ * \file CellPlane.c
+ *
+ * \author Marco Morais
+ * \date 2000-2001
+ *
+ *	HFire (Highly Optmized Tolerance Fire Spread Model) Library
+ *	Copyright (C) 2001 Marco Morais
+ *
+ *	This library is free software; you can redistribute it and/or
+ *	modify it under the terms of the GNU Lesser General Public
+ *	License as published by the Free Software Foundation; either
+ *	version 2.1 of the License, or (at your option) any later version.
+ *
+ *	This library is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *	Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public
+ *	License along with this library; if not, write to the Free Software
+ *	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "CellPlane.h"
+
+CellPlane * InitCellPlane(int nrows, int ncols)	{
+	CellPlane * cp = NULL;
+	long int k, ncells;
+
+	/* check args */
+	if ( nrows < 1 || ncols < 1 )	{
+		ERR_ERROR_CONTINUE("Size of domain supplied to CellPlane invalid. \n", ERR_EINVAL);
+		return cp;
+		}
+
+	if ( (cp = (CellPlane *) calloc(1, sizeof(CellPlane))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to allocate memory for CellPlane. \n", ERR_ENOMEM);
+		return cp;
+		}
+	cp->nrows = nrows;
+	cp->ncols = ncols;
+	cp->mask_stride = (ncols + 7) / 8;
+
+	/* calloc leaves every cell of mask burnable */
+	ncells = (long int) nrows * ncols;
+	if ( (cp->cells = (unsigned short *) malloc(sizeof(unsigned short) * ncells)) == NULL
+			|| (cp->unburnable = (unsigned char *) calloc((size_t) nrows * cp->mask_stride, sizeof(unsigned char))) == NULL )	{
+		FreeCellPlane(cp);
+		ERR_ERROR_CONTINUE("Unable to allocate memory for CellPlane. \n", ERR_ENOMEM);
+		return NULL;
+		}
+	for(k = 0; k < ncells; k++)	{
+		cp->cells[k] = (unsigned short) EnumNoFireCellState;
+		}
+
+	return cp;
+	}
+
+void FreeCellPlane(void * vptr)	{
+	CellPlane * cp = NULL;
+
+	if ( vptr != NULL )	{
+		cp = (CellPlane *) vptr;
+		if ( cp->cells != NULL )		free(cp->cells);
+		if ( cp->unburnable != NULL )	free(cp->unburnable);
+		free(cp);
+		}
+	cp = NULL;
+
+	return;
+	}
+
+/* end of CellPlane.c */
@@ -0,0 +1,222 @@
+/*!
+ * \file CellPlane.h
+ * \brief Packed per cell state of the simulation domain shared by every year of simulation.
+ *
+ * \author Marco Morais
+ * \date 2000-2001
+ *
+ *	HFire (Highly Optmized Tolerance Fire Spread Model) Library
+ *	Copyright (C) 2001 Marco Morais
+ *
+ *	This library is free software; you can redistribute it and/or
+ *	modify it under the terms of the GNU Lesser General Public
+ *	License as published by the Free Software Foundation; either
+ *	version 2.1 of the License, or (at your option) any later version.
+ *
+ *	This library is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *	Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public
+ *	License along with this library; if not, write to the Free Software
+ *	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef	CellPlane_H
+#define CellPlane_H
+
+#include <stdlib.h>
+
+#include "Err.h"
+
+/*
+ *********************************************************
+ * DEFINES, ENUMS
+ *********************************************************
+ */
+
+/*! \enum EnumCellState_
+ *	\brief constant storing state of fire inside of cell
+ *	\note EnumUnBurnableCellState cell is not burnable
+ *	\note EnumNoFireCellState cell is burnable, but has no fire in cell
+ *	\note EnumHasFireCellState fire in cell, but fuel in cell is not completely consumed
+ *	\note EnumConsumedCellState all fuel in cell is consumed, fire will not propagate through cell
+ */
+enum EnumCellState_	{
+	EnumUnBurnableCellState	= 0,
+	EnumNoFireCellState		= 1,
+	EnumHasFireCellState	= 2,
+	EnumConsumedCellState	= 3
+	};
+
+/*! \def CELL_PLANE_STATE_BITS
+ *	\brief bits of each cell storing EnumCellState
+ */
+#define CELL_PLANE_STATE_BITS			(0x0003)
+
+/*! \def CELL_PLANE_SA_SHIFT
+ *	\brief position of the bits of each cell storing santa ana history
+ */
+#define CELL_PLANE_SA_SHIFT				(2)
+
+/*! \def CELL_PLANE_SA_BITS
+ *	\brief bits of each cell storing santa ana history
+ */
+#define CELL_PLANE_SA_BITS				(0x000C)
+
+/*! \def CELL_PLANE_HOURS_SHIFT
+ *	\brief position of the bits of each cell storing hours burning
+ */
+#define CELL_PLANE_HOURS_SHIFT			(4)
+
+/*! \def CELL_PLANE_HOURS_MAX
+ *	\brief largest count of hours burning, the count saturates at this value
+ */
+#define CELL_PLANE_HOURS_MAX			(0x0FFF)
+
+/*
+ *********************************************************
+ * STRUCTS, TYPEDEFS
+ *********************************************************
+ */
+
+/*! Type name for EnumCellState_
+ *	\sa For a list of constants goto EnumCellState_
+ */
+typedef enum EnumCellState_ EnumCellState;
+
+/*! Type name for CellPlane_
+ *	\sa For a list of members goto CellPlane_
+ */
+typedef struct CellPlane_ CellPlane;
+
+/*!	\struct CellPlane_ CellPlane.h "CellPlane.h"
+ *	\brief per cell state packed into a single word, with a mask of cells holding unburnable fuel
+ *	Each word holds the EnumCellState in bits 0-1, the santa ana history in bits 2-3, and the
+ *	number of hours the cell has been burning in bits 4-15.  The mask holds one bit per cell, each
+ *	row starting on a new byte so rows may be written by different threads.  The plane is allocated
+ *	once and reset from the fuels at the start of each year.
+ */
+struct CellPlane_ {
+	/*! number of rows in domain */
+	int nrows;
+	/*! number of columns in domain */
+	int ncols;
+	/*! number of bytes in each row of unburnable */
+	int mask_stride;
+	/*! packed state of each cell */
+	unsigned short * cells;
+	/*! one bit per cell, set if fuel in cell is unburnable */
+	unsigned char * unburnable;
+	};
+
+/*
+ *********************************************************
+ * MACROS
+ *********************************************************
+ */
+
+/*! \def CELL_PLANE_CELL
+ *	\brief packed word of cell at row and column, may be assigned
+ */
+#define CELL_PLANE_CELL(cp, i, j)				((cp)->cells[(long int) (i) * (cp)->ncols + (j)])
+
+/*! \def CELL_PLANE_WORD_STATE
+ *	\brief EnumCellState stored in packed word
+ */
+#define CELL_PLANE_WORD_STATE(w)				((w) & CELL_PLANE_STATE_BITS)
+
+/*! \def CELL_PLANE_WORD_SA
+ *	\brief santa ana history stored in packed word
+ */
+#define CELL_PLANE_WORD_SA(w)					(((w) & CELL_PLANE_SA_BITS) >> CELL_PLANE_SA_SHIFT)
+
+/*! \def CELL_PLANE_GET_STATE
+ *	\brief EnumCellState of cell at row and column
+ */
+#define CELL_PLANE_GET_STATE(cp, i, j)			CELL_PLANE_WORD_STATE(CELL_PLANE_CELL(cp, i, j))
+
+/*! \def CELL_PLANE_SET_STATE
+ *	\brief sets EnumCellState of cell at row and column
+ */
+#define CELL_PLANE_SET_STATE(cp, i, j, state)	(CELL_PLANE_CELL(cp, i, j) = (unsigned short)						\
+													((CELL_PLANE_CELL(cp, i, j) & ~CELL_PLANE_STATE_BITS) | ((state) & CELL_PLANE_STATE_BITS)))
+
+/*! \def CELL_PLANE_GET_SA
+ *	\brief santa ana history of cell at row and column
+ */
+#define CELL_PLANE_GET_SA(cp, i, j)				CELL_PLANE_WORD_SA(CELL_PLANE_CELL(cp, i, j))
+
+/*! \def CELL_PLANE_SET_SA
+ *	\brief sets santa ana history of cell at row and column, sa in the range 0-3
+ */
+#define CELL_PLANE_SET_SA(cp, i, j, sa)			(CELL_PLANE_CELL(cp, i, j) = (unsigned short)						\
+													((CELL_PLANE_CELL(cp, i, j) & ~CELL_PLANE_SA_BITS) | (((sa) << CELL_PLANE_SA_SHIFT) & CELL_PLANE_SA_BITS)))
+
+/*! \def CELL_PLANE_GET_HOURS
+ *	\brief hours cell at row and column has been burning
+ */
+#define CELL_PLANE_GET_HOURS(cp, i, j)			(CELL_PLANE_CELL(cp, i, j) >> CELL_PLANE_HOURS_SHIFT)
+
+/*! \def CELL_PLANE_INCR_HOURS
+ *	\brief increments hours cell at row and column has been burning, saturating at CELL_PLANE_HOURS_MAX
+ */
+#define CELL_PLANE_INCR_HOURS(cp, i, j)			(CELL_PLANE_CELL(cp, i, j) = (unsigned short) (CELL_PLANE_CELL(cp, i, j)		\
+													+ ((CELL_PLANE_GET_HOURS(cp, i, j) < CELL_PLANE_HOURS_MAX) ? (1 << CELL_PLANE_HOURS_SHIFT) : 0)))
+
+/*! \def CELL_PLANE_CLEAR_HOURS
+ *	\brief resets hours cell at row and column has been burning to zero
+ */
+#define CELL_PLANE_CLEAR_HOURS(cp, i, j)		(CELL_PLANE_CELL(cp, i, j) = (unsigned short)						\
+													(CELL_PLANE_CELL(cp, i, j) & ~(CELL_PLANE_HOURS_MAX << CELL_PLANE_HOURS_SHIFT)))
+
+/*! \def CELL_PLANE_MASK_BYTE
+ *	\brief byte of unburnable mask holding the bit of cell at row and column
+ */
+#define CELL_PLANE_MASK_BYTE(cp, i, j)			((cp)->unburnable[(long int) (i) * (cp)->mask_stride + ((j) >> 3)])
+
+/*! \def CELL_PLANE_IS_UNBURNABLE
+ *	\brief 1 if fuel in cell at row and column is unburnable, 0 otherwise
+ */
+#define CELL_PLANE_IS_UNBURNABLE(cp, i, j)		((CELL_PLANE_MASK_BYTE(cp, i, j) >> ((j) & 7)) & 1)
+
+/*! \def CELL_PLANE_INIT_CELL
+ *	\brief resets cell at row and column at the start of a year, unburnable state and mask bit set if is_unburnable
+ *	No fire has burned in the cell and the cell has not been burning for any hours.
+ */
+#define CELL_PLANE_INIT_CELL(cp, i, j, is_unburnable)	{														\
+			if ( (is_unburnable) )	{																		\
+				CELL_PLANE_CELL(cp, i, j) = (unsigned short) EnumUnBurnableCellState;						\
+				CELL_PLANE_MASK_BYTE(cp, i, j) |= (unsigned char) (1 << ((j) & 7));							\
+				}																							\
+			else	{																						\
+				CELL_PLANE_CELL(cp, i, j) = (unsigned short) EnumNoFireCellState;							\
+				CELL_PLANE_MASK_BYTE(cp, i, j) &= (unsigned char) ~(1 << ((j) & 7));							\
+				}																							\
+			}
+
+/*
+ *********************************************************
+ * PUBLIC FUNCTIONS
+ *********************************************************
+ */
+
+/*! \fn CellPlane * InitCellPlane(int nrows, int ncols)
+ * 	\brief Allocates a CellPlane for a domain of the supplied size with every cell burnable and not burning.
+ *
+ * 	\param nrows number of rows in domain
+ * 	\param ncols number of columns in domain
+ * 	\retval CellPlane* Ptr to CellPlane, or NULL if unable to initialize
+ */
+CellPlane * InitCellPlane(int nrows, int ncols);
+
+/*! \fn void FreeCellPlane(void * vptr)
+ * 	\brief Frees memory associated with CellPlane structure.
+ *
+ *	\sa CellPlane
+ * 	\param vptr ptr to CellPlane
+ */
+void FreeCellPlane(void * vptr);
+
+#endif CellPlane_H		/* end of CellPlane.h */
@@ -27,7 +27,8 @@
 CellState * InitCellStateFuels(GridData * fuels, ChHashTable * fmtble)	{
 	CellState * cs 	= NULL;
 	FuelModel * fm 	= NULL;
-	int cell_fm_num;
+	int * fm_row	= NULL;
+	int cell_fm_num, is_unburnable;
 	int i, j;
 	
 	/* check args */
@@ -48,8 +49,9 @@ CellState * InitCellStateFuels(GridData * fuels, ChHashTable * fmtble)	{
 	cs->cellsize = fuels->ghdr->cellsize;
 	
 	/* allocate memory for cell state */
-	cs->state = InitByteTwoDArraySizeIniValue(fuels->ghdr->nrows, fuels->ghdr->ncols, EnumNoFireCellState);
-	if ( cs->state == NULL )	{
+	cs->plane = InitCellPlane(fuels->ghdr->nrows, fuels->ghdr->ncols);
+	cs->owns_plane = 1;
+	if ( cs->plane == NULL )	{
 		ERR_ERROR_CONTINUE("Unable to allocate memory for state array underlying CellState. \n", ERR_ENOMEM);	
 		if ( cs != NULL )
 			free(cs);
@@ -57,24 +59,58 @@ CellState * InitCellStateFuels(GridData * fuels, ChHashTable * fmtble)	{
 		return cs;
 		}
 
+	/* fuels are retrieved one row at a time */
+	if ( (fm_row = (int *) malloc(sizeof(int) * fuels->ghdr->ncols)) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to allocate memory for row of fuels. \n", ERR_ENOMEM);
+		FreeCellState(cs);
+		return NULL;
+		}
+
 	/* initialize state */
 	for(i = 0; i < fuels->ghdr->nrows; i++)	{
+		GetRowAsIntGridData(fuels, i, fm_row);
 		for(j = 0; j < fuels->ghdr->ncols; j++)	{
 			/* retrieve fuel model attribute data */
-			GRID_DATA_GET_DATA(fuels, i, j, cell_fm_num);
+			cell_fm_num = fm_row[j];
 			if ( ChHashTableRetrieve(fmtble, &cell_fm_num, (void *)&fm) )	{
 				ERR_ERROR_CONTINUE("Unable to retrieve fuel model from fuels GridData. \n", ERR_EBADFUNC);
 				continue;
 				}
 			/* set cell state to unburnable */		
-			if ( fm->type == EnumRoth && fm->rfm->brntype == EnumRothUnBurnable )	{
-				BYTETWODARRAY_SET_DATA(cs->state, i, j, EnumUnBurnableCellState);
-				}
-			else if ( fm->type == EnumPhys && fm->pfm->brntype == EnumPhysUnBurnable )	{
-				BYTETWODARRAY_SET_DATA(cs->state, i, j, EnumUnBurnableCellState);
-				}
+			is_unburnable = ( (fm->type == EnumRoth && fm->rfm->brntype == EnumRothUnBurnable)
+								|| (fm->type == EnumPhys && fm->pfm->brntype == EnumPhysUnBurnable) );
+			CELL_PLANE_INIT_CELL(cs->plane, i, j, is_unburnable);
 			}
 		}
+	free(fm_row);
+				
+	return cs;
+	}
+
+CellState * InitCellStateFireYear(FireYear * fy, GridData * fuels)	{
+	CellState * cs 	= NULL;
+	
+	/* check args */
+	if ( fy == NULL || fy->plane == NULL || fuels == NULL 
+			|| fy->plane->nrows != fuels->ghdr->nrows || fy->plane->ncols != fuels->ghdr->ncols )	{
+		ERR_ERROR_CONTINUE("Unable to initialize CellState, FireYear not initialized from fuels. \n", ERR_EINVAL);
+		return cs;
+		}
+		
+	/* allocate memory for structure */
+	if ( (cs = (CellState *) malloc(sizeof(CellState))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to allocate memory for CellState. \n", ERR_ENOMEM);	
+		return cs;
+		}
+		
+	/* initialize structure members */
+	cs->xllcorner = fuels->ghdr->xllcorner;
+	cs->yllcorner = fuels->ghdr->yllcorner;
+	cs->cellsize = fuels->ghdr->cellsize;
+	
+	/* cells with unburnable fuels were set unburnable when fy reset the plane */
+	cs->plane = fy->plane;
+	cs->owns_plane = 0;
 				
 	return cs;
 	}
@@ -82,12 +118,12 @@ CellState * InitCellStateFuels(GridData * fuels, ChHashTable * fmtble)	{
 int CellStateSetCellStateRowCol(CellState * cs, int i, int j, EnumCellState state)	{
 	/* check args */
 	if ( cs == NULL )	{
-		ERR_ERROR("Unable to set cell state, ByteTwoDArray not initialized. \n", ERR_EINVAL);
+		ERR_ERROR("Unable to set cell state, CellPlane not initialized. \n", ERR_EINVAL);
 		}
 
 	/* set the cell state */
-	if ( BYTETWODARRAY_GET_DATA(cs->state, i, j) != EnumUnBurnableCellState )	{
-		BYTETWODARRAY_SET_DATA(cs->state, i, j, state);
+	if ( CELL_STATE_GET_DATA(cs, i, j) != EnumUnBurnableCellState )	{
+		CELL_STATE_SET_DATA(cs, i, j, state);
 		}		
 			
 	return ERR_SUCCESS;		
@@ -98,19 +134,19 @@ int CellStateSetCellStateRealWorld(CellState * cs, double rwx, double rwy, EnumC
 	
 	/* check args */
 	if ( cs == NULL )	{
-		ERR_ERROR("Unable to set cell state, ByteTwoDArray not initialized. \n", ERR_EINVAL);
+		ERR_ERROR("Unable to set cell state, CellPlane not initialized. \n", ERR_EINVAL);
 		}
 		
 	/* retrieve array row and column indecies from real world coordinates */
 	if ( CoordTransRealWorldToRaster(rwx, rwy, cs->cellsize, cs->cellsize,
 			COORD_TRANS_XLLCORNER_TO_XULCNTR(cs->xllcorner, cs->cellsize), 
-			COORD_TRANS_YLLCORNER_TO_YULCNTR(cs->yllcorner, cs->cellsize, BYTETWODARRAY_SIZE_ROW(cs->state)), &i, &j) )		{
+			COORD_TRANS_YLLCORNER_TO_YULCNTR(cs->yllcorner, cs->cellsize, cs->plane->nrows), &i, &j) )		{
 		ERR_ERROR("Unable to set cell state, real world coordinates not inside domain. \n", ERR_ERANGE);
 		}
 		
 	/* set the cell state */
-	if ( BYTETWODARRAY_GET_DATA(cs->state, i, j) != EnumUnBurnableCellState )	{
-		BYTETWODARRAY_SET_DATA(cs->state, i, j, state);
+	if ( CELL_STATE_GET_DATA(cs, i, j) != EnumUnBurnableCellState )	{
+		CELL_STATE_SET_DATA(cs, i, j, state);
 		}		
 			
 	return ERR_SUCCESS;
@@ -118,8 +154,8 @@ int CellStateSetCellStateRealWorld(CellState * cs, double rwx, double rwy, EnumC
 
 void FreeCellState(CellState * cs)	{
 	if ( cs != NULL )	{
-		if ( cs->state != NULL )	{
-			FreeByteTwoDArray(cs->state);
+		if ( cs->owns_plane )	{
+			FreeCellPlane(cs->plane);
 			}
 		free(cs);
 		}		
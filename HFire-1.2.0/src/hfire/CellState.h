@@ -33,7 +33,8 @@
 #include "PhysFuelModel.h"
 
 #include "GridData.h"
-#include "ByteTwoDArray.h"
+#include "FireYear.h"
+#include "CellPlane.h"
 #include "ChHashTable.h"
 #include "CoordTrans.h"
 #include "Err.h"
@@ -44,31 +45,12 @@
  *********************************************************
  */
 
-/*! \enum EnumCellState_
- *	\brief constant storing state of fire inside of cell
- *	\note EnumUnBurnableCellState cell is not burnable
- *	\note EnumNoFireCellState cell is burnable, but has no fire in cell
- *	\note EnumHasFireCellState fire in cell, but fuel in cell is not completely consumed
- *	\note EnumConsumedCellState all fuel in cell is consumed, fire will not propagate through cell
- */
-enum EnumCellState_	{
-	EnumUnBurnableCellState	= 0,
-	EnumNoFireCellState		= 1,
-	EnumHasFireCellState	= 2,
-	EnumConsumedCellState	= 3
-	};
-	 
 /*
  *********************************************************
  * STRUCTS, TYPEDEFS
  *********************************************************
  */
 
-/*! Type name for EnumCellState_ 
- *	\sa For a list of constants goto EnumCellState_
- */
-typedef enum EnumCellState_ EnumCellState;
-
 /*! Type name for CellState_ 
  *	\sa For a list of members goto CellState_
  */
@@ -84,8 +66,10 @@ struct CellState_ {
 	double yllcorner;
 	/*! cellsize in real world units */		
 	int cellsize;
-	/*! each cell stores value corresponding to EnumCellState */
-	ByteTwoDArray * state;			
+	/*! each cell stores value corresponding to EnumCellState, packed with the other per cell state of the year */
+	CellPlane * plane;
+	/*! 1 if plane allocated with this CellState, 0 if plane belongs to a FireYear */
+	int owns_plane;
 	};
  
 /*
@@ -93,6 +77,16 @@ struct CellState_ {
  * MACROS
  *********************************************************
  */
+
+/*! \def CELL_STATE_GET_DATA
+ *	\brief EnumCellState of cell at array i,j location
+ */
+#define CELL_STATE_GET_DATA(cs, i, j)			CELL_PLANE_GET_STATE((cs)->plane, i, j)
+
+/*! \def CELL_STATE_SET_DATA
+ *	\brief sets EnumCellState of cell at array i,j location
+ */
+#define CELL_STATE_SET_DATA(cs, i, j, state)	CELL_PLANE_SET_STATE((cs)->plane, i, j, state)
  
 /*
  *********************************************************
@@ -109,6 +103,20 @@ struct CellState_ {
  */
 CellState * InitCellStateFuels(GridData * fuels, ChHashTable * fmtble);
 
+/*! \fn CellState * InitCellStateFireYear(FireYear * fy, GridData * fuels)
+ *	\brief Allocates memory for CellState structure sharing the CellPlane of a new FireYear
+ *
+ *	Equivalent to InitCellStateFuels when fy was initialized from the same fuels and no fire has 
+ *	been recorded in fy, without retrieving the fuel model of each cell again.  The state of each 
+ *	cell was reset with the CellPlane when fy was initialized, so no memory is allocated for cells.
+ *	\sa CellState
+ *	\sa FireYear
+ *	\param fy FireYear initialized from fuels
+ *	\param fuels Raster of fuel model numbers
+ *	\retval CellState* Ptr to initialized CellState structure
+ */
+CellState * InitCellStateFireYear(FireYear * fy, GridData * fuels);
+
 /*! \fn int CellStateSetCellStateRowCol(CellState * cs, int i, int j, EnumCellState state)
  *	\brief Sets the state of the cell at array i,j location
  *	\sa CellState
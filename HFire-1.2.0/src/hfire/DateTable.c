@@ -0,0 +1,142 @@
+/*!
+ * \file DateTable.c
+ *
+ * \author Marco Morais
+ * \date 2000-2001
+ *
+ *	HFire (Highly Optmized Tolerance Fire Spread Model) Library
+ *	Copyright (C) 2001 Marco Morais
+ *
+ *	This library is free software; you can redistribute it and/or
+ *	modify it under the terms of the GNU Lesser General Public
+ *	License as published by the Free Software Foundation; either
+ *	version 2.1 of the License, or (at your option) any later version.
+ *
+ *	This library is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *	Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public
+ *	License along with this library; if not, write to the Free Software
+ *	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "DateTable.h"
+
+/*
+ *********************************************************
+ * NON PUBLIC FUNCTIONS
+ *********************************************************
+ */
+
+static int GetWholeValDateTable(DblTwoDArray * tbl, int rec, int col, int * val);
+
+DateTable * InitDateTable(DblTwoDArray * tbl, int mo_col, int dy_col)	{
+	DateTable * dt = NULL;
+	int rec, key, mo, dy;
+
+	/* check args */
+	if ( tbl == NULL || mo_col < 0 || mo_col >= DBLTWODARRAY_SIZE_COL(tbl)
+			|| dy_col < 0 || dy_col >= DBLTWODARRAY_SIZE_COL(tbl) )	{
+		if ( tbl != NULL )	{
+			FreeDblTwoDArray(tbl);
+			}
+		ERR_ERROR_CONTINUE("Arguments supplied to DateTable invalid. \n", ERR_EINVAL);
+		return dt;
+		}
+
+	if ( (dt = (DateTable *) calloc(1, sizeof(DateTable))) == NULL )	{
+		FreeDblTwoDArray(tbl);
+		ERR_ERROR_CONTINUE("Unable to allocate memory for DateTable. \n", ERR_ENOMEM);
+		return dt;
+		}
+	dt->tbl = tbl;
+
+	/* first row of each month and day, rows are visited last to first so the first row is kept */
+	for(key = 0; key < DATE_TABLE_NUM_DAYS; key++)	{
+		dt->rec_of_day[key] = DATE_TABLE_NO_REC;
+		}
+	for(rec = DBLTWODARRAY_SIZE_ROW(tbl) - 1; rec >= 0; rec--)	{
+		if ( GetWholeValDateTable(tbl, rec, mo_col, &mo) == 0 && GetWholeValDateTable(tbl, rec, dy_col, &dy) == 0
+				&& (key = DATE_TABLE_DAY_KEY(mo, dy)) >= 0 )	{
+			dt->rec_of_day[key] = rec;
+			}
+		}
+
+	/* row in effect carries the last date listed forward, dates before the first date use the first date */
+	rec = DATE_TABLE_NO_REC;
+	for(key = 0; key < DATE_TABLE_NUM_DAYS && rec == DATE_TABLE_NO_REC; key++)	{
+		rec = dt->rec_of_day[key];
+		}
+	for(key = 0; key < DATE_TABLE_NUM_DAYS; key++)	{
+		if ( dt->rec_of_day[key] != DATE_TABLE_NO_REC )	{
+			rec = dt->rec_of_day[key];
+			}
+		dt->rec_in_effect[key] = rec;
+		}
+
+	return dt;
+	}
+
+int DateTableGetRec(DateTable * dt, int month, int day)	{
+	int key = DATE_TABLE_DAY_KEY(month, day);
+
+	if ( dt == NULL || key < 0 )	{
+		return DATE_TABLE_NO_REC;
+		}
+
+	return dt->rec_of_day[key];
+	}
+
+int DateTableGetRecInEffect(DateTable * dt, int month, int day)	{
+	int key = DATE_TABLE_DAY_KEY(month, day);
+
+	if ( dt == NULL || key < 0 )	{
+		return DATE_TABLE_NO_REC;
+		}
+
+	return dt->rec_in_effect[key];
+	}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Retrieves a value of the table stored as a whole number, as dates are compared to the
+ * values of the table.
+ *
+ * Arguments:
+ * tbl- contents of table
+ * rec- row of table
+ * col- column of table
+ * val- whole number stored in row and column
+ *
+ * Returns:
+ * ERR_SUCCESS(0) if value is a whole number, an error code otherwise
+ */
+static int GetWholeValDateTable(DblTwoDArray * tbl, int rec, int col, int * val)	{
+	double dval = DBLTWODARRAY_GET_DATA(tbl, rec, col);
+
+	if ( dval < -2147483647.0 || dval > 2147483647.0 || (double) (*val = (int) dval) != dval )	{
+		return ERR_EINVAL;
+		}
+
+	return ERR_SUCCESS;
+	}
+
+void FreeDateTable(void * vptr)	{
+	DateTable * dt = NULL;
+
+	if ( vptr != NULL )	{
+		dt = (DateTable *) vptr;
+		if ( dt->tbl != NULL )	FreeDblTwoDArray(dt->tbl);
+		free(dt);
+		}
+	dt = NULL;
+
+	return;
+	}
+
+/* end of DateTable.c */
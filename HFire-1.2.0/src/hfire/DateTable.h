@@ -0,0 +1,152 @@
+/*!
+ * \file DateTable.h
+ * \brief Table of values read from a text file and indexed once by year, month and day.
+ *
+ * \author Marco Morais
+ * \date 2000-2001
+ *
+ *	HFire (Highly Optmized Tolerance Fire Spread Model) Library
+ *	Copyright (C) 2001 Marco Morais
+ *
+ *	This library is free software; you can redistribute it and/or
+ *	modify it under the terms of the GNU Lesser General Public
+ *	License as published by the Free Software Foundation; either
+ *	version 2.1 of the License, or (at your option) any later version.
+ *
+ *	This library is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *	Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public
+ *	License along with this library; if not, write to the Free Software
+ *	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef	DateTable_H
+#define DateTable_H
+
+#include <stdlib.h>
+
+#include "DblTwoDArray.h"
+#include "Err.h"
+
+/*
+ *********************************************************
+ * DEFINES, ENUMS
+ *********************************************************
+ */
+
+/*! \def DATE_TABLE_NUM_DAYS
+ *	\brief number of month and day combinations indexed, every month given 31 days
+ */
+#define DATE_TABLE_NUM_DAYS					(12 * 31)
+
+/*! \def DATE_TABLE_NO_REC
+ *	\brief record index of a date not listed in the table
+ */
+#define DATE_TABLE_NO_REC					(-1)
+
+/*
+ *********************************************************
+ * STRUCTS, TYPEDEFS
+ *********************************************************
+ */
+
+/*! Type name for DateTable_
+ *	\sa For a list of members goto DateTable_
+ */
+typedef struct DateTable_ DateTable;
+
+/*!	\struct DateTable_ DateTable.h "DateTable.h"
+ *	\brief rows of a table of values with the first row of each date indexed
+ *	Each row of the table stores a month and day followed by values.  The
+ *	index is built once when the table is read so the row of a date is found without scanning
+ *	the table.  Tables need not be sorted, but the row in effect on a date assumes rows are listed
+ *	in the order they take effect.
+ */
+struct DateTable_	{
+	/*! contents of table */
+	DblTwoDArray * tbl;
+	/*! first row of each month and day in any year, DATE_TABLE_NO_REC if not listed */
+	int rec_of_day[DATE_TABLE_NUM_DAYS];
+	/*! first row of the last date listed on or before each month and day in any year */
+	int rec_in_effect[DATE_TABLE_NUM_DAYS];
+	};
+
+/*
+ *********************************************************
+ * MACROS
+ *********************************************************
+ */
+
+/*! \def DATE_TABLE_DAY_KEY
+ *	\brief index of month and day in rec_of_day, -1 if out of range
+ */
+#define DATE_TABLE_DAY_KEY(month, day)			( ((month) < 1 || (month) > 12 || (day) < 1 || (day) > 31) ? -1	\
+													: ((month) - 1) * 31 + ((day) - 1) )
+
+/*! \def DATE_TABLE_SIZE_ROW
+ *	\brief number of rows in table
+ */
+#define DATE_TABLE_SIZE_ROW(dt)					DBLTWODARRAY_SIZE_ROW((dt)->tbl)
+
+/*! \def DATE_TABLE_SIZE_COL
+ *	\brief number of columns in table
+ */
+#define DATE_TABLE_SIZE_COL(dt)					DBLTWODARRAY_SIZE_COL((dt)->tbl)
+
+/*! \def DATE_TABLE_GET_DATA
+ *	\brief value stored in row and column of table
+ */
+#define DATE_TABLE_GET_DATA(dt, rec, col)		DBLTWODARRAY_GET_DATA((dt)->tbl, rec, col)
+
+/*
+ *********************************************************
+ * PUBLIC FUNCTIONS
+ *********************************************************
+ */
+
+/*! \fn DateTable * InitDateTable(DblTwoDArray * tbl, int mo_col, int dy_col)
+ * 	\brief Indexes the rows of a table by month and day.
+ *
+ *	The DateTable takes ownership of tbl, which is freed with the DateTable or if the DateTable
+ *	cannot be initialized.  Rows with a date that is not a whole number or out of range are not indexed.
+ * 	\param tbl contents of table
+ * 	\param mo_col column of tbl storing month
+ * 	\param dy_col column of tbl storing day
+ * 	\retval DateTable* Ptr to DateTable, or NULL if unable to initialize
+ */
+DateTable * InitDateTable(DblTwoDArray * tbl, int mo_col, int dy_col);
+
+/*! \fn int DateTableGetRec(DateTable * dt, int month, int day)
+ * 	\brief Retrieves the first row listed on month and day of any year.
+ *
+ * 	\param dt DateTable
+ * 	\param month month
+ * 	\param day day
+ *	\retval int row, or DATE_TABLE_NO_REC if the date is not listed
+ */
+int DateTableGetRec(DateTable * dt, int month, int day);
+
+/*! \fn int DateTableGetRecInEffect(DateTable * dt, int month, int day)
+ * 	\brief Retrieves the row in effect on month and day of any year.
+ *
+ *	The row in effect is the first row listed on the last date on or before month and day.  Dates
+ *	before the first date listed use the row of the first date listed.
+ * 	\param dt DateTable
+ * 	\param month month
+ * 	\param day day
+ *	\retval int row, or DATE_TABLE_NO_REC if the table lists no dates or month and day is out of range
+ */
+int DateTableGetRecInEffect(DateTable * dt, int month, int day);
+
+/*! \fn void FreeDateTable(void * vptr)
+ * 	\brief Frees memory associated with DateTable structure.
+ *
+ *	\sa DateTable
+ * 	\param vptr ptr to DateTable
+ */
+void FreeDateTable(void * vptr);
+
+#endif DateTable_H		/* end of DateTable.h */
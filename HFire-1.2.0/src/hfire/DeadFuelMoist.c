@@ -26,290 +26,294 @@
 
 #include <math.h>
 
-int GetDeadFuelMoistFIXEDFromProps(ChHashTable * proptbl, int month, int day, int hour, 
-											double rwx, double rwy, 
-                      double * d1hfm, double * d10hfm, double * d100hfm)		{
-	/* static variables used to store state across function calls */
-	static int smonth 				= 0;
-	static int sday 				= 0;
-	static int shour 				= 0;
-	static double sd1hfm			= 0.0;
-	static double sd10hfm			= 0.0;
-	static double sd100hfm			= 0.0;
-	static DblTwoDArray * sd10h_tbl = NULL;
-  static double sd1hfminc = 0.02;
-  static double sd100hfminc = 0.02;
+DeadFuelMoistTables * InitDeadFuelMoistTables()	{
+	DeadFuelMoistTables * tbls = NULL;
+
+	if ( (tbls = (DeadFuelMoistTables *) calloc(1, sizeof(DeadFuelMoistTables))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to allocate memory for DeadFuelMoistTables. \n", ERR_ENOMEM);
+		return tbls;
+		}
+
+	return tbls;
+	}
+
+int SetDeadFuelMoistTablesFIXEDFromProps(DeadFuelMoistTables * tbls, ChHashTable * proptbl)	{
+	/* stack variables */
+	KeyVal * entry					= NULL;				/* key/val instances from table */
+	FILE * fstream					= NULL;				/* file stream */
+	DblTwoDArray * d10h_tbl			= NULL;				/* contents of 10h file */
+
+	/* table of fixed values only needs to be initialized once */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_DFMFFILE), (void *)&entry) )	{
+		ERR_ERROR("Unable to retrieve DEAD_FUEL_MOIST_FIXED_FILE property. \n", ERR_EINVAL);
+		}
+	/* open fixed dead fuel moisture file */
+	if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{		
+		ERR_ERROR("Unable to open file containing fixed Dead Fuel Moisture. \n", ERR_EIOFAIL);
+		}
+	/* create the table of values */
+	if ( (d10h_tbl = GetDblTwoDArrayTableFStreamIO(fstream, 
+			DEAD_FUEL_MOIST_10H_SEP_CHARS, DEAD_FUEL_MOIST_10H_COMMENT_CHAR)) == NULL )	{
+		fclose(fstream);
+		ERR_ERROR("Unable to initialize fixed Dead Fuel Moisture table. \n", ERR_EFAILED);
+		}
+	fclose(fstream);
+	/* index table by month and day */
+	if ( (tbls->d10h_dt = InitDateTable(d10h_tbl, DEAD_FUEL_MOIST_MO_10H_TBL_INDEX,
+				DEAD_FUEL_MOIST_DY_10H_TBL_INDEX)) == NULL )	{
+		ERR_ERROR("Unable to index fixed Dead Fuel Moisture table. \n", ERR_EFAILED);
+		}
+
+	return ERR_SUCCESS;
+	}
+
+int SetDeadFuelMoistTablesRANDHFromProps(DeadFuelMoistTables * tbls, ChHashTable * proptbl)	{
+	/* stack variables */
+	KeyVal * entry					= NULL;				/* key/val instances from table */
+	FILE * fstream					= NULL;				/* file stream */
+
+	/* table of historical values only needs to be initialized once */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_DFMHFILE), (void *)&entry) )	{
+		ERR_ERROR("Unable to retrieve DEAD_FUEL_MOIST_HISTORICAL_FILE property. \n", ERR_EINVAL);
+		}
+	/* open historical dead fuel moisture file */
+	if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
+		ERR_ERROR("Unable to open file containing historical Dead Fuel Moisture. \n", ERR_EIOFAIL);
+		}
+	/* create the table of values */
+	if ( (tbls->d10h_tbl = GetDblTwoDArrayTableFStreamIO(fstream, 
+			DEAD_FUEL_MOIST_10H_SEP_CHARS, DEAD_FUEL_MOIST_10H_COMMENT_CHAR)) == NULL )	{
+		fclose(fstream);
+		ERR_ERROR("Unable to initialize historical Dead Fuel Moisture table. \n", ERR_EFAILED);
+		}
+	fclose(fstream);
+
+	return ERR_SUCCESS;
+	}
+
+int SetDeadFuelMoistTablesSPATIALFromProps(DeadFuelMoistTables * tbls, ChHashTable * proptbl)	{
 	/* stack variables */
 	KeyVal * entry					= NULL;				/* key/val instances from table */
 	FILE * fstream					= NULL;				/* file stream */
+	StrTwoDArray * atm_tbl			= NULL;				/* contents of 10h file */
+	int file_col					= DEAD_FUEL_MOIST_RAST_10H_FILE_TBL_INDEX;
+
+	/* retriev 10h filename from properties */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_DFMSPFILE), (void *)&entry) )	{
+		ERR_ERROR("Unable to retrieve DEAD_FUEL_MOIST_SPATIAL_FILE property. \n", ERR_EINVAL);
+		}
+	/* open 10h file */
+	if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
+		ERR_ERROR("Unable to open DEAD_FUEL_MOIST_SPATIAL_FILE. \n", ERR_EIOFAIL);
+		}
+	/* retrieve contents of 10h file */
+	if ( (atm_tbl = GetStrTwoDArrayTableFStreamIO(fstream, DEAD_FUEL_MOIST_RAST_10H_SEP_CHARS, 
+				DEAD_FUEL_MOIST_RAST_10H_COMMENT_CHAR)) == NULL )	{
+		fclose(fstream);
+		ERR_ERROR("Unable to parse DEAD_FUEL_MOIST_SPATIAL_FILE. \n", ERR_EINVAL);
+		}
+	/* cleanup */
+	fclose(fstream);
+	/* index 10h table, rasters are read as simulations reach them */
+	if ( (tbls->d10h_ws = InitWeatherStream(proptbl, atm_tbl, DEAD_FUEL_MOIST_RAST_10H_MO_TBL_INDEX, DEAD_FUEL_MOIST_RAST_10H_DY_TBL_INDEX,
+				DEAD_FUEL_MOIST_RAST_10H_HR_TBL_INDEX, &file_col, 1)) == NULL )	{
+		ERR_ERROR("Unable to index DEAD_FUEL_MOIST_SPATIAL_FILE. \n", ERR_EINVAL);
+		}
+
+	return ERR_SUCCESS;
+	}
+
+void FreeDeadFuelMoistTables(void * vptr)	{
+	DeadFuelMoistTables * tbls = NULL;
+
+	if ( vptr != NULL )	{
+		tbls = (DeadFuelMoistTables *) vptr;
+		if ( tbls->d10h_dt != NULL )	FreeDateTable(tbls->d10h_dt);
+		if ( tbls->d10h_tbl != NULL )	FreeDblTwoDArray(tbls->d10h_tbl);
+		if ( tbls->d10h_ws != NULL )	FreeWeatherStream(tbls->d10h_ws);
+		free(tbls);
+		}
+	tbls = NULL;
+
+	return;
+	}
+
+DeadFuelMoistState * InitDeadFuelMoistState()	{
+	DeadFuelMoistState * st = NULL;
+
+	if ( (st = (DeadFuelMoistState *) calloc(1, sizeof(DeadFuelMoistState))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to allocate memory for DeadFuelMoistState. \n", ERR_ENOMEM);
+		return st;
+		}
+	st->d1hfminc = 0.02;
+	st->d100hfminc = 0.02;
+
+	return st;
+	}
+
+int SetDeadFuelMoistStateFromSimConfig(DeadFuelMoistState * st, const SimConfig * cfg)	{
+	/* check args */
+	if ( st == NULL || cfg == NULL )	{
+		ERR_ERROR("Arguments supplied to set DeadFuelMoistState invalid. \n", ERR_EINVAL);
+		}
+
+	st->d1hfminc = cfg->dfm_d1h_inc;
+	st->d100hfminc = cfg->dfm_d100h_inc;
+
+	return ERR_SUCCESS;
+	}
+
+int SetDeadFuelMoistStateFromTables(DeadFuelMoistState * st, const DeadFuelMoistTables * tbls)	{
+	/* check args */
+	if ( st == NULL || tbls == NULL )	{
+		ERR_ERROR("Arguments supplied to set DeadFuelMoistState invalid. \n", ERR_EINVAL);
+		}
+
+	st->tbls = tbls;
+	/* rasters of the first record are read now, later records as the simulation reaches them */
+	if ( tbls->d10h_ws != NULL )	{
+		if ( (st->d10h_wc = InitWeatherStreamCursor(tbls->d10h_ws)) == NULL )	{
+			ERR_ERROR("Unable to initialize GridData from file listed in DEAD_FUEL_MOIST_SPATIAL_FILE. \n", ERR_EINVAL);
+			}
+		}
+
+	return ERR_SUCCESS;
+	}
+
+int GetDeadFuelMoistFIXEDFromProps(DeadFuelMoistState * st, ChHashTable * proptbl, int month, int day, int hour, 
+											double rwx, double rwy, 
+                      double * d1hfm, double * d10hfm, double * d100hfm)		{
 	int i;
 
+	if ( st->tbls == NULL || st->tbls->d10h_dt == NULL )	{
+		ERR_ERROR("Dead Fuel Moisture table not initialized. \n", ERR_EINVAL);
+		}
+
 	/* check to see if new dead fuel moisture needed */	
-	if ( (smonth != month) || (sday != day) || (shour != hour) )	{
-		/* new dead fuel moistures table needed */
-		if (sd10h_tbl == NULL )	{
-			/* initialize returned vars in case table not created */
-			*d1hfm = sd1hfm;
-			*d10hfm = sd10hfm;
-			*d100hfm = sd100hfm;
-			/* table of fixed values only needs to be initialized once */
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_DFMFFILE), (void *)&entry) )	{
-				ERR_ERROR("Unable to retrieve DEAD_FUEL_MOIST_FIXED_FILE property. \n", ERR_EINVAL);
-				}
-			/* open fixed dead fuel moisture file */
-			if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{		
-				ERR_ERROR("Unable to open file containing fixed Dead Fuel Moisture. \n", ERR_EIOFAIL);
-				}
-			/* create the table of values */
-			if ( (sd10h_tbl = GetDblTwoDArrayTableFStreamIO(fstream, 
-					DEAD_FUEL_MOIST_10H_SEP_CHARS, DEAD_FUEL_MOIST_10H_COMMENT_CHAR)) == NULL )	{
-				fclose(fstream);
-				ERR_ERROR("Unable to initialize fixed Dead Fuel Moisture table. \n", ERR_EFAILED);
-				}
-			fclose(fstream);
-      /* obtain the dead fuel moisture increments */
-      if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_DFMD1HINC), (void *)&entry) ) {
-        sd1hfminc = 0.02; /* default */
-        }
-      else {
-        sd1hfminc = fabs(atof(entry->val)) / 100.0;
+	if ( (st->month != month) || (st->day != day) || (st->hour != hour) )	{
+		/* find first record of month and day in table */
+		if ( (i = DateTableGetRec(st->tbls->d10h_dt, month, day)) != DATE_TABLE_NO_REC )	{
+			/* retrieve dfm on that month and day */
+			st->d10hfm = DATE_TABLE_GET_DATA(st->tbls->d10h_dt, i, DEAD_FUEL_MOIST_HR_TO_10H_TBL_INDEX(hour)) / 100.0;
+			if ( !UNITS_FP_GT_ZERO(st->d10hfm) ) {
+				st->d10hfm = 0.01;
         }
-      if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_DFMD100HINC), (void *)&entry) ) {
-        sd100hfminc = 0.02; /* default */
+      /* compute d1h from d10h */
+			st->d1hfm = st->d10hfm - st->d1hfminc;
+			if ( !UNITS_FP_GT_ZERO(st->d1hfm) ) {
+				st->d1hfm = 0.01;
         }
-      else {
-        sd100hfminc = fabs(atof(entry->val)) / 100.0;
+      /* compute d100h from d10h */
+			st->d100hfm = st->d10hfm + st->d100hfminc;
+			if ( !UNITS_FP_GT_ZERO(st->d100hfm) ) {
+				st->d100hfm = 0.01;
         }
 			}
-		/* find record in table */
-		for(i = 0; i < DBLTWODARRAY_SIZE_ROW(sd10h_tbl); i++)	{
-			/* find matching month and day */
-			if ( DBLTWODARRAY_GET_DATA(sd10h_tbl, i, DEAD_FUEL_MOIST_MO_10H_TBL_INDEX) == month 
-				 && DBLTWODARRAY_GET_DATA(sd10h_tbl, i, DEAD_FUEL_MOIST_DY_10H_TBL_INDEX) == day )	{
-				  /* retrieve dfm on that month and day */
-				  sd10hfm = DBLTWODARRAY_GET_DATA(sd10h_tbl, i, DEAD_FUEL_MOIST_HR_TO_10H_TBL_INDEX(hour)) / 100.0;
-				  if ( !UNITS_FP_GT_ZERO(sd10hfm) ) {
-					  sd10hfm = 0.01;
-            }
-          /* compute d1h from d10h */
-				  sd1hfm = sd10hfm - sd1hfminc;
-				  if ( !UNITS_FP_GT_ZERO(sd1hfm) ) {
-					  sd1hfm = 0.01;
-            }
-          /* compute d100h from d10h */
-				  sd100hfm = sd10hfm + sd100hfminc;
-				  if ( !UNITS_FP_GT_ZERO(sd100hfm) ) {
-					  sd100hfm = 0.01;
-            }
-				  break;
-				}
-			}
 		/* set {month, day, hour} for future calls */
-		smonth = month;
-		sday = day;
-		shour = hour;
+		st->month = month;
+		st->day = day;
+		st->hour = hour;
 		}
 
-	*d1hfm = sd1hfm;
-	*d10hfm = sd10hfm;
-	*d100hfm = sd100hfm;
+	*d1hfm = st->d1hfm;
+	*d10hfm = st->d10hfm;
+	*d100hfm = st->d100hfm;
 					
 	return ERR_SUCCESS;
 	}
 
 																					
-int GetDeadFuelMoistRANDHFromProps(ChHashTable * proptbl, int month, int day, int hour, 
+int GetDeadFuelMoistRANDHFromProps(DeadFuelMoistState * st, ChHashTable * proptbl, int month, int day, int hour, 
 											double rwx, double rwy, 
                       double * d1hfm, double * d10hfm, double * d100hfm)		{
-	/* static variables used to store state across function calls */
-	static int smonth 				= 0;
-	static int sday 				= 0;
-	static int shour 				= 0;
-	static int srec					= 0;
-	static double sd1hfm			= 0.0;
-	static double sd10hfm			= 0.0;
-	static double sd100hfm			= 0.0;
-	static DblTwoDArray * sd10h_tbl = NULL;
-  static double sd1hfminc = 0.02;
-  static double sd100hfminc = 0.02;
-	/* stack variables */
-	KeyVal * entry					= NULL;				/* key/val instances from table */
-	FILE * fstream					= NULL;				/* file stream */
+
+	if ( st->tbls == NULL || st->tbls->d10h_tbl == NULL )	{
+		ERR_ERROR("Dead Fuel Moisture table not initialized. \n", ERR_EINVAL);
+		}
 
 	/* check to see if new dead fuel moisture needed */
-	if ( (smonth != month) || (sday != day) || (shour != hour) )	{
-		/* new dead fuel moistures table needed */
-		if (sd10h_tbl == NULL )	{
-			/* initialize returned vars in case table not created */
-			*d1hfm = sd1hfm;
-			*d10hfm = sd10hfm;
-			*d100hfm = sd100hfm;		
-			/* table of fixed values only needs to be initialized once */
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_DFMHFILE), (void *)&entry) )	{
-				ERR_ERROR("Unable to retrieve DEAD_FUEL_MOIST_HISTORICAL_FILE property. \n", ERR_EINVAL);
-				}
-			/* open fixed azimuth file */
-			if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
-				ERR_ERROR("Unable to open file containing historical Dead Fuel Moisture. \n", ERR_EIOFAIL);
-				}
-			/* create the table of values */
-			if ( (sd10h_tbl = GetDblTwoDArrayTableFStreamIO(fstream, 
-					DEAD_FUEL_MOIST_10H_SEP_CHARS, DEAD_FUEL_MOIST_10H_COMMENT_CHAR)) == NULL )	{
-				fclose(fstream);
-				ERR_ERROR("Unable to initialize historical Dead Fuel Moisture table. \n", ERR_EFAILED);
-				}
-			fclose(fstream);
-      /* obtain the dead fuel moisture increments */
-      if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_DFMD1HINC), (void *)&entry) ) {
-        sd1hfminc = 0.02; /* default */
-        }
-      else {
-        sd1hfminc = fabs(atof(entry->val)) / 100.0;
-        }
-      if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_DFMD100HINC), (void *)&entry) ) {
-        sd100hfminc = 0.02; /* default */
-        }
-      else {
-        sd100hfminc = fabs(atof(entry->val)) / 100.0;
-        }
-			}
+	if ( (st->month != month) || (st->day != day) || (st->hour != hour) )	{
 		/* new random record number (day) from table needed */
-		if ( (smonth != month) || (sday != day) )	{
+		if ( (st->month != month) || (st->day != day) )	{
 			/* retrieve new record at random from table within range 0 to num_recs */
-			srec = randi(0) % DBLTWODARRAY_SIZE_ROW(sd10h_tbl);
+			st->rec = RandStreamIndex(&st->rs, DBLTWODARRAY_SIZE_ROW(st->tbls->d10h_tbl));
 			}
 		/* retrieve dead fuel moisture at hour from current day, otherwise use last value */
-		if ( (DBLTWODARRAY_GET_DATA(sd10h_tbl, srec, DEAD_FUEL_MOIST_HR_TO_10H_TBL_INDEX(hour))) 
+		if ( (DBLTWODARRAY_GET_DATA(st->tbls->d10h_tbl, st->rec, DEAD_FUEL_MOIST_HR_TO_10H_TBL_INDEX(hour))) 
 				!= DEAD_FUEL_MOIST_10H_NO_DATA_VALUE ) {
-			sd10hfm = (DBLTWODARRAY_GET_DATA(sd10h_tbl, srec, DEAD_FUEL_MOIST_HR_TO_10H_TBL_INDEX(hour))) / 100.0;
-			if ( !UNITS_FP_GT_ZERO(sd10hfm) ) {
-				sd10hfm = 0.01;
+			st->d10hfm = (DBLTWODARRAY_GET_DATA(st->tbls->d10h_tbl, st->rec, DEAD_FUEL_MOIST_HR_TO_10H_TBL_INDEX(hour))) / 100.0;
+			if ( !UNITS_FP_GT_ZERO(st->d10hfm) ) {
+				st->d10hfm = 0.01;
         }
       /* compute d1h from d10h */
-			sd1hfm = sd10hfm - sd1hfminc;
-			if ( !UNITS_FP_GT_ZERO(sd1hfm) ) {
-				sd1hfm = 0.01;
+			st->d1hfm = st->d10hfm - st->d1hfminc;
+			if ( !UNITS_FP_GT_ZERO(st->d1hfm) ) {
+				st->d1hfm = 0.01;
         }
       /* compute d100h from d10h */
-			sd100hfm = sd10hfm + sd100hfminc;
-			if ( !UNITS_FP_GT_ZERO(sd100hfm) ) {
-				sd100hfm = 0.01;
+			st->d100hfm = st->d10hfm + st->d100hfminc;
+			if ( !UNITS_FP_GT_ZERO(st->d100hfm) ) {
+				st->d100hfm = 0.01;
         }
 		}
 		
 		/* set {month, day, hour} for future calls */
-		smonth = month;
-		sday = day;
-		shour = hour;
+		st->month = month;
+		st->day = day;
+		st->hour = hour;
 		}
 		
-	*d1hfm = sd1hfm;
-	*d10hfm = sd10hfm;
-	*d100hfm = sd100hfm;
+	*d1hfm = st->d1hfm;
+	*d10hfm = st->d10hfm;
+	*d100hfm = st->d100hfm;
 					
 	return ERR_SUCCESS;	
 	}
 
-int GetDeadFuelMoistSPATIALFromProps(ChHashTable * proptbl, int month, int day, int hour, 
+int GetDeadFuelMoistSPATIALFromProps(DeadFuelMoistState * st, ChHashTable * proptbl, int month, int day, int hour, 
 											double rwx, double rwy, 
                       double * d1hfm, double * d10hfm, double * d100hfm)		{
-	/* static variables used to store state across function calls */
-	static int smonth 			= 0;
-	static int sday 				= 0;
-	static int shour 				= 0;
-	static StrTwoDArray * s10h_tbl	= NULL;
-	static GridData * s10h_grid 	= NULL;
-  static double sd1hfminc = 0.02;
-  static double sd100hfminc = 0.02;
 	/* stack variables */
-	KeyVal * entry					= NULL;				/* key/val instances from table */
-	FILE * fstream					= NULL;				/* file stream */
+	GridData * d10h_grid			= NULL;				/* 10h fuel moisture of the current hour */
 	int i,j;
 
-	/* check to see if new tables are needed */
-	if ( (smonth != month) || (sday != day) || (shour != hour) )	{
-		/* new 10h tbl */
-		if (s10h_tbl == NULL )	{
-			/* retriev 10h filename from properties */
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_DFMSPFILE), (void *)&entry) )	{
-				ERR_ERROR("Unable to retrieve DEAD_FUEL_MOIST_SPATIAL_FILE property. \n", ERR_EINVAL);
-				}
-			/* open 10h file */
-			if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
-				ERR_ERROR("Unable to open DEAD_FUEL_MOIST_SPATIAL_FILE. \n", ERR_EIOFAIL);
-				}
-			/* retrieve contents of 10h file */
-			if ( (s10h_tbl = GetStrTwoDArrayTableFStreamIO(fstream, DEAD_FUEL_MOIST_RAST_10H_SEP_CHARS, 
-						DEAD_FUEL_MOIST_RAST_10H_COMMENT_CHAR)) == NULL )	{
-				fclose(fstream);
-				ERR_ERROR("Unable to parse DEAD_FUEL_MOIST_SPATIAL_FILE. \n", ERR_EINVAL);
-				}
-			/* cleanup */
-			fclose(fstream);
-      /* obtain the dead fuel moisture increments */
-      if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_DFMD1HINC), (void *)&entry) ) {
-        sd1hfminc = 0.02; /* default */
-        }
-      else {
-        sd1hfminc = fabs(atof(entry->val)) / 100.0;
-        }
-      if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_DFMD100HINC), (void *)&entry) ) {
-        sd100hfminc = 0.02; /* default */
-        }
-      else {
-        sd100hfminc = fabs(atof(entry->val)) / 100.0;
-        }
-			}							
-		/* new 10h grid */
-		if ( s10h_grid == NULL )	{
-			if ( (s10h_grid = InitGridDataFromAsciiRaster(STRTWODARRAY_GET_DATA(s10h_tbl, 0, DEAD_FUEL_MOIST_RAST_10H_FILE_TBL_INDEX), 
-								EnumDblGrid)) == NULL )	{
-				ERR_ERROR("Unable to initialize GridData from file listed in DEAD_FUEL_MOIST_SPATIAL_FILE. \n", ERR_EINVAL);
-				}
-			}
-		/* find record in 10h table */
-		for(i = 0; i < DBLTWODARRAY_SIZE_ROW(s10h_tbl); i++)	{
-			/* parse the 10h table from strings to numbers */
-			smonth = atoi(STRTWODARRAY_GET_DATA(s10h_tbl, i, DEAD_FUEL_MOIST_RAST_10H_MO_TBL_INDEX));
-			sday = atoi(STRTWODARRAY_GET_DATA(s10h_tbl, i, DEAD_FUEL_MOIST_RAST_10H_DY_TBL_INDEX));
-			shour = atoi(STRTWODARRAY_GET_DATA(s10h_tbl, i, DEAD_FUEL_MOIST_RAST_10H_HR_TBL_INDEX)) / 100;
-			/* find matching month and day and hour */
-			if ( (smonth == month) && (sday == day) && (shour == hour) )	{
-				/* free old grid */
-				FreeGridData(s10h_grid);
-				/* initialize new grid */
-				if ( (s10h_grid = InitGridDataFromAsciiRaster(STRTWODARRAY_GET_DATA(s10h_tbl, i, DEAD_FUEL_MOIST_RAST_10H_FILE_TBL_INDEX), 
-									EnumDblGrid)) == NULL )	{
-					ERR_ERROR("Unable to initialize GridData from file listed in DEAD_FUEL_MOIST_SPATIAL_FILE. \n", ERR_EINVAL);
-					}
-				break;
-				}
+	if ( st->d10h_wc == NULL )	{
+		ERR_ERROR("Dead Fuel Moisture rasters not initialized. \n", ERR_EINVAL);
+		}
+
+	/* check to see if new rasters are needed */
+	if ( (st->month != month) || (st->day != day) || (st->hour != hour) )	{
+		/* rasters of the hour listed in the atm table, read in the background when the previous hour was reached */
+		if ( WeatherStreamSeek(st->d10h_wc, month, day, hour) )	{
+			ERR_ERROR("Unable to initialize GridData from file listed in DEAD_FUEL_MOIST_SPATIAL_FILE. \n", ERR_EINVAL);
 			}
 		/* set {month, day, hour} for future calls */
-		smonth = month;
-		sday = day;
-		shour = hour;
+		st->month = month;
+		st->day = day;
+		st->hour = hour;
 		}
+	/* rasters of the current hour */
+	d10h_grid = WEATHER_STREAM_GET_GRID(st->d10h_wc, 0);
 
 	/* transform array indecies into spatial coordinates */
-	if ( CoordTransRealWorldToRaster(rwx, rwy, s10h_grid->ghdr->cellsize, s10h_grid->ghdr->cellsize,
-			COORD_TRANS_XLLCORNER_TO_XULCNTR(s10h_grid->ghdr->xllcorner, s10h_grid->ghdr->cellsize),
-			COORD_TRANS_YLLCORNER_TO_YULCNTR(s10h_grid->ghdr->yllcorner, s10h_grid->ghdr->cellsize, s10h_grid->ghdr->nrows),
+	if ( CoordTransRealWorldToRaster(rwx, rwy, d10h_grid->ghdr->cellsize, d10h_grid->ghdr->cellsize,
+			COORD_TRANS_XLLCORNER_TO_XULCNTR(d10h_grid->ghdr->xllcorner, d10h_grid->ghdr->cellsize),
+			COORD_TRANS_YLLCORNER_TO_YULCNTR(d10h_grid->ghdr->yllcorner, d10h_grid->ghdr->cellsize, d10h_grid->ghdr->nrows),
 			&i, &j) )	{
 		ERR_ERROR("Unable to transform real world coordinates to grid indecies. \n", ERR_ESING);
 		}			
 													
 	/* retrieve d10h at coordinate */
-	GRID_DATA_GET_DATA(s10h_grid, i, j, *d10hfm);
+	GRID_DATA_GET_DATA(d10h_grid, i, j, *d10hfm);
   *d10hfm = *d10hfm / 100.0;
 
   /* compute d1h from d10h */
-	*d1hfm = *d10hfm - sd1hfminc;
+	*d1hfm = *d10hfm - st->d1hfminc;
 	if ( !UNITS_FP_GT_ZERO(*d1hfm) ) {
 		*d1hfm = 0.01;
     }
   /* compute d100h from d10h */
-	*d100hfm = *d10hfm + sd100hfminc;
+	*d100hfm = *d10hfm + st->d100hfminc;
 	if ( !UNITS_FP_GT_ZERO(*d100hfm) ) {
 		*d100hfm = 0.01;
     }
@@ -317,4 +321,18 @@ int GetDeadFuelMoistSPATIALFromProps(ChHashTable * proptbl, int month, int day,
 	return ERR_SUCCESS;
 	}
 
+void FreeDeadFuelMoistState(void * vptr)	{
+	DeadFuelMoistState * st = NULL;
+
+	if ( vptr != NULL )	{
+		st = (DeadFuelMoistState *) vptr;
+		/* tables are shared and freed by their owner */
+		if ( st->d10h_wc != NULL )	FreeWeatherStreamCursor(st->d10h_wc);
+		free(st);
+		}
+	st = NULL;
+
+	return;
+	}
+
 /* end of DeadFuelMoist.c */
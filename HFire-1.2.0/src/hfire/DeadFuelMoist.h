@@ -33,14 +33,18 @@
 
 #include "CoordTrans.h"
 #include "Units.h"
-#include "NLIBRand.h"
+#include "RandStream.h"
 #include "FireProp.h"
 #include "ChHashTable.h"
 #include "KeyVal.h"
 #include "DblTwoDArray.h"
+#include "DateTable.h"
 #include "StrTwoDArray.h"
 #include "GridData.h"
+#include "FireGridData.h"
+#include "WeatherStream.h"
 #include "FStreamIO.h"
+#include "SimConfig.h"
 #include "Err.h"
 
 /*
@@ -80,7 +84,61 @@
  * STRUCTS, TYPEDEFS
  *********************************************************
  */
- 
+
+/*! Type name for DeadFuelMoistTables_
+ *	\sa For a list of members goto DeadFuelMoistTables_
+ */
+typedef struct DeadFuelMoistTables_ DeadFuelMoistTables;
+
+/*!	\struct DeadFuelMoistTables_ DeadFuelMoist.h "DeadFuelMoist.h"
+ *	\brief tables of 10 hour dead fuel moistures read once from the files named in the simulation properties
+ *	Not modified once read, so shared by the DeadFuelMoistState of every simulation.
+ */
+struct DeadFuelMoistTables_	{
+	/*! table of FIXED 10 hour dead fuel moistures indexed by month and day */
+	DateTable * d10h_dt;
+	/*! table of RANDH 10 hour dead fuel moistures */
+	DblTwoDArray * d10h_tbl;
+	/*! atm table of SPATIAL 10 hour dead fuel moistures */
+	WeatherStream * d10h_ws;
+	};
+
+/*! Type name for DeadFuelMoistState_
+ *	\sa For a list of members goto DeadFuelMoistState_
+ */
+typedef struct DeadFuelMoistState_ DeadFuelMoistState;
+
+/*!	\struct DeadFuelMoistState_ DeadFuelMoist.h "DeadFuelMoist.h"
+ *	\brief dead fuel moisture retrieved by the dead fuel moisture functions
+ *	Stored by FireEnv in place of function statics so each simulation owns its state.
+ */
+struct DeadFuelMoistState_	{
+	/*! month of the last call */
+	int month;
+	/*! day of the last call */
+	int day;
+	/*! hour of the last call */
+	int hour;
+	/*! record of RANDH table chosen for the day of the last call */
+	int rec;
+	/*! 1 hour dead fuel moisture of the last call */
+	double d1hfm;
+	/*! 10 hour dead fuel moisture of the last call */
+	double d10hfm;
+	/*! 100 hour dead fuel moisture of the last call */
+	double d100hfm;
+	/*! tables shared by every simulation */
+	const DeadFuelMoistTables * tbls;
+	/*! rasters of SPATIAL 10 hour dead fuel moistures at the current hour */
+	WeatherStreamCursor * d10h_wc;
+	/*! increment of 10 hour dead fuel moisture to 1 hour dead fuel moisture */
+	double d1hfminc;
+	/*! increment of 10 hour dead fuel moisture to 100 hour dead fuel moisture */
+	double d100hfminc;
+	/*! random numbers choosing RANDH records */
+	RandStream rs;
+	};
+
 /*
  *********************************************************
  * MACROS
@@ -100,7 +158,97 @@
  *********************************************************
  */
 
-/*! \fn int GetDeadFuelMoistFIXEDFromProps(ChHashTable * proptbl, int month, int day, int hour, 
+/*! \fn DeadFuelMoistTables * InitDeadFuelMoistTables()
+ *	\brief Initializes an empty set of dead fuel moisture tables.
+ *
+ *	\sa DeadFuelMoistTables
+ *	\retval DeadFuelMoistTables* Ptr to initialized DeadFuelMoistTables, or NULL if unable to allocate
+ */
+DeadFuelMoistTables * InitDeadFuelMoistTables();
+
+/*! \fn int SetDeadFuelMoistTablesFIXEDFromProps(DeadFuelMoistTables * tbls, ChHashTable * proptbl)
+ *	\brief Reads the table named by DEAD_FUEL_MOIST_FIXED_FILE and indexes it by month and day.
+ *
+ *	\sa DeadFuelMoistTables
+ *	\param tbls DeadFuelMoistTables
+ *	\param proptbl ChHashTable of simulation properties
+ *	\retval int ERR_SUCCESS(0) if successful, an error code otherwise
+ */
+int SetDeadFuelMoistTablesFIXEDFromProps(DeadFuelMoistTables * tbls, ChHashTable * proptbl);
+
+/*! \fn int SetDeadFuelMoistTablesRANDHFromProps(DeadFuelMoistTables * tbls, ChHashTable * proptbl)
+ *	\brief Reads the table named by DEAD_FUEL_MOIST_HISTORICAL_FILE.
+ *
+ *	\sa DeadFuelMoistTables
+ *	\param tbls DeadFuelMoistTables
+ *	\param proptbl ChHashTable of simulation properties
+ *	\retval int ERR_SUCCESS(0) if successful, an error code otherwise
+ */
+int SetDeadFuelMoistTablesRANDHFromProps(DeadFuelMoistTables * tbls, ChHashTable * proptbl);
+
+/*! \fn int SetDeadFuelMoistTablesSPATIALFromProps(DeadFuelMoistTables * tbls, ChHashTable * proptbl)
+ *	\brief Reads the atm table named by DEAD_FUEL_MOIST_SPATIAL_FILE and indexes it by month, day and hour.
+ *
+ *	The rasters listed in the atm table are read as simulations reach them.
+ *	\sa DeadFuelMoistTables
+ *	\sa WeatherStream
+ *	\param tbls DeadFuelMoistTables
+ *	\param proptbl ChHashTable of simulation properties
+ *	\retval int ERR_SUCCESS(0) if successful, an error code otherwise
+ */
+int SetDeadFuelMoistTablesSPATIALFromProps(DeadFuelMoistTables * tbls, ChHashTable * proptbl);
+
+/*! \fn void FreeDeadFuelMoistTables(void * vptr)
+ *	\brief Frees memory associated with DeadFuelMoistTables structure.
+ *
+ *	Every DeadFuelMoistState using the tables must be freed first.
+ *	\sa DeadFuelMoistTables
+ *	\param vptr ptr to DeadFuelMoistTables
+ */
+void FreeDeadFuelMoistTables(void * vptr);
+
+/*! \fn DeadFuelMoistState * InitDeadFuelMoistState()
+ *	\brief Initializes the dead fuel moisture state of a simulation.
+ *
+ *	\sa DeadFuelMoistState
+ *	\retval DeadFuelMoistState* Ptr to initialized DeadFuelMoistState, or NULL if unable to allocate
+ */
+DeadFuelMoistState * InitDeadFuelMoistState();
+
+/*! \fn void FreeDeadFuelMoistState(void * vptr)
+ *	\brief Frees memory associated with DeadFuelMoistState structure.
+ *
+ *	\sa DeadFuelMoistState
+ *	\param vptr ptr to DeadFuelMoistState
+ */
+void FreeDeadFuelMoistState(void * vptr);
+
+/*! \fn int SetDeadFuelMoistStateFromSimConfig(DeadFuelMoistState * st, const SimConfig * cfg)
+ *	\brief Sets the 1 and 100 hour dead fuel moisture increments of the dead fuel moisture state from SimConfig.
+ *
+ *	Call once before the first call to the functions taking DeadFuelMoistState as argument.
+ *	\sa DeadFuelMoistState
+ *	\sa SimConfig
+ *	\param st DeadFuelMoistState
+ *	\param cfg SimConfig of simulation
+ *	\retval int ERR_SUCCESS(0) if successful, an error code otherwise
+ */
+int SetDeadFuelMoistStateFromSimConfig(DeadFuelMoistState * st, const SimConfig * cfg);
+
+/*! \fn int SetDeadFuelMoistStateFromTables(DeadFuelMoistState * st, const DeadFuelMoistTables * tbls)
+ *	\brief Links the dead fuel moisture state of a simulation to the shared dead fuel moisture tables.
+ *
+ *	Call once before the first call to the functions taking DeadFuelMoistState as argument.
+ *	The tables must outlive the state.
+ *	\sa DeadFuelMoistState
+ *	\sa DeadFuelMoistTables
+ *	\param st DeadFuelMoistState
+ *	\param tbls DeadFuelMoistTables read for the dead fuel moisture type of the simulation
+ *	\retval int ERR_SUCCESS(0) if successful, an error code otherwise
+ */
+int SetDeadFuelMoistStateFromTables(DeadFuelMoistState * st, const DeadFuelMoistTables * tbls);
+
+/*! \fn int GetDeadFuelMoistFIXEDFromProps(DeadFuelMoistState * st, ChHashTable * proptbl, int month, int day, int hour, 
 											unsigned int row, unsigned int col, 
 											double * d1hfm, double * d10hfm, double * d100hfm)
  *	\brief retrieves time and space dependent dead fuel moisture value at a cell
@@ -109,6 +257,7 @@
  * 	moisture based upon index into a table of historical values
  *	\sa ChHashTable
  *	\sa Check the \htmlonly <a href="config_file_doc.html#DEAD_FUEL">config file documentation</a> \endhtmlonly
+ *	\param st DeadFuelMoistState storing the dead fuel moisture between calls
  *	\param proptbl ChHashTable of simulation properties
  *	\param year date to retreive live fuel moisture for
  *	\param month date to retreive live fuel moisture for 
@@ -127,11 +276,11 @@
  *				// something bad happened
  *	\endcode
  */
-int GetDeadFuelMoistFIXEDFromProps(ChHashTable * proptbl, int month, int day, int hour, 
+int GetDeadFuelMoistFIXEDFromProps(DeadFuelMoistState * st, ChHashTable * proptbl, int month, int day, int hour, 
 											double rwx, double rwy, 
                       double * d1hfm, double * d10hfm, double * d100hfm);
 
-/*! \fn int GetDeadFuelMoistRANDHFromProps(ChHashTable * proptbl, int month, int day, int hour, 
+/*! \fn int GetDeadFuelMoistRANDHFromProps(DeadFuelMoistState * st, ChHashTable * proptbl, int month, int day, int hour, 
 											unsigned int row, unsigned int col,
 											double * d1hfm, double * d10hfm, double * d100hfm)
  *	\brief retrieves time and space dependent dead fuel moisture value at a cell
@@ -140,6 +289,7 @@ int GetDeadFuelMoistFIXEDFromProps(ChHashTable * proptbl, int month, int day, in
  * 	moisture based upon random index into a table of historical values
  *	\sa ChHashTable
  *	\sa Check the \htmlonly <a href="config_file_doc.html#DEAD_FUEL">config file documentation</a> \endhtmlonly
+ *	\param st DeadFuelMoistState storing the dead fuel moisture between calls
  *	\param proptbl ChHashTable of simulation properties
  *	\param year date to retreive live fuel moisture for
  *	\param month date to retreive live fuel moisture for 
@@ -158,11 +308,11 @@ int GetDeadFuelMoistFIXEDFromProps(ChHashTable * proptbl, int month, int day, in
  *				// something bad happened
  *	\endcode
  */																					
-int GetDeadFuelMoistRANDHFromProps(ChHashTable * proptbl, int month, int day, int hour, 
+int GetDeadFuelMoistRANDHFromProps(DeadFuelMoistState * st, ChHashTable * proptbl, int month, int day, int hour, 
 											double rwx, double rwy, 
                       double * d1hfm, double * d10hfm, double * d100hfm);
 
-/*! \fn int GetDeadFuelMoistSPATIALFromProps(ChHashTable * proptbl, int month, int day, int hour, 
+/*! \fn int GetDeadFuelMoistSPATIALFromProps(DeadFuelMoistState * st, ChHashTable * proptbl, int month, int day, int hour, 
 											unsigned int row, unsigned int col, 
 											double * d1hfm, double * d10hfm, double * d100hfm)
  *	\brief retrieves time and space dependent dead fuel moisture value at a cell
@@ -171,6 +321,7 @@ int GetDeadFuelMoistRANDHFromProps(ChHashTable * proptbl, int month, int day, in
  * 	moisture based upon lookup into a raster of dead fuel moisture values
  *	\sa ChHashTable
  *	\sa Check the \htmlonly <a href="config_file_doc.html#DEAD_FUEL">config file documentation</a> \endhtmlonly
+ *	\param st DeadFuelMoistState storing the dead fuel moisture between calls
  *	\param proptbl ChHashTable of simulation properties
  *	\param year date to retreive live fuel moisture for
  *	\param month date to retreive live fuel moisture for 
@@ -189,7 +340,7 @@ int GetDeadFuelMoistRANDHFromProps(ChHashTable * proptbl, int month, int day, in
  *				// something bad happened
  *	\endcode
  */										
-int GetDeadFuelMoistSPATIALFromProps(ChHashTable * proptbl, int month, int day, int hour, 
+int GetDeadFuelMoistSPATIALFromProps(DeadFuelMoistState * st, ChHashTable * proptbl, int month, int day, int hour, 
 											double rwx, double rwy, 
                       double * d1hfm, double * d10hfm, double * d100hfm);
  																			 
@@ -0,0 +1,42 @@
+/*!
+ * \file EightNbr.c
+ *
+ * \author Marco Morais
+ * \date 2000-2001
+ *
+ *	HFire (Highly Optmized Tolerance Fire Spread Model) Library
+ *	Copyright (C) 2001 Marco Morais
+ *
+ *	This library is free software; you can redistribute it and/or
+ *	modify it under the terms of the GNU Lesser General Public
+ *	License as published by the Free Software Foundation; either
+ *	version 2.1 of the License, or (at your option) any later version.
+ *
+ *	This library is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *	Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public
+ *	License along with this library; if not, write to the Free Software
+ *	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <math.h>
+
+#include "EightNbr.h"
+
+void EightNbrCalcTerrainDist(double cellsz, double elev, const double * nbr_elev, double * dist)	{
+	double cellsz2 = cellsz * cellsz;
+	double dz;
+	int k;
+
+	for(k = 0; k < EIGHTNBR_NUM_NBR_CELLS; k++)	{
+		dz = nbr_elev[k] - elev;
+		dist[k] = sqrt(egtnbr_dist2[k] * cellsz2 + dz * dz);
+		}
+
+	return;
+	}
+
+/* end of EightNbr.c */
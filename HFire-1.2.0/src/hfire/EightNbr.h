@@ -68,6 +68,17 @@ static const double egtnbr_az	[EIGHTNBR_NUM_NBR_CELLS]	= {0.0, 45.0, 90.0, 135.0
 
 /*! used to quickly retrieve nbr cartesian distance: N, NE, E, SE, S, SW, W, NW */
 static const double egtnbr_dist	[EIGHTNBR_NUM_NBR_CELLS]	= {1.0, 1.4142, 1.0, 1.4142, 1.0, 1.4142, 1.0, 1.4142};
+
+/*! used to quickly retrieve square of nbr cartesian distance: N, NE, E, SE, S, SW, W, NW */
+static const double egtnbr_dist2[EIGHTNBR_NUM_NBR_CELLS]	= {1.0, 2.0, 1.0, 2.0, 1.0, 2.0, 1.0, 2.0};
+
+/*! used to quickly retrieve cosine of nbr azimuth: N, NE, E, SE, S, SW, W, NW */
+static const double egtnbr_cos	[EIGHTNBR_NUM_NBR_CELLS]	= { 1.0,  0.70710678118654752,  0.0, -0.70710678118654752,
+																-1.0, -0.70710678118654752,  0.0,  0.70710678118654752};
+
+/*! used to quickly retrieve sine of nbr azimuth: N, NE, E, SE, S, SW, W, NW */
+static const double egtnbr_sin	[EIGHTNBR_NUM_NBR_CELLS]	= { 0.0,  0.70710678118654752,  1.0,  0.70710678118654752,
+																 0.0, -0.70710678118654752, -1.0, -0.70710678118654752};
  
 /*
  *********************************************************
@@ -100,5 +111,16 @@ static const double egtnbr_dist	[EIGHTNBR_NUM_NBR_CELLS]	= {1.0, 1.4142, 1.0, 1.
  * PUBLIC FUNCTIONS
  *********************************************************
  */
- 
+
+/*! \fn void EightNbrCalcTerrainDist(double cellsz, double elev, const double * nbr_elev, double * dist)
+ *	\brief Calculates distance along the ground from a cell center to the center of each neighbor.
+ *
+ *	All neighbors are evaluated in a single pass without branching.
+ *	\param cellsz cell resolution, in m
+ *	\param elev elevation of cell, in m
+ *	\param nbr_elev array of EIGHTNBR_NUM_NBR_CELLS neighbor elevations in nbr azimuth order, in m
+ *	\param dist array of EIGHTNBR_NUM_NBR_CELLS receiving distance to each neighbor, in m
+ */
+void EightNbrCalcTerrainDist(double cellsz, double elev, const double * nbr_elev, double * dist);
+
 #endif EightNbr_H		/* end of EightNbr.h */
@@ -0,0 +1,464 @@
+/*!
+ * \file Ensemble.c
+ *
+ * \author Marco Morais
+ * \date 2000-2001
+ *
+ *	HFire (Highly Optmized Tolerance Fire Spread Model) Library
+ *	Copyright (C) 2001 Marco Morais
+ *
+ *	This library is free software; you can redistribute it and/or
+ *	modify it under the terms of the GNU Lesser General Public
+ *	License as published by the Free Software Foundation; either
+ *	version 2.1 of the License, or (at your option) any later version.
+ *
+ *	This library is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *	Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public
+ *	License along with this library; if not, write to the Free Software
+ *	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "Ensemble.h"
+
+#include "FireConfig.h"
+
+/* export properties redirected to the replicate directory, directories are listed first */
+static const EnumFireProp exp_props[ENSEMBLE_NUM_EXPORT_PROPS] = {
+	PROP_EXPFIDDIR,							/* EXPORT_FIRE_ID_RASTER_DIR */
+	PROP_EXPFUELDIR,						/* EXPORT_FUELS_RASTER_DIR */
+	PROP_EXPSAGEDIR,						/* EXPORT_STAND_AGE_RASTER_DIR */
+	PROP_EXPFPDIR,							/* EXPORT_FIRE_ID_PNG_DIRECTORY */
+	PROP_EXPSADIR,							/* EXPORT_SANTA_ANA_RASTER_DIR */
+	PROP_EXPFAREAF,							/* EXPORT_FIRE_AREA_FILE */
+	PROP_EXPFPERMF,							/* EXPORT_FIRE_PERIMTER_FILE */
+	PROP_EXPIGLCF,							/* EXPORT_IGNITION_LOCS_FILE */
+	PROP_EXPSANAEVF,						/* EXPORT_SANTA_ANA_EVT_FILE */
+	PROP_EXPFINOF,							/* EXPORT_FIRE_INFO_FILE */
+	PROP_EXPAABHF							/* EXPORT_AGE_AT_BURN_HIST_FILE */
+	};
+
+/*
+ *********************************************************
+ * NON PUBLIC FUNCTIONS
+ *********************************************************
+ */
+
+static int MakeDirEnsemble(const char * dir);
+
+static int JoinPathEnsemble(const char * dir, const char * fname, char * path);
+
+static int AddFireYearEnsemble(Ensemble * ens, int rep, FireYear * fy);
+
+static void CountCellEnsemble(Ensemble * ens, FireYear * fy, int i, int j, int stamp, long int * cells);
+
+Ensemble * InitEnsemble(int num_replicates, const char * dir)	{
+	Ensemble * ens = NULL;
+
+	/* check args */
+	if ( num_replicates < 1 || num_replicates > ENSEMBLE_MAX_REPLICATES || dir == NULL
+			|| strlen(dir) >= FIRE_EXPORT_DEFAULT_FILENAME_SIZE )	{
+		ERR_ERROR_CONTINUE("Arguments supplied to Ensemble invalid. \n", ERR_EINVAL);
+		return ens;
+		}
+
+	if ( (ens = (Ensemble *) calloc(1, sizeof(Ensemble))) == NULL
+			|| (ens->rep_years = (long int *) calloc(num_replicates, sizeof(long int))) == NULL
+			|| (ens->rep_fires = (long int *) calloc(num_replicates, sizeof(long int))) == NULL
+			|| (ens->rep_cells = (long int *) calloc(num_replicates, sizeof(long int))) == NULL )	{
+		FreeEnsemble(ens);
+		ERR_ERROR_CONTINUE("Unable to allocate memory for Ensemble. \n", ERR_ENOMEM);
+		return NULL;
+		}
+	ens->num_replicates = num_replicates;
+	strcpy(ens->dir, dir);
+#ifdef USING_UNIX
+	pthread_mutex_init(&ens->lock, NULL);
+#endif
+
+	if ( MakeDirEnsemble(ens->dir) )	{
+		FreeEnsemble(ens);
+		ERR_ERROR_CONTINUE("Unable to create ENSEMBLE_OUTPUT_DIR directory. \n", ERR_EIOFAIL);
+		return NULL;
+		}
+
+	return ens;
+	}
+
+EnsembleReplicate * InitEnsembleReplicate(Ensemble * ens, ChHashTable * proptbl, int rep)	{
+	EnsembleReplicate * er = NULL;
+	char rep_name[FIRE_EXPORT_DEFAULT_FILENAME_SIZE] = {'\0'};
+	KeyVal * entry = NULL;
+	const char * val = NULL;
+	const char * fname = NULL;
+	const char * c = NULL;
+	int i, k;
+
+	/* check args */
+	if ( ens == NULL || proptbl == NULL || rep < 0 || rep >= ens->num_replicates )	{
+		ERR_ERROR_CONTINUE("Arguments supplied to EnsembleReplicate invalid. \n", ERR_EINVAL);
+		return er;
+		}
+
+	if ( (er = (EnsembleReplicate *) calloc(1, sizeof(EnsembleReplicate))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to allocate memory for EnsembleReplicate. \n", ERR_ENOMEM);
+		return er;
+		}
+	er->rep = rep;
+
+	/* output of replicate is written under its own directory */
+	sprintf(rep_name, "rep%04d", rep);
+	if ( JoinPathEnsemble(ens->dir, rep_name, er->dir) || MakeDirEnsemble(er->dir) )	{
+		FreeEnsembleReplicate(er);
+		ERR_ERROR_CONTINUE("Unable to create directory of ensemble replicate. \n", ERR_EIOFAIL);
+		return NULL;
+		}
+
+	if ( (er->proptbl = InitChHashTable(FIRE_CONFIG_TBL_INI_CAPCTY, UniversalStringHashFunc,
+										MatchStringKeyVal, FreeKeyVal)) == NULL )	{
+		FreeEnsembleReplicate(er);
+		ERR_ERROR_CONTINUE("Unable to initialize Hash Table of replicate properties. \n", ERR_EFAILED);
+		return NULL;
+		}
+
+	/* copy every property, rewriting the export properties which are set */
+	for(i = 0; i < PROP_UP_BOUND; i++)	{
+		if ( ChHashTableRetrieve(proptbl, GetFireProp((EnumFireProp)i), (void *)&entry) )	{
+			FreeEnsembleReplicate(er);
+			ERR_ERROR_CONTINUE("Unable to retrieve property of ensemble replicate. \n", ERR_EFAILED);
+			return NULL;
+			}
+		val = entry->val;
+
+		for(k = 0; k < ENSEMBLE_NUM_EXPORT_PROPS && exp_props[k] != (EnumFireProp)i; k++)
+			;
+		if ( k < ENSEMBLE_NUM_EXPORT_PROPS && strcmp(val, GetFireVal(VAL_NULL)) != 0 )	{
+			if ( k < ENSEMBLE_NUM_EXPORT_DIRS )	{
+				strcpy(er->exp[k], er->dir);
+				}
+			else	{
+				/* file keeps its name without the directory */
+				for(fname = c = val; *c != '\0'; c++)	{
+					if ( *c == '/' || *c == '\\' )	fname = c + 1;
+					}
+				if ( JoinPathEnsemble(er->dir, fname, er->exp[k]) )	{
+					FreeEnsembleReplicate(er);
+					ERR_ERROR_CONTINUE("Export file name of ensemble replicate too long. \n", ERR_ERANGE);
+					return NULL;
+					}
+				}
+			val = er->exp[k];
+			}
+
+		if ( ChHashTableInsert(er->proptbl, GetFireProp((EnumFireProp)i), InitKeyVal(GetFireProp((EnumFireProp)i), val)) )	{
+			FreeEnsembleReplicate(er);
+			ERR_ERROR_CONTINUE("Unable to insert property of ensemble replicate. \n", ERR_EFAILED);
+			return NULL;
+			}
+		}
+
+	return er;
+	}
+
+int EnsembleAddFireYear(Ensemble * ens, int rep, FireYear * fy)	{
+	int status;
+
+	/* check args */
+	if ( ens == NULL || fy == NULL || fy->id == NULL || rep < 0 || rep >= ens->num_replicates )	{
+		ERR_ERROR("Arguments supplied to aggregate FireYear in Ensemble invalid. \n", ERR_EINVAL);
+		}
+
+#ifdef USING_UNIX
+	pthread_mutex_lock(&ens->lock);
+#endif
+	status = AddFireYearEnsemble(ens, rep, fy);
+#ifdef USING_UNIX
+	pthread_mutex_unlock(&ens->lock);
+#endif
+	if ( status )	{
+		ERR_ERROR("Unable to aggregate FireYear in Ensemble. \n", status);
+		}
+
+	return ERR_SUCCESS;
+	}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Aggregates the fires of a year of replicate rep, the caller holds the lock of the Ensemble.
+ * Cells unburnable in the first year of replicate 0 which have not burned in a year already
+ * aggregated are marked, so the cells marked do not depend on the order years are aggregated.
+ *
+ * Arguments:
+ * ens- Ensemble
+ * rep- index of replicate
+ * fy- FireYear at end of year
+ *
+ * Returns:
+ * ERR_SUCCESS(0) if successful, an error code otherwise
+ */
+static int AddFireYearEnsemble(Ensemble * ens, int rep, FireYear * fy)	{
+	int i, j, id, cls, stamp;
+	int num_fires;
+	long int k, fires = 0, cells = 0;
+
+	/* counts are sized to the first year aggregated */
+	if ( ens->num_burned == NULL )	{
+		if ( (ens->num_burned = InitIntTwoDArraySizeIniValue(INTTWODARRAY_SIZE_ROW(fy->id), INTTWODARRAY_SIZE_COL(fy->id), 0)) == NULL
+				|| (ens->last_year = InitIntTwoDArraySizeIniValue(INTTWODARRAY_SIZE_ROW(fy->id), INTTWODARRAY_SIZE_COL(fy->id), 0)) == NULL )	{
+			ERR_ERROR("Unable to allocate memory for burn counts of Ensemble. \n", ERR_ENOMEM);
+			}
+		ens->xllcorner = fy->xllcorner;
+		ens->yllcorner = fy->yllcorner;
+		ens->cellsize = fy->cellsize;
+		}
+	else if ( INTTWODARRAY_SIZE_ROW(ens->num_burned) != INTTWODARRAY_SIZE_ROW(fy->id)
+			|| INTTWODARRAY_SIZE_COL(ens->num_burned) != INTTWODARRAY_SIZE_COL(fy->id) )	{
+		ERR_ERROR("FireYear dimensions differ from Ensemble. \n", ERR_EBADLEN);
+		}
+	/* cells unburnable in the first year of replicate 0 are marked unless burned in another replicate */
+	if ( rep == 0 && ens->rep_years[0] == 0 )	{
+		for(i = 0; i < INTTWODARRAY_SIZE_ROW(fy->id); i++)	{
+			for(j = 0; j < INTTWODARRAY_SIZE_COL(fy->id); j++)	{
+				if ( INTTWODARRAY_GET_DATA(fy->id, i, j) == FIRE_YEAR_ID_UNBURNABLE
+						&& INTTWODARRAY_GET_DATA(ens->num_burned, i, j) == 0 )	{
+					INTTWODARRAY_SET_DATA(ens->last_year, i, j, ENSEMBLE_NODATA_VALUE);
+					}
+				}
+			}
+		}
+	stamp = (int) ++ens->num_years;
+
+	/* only cells touched during the year may have burned, a cell touched twice is counted once */
+	if ( fy->cap_touched >= 0 )	{
+		for(k = 0; k < fy->num_touched; k++)	{
+			CountCellEnsemble(ens, fy, (int) (fy->touched[k] / INTTWODARRAY_SIZE_COL(fy->id)),
+								(int) (fy->touched[k] % INTTWODARRAY_SIZE_COL(fy->id)), stamp, &cells);
+			}
+		}
+	else	{
+		for(i = 0; i < INTTWODARRAY_SIZE_ROW(fy->id); i++)	{
+			for(j = 0; j < INTTWODARRAY_SIZE_COL(fy->id); j++)	{
+				CountCellEnsemble(ens, fy, i, j, stamp, &cells);
+				}
+			}
+		}
+
+	/* size class of each fire which is not a failed ignition */
+	num_fires = ( fy->num_fires < FIRE_YEAR_ID_MAX ) ? fy->num_fires : FIRE_YEAR_ID_MAX;
+	for(id = 1; id <= num_fires; id++)	{
+		if ( fy->finfo[id].is_failed_ig || fy->finfo[id].num_cells_burned < 1 )	{
+			continue;
+			}
+		for(cls = 0; cls < ENSEMBLE_NUM_SIZE_CLASSES - 1 && (fy->finfo[id].num_cells_burned >> (cls + 1)) > 0; cls++)
+			;
+		ens->size_class[cls]++;
+		fires++;
+		}
+
+	ens->rep_years[rep]++;
+	ens->rep_fires[rep] += fires;
+	ens->rep_cells[rep] += cells;
+
+	return ERR_SUCCESS;
+	}
+
+int EnsembleExport(Ensemble * ens)	{
+	char fname[FIRE_EXPORT_DEFAULT_FILENAME_SIZE] = {'\0'};
+	FltTwoDArray * prob = NULL;
+	FILE * fout = NULL;
+	long int num_fires = 0, num_ge;
+	int i, j, cls, max_cls = -1;
+	double ha_per_cell;
+
+	/* check args */
+	if ( ens == NULL )	{
+		ERR_ERROR("Arguments supplied to export Ensemble invalid. \n", ERR_EINVAL);
+		}
+
+	/* fraction of replicate years each cell burned */
+	if ( ens->num_burned != NULL )	{
+		if ( (prob = InitFltTwoDArraySizeEmpty(INTTWODARRAY_SIZE_ROW(ens->num_burned), INTTWODARRAY_SIZE_COL(ens->num_burned))) == NULL )	{
+			ERR_ERROR("Unable to allocate memory for burn probability of Ensemble. \n", ERR_ENOMEM);
+			}
+		for(i = 0; i < INTTWODARRAY_SIZE_ROW(ens->num_burned); i++)	{
+			for(j = 0; j < INTTWODARRAY_SIZE_COL(ens->num_burned); j++)	{
+				if ( INTTWODARRAY_GET_DATA(ens->last_year, i, j) == ENSEMBLE_NODATA_VALUE )	{
+					FLTTWODARRAY_SET_DATA(prob, i, j, (float) ENSEMBLE_NODATA_VALUE);
+					}
+				else	{
+					FLTTWODARRAY_SET_DATA(prob, i, j, (float) ((double) INTTWODARRAY_GET_DATA(ens->num_burned, i, j) / (double) ens->num_years));
+					}
+				}
+			}
+		if ( JoinPathEnsemble(ens->dir, ENSEMBLE_BURN_PROB_FNAME, fname)
+				|| ExportFltTwoDArrayAsAsciiRaster(prob, ens->xllcorner, ens->yllcorner, ens->cellsize, ENSEMBLE_NODATA_VALUE, fname) )	{
+			FreeFltTwoDArray(prob);
+			ERR_ERROR("Unable to export burn probability of Ensemble. \n", ERR_EIOFAIL);
+			}
+		FreeFltTwoDArray(prob);
+		}
+
+	/* number of fires in each size class and fraction of fires at least as large */
+	for(cls = 0; cls < ENSEMBLE_NUM_SIZE_CLASSES; cls++)	{
+		num_fires += ens->size_class[cls];
+		if ( ens->size_class[cls] > 0 )	max_cls = cls;
+		}
+	if ( JoinPathEnsemble(ens->dir, ENSEMBLE_FIRE_SIZE_FNAME, fname) || (fout = fopen(fname, "w")) == NULL )	{
+		ERR_ERROR("Unable to export fire size distribution of Ensemble. \n", ERR_EIOFAIL);
+		}
+	ha_per_cell = (double) ens->cellsize * (double) ens->cellsize / 10000.0;
+	fprintf(fout, "MIN_CELLS, MAX_CELLS, MIN_HA, MAX_HA, NUM_FIRES, FRAC_FIRES, FRAC_FIRES_GE\n");
+	for(cls = 0, num_ge = num_fires; cls <= max_cls; cls++)	{
+		fprintf(fout, "%ld, %ld, %f, %f, %ld, %f, %f\n", 1L << cls, (1L << (cls + 1)) - 1,
+				(double) (1L << cls) * ha_per_cell, (double) ((1L << (cls + 1)) - 1) * ha_per_cell, ens->size_class[cls],
+				(double) ens->size_class[cls] / (double) num_fires, (double) num_ge / (double) num_fires);
+		num_ge -= ens->size_class[cls];
+		}
+	fclose(fout);
+
+	/* seed and totals of each replicate */
+	if ( JoinPathEnsemble(ens->dir, ENSEMBLE_REPLICATES_FNAME, fname) || (fout = fopen(fname, "w")) == NULL )	{
+		ERR_ERROR("Unable to export replicates of Ensemble. \n", ERR_EIOFAIL);
+		}
+	fprintf(fout, "REP, SEED, NUM_YEARS, NUM_FIRES, NUM_BURNED\n");
+	for(i = 0; i < ens->num_replicates; i++)	{
+		fprintf(fout, "%d, %ld, %ld, %ld, %ld\n", i, ens->seed, ens->rep_years[i], ens->rep_fires[i], ens->rep_cells[i]);
+		}
+	fclose(fout);
+
+	return ERR_SUCCESS;
+	}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Creates a directory of ensemble output, an existing directory is used as is.
+ *
+ * Arguments:
+ * dir- name of directory
+ *
+ * Returns:
+ * ERR_SUCCESS(0) if directory exists, an error code otherwise
+ */
+static int MakeDirEnsemble(const char * dir)	{
+	#ifdef USING_PC
+	if ( _mkdir(dir) != 0 && errno != EEXIST )	{
+		return ERR_EIOFAIL;
+		}
+	#endif
+	#ifdef USING_UNIX
+	if ( mkdir(dir, 0755) != 0 && errno != EEXIST )	{
+		return ERR_EIOFAIL;
+		}
+	#endif
+
+	return ERR_SUCCESS;
+	}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Joins a directory and file name into a path of FIRE_EXPORT_DEFAULT_FILENAME_SIZE characters.
+ *
+ * Arguments:
+ * dir- name of directory
+ * fname- name of file within directory
+ * path- joined path
+ *
+ * Returns:
+ * ERR_SUCCESS(0) if path fits, an error code otherwise
+ */
+static int JoinPathEnsemble(const char * dir, const char * fname, char * path)	{
+	if ( strlen(dir) + strlen(fname) + 3 > FIRE_EXPORT_DEFAULT_FILENAME_SIZE )	{
+		return ERR_ERANGE;
+		}
+
+	strcpy(path, dir);
+	#ifdef USING_PC
+	strcat(path, "\\");
+	#endif
+	#ifdef USING_UNIX
+	strcat(path, "//");
+	#endif
+	strcat(path, fname);
+
+	return ERR_SUCCESS;
+	}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Counts a cell toward burn probability if it burned in a fire that is not a failed ignition and
+ * was not already counted during the year.  A cell unburnable in the first year which later burns
+ * is counted from then on.
+ *
+ * Arguments:
+ * ens- Ensemble
+ * fy- FireYear at end of year
+ * i- row index of cell
+ * j- column index of cell
+ * stamp- index of year being aggregated
+ * cells- incremented if cell is counted
+ *
+ * Returns:
+ * None
+ */
+static void CountCellEnsemble(Ensemble * ens, FireYear * fy, int i, int j, int stamp, long int * cells)	{
+	int id = INTTWODARRAY_GET_DATA(fy->id, i, j);
+
+	if ( id > FIRE_YEAR_ID_DEFAULT && id <= FIRE_YEAR_ID_MAX && !fy->finfo[id].is_failed_ig
+			&& INTTWODARRAY_GET_DATA(ens->last_year, i, j) != stamp )	{
+		INTTWODARRAY_SET_DATA(ens->last_year, i, j, stamp);
+		INTTWODARRAY_GET_DATA(ens->num_burned, i, j) += 1;
+		*cells += 1;
+		}
+
+	return;
+	}
+
+void FreeEnsembleReplicate(void * vptr)	{
+	EnsembleReplicate * er = NULL;
+
+	if ( vptr != NULL )	{
+		er = (EnsembleReplicate *) vptr;
+		if ( er->proptbl != NULL )	FreeChHashTable(er->proptbl);
+		free(er);
+		}
+	er = NULL;
+
+	return;
+	}
+
+void FreeEnsemble(void * vptr)	{
+	Ensemble * ens = NULL;
+
+	if ( vptr != NULL )	{
+		ens = (Ensemble *) vptr;
+		if ( ens->num_burned != NULL )	FreeIntTwoDArray(ens->num_burned);
+		if ( ens->last_year != NULL )	FreeIntTwoDArray(ens->last_year);
+		if ( ens->rep_years != NULL )	free(ens->rep_years);
+		if ( ens->rep_fires != NULL )	free(ens->rep_fires);
+		if ( ens->rep_cells != NULL )	free(ens->rep_cells);
+#ifdef USING_UNIX
+		pthread_mutex_destroy(&ens->lock);
+#endif
+		free(ens);
+		}
+	ens = NULL;
+
+	return;
+	}
+
+/* end of Ensemble.c */
@@ -0,0 +1,247 @@
+/*!
+ * \file Ensemble.h
+ * \brief Replicates of a simulation run in a single process and the statistics aggregated over them.
+ *
+ * \sa Check the \htmlonly <a href="config_file_doc.html">config file documentation</a> \endhtmlonly
+ * \author Marco Morais
+ * \date 2000-2001
+ *
+ *	HFire (Highly Optmized Tolerance Fire Spread Model) Library
+ *	Copyright (C) 2001 Marco Morais
+ *
+ *	This library is free software; you can redistribute it and/or
+ *	modify it under the terms of the GNU Lesser General Public
+ *	License as published by the Free Software Foundation; either
+ *	version 2.1 of the License, or (at your option) any later version.
+ *
+ *	This library is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *	Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public
+ *	License along with this library; if not, write to the Free Software
+ *	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef	Ensemble_H
+#define Ensemble_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+#ifdef USING_UNIX
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <pthread.h>
+#endif
+#ifdef USING_PC
+#include <direct.h>
+#endif
+
+#include "FireProp.h"
+#include "FireYear.h"
+#include "FireExport.h"
+
+#include "ChHashTable.h"
+#include "HashFuncs.h"
+#include "KeyVal.h"
+#include "IntTwoDArray.h"
+#include "FltTwoDArray.h"
+#include "GridData.h"
+#include "Err.h"
+
+/*
+ *********************************************************
+ * DEFINES, ENUMS
+ *********************************************************
+ */
+
+/*! \def ENSEMBLE_MAX_REPLICATES
+ *	\brief largest number of replicates in an ensemble, replicate directories are numbered with four digits
+ */
+#define ENSEMBLE_MAX_REPLICATES						(10000)
+
+/*! \def ENSEMBLE_NUM_EXPORT_PROPS
+ *	\brief number of export properties redirected to the directory of each replicate
+ */
+#define ENSEMBLE_NUM_EXPORT_PROPS					(11)
+
+/*! \def ENSEMBLE_NUM_EXPORT_DIRS
+ *	\brief number of export properties naming a directory, which are replaced by the replicate directory
+ */
+#define ENSEMBLE_NUM_EXPORT_DIRS					(5)
+
+/*! \def ENSEMBLE_NUM_SIZE_CLASSES
+ *	\brief number of fire size classes, class k holds fires of 2^k to 2^(k+1)-1 cells
+ */
+#define ENSEMBLE_NUM_SIZE_CLASSES					(30)
+
+/*! \def ENSEMBLE_BURN_PROB_FNAME
+ *	\brief name of raster of burn probability written to the ensemble directory
+ */
+#define ENSEMBLE_BURN_PROB_FNAME					("burnprob.asc")
+
+/*! \def ENSEMBLE_FIRE_SIZE_FNAME
+ *	\brief name of fire size distribution written to the ensemble directory
+ */
+#define ENSEMBLE_FIRE_SIZE_FNAME					("firesize.txt")
+
+/*! \def ENSEMBLE_REPLICATES_FNAME
+ *	\brief name of summary of each replicate written to the ensemble directory
+ */
+#define ENSEMBLE_REPLICATES_FNAME					("replicates.txt")
+
+/*! \def ENSEMBLE_NODATA_VALUE
+ *	\brief value of cells of burn probability raster which were never burnable
+ */
+#define ENSEMBLE_NODATA_VALUE						(-9999)
+
+/*
+ *********************************************************
+ * STRUCTS, TYPEDEFS
+ *********************************************************
+ */
+
+/*! Type name for EnsembleReplicate_
+ *	\sa For a list of members goto EnsembleReplicate_
+ */
+typedef struct EnsembleReplicate_ EnsembleReplicate;
+
+/*!	\struct EnsembleReplicate_ Ensemble.h "Ensemble.h"
+ *	\brief properties of a single replicate of an ensemble
+ *	The properties table of a replicate shares the values of the simulation properties, except
+ *	the export properties which are redirected to the directory of the replicate.  The rewritten
+ *	values are stored in the replicate.
+ */
+struct EnsembleReplicate_	{
+	/*! index of replicate, from 0 */
+	int rep;
+	/*! properties table of replicate */
+	ChHashTable * proptbl;
+	/*! directory of replicate output */
+	char dir[FIRE_EXPORT_DEFAULT_FILENAME_SIZE];
+	/*! export properties of replicate */
+	char exp[ENSEMBLE_NUM_EXPORT_PROPS][FIRE_EXPORT_DEFAULT_FILENAME_SIZE];
+	};
+
+/*! Type name for Ensemble_
+ *	\sa For a list of members goto Ensemble_
+ */
+typedef struct Ensemble_ Ensemble;
+
+/*!	\struct Ensemble_ Ensemble.h "Ensemble.h"
+ *	\brief statistics aggregated over every year of every replicate of an ensemble
+ *	Counts are accumulated from the cells visited by fires each year, so aggregating a year
+ *	does not require a pass over the simulation domain.  Replicates may run concurrently, years
+ *	are aggregated one at a time and the counts do not depend on the order years are aggregated.
+ */
+struct Ensemble_	{
+	/*! number of replicates */
+	int num_replicates;
+	/*! directory of ensemble output */
+	char dir[FIRE_EXPORT_DEFAULT_FILENAME_SIZE];
+	/*! number of years burned by each cell, allocated with the first year aggregated */
+	IntTwoDArray * num_burned;
+	/*! index of the last year counted by each cell, ENSEMBLE_NODATA_VALUE if unburnable in the first year of replicate 0 and not yet burned */
+	IntTwoDArray * last_year;
+	/*! lower left coordinates of simulation domain */
+	double xllcorner, yllcorner;
+	/*! simulation cell resolution, in m */
+	int cellsize;
+	/*! number of years aggregated */
+	long int num_years;
+	/*! number of fires in each size class */
+	long int size_class[ENSEMBLE_NUM_SIZE_CLASSES];
+	/*! number of years, fires, and cells burned by each replicate */
+	long int * rep_years, * rep_fires, * rep_cells;
+	/*! seed of the root random number stream, replicate rep draws from child stream rep of the root */
+	long int seed;
+#ifdef USING_UNIX
+	/*! serializes aggregation of years by replicates running concurrently */
+	pthread_mutex_t lock;
+#endif
+	};
+
+/*
+ *********************************************************
+ * MACROS
+ *********************************************************
+ */
+
+/*
+ *********************************************************
+ * PUBLIC FUNCTIONS
+ *********************************************************
+ */
+
+/*! \fn Ensemble * InitEnsemble(int num_replicates, const char * dir)
+ * 	\brief Initializes an Ensemble of replicates writing output under dir.
+ *
+ *	The directory is created if it does not exist.
+ * 	\param num_replicates number of replicates, from 1 to ENSEMBLE_MAX_REPLICATES
+ * 	\param dir directory of ensemble output
+ * 	\retval Ensemble* Ptr to Ensemble, or NULL if unable to initialize
+ */
+Ensemble * InitEnsemble(int num_replicates, const char * dir);
+
+/*! \fn EnsembleReplicate * InitEnsembleReplicate(Ensemble * ens, ChHashTable * proptbl, int rep)
+ * 	\brief Initializes the properties of replicate rep of the Ensemble.
+ *
+ *	Export properties which are not NULL are redirected to the directory rep%04d of the ensemble,
+ *	which is created if it does not exist.  Directories are replaced by the replicate directory and
+ *	files are written to the replicate directory under the same name.  The random numbers of a
+ *	replicate are not set by its properties, they are drawn from child stream rep of the root
+ *	stream of the ensemble, so any replicate is reproduced from the seed and rep alone.
+ * 	\param ens Ensemble
+ * 	\param proptbl simulation properties read from file, not modified
+ * 	\param rep index of replicate, from 0
+ * 	\retval EnsembleReplicate* Ptr to EnsembleReplicate, or NULL if unable to initialize
+ */
+EnsembleReplicate * InitEnsembleReplicate(Ensemble * ens, ChHashTable * proptbl, int rep);
+
+/*! \fn int EnsembleAddFireYear(Ensemble * ens, int rep, FireYear * fy)
+ * 	\brief Aggregates the fires of a year of replicate rep.
+ *
+ *	Cells burned by fires which are not failed ignitions are counted toward burn probability and
+ *	each such fire is counted toward the fire size distribution.  Call once a year after failed
+ *	ignitions are set and before the FireYear is reset.  May be called by replicates running
+ *	concurrently, each with its own FireYear.
+ * 	\param ens Ensemble
+ * 	\param rep index of replicate, from 0
+ * 	\param fy FireYear at end of year
+ *	\retval int ERR_SUCCESS(0) if successful, an error code otherwise
+ */
+int EnsembleAddFireYear(Ensemble * ens, int rep, FireYear * fy);
+
+/*! \fn int EnsembleExport(Ensemble * ens)
+ * 	\brief Writes the statistics aggregated over every replicate to the ensemble directory.
+ *
+ *	Burn probability is the fraction of replicate years in which a cell burned, written as an
+ *	ascii raster.  The fire size distribution lists the number of fires and the fraction of fires
+ *	at least as large as each size class.  The summary lists the root seed, years, fires, and cells
+ *	burned of each replicate.
+ * 	\param ens Ensemble
+ *	\retval int ERR_SUCCESS(0) if successful, an error code otherwise
+ */
+int EnsembleExport(Ensemble * ens);
+
+/*! \fn void FreeEnsembleReplicate(void * vptr)
+ * 	\brief Frees memory associated with EnsembleReplicate structure.
+ *
+ *	\sa EnsembleReplicate
+ * 	\param vptr ptr to EnsembleReplicate
+ */
+void FreeEnsembleReplicate(void * vptr);
+
+/*! \fn void FreeEnsemble(void * vptr)
+ * 	\brief Frees memory associated with Ensemble structure.
+ *
+ *	\sa Ensemble
+ * 	\param vptr ptr to Ensemble
+ */
+void FreeEnsemble(void * vptr);
+
+#endif Ensemble_H		/* end of Ensemble.h */
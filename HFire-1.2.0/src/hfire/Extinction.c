@@ -30,13 +30,13 @@
  *********************************************************
  */
 
-int IsExtinguishedROS(ChHashTable * proptbl, double mpsros);
+static int IsExtinguishedROS(const SimConfig * cfg, double mpsros);
 
-int IsExtinguishedHOURS(ChHashTable * proptbl, unsigned char hours);
+static int IsExtinguishedHOURS(const SimConfig * cfg, int hours);
 
 /*
  * Visibility:
- * global
+ * local
  *
  * Description:
  * Tests whether the rate of spread supplied as an argument is less than the extinction threshold.
@@ -45,40 +45,15 @@ int IsExtinguishedHOURS(ChHashTable * proptbl, unsigned char hours);
  * greater or equal, then this method returns 0.
  *
  * Arguments:
- * proptbl- HashTable of simulation properties
+ * cfg- SimConfig of current simulation
  * mpsros- rate of spread, in meters per second, being tested
  *
  * Returns:
  * Returns 1 (true) if mpsros less than threshold, or 0 (false) otherwise.
  */	
-int IsExtinguishedROS(ChHashTable * proptbl, double mpsros)		{
-	/* static variables used to store state across function calls */
-	static int ext_ros_enabled	= -1;
-	static double ext_mpsros 	= -1.0;
-	/* stack variables */
-	KeyVal * entry	= NULL;									/* key/val entries from table */
-	
-	/* check args */
-	if ( proptbl == NULL || ext_ros_enabled == 0 )	{
-		return 0;
-		}
-	/* determine if extinction threshold enabled, only done once */
-	if ( ext_ros_enabled == -1 )	{
-		if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_FEXROS), (void *)&entry) )	{
-			ERR_ERROR_CONTINUE("Unable to retrieve FIRE_EXTINCTION_ROS_MPS property. \n", ERR_EINVAL);
-			ext_ros_enabled = 0;
-			return 0;
-			}
-		if ( strcmp(entry->val, GetFireVal(VAL_NULL)) == 0)	{
-			/* disable extinction via this mechanism */
-			ext_ros_enabled = 0;
-			return 0;
-			}
-		ext_ros_enabled = 1;
-		ext_mpsros = atof(entry->val);
-		}
+static int IsExtinguishedROS(const SimConfig * cfg, double mpsros)		{
 	/* test if extinction occurs */
-	if ( mpsros < ext_mpsros )	{
+	if ( cfg->ext_ros_enabled && mpsros < cfg->ext_ros_mps )	{
 		return 1;
 		}
 		
@@ -87,7 +62,7 @@ int IsExtinguishedROS(ChHashTable * proptbl, double mpsros)		{
 
 /*
  * Visibility:
- * global
+ * local
  *
  * Description:
  * Tests whether the hours supplied as an argument are greater than or equal to the extinction
@@ -96,160 +71,104 @@ int IsExtinguishedROS(ChHashTable * proptbl, double mpsros)		{
  * than the threshold, then this method returns 0.
  *
  * Arguments:
- * proptbl- HashTable of simulation properties
+ * cfg- SimConfig of current simulation
  * hours- hours being tested
  *
  * Returns:
  * Returns 1 (true) if hours greater than or equal to threshold, or 0 (false) otherwise.
  */	
-int IsExtinguishedHOURS(ChHashTable * proptbl, unsigned char hours)	{
-	/* static variables used to store state across function calls */
-	static int ext_hrs_enabled		= -1;
-	static int ext_hrs 				= -1;
-	/* stack variables */
-	KeyVal * entry	= NULL;									/* key/val entries from table */
-	
-	/* check args */
-	if ( proptbl == NULL || ext_hrs_enabled == 0 )	{
-		return 0;
-		}
-	/* determine if extinction threshold enabled, only done once */
-	if ( ext_hrs_enabled == -1 )	{
-		if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_FEXHR), (void *)&entry) )	{
-			ERR_ERROR_CONTINUE("Unable to retrieve FIRE_EXTINCTION_HOURS property. \n", ERR_EINVAL);
-			ext_hrs_enabled = 0;
-			return 0;
-			}
-		if ( strcmp(entry->val, GetFireVal(VAL_NULL)) == 0)	{
-			/* disable extinction via this mechanism */
-			ext_hrs_enabled = 0;
-			return 0;
-			}
-		ext_hrs_enabled = 1;
-		ext_hrs = atoi(entry->val);
-		}
+static int IsExtinguishedHOURS(const SimConfig * cfg, int hours)	{
 	/* test if extinction occurs */
-	if ( (int)hours >= ext_hrs )	{
+	if ( cfg->ext_hrs_enabled && hours >= cfg->ext_hrs )	{
 		return 1;
 		}
 
 	return 0;	
 	}
 
-int UpdateExtinctionHOURS(ChHashTable * proptbl, int month, int day, int hour, CellState * cs, ByteTwoDArray * hrs_brn){
-	/* static variables used to store state across function calls */
-	static EnumExtinctionType ext_type 	= EnumExtinctionUnknown;
-	static int smonth 					= 0;
-	static int sday 					= 0;
-	static int shour 					= 0;
+ExtinctionState * InitExtinctionState()	{
+	ExtinctionState * st = NULL;
+
+	if ( (st = (ExtinctionState *) calloc(1, sizeof(ExtinctionState))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to allocate memory for ExtinctionState. \n", ERR_ENOMEM);
+		return st;
+		}
+
+	return st;
+	}
+
+int UpdateExtinctionHOURS(ExtinctionState * st, const SimConfig * cfg, int month, int day, int hour, CellState * cs, BurnFront * bf){
 	/* stack variables */
-	KeyVal * entry	= NULL;									/* key/val entries from table */
-	int domain_rows, domain_cols;
-	int i,j;
+	int idx, i, j;
 	
 	/* check args */
-	if ( proptbl == NULL || cs == NULL || hrs_brn == NULL )		{
+	if ( cfg == NULL || cs == NULL || bf == NULL )		{
 		ERR_ERROR("Unable to update extinction using hours criteria. \n", ERR_EINVAL);
 		}
 
-	/* set extinction type, only done once */
-	if ( ext_type == EnumExtinctionUnknown )	{
-		if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_FEXTYP), (void *)&entry) )	{
-			ERR_ERROR("Unable to retrieve FIRE_EXTINCTION_TYPE property. \n", ERR_EINVAL);
-			}
-		if ( strcmp(entry->val, GetFireVal(VAL_CONS)) == 0)	{
-			ext_type = EnumExtinctionConsume;
-			}
-		else if ( strcmp(entry->val, GetFireVal(VAL_REIG)) == 0)	{
-			ext_type = EnumExtinctionReignite;
-			}
-		else	{
-			ERR_ERROR("Unrecognized FIRE_EXTINCTION_TYPE property. \n", ERR_EINVAL);
-			}
-		}
-
 	/* determine if at least one hour has passed since last call to this function */
-	if ( (smonth != month) || (sday != day) || (shour != hour) )	{
-		/* get domain dimensions */
-		domain_rows = BYTETWODARRAY_SIZE_ROW(cs->state);
-		domain_cols = BYTETWODARRAY_SIZE_COL(cs->state);
-	
-		/* increment extinction clock */
-		for(i = 0; i < domain_rows; i++)	{
-			for(j = 0; j < domain_cols; j++)	{
-				if ( BYTETWODARRAY_GET_DATA(cs->state, i, j) == EnumHasFireCellState )	{ 
-					/* increment the hrs_brned */
-					BYTETWODARRAY_SET_DATA(hrs_brn, i, j, (BYTETWODARRAY_GET_DATA(hrs_brn, i, j) + 1));
-					/* extinguish the cell if necessary */
-					if ( IsExtinguishedHOURS(proptbl, BYTETWODARRAY_GET_DATA(hrs_brn, i, j)) )	{
-						BYTETWODARRAY_SET_DATA(hrs_brn, i, j, 0);
-						switch(ext_type)	{
-							case EnumExtinctionConsume:
-								/* cell cannot burn again this year */
-								BYTETWODARRAY_SET_DATA(cs->state, i, j, EnumUnBurnableCellState);
-								break;
-							case EnumExtinctionReignite:
-								/* cell can burn again this year */
-								BYTETWODARRAY_SET_DATA(cs->state, i, j, EnumNoFireCellState);
-								break;
-							default:
-								ERR_ERROR("Unable to determine FIRE_EXTINCTION_TYPE property. \n", ERR_ESANITY);
-								break;
-							}
+	if ( (st->month != month) || (st->day != day) || (st->hour != hour) )	{
+		/* increment extinction clock of every burning cell */
+		for(idx = 0; idx < BURN_FRONT_SIZE(bf); idx++)	{
+			if ( BURN_FRONT_IS_REMOVED(bf, idx) )	{
+				continue;
+				}
+			i = bf->i[idx];
+			j = bf->j[idx];
+			/* a cell ignited more than once is only counted at its latest ignition */
+			if ( BURN_FRONT_INDEX_AT(bf, i, j) != idx )	{
+				continue;
+				}
+			if ( CELL_STATE_GET_DATA(cs, i, j) == EnumHasFireCellState )	{ 
+				/* increment the hours burning */
+				CELL_PLANE_INCR_HOURS(cs->plane, i, j);
+				/* extinguish the cell if necessary */
+				if ( IsExtinguishedHOURS(cfg, CELL_PLANE_GET_HOURS(cs->plane, i, j)) )	{
+					CELL_PLANE_CLEAR_HOURS(cs->plane, i, j);
+					switch(cfg->ext_type)	{
+						case EnumExtinctionConsume:
+							/* cell cannot burn again this year */
+							CELL_STATE_SET_DATA(cs, i, j, EnumUnBurnableCellState);
+							break;
+						case EnumExtinctionReignite:
+							/* cell can burn again this year */
+							CELL_STATE_SET_DATA(cs, i, j, EnumNoFireCellState);
+							break;
+						default:
+							ERR_ERROR("Unable to determine FIRE_EXTINCTION_TYPE property. \n", ERR_ESANITY);
+							break;
 						}
 					}
 				}
 			}
 	
 		/* set {month, day, hour} for future calls */
-		smonth = month;
-		sday = day;
-		shour = hour;
+		st->month = month;
+		st->day = day;
+		st->hour = hour;
 		}
 		
 	return ERR_SUCCESS;				
 	}
 
-int UpdateExtinctionROS(ChHashTable * proptbl, int i, int j, double mpsros, CellState * cs, ByteTwoDArray * hrs_brn){
-	/* static variables used to store state across function calls */
-	static EnumExtinctionType ext_type 	= EnumExtinctionUnknown;
-	/* stack variables */
-	KeyVal * entry	= NULL;									/* key/val entries from table */
-	
+int UpdateExtinctionROS(const SimConfig * cfg, int i, int j, double mpsros, CellState * cs){
 	/* check args */
-	if ( proptbl == NULL || cs == NULL || hrs_brn == NULL )		{
+	if ( cfg == NULL || cs == NULL )		{
 		ERR_ERROR_CONTINUE("Unable to update extinction using hours criteria. \n", ERR_EINVAL);
 		return 0;
 		}
 
-	/* set extinction type, only done once */
-	if ( ext_type == EnumExtinctionUnknown )	{
-		if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_FEXTYP), (void *)&entry) )	{
-			ERR_ERROR_CONTINUE("Unable to retrieve FIRE_EXTINCTION_TYPE property. \n", ERR_EINVAL);
-			}
-		if ( strcmp(entry->val, GetFireVal(VAL_CONS)) == 0)	{
-			ext_type = EnumExtinctionConsume;
-			}
-		else if ( strcmp(entry->val, GetFireVal(VAL_REIG)) == 0)	{
-			ext_type = EnumExtinctionReignite;
-			}
-		else	{
-			ERR_ERROR_CONTINUE("Unrecognized FIRE_EXTINCTION_TYPE property. \n", ERR_EINVAL);
-			return 0;
-			}
-		}
-
 	/* extinguish the cell */
-	if ( IsExtinguishedROS(proptbl, mpsros) )	{
-		BYTETWODARRAY_SET_DATA(hrs_brn, i, j, 0);
-		switch(ext_type)	{
+	if ( IsExtinguishedROS(cfg, mpsros) )	{
+		CELL_PLANE_CLEAR_HOURS(cs->plane, i, j);
+		switch(cfg->ext_type)	{
 			case EnumExtinctionConsume:
 				/* cell cannot burn again this year */
-				BYTETWODARRAY_SET_DATA(cs->state, i, j, EnumUnBurnableCellState);
+				CELL_STATE_SET_DATA(cs, i, j, EnumUnBurnableCellState);
 				break;
 			case EnumExtinctionReignite:
 				/* cell can burn again this year */
-				BYTETWODARRAY_SET_DATA(cs->state, i, j, EnumNoFireCellState);
+				CELL_STATE_SET_DATA(cs, i, j, EnumNoFireCellState);
 				break;
 			default:
 				ERR_ERROR_CONTINUE("Unable to determine FIRE_EXTINCTION_TYPE property. \n", ERR_ESANITY);
@@ -261,4 +180,16 @@ int UpdateExtinctionROS(ChHashTable * proptbl, int i, int j, double mpsros, Cell
 	return 0;							
 	}
 	 
+void FreeExtinctionState(void * vptr)	{
+	ExtinctionState * st = NULL;
+
+	if ( vptr != NULL )	{
+		st = (ExtinctionState *) vptr;
+		free(st);
+		}
+	st = NULL;
+
+	return;
+	}
+
 /* end of Extinction.c */
@@ -32,8 +32,10 @@
 
 #include "FireProp.h"
 #include "CellState.h"
+#include "BurnFront.h"
 #include "ByteTwoDArray.h"
 #include "FltTwoDArray.h"
+#include "SimConfig.h"
 #include "Err.h"
 #include "ChHashTable.h"
 #include "KeyVal.h"
@@ -43,16 +45,6 @@
  * DEFINES, ENUMS
  *********************************************************
  */
-
-#ifndef DOXYGEN_SHOULD_SKIP_THIS
-
-enum EnumExtinctionType_	{
-	EnumExtinctionUnknown	= 0,
-	EnumExtinctionConsume	= 1,
-	EnumExtinctionReignite	= 2
-	};
- 
-#endif /* DOXYGEN_SHOULD_SKIP_THIS */
  
 /*
  *********************************************************
@@ -60,11 +52,23 @@ enum EnumExtinctionType_	{
  *********************************************************
  */
 
-#ifndef DOXYGEN_SHOULD_SKIP_THIS
-
-typedef enum EnumExtinctionType_ EnumExtinctionType;
+/*! Type name for ExtinctionState_
+ *	\sa For a list of members goto ExtinctionState_
+ */
+typedef struct ExtinctionState_ ExtinctionState;
 
-#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+/*!	\struct ExtinctionState_ Extinction.h "Extinction.h"
+ *	\brief date of the last update of extinction by hours burning
+ *	Stored by FireEnv in place of function statics so each simulation owns its state.
+ */
+struct ExtinctionState_	{
+	/*! month of the last call */
+	int month;
+	/*! day of the last call */
+	int day;
+	/*! hour of the last call */
+	int hour;
+	};
 
 /*
  *********************************************************
@@ -78,15 +82,34 @@ typedef enum EnumExtinctionType_ EnumExtinctionType;
  *********************************************************
  */
 
-/*! \fn int UpdateExtinctionHOURS(ChHashTable * proptbl, int month, int day, int hour, CellState * cs, ByteTwoDArray * hrs_brn)
- *	\brief Extinguishes cell  if it has been ignited for longer than threshold in simulation properties table
+/*! \fn ExtinctionState * InitExtinctionState()
+ *	\brief Initializes the extinction state of a simulation.
+ *
+ *	\sa ExtinctionState
+ *	\retval ExtinctionState* Ptr to initialized ExtinctionState, or NULL if unable to allocate
+ */
+ExtinctionState * InitExtinctionState();
+
+/*! \fn void FreeExtinctionState(void * vptr)
+ *	\brief Frees memory associated with ExtinctionState structure.
+ *
+ *	\sa ExtinctionState
+ *	\param vptr ptr to ExtinctionState
+ */
+void FreeExtinctionState(void * vptr);
+
+/*! \fn int UpdateExtinctionHOURS(ExtinctionState * st, const SimConfig * cfg, int month, int day, int hour, CellState * cs, BurnFront * bf)
+ *	\brief Extinguishes cell  if it has been ignited for longer than threshold in simulation configuration
+ *	Only the cells in the front of burning cells are visited, so the cost is proportional to the number of
+ *	burning cells rather than the size of the domain.
  *	\sa Check the \htmlonly <a href="config_file_doc.html#FIRE_EXTINCTION">config file documentation</a> \endhtmlonly
- *	\param proptbl ChHashTable of current simulation properties
+ *	\param st ExtinctionState storing the date of the last update
+ *	\param cfg SimConfig of current simulation
  *	\param month current simulation month, 1-based index
  *	\param day current simulation day, 1-based index
  *	\param hour current simulation hour, 0000-2400 
- *	\param cs simulation CellState
- *	\param hrs_brn two-dimensional array storing number of hours cell has been ignited
+ *	\param cs simulation CellState, storing number of hours each cell has been ignited
+ *	\param bf front of burning cells
  *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
  *	\note Best use of this facility is as follows:
  *	\code	
@@ -95,17 +118,16 @@ typedef enum EnumExtinctionType_ EnumExtinctionType;
  *				// something bad happened
  *	\endcode
  */
-int UpdateExtinctionHOURS(ChHashTable * proptbl, int month, int day, int hour, CellState * cs, ByteTwoDArray * hrs_brn);
+int UpdateExtinctionHOURS(ExtinctionState * st, const SimConfig * cfg, int month, int day, int hour, CellState * cs, BurnFront * bf);
 
-/*! \fn int UpdateExtinctionROS(ChHashTable * proptbl, int i, int j, double mpsros, CellState * cs, ByteTwoDArray * hrs_brn)
- *	\brief Extinguishes cell if rate of spread below threshold in simulation properties table
+/*! \fn int UpdateExtinctionROS(const SimConfig * cfg, int i, int j, double mpsros, CellState * cs)
+ *	\brief Extinguishes cell if rate of spread below threshold in simulation configuration
  *	\sa Check the \htmlonly <a href="config_file_doc.html#FIRE_EXTINCTION">config file documentation</a> \endhtmlonly
- *	\param proptbl ChHashTable of current simulation properties
+ *	\param cfg SimConfig of current simulation
  *	\param i array row index of cell
  *	\param j array column index of cell
  *	\param mpsros rate of spread in meters per second of cell at i,j
- *	\param cs simulation CellState
- *	\param hrs_brn two-dimensional array storing number of hours cell has been ignited
+ *	\param cs simulation CellState, storing number of hours each cell has been ignited
  *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
  *	\note Best use of this facility is as follows:
  *	\code	
@@ -114,6 +136,6 @@ int UpdateExtinctionHOURS(ChHashTable * proptbl, int month, int day, int hour, C
  *				// something bad happened
  *	\endcode
  */
-int UpdateExtinctionROS(ChHashTable * proptbl, int i, int j, double mpsros, CellState * cs, ByteTwoDArray * hrs_brn);
+int UpdateExtinctionROS(const SimConfig * cfg, int i, int j, double mpsros, CellState * cs);
   
 #endif Extinction_H		/* end of Extinction.h */
@@ -23,6 +23,10 @@
  */
 
 #include "FireConfig.h"
+
+static int GetIntPropFireConfig(ChHashTable * proptbl, EnumFireProp prop, int min, int max, int * val);
+static int GetDoublePropFireConfig(ChHashTable * proptbl, EnumFireProp prop, double min, double * val);
+static int IsNullPropFireConfig(ChHashTable * proptbl, EnumFireProp prop, int * is_null);
 			
 int InitPropsFromFireConfig(ChHashTable ** proptbl, char * cfg_fname)	{
 	FILE * fstream 	= NULL;
@@ -60,19 +64,316 @@ int InitPropsFromFireConfig(ChHashTable ** proptbl, char * cfg_fname)	{
 	return ERR_SUCCESS;
 	}
 
-int InitGridsFromPropsFireConfig(ChHashTable * proptbl, GridData ** elev, GridData ** slope, GridData ** aspect)	{
-	if ( proptbl == NULL )	{
+int InitSimConfigFromPropsFireConfig(ChHashTable * proptbl, SimConfig ** cfg)	{
+	KeyVal * entry	= NULL;
+	int is_null;
+	EnumFireProp step_props[4];
+	double * steps[4];
+	int i;
+	
+	/* check args */
+	if ( proptbl == NULL || cfg == NULL )	{
+		ERR_ERROR("Unable to initialize SimConfig from properties HashTable. \n", ERR_EINVAL);
+		}
+	if ( (*cfg = InitSimConfig()) == NULL )	{
+		ERR_ERROR("Unable to initialize SimConfig. \n", ERR_EFAILED);
+		}
+
+	/* simulation start and end */
+	if ( GetIntPropFireConfig(proptbl, PROP_SIMSTYR, 0, INT_MAX, &(*cfg)->start_yr)
+			|| GetIntPropFireConfig(proptbl, PROP_SIMSTMO, FIRE_TIMER_MIN_MO_YEAR, FIRE_TIMER_MAX_MO_YEAR, &(*cfg)->start_mo)
+			|| GetIntPropFireConfig(proptbl, PROP_SIMSTDY, 1, 31, &(*cfg)->start_dy)
+			|| GetIntPropFireConfig(proptbl, PROP_SIMSTHR, FIRE_TIMER_MIN_HOUR_DAY, FIRE_TIMER_MAX_HOUR_DAY, &(*cfg)->start_hr)
+			|| GetIntPropFireConfig(proptbl, PROP_SIMEDYR, (*cfg)->start_yr, INT_MAX, &(*cfg)->end_yr)
+			|| GetIntPropFireConfig(proptbl, PROP_SIMEDMO, FIRE_TIMER_MIN_MO_YEAR, FIRE_TIMER_MAX_MO_YEAR, &(*cfg)->end_mo)
+			|| GetIntPropFireConfig(proptbl, PROP_SIMEDDY, 1, 31, &(*cfg)->end_dy)
+			|| GetIntPropFireConfig(proptbl, PROP_SIMEDHR, FIRE_TIMER_MIN_HOUR_DAY, FIRE_TIMER_MAX_HOUR_DAY, &(*cfg)->end_hr)
+			|| GetIntPropFireConfig(proptbl, PROP_SIMTSSEC, 1, INT_MAX, &(*cfg)->timestep_secs) )	{
+		FreeSimConfig(*cfg);
+		*cfg = NULL;
+		ERR_ERROR("Unable to set simulation start, end, and timestep. \n", ERR_EINVAL);
+		}
+
+	/* spread engine, NULL implies sweep */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SIMENGINE), (void *)&entry) 
+			|| strcmp(entry->val, GetFireVal(VAL_NULL)) == 0 
+			|| strcmp(entry->val, GetFireVal(VAL_SWEEP)) == 0 )	{
+		(*cfg)->spread_engine = EnumSpreadEngineSweep;
+		}
+	else if ( strcmp(entry->val, GetFireVal(VAL_EVENT)) == 0 )	{
+		(*cfg)->spread_engine = EnumSpreadEngineEvent;
+		}
+	else	{
+		FreeSimConfig(*cfg);
+		*cfg = NULL;
+		ERR_ERROR("SIMULATION_SPREAD_ENGINE property must be SWEEP, EVENT, or NULL. \n", ERR_EINVAL);
+		}
+
+	/* scope of adaptive timestep, NULL implies global */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SIMADAPT), (void *)&entry) 
+			|| strcmp(entry->val, GetFireVal(VAL_NULL)) == 0 
+			|| strcmp(entry->val, GetFireVal(VAL_GLOBAL)) == 0 )	{
+		(*cfg)->adaptive_timestep = EnumAdaptiveTimestepGlobal;
+		}
+	else if ( strcmp(entry->val, GetFireVal(VAL_FIRE)) == 0 )	{
+		(*cfg)->adaptive_timestep = EnumAdaptiveTimestepFire;
+		}
+	else	{
+		FreeSimConfig(*cfg);
+		*cfg = NULL;
+		ERR_ERROR("SIMULATION_ADAPTIVE_TIMESTEP property must be GLOBAL, FIRE, or NULL. \n", ERR_EINVAL);
+		}
+
+	/* fire ellipse adjustment factor, NULL implies zero and the length to width ratio is not adjusted for wind */
+	if ( IsNullPropFireConfig(proptbl, PROP_FEAF, &is_null)
+			|| (!is_null && GetDoublePropFireConfig(proptbl, PROP_FEAF, 0.0, &(*cfg)->ell_adj)) )	{
+		FreeSimConfig(*cfg);
+		*cfg = NULL;
+		ERR_ERROR("Unable to set FIRE_ELLIPSE_ADJUSTMENT_FACTOR property. \n", ERR_EINVAL);
+		}
+
+	/* windspeed adjustment factor, NULL implies AB79 */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_WSPWAF), (void *)&entry) )	{
+		FreeSimConfig(*cfg);
+		*cfg = NULL;
+		ERR_ERROR("Unable to retrieve WIND_SPEED_WIND_ADJUSTMENT_FACTOR property. \n", ERR_EFAILED);
+		}
+	if ( strcmp(entry->val, GetFireVal(VAL_NULL)) == 0 || strcmp(entry->val, GetFireVal(VAL_AB79)) == 0 )	{
+		(*cfg)->wsp_waf = EnumWindAdjustAB79;
+		}
+	else if ( strcmp(entry->val, GetFireVal(VAL_BHP)) == 0 )	{
+		(*cfg)->wsp_waf = EnumWindAdjustBHP;
+		}
+	else if ( strcmp(entry->val, GetFireVal(VAL_NOWAF)) == 0 )	{
+		(*cfg)->wsp_waf = EnumWindAdjustNone;
+		}
+	else	{
+		FreeSimConfig(*cfg);
+		*cfg = NULL;
+		ERR_ERROR("WIND_SPEED_WIND_ADJUSTMENT_FACTOR property must be AB79, BHP, NOWAF, or NULL. \n", ERR_EINVAL);
+		}
+
+	/* increments of 10 hour to 1 and 100 hour dead fuel moisture in percent, NULL implies no increment */
+	if ( IsNullPropFireConfig(proptbl, PROP_DFMD1HINC, &is_null)
+			|| (!is_null && GetDoublePropFireConfig(proptbl, PROP_DFMD1HINC, 0.0, &(*cfg)->dfm_d1h_inc)) )	{
+		FreeSimConfig(*cfg);
+		*cfg = NULL;
+		ERR_ERROR("Unable to set DEAD_FUEL_MOIST_D1H_INCREMENT property. \n", ERR_EINVAL);
+		}
+	if ( IsNullPropFireConfig(proptbl, PROP_DFMD100HINC, &is_null)
+			|| (!is_null && GetDoublePropFireConfig(proptbl, PROP_DFMD100HINC, 0.0, &(*cfg)->dfm_d100h_inc)) )	{
+		FreeSimConfig(*cfg);
+		*cfg = NULL;
+		ERR_ERROR("Unable to set DEAD_FUEL_MOIST_D100H_INCREMENT property. \n", ERR_EINVAL);
+		}
+	(*cfg)->dfm_d1h_inc /= 100.0;
+	(*cfg)->dfm_d100h_inc /= 100.0;
+
+	/* extinction type is required */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_FEXTYP), (void *)&entry) )	{
+		FreeSimConfig(*cfg);
+		*cfg = NULL;
+		ERR_ERROR("Unable to retrieve FIRE_EXTINCTION_TYPE property. \n", ERR_EFAILED);
+		}
+	if ( strcmp(entry->val, GetFireVal(VAL_CONS)) == 0 )	{
+		(*cfg)->ext_type = EnumExtinctionConsume;
+		}
+	else if ( strcmp(entry->val, GetFireVal(VAL_REIG)) == 0 )	{
+		(*cfg)->ext_type = EnumExtinctionReignite;
+		}
+	else	{
+		FreeSimConfig(*cfg);
+		*cfg = NULL;
+		ERR_ERROR("FIRE_EXTINCTION_TYPE property must be CONSUME or REIGNITE. \n", ERR_EINVAL);
+		}
+
+	/* extinction thresholds, NULL disables the mechanism */
+	if ( IsNullPropFireConfig(proptbl, PROP_FEXROS, &is_null)
+			|| (!is_null && GetDoublePropFireConfig(proptbl, PROP_FEXROS, 0.0, &(*cfg)->ext_ros_mps)) )	{
+		FreeSimConfig(*cfg);
+		*cfg = NULL;
+		ERR_ERROR("Unable to set FIRE_EXTINCTION_ROS_MPS property. \n", ERR_EINVAL);
+		}
+	(*cfg)->ext_ros_enabled = !is_null;
+	if ( IsNullPropFireConfig(proptbl, PROP_FEXHR, &is_null)
+			|| (!is_null && GetIntPropFireConfig(proptbl, PROP_FEXHR, 0, CELL_PLANE_HOURS_MAX, &(*cfg)->ext_hrs)) )	{
+		FreeSimConfig(*cfg);
+		*cfg = NULL;
+		ERR_ERROR("Unable to set FIRE_EXTINCTION_HOURS property. \n", ERR_EINVAL);
+		}
+	(*cfg)->ext_hrs_enabled = !is_null;
+
+	/* ignition type is required, frequency only applies to random ignitions */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_IGTYP), (void *)&entry) )	{
+		FreeSimConfig(*cfg);
+		*cfg = NULL;
+		ERR_ERROR("Unable to retrieve IGNITION_TYPE property. \n", ERR_EFAILED);
+		}
+	if ( strcmp(entry->val, GetFireVal(VAL_FIXED)) == 0 )	{
+		(*cfg)->ig_type = EnumIgnitionFixed;
+		}
+	else if ( strcmp(entry->val, GetFireVal(VAL_RANDU)) == 0 )	{
+		(*cfg)->ig_type = EnumIgnitionRandU;
+		}
+	else if ( strcmp(entry->val, GetFireVal(VAL_RANDS)) == 0 )	{
+		(*cfg)->ig_type = EnumIgnitionRandS;
+		}
+	else	{
+		FreeSimConfig(*cfg);
+		*cfg = NULL;
+		ERR_ERROR("IGNITION_TYPE property must be FIXED, RANDOM_UNIFORM, or RANDOM_SPATIAL. \n", ERR_EINVAL);
+		}
+	if ( (*cfg)->ig_type != EnumIgnitionFixed
+			&& GetDoublePropFireConfig(proptbl, PROP_IGFREQYR, 0.0, &(*cfg)->ig_freq_yr) )	{
+		FreeSimConfig(*cfg);
+		*cfg = NULL;
+		ERR_ERROR("Unable to set IGNITION_FREQUENCY_PER_YEAR property. \n", ERR_EINVAL);
+		}
+
+	/* fixed stand age and fuel model only apply to the FIXED types */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SAGETYP), (void *)&entry) )	{
+		FreeSimConfig(*cfg);
+		*cfg = NULL;
+		ERR_ERROR("Unable to retrieve STAND_AGE_TYPE property. \n", ERR_EFAILED);
+		}
+	if ( strcmp(entry->val, GetFireVal(VAL_FIXED)) == 0
+			&& GetIntPropFireConfig(proptbl, PROP_SAGEFIX, 0, INT_MAX, &(*cfg)->std_age_fixed) )	{
+		FreeSimConfig(*cfg);
+		*cfg = NULL;
+		ERR_ERROR("Unable to set STAND_AGE_FIXED_AGE property. \n", ERR_EINVAL);
+		}
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_RGRTYP), (void *)&entry) )	{
+		FreeSimConfig(*cfg);
+		*cfg = NULL;
+		ERR_ERROR("Unable to retrieve FUELS_REGROWTH_TYPE property. \n", ERR_EFAILED);
+		}
+	if ( strcmp(entry->val, GetFireVal(VAL_FIXED)) == 0
+			&& GetIntPropFireConfig(proptbl, PROP_FIXFNUM, 0, INT_MAX, &(*cfg)->fuels_fixed_num) )	{
+		FreeSimConfig(*cfg);
+		*cfg = NULL;
+		ERR_ERROR("Unable to set FUELS_FIXED_MODEL_NUM property. \n", ERR_EINVAL);
+		}
+
+	/* Santa Ana frequency, NULL implies no Santa Ana events */
+	if ( IsNullPropFireConfig(proptbl, PROP_SANAFREQ, &is_null)
+			|| (!is_null && GetDoublePropFireConfig(proptbl, PROP_SANAFREQ, 0.0, &(*cfg)->sa_freq_yr)) )	{
+		FreeSimConfig(*cfg);
+		*cfg = NULL;
+		ERR_ERROR("Unable to set SANTA_ANA_FREQUENCY_PER_YEAR property. \n", ERR_EINVAL);
+		}
+	/* Santa Ana duration only required when events occur */
+	if ( UNITS_FP_GT_ZERO((*cfg)->sa_freq_yr) 
+			&& GetIntPropFireConfig(proptbl, PROP_SANANUMD, 1, INT_MAX, &(*cfg)->sa_num_days) )	{
+		FreeSimConfig(*cfg);
+		*cfg = NULL;
+		ERR_ERROR("Unable to set SANTA_ANA_NUM_DAYS_DURATION property. \n", ERR_EINVAL);
+		}
+
+	/* random number seed, TABLE draws the seed from the seed table */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SIMRNGSD), (void *)&entry) )	{
+		FreeSimConfig(*cfg);
+		*cfg = NULL;
+		ERR_ERROR("Unable to retrieve SIMULATION_RAND_NUM_SEED property. \n", ERR_EFAILED);
+		}
+	(*cfg)->rng_seed_table = ( strcmp(entry->val, GetFireVal(VAL_TABLE)) == 0 );
+	if ( !(*cfg)->rng_seed_table && GetIntPropFireConfig(proptbl, PROP_SIMRNGSD, INT_MIN, INT_MAX, &(*cfg)->rng_seed) )	{
+		FreeSimConfig(*cfg);
+		*cfg = NULL;
+		ERR_ERROR("SIMULATION_RAND_NUM_SEED property must be an integer or TABLE. \n", ERR_EINVAL);
+		}
+
+	/* number of worker threads, NULL implies serial execution */
+	if ( IsNullPropFireConfig(proptbl, PROP_SIMNUMTHRD, &is_null)
+			|| (!is_null && GetIntPropFireConfig(proptbl, PROP_SIMNUMTHRD, 1, THREAD_POOL_MAX_WORKERS, &(*cfg)->num_threads)) )	{
+		FreeSimConfig(*cfg);
+		*cfg = NULL;
+		ERR_ERROR("Unable to set SIMULATION_NUM_THREADS property. \n", ERR_EINVAL);
+		}
+
+	/* memory of tiles held by each TILED raster, NULL implies the default */
+	if ( IsNullPropFireConfig(proptbl, PROP_RASTTILEMB, &is_null)
+			|| (!is_null && GetIntPropFireConfig(proptbl, PROP_RASTTILEMB, 1, INT_MAX, &(*cfg)->tile_cache_mb)) )	{
+		FreeSimConfig(*cfg);
+		*cfg = NULL;
+		ERR_ERROR("Unable to set RASTER_TILE_CACHE_MB property. \n", ERR_EINVAL);
+		}
+
+	/* rate of spread table, NULL implies direct calculation */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_ROSTBLTYP), (void *)&entry) )	{
+		FreeSimConfig(*cfg);
+		*cfg = NULL;
+		ERR_ERROR("Unable to retrieve ROS_TABLE_TYPE property. \n", ERR_EFAILED);
+		}
+	if ( strcmp(entry->val, GetFireVal(VAL_NULL)) == 0 )	{
+		(*cfg)->ros_tbl_type = EnumRosTableNone;
+		}
+	else if ( strcmp(entry->val, GetFireVal(VAL_LOOKUP)) == 0 )	{
+		(*cfg)->ros_tbl_type = EnumRosTableLookup;
+		}
+	else if ( strcmp(entry->val, GetFireVal(VAL_VALIDATE)) == 0 )	{
+		(*cfg)->ros_tbl_type = EnumRosTableValidate;
+		}
+	else	{
+		FreeSimConfig(*cfg);
+		*cfg = NULL;
+		ERR_ERROR("ROS_TABLE_TYPE property must be LOOKUP, VALIDATE, or NULL. \n", ERR_EINVAL);
+		}
+
+	/* size, quantization steps, and error bound of rate of spread table, NULL implies the default */
+	(*cfg)->ros_tbl_entries = ROTH_SPREAD_TABLE_DEFAULT_ENTRIES;
+	(*cfg)->ros_tbl_moist_step = ROTH_SPREAD_TABLE_DEFAULT_MOIST_STEP;
+	(*cfg)->ros_tbl_wsp_step = ROTH_SPREAD_TABLE_DEFAULT_WSP_STEP;
+	(*cfg)->ros_tbl_az_step = ROTH_SPREAD_TABLE_DEFAULT_AZ_STEP;
+	(*cfg)->ros_tbl_slp_step = ROTH_SPREAD_TABLE_DEFAULT_SLP_STEP;
+	(*cfg)->ros_tbl_max_rel_err = ROTH_SPREAD_TABLE_DEFAULT_MAX_REL_ERR;
+	if ( (*cfg)->ros_tbl_type != EnumRosTableNone )	{
+		if ( IsNullPropFireConfig(proptbl, PROP_ROSTBLSZ, &is_null)
+				|| (!is_null && GetIntPropFireConfig(proptbl, PROP_ROSTBLSZ, 1, INT_MAX, &(*cfg)->ros_tbl_entries)) )	{
+			FreeSimConfig(*cfg);
+			*cfg = NULL;
+			ERR_ERROR("Unable to set ROS_TABLE_ENTRIES_PER_FUEL_MODEL property. \n", ERR_EINVAL);
+			}
+		step_props[0] = PROP_ROSTBLMST;
+		steps[0] = &(*cfg)->ros_tbl_moist_step;
+		step_props[1] = PROP_ROSTBLWSP;
+		steps[1] = &(*cfg)->ros_tbl_wsp_step;
+		step_props[2] = PROP_ROSTBLAZ;
+		steps[2] = &(*cfg)->ros_tbl_az_step;
+		step_props[3] = PROP_ROSTBLSLP;
+		steps[3] = &(*cfg)->ros_tbl_slp_step;
+		for(i = 0; i < 4; i++)	{
+			if ( IsNullPropFireConfig(proptbl, step_props[i], &is_null)
+					|| (!is_null && (GetDoublePropFireConfig(proptbl, step_props[i], 0.0, steps[i]) 
+										|| !UNITS_FP_GT_ZERO(*steps[i]))) )	{
+				FreeSimConfig(*cfg);
+				*cfg = NULL;
+				ERR_ERROR("ROS_TABLE step property must be greater than zero. \n", ERR_ERANGE);
+				}
+			}
+		if ( IsNullPropFireConfig(proptbl, PROP_ROSTBLERR, &is_null)
+				|| (!is_null && GetDoublePropFireConfig(proptbl, PROP_ROSTBLERR, 0.0, &(*cfg)->ros_tbl_max_rel_err)) )	{
+			FreeSimConfig(*cfg);
+			*cfg = NULL;
+			ERR_ERROR("Unable to set ROS_TABLE_MAX_REL_ERROR property. \n", ERR_EINVAL);
+			}
+		}
+
+	return ERR_SUCCESS;
+	}
+
+int InitGridsFromPropsFireConfig(ChHashTable * proptbl, const SimConfig * cfg, GridData ** elev, GridData ** slope, GridData ** aspect)	{
+	if ( proptbl == NULL || cfg == NULL )	{
 		ERR_ERROR("Unable to initialize GridData with unitialized property Hash Table. \n", ERR_EINVAL);
 		}	
 
 	/* retrieve elev data */
-	*elev = GetGridDataFromPropsFireGridData(proptbl, FIRE_GRIDDATA_ELEV_DATA);
+	*elev = GetGridDataFromPropsFireGridData(proptbl, cfg, FIRE_GRIDDATA_ELEV_DATA);
 
 	/* retrieve slope data */
-	*slope = GetGridDataFromPropsFireGridData(proptbl, FIRE_GRIDDATA_SLOPE_DATA);
+	*slope = GetGridDataFromPropsFireGridData(proptbl, cfg, FIRE_GRIDDATA_SLOPE_DATA);
 	
 	/* retrieve aspect data */
-	*aspect = GetGridDataFromPropsFireGridData(proptbl, FIRE_GRIDDATA_ASPECT_DATA);
+	*aspect = GetGridDataFromPropsFireGridData(proptbl, cfg, FIRE_GRIDDATA_ASPECT_DATA);
 	
 	if ( *elev == NULL || *slope == NULL || *aspect == NULL )	{
 		ERR_ERROR("Unable to initialize one of the GridData structures specified in config file. \n", ERR_EFAILED);
@@ -85,65 +386,53 @@ int InitGridsFromPropsFireConfig(ChHashTable * proptbl, GridData ** elev, GridDa
 	return ERR_SUCCESS;									
 	}
 
-int InitFireTimerFromPropsFireConfig(ChHashTable * proptbl, FireTimer ** ft)	{
-	/* store values used to construct FireTimer: styr, stmo, stdy, sthr, edyr, edmo, eddy, edhr */
-	int styr, stmo, stdy, sthr, edyr, edmo, eddy, edhr;
+int InitTerrainDistFromPropsFireConfig(ChHashTable * proptbl, GridData * elev, TerrainDist ** td)	{
+	EnumTerrainDistType type;
 	KeyVal * entry	= NULL;	
-		
-	styr = stmo = stdy = sthr = edyr = edmo = eddy = edhr = 0;
 	
-	if ( proptbl == NULL )	{
-		ERR_ERROR("Unable to initialize FireTimer with uninitialized property Hash Table. \n", ERR_EINVAL);
+	/* check args */
+	if ( proptbl == NULL || elev == NULL || td == NULL )	{
+		ERR_ERROR("Unable to initialize TerrainDist from properties HashTable. \n", ERR_EINVAL);
 		}
+	*td = NULL;
 
-	/* simulation start properties */
-	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SIMSTYR), (void *)&entry) )	{
-		ERR_ERROR("Unable to retrieve simulation start year from property HashTable. \n", ERR_EFAILED);
+	/* retrieve precision of stored distances, NULL implies distances calculated as needed */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_TDCTYP), (void *)&entry) )	{
+		ERR_ERROR("Unable to retrieve TERRAIN_DIST_CACHE_TYPE property. \n", ERR_EFAILED);
 		}
-	styr = atoi(entry->val);
-	
-	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SIMSTMO), (void *)&entry) )	{
-		ERR_ERROR("Unable to retrieve simulation start month from property HashTable. \n", ERR_EFAILED);
+	if ( strcmp(entry->val, GetFireVal(VAL_NULL)) == 0 )	{
+		return ERR_SUCCESS;
 		}
-	stmo = atoi(entry->val);	
-
-	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SIMSTDY), (void *)&entry) )	{
-		ERR_ERROR("Unable to retrieve simulation start day from property HashTable. \n", ERR_EFAILED);
-		}
-	stdy = atoi(entry->val);	
-
-	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SIMSTHR), (void *)&entry) )	{
-		ERR_ERROR("Unable to retrieve simulation start hour from property HashTable. \n", ERR_EFAILED);
+	else if ( strcmp(entry->val, GetFireVal(VAL_FLOAT)) == 0 )	{
+		type = EnumTerrainDistFloat;
 		}
-	sthr = atoi(entry->val);	
-
-	/* simulation end properties */
-	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SIMEDYR), (void *)&entry) )	{
-		ERR_ERROR("Unable to retrieve simulation end year from property HashTable. \n", ERR_EFAILED);
+	else if ( strcmp(entry->val, GetFireVal(VAL_HALF)) == 0 )	{
+		type = EnumTerrainDistHalf;
 		}
-	edyr = atoi(entry->val);
-	
-	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SIMEDMO), (void *)&entry) )	{
-		ERR_ERROR("Unable to retrieve simulation end month from property HashTable. \n", ERR_EFAILED);
+	else	{
+		ERR_ERROR("TERRAIN_DIST_CACHE_TYPE property must be FLOAT, HALF, or NULL. \n", ERR_EINVAL);
 		}
-	edmo = atoi(entry->val);	
 
-	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SIMEDDY), (void *)&entry) )	{
-		ERR_ERROR("Unable to retrieve simulation end day from property HashTable. \n", ERR_EFAILED);
+	if ( (*td = InitTerrainDistFromGridData(elev, type)) == NULL )	{
+		ERR_ERROR("Unable to initialize TerrainDist. \n", ERR_EFAILED);
 		}
-	eddy = atoi(entry->val);	
+		
+	return ERR_SUCCESS;
+	}
 
-	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SIMEDHR), (void *)&entry) )	{
-		ERR_ERROR("Unable to retrieve simulation end hour from property HashTable. \n", ERR_EFAILED);
+int InitFireTimerFromSimConfigFireConfig(const SimConfig * cfg, FireTimer ** ft)	{
+	/* check args */
+	if ( cfg == NULL || ft == NULL )	{
+		ERR_ERROR("Unable to initialize FireTimer with uninitialized SimConfig. \n", ERR_EINVAL);
 		}
-	edhr = atoi(entry->val);
-	
-	/* initialize the FireTimer */
-	if ( (*ft = InitFireTimer(styr, stmo, stdy, sthr, edyr, edmo, eddy, edhr)) == NULL )	{
+
+	/* start and end were range checked when SimConfig was loaded */
+	if ( (*ft = InitFireTimer(cfg->start_yr, cfg->start_mo, cfg->start_dy, cfg->start_hr,
+							cfg->end_yr, cfg->end_mo, cfg->end_dy, cfg->end_hr)) == NULL )	{
 		ERR_ERROR("Unable to initialize FireTimer from config file. \n", ERR_EFAILED);
 		}
 
-	return ERR_SUCCESS;	
+	return ERR_SUCCESS;
 	}
 	
 int InitFuelModelHashTableFromFuelModelListFireConfig(List * fmlist, ChHashTable ** fmtble)	{
@@ -173,7 +462,7 @@ int InitFuelModelHashTableFromFuelModelListFireConfig(List * fmlist, ChHashTable
 	return ERR_SUCCESS;
 	}
 
-int InitStandAgeFromPropsFireConfig(ChHashTable * proptbl, GridData * elev, GridData ** std_age)	{
+int InitStandAgeFromPropsFireConfig(ChHashTable * proptbl, const SimConfig * cfg, GridData * elev, GridData ** std_age)	{
 	IntTwoDArray * agearr	= NULL;				/* temporary stand age array used to initialize GridData */
 	KeyVal * entry			= NULL;				/* key/val instances from table */
 	int domain_rows;							/* size of domain rows */
@@ -182,7 +471,7 @@ int InitStandAgeFromPropsFireConfig(ChHashTable * proptbl, GridData * elev, Grid
 	int i, j;	
 	int fixed_age;
 		
-	if ( proptbl == NULL || elev == NULL )	{
+	if ( proptbl == NULL || cfg == NULL || elev == NULL )	{
 		ERR_ERROR("Arguments supplied to initialize stand age invalid. \n", ERR_EINVAL);
 		}
 		
@@ -193,14 +482,11 @@ int InitStandAgeFromPropsFireConfig(ChHashTable * proptbl, GridData * elev, Grid
 
 	if	( strcmp(entry->val, GetFireVal(VAL_SPATIAL)) == 0)	{
 		/* initialize stand age from grid */
-		*std_age = GetGridDataFromPropsFireGridData(proptbl, FIRE_GRIDDATA_STD_AGE_DATA);
+		*std_age = GetGridDataFromPropsFireGridData(proptbl, cfg, FIRE_GRIDDATA_STD_AGE_DATA);
 		}		
 	else if ( strcmp(entry->val, GetFireVal(VAL_FIXED)) == 0)	{
-		/* initialize stand age grid to a fixed value */
-		if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SAGEFIX), (void *)&entry) )	{
-			ERR_ERROR("Unable to retrieve properties for Stand Age. \n", ERR_EFAILED);
-			}
-		fixed_age = atoi((char *) entry->val);
+		/* initialize stand age grid to a fixed value, range checked when SimConfig was loaded */
+		fixed_age = cfg->std_age_fixed;
 
 		/* get dimensions for stand age from elev */	
 		domain_rows = elev->ghdr->nrows; 
@@ -246,10 +532,114 @@ int InitStandAgeFromPropsFireConfig(ChHashTable * proptbl, GridData * elev, Grid
 	return ERR_SUCCESS;
 	}
 
-int InitFireEnvFromPropsFireConfig(ChHashTable * proptbl, FireEnv ** fe)		{
+int InitFireEnvTablesFromPropsFireConfig(ChHashTable * proptbl, const SimConfig * cfg, FireEnvTables ** fet)	{
+	FireEnvTables * tbls	= NULL;
+	KeyVal * entry			= NULL;
+	int status				= ERR_SUCCESS;
+
+	/* check args */
+	if ( proptbl == NULL || cfg == NULL || fet == NULL )	{
+		ERR_ERROR("Unable to initialize FireEnvTables from properties HashTable. \n", ERR_EINVAL);
+		}
+	*fet = NULL;
+	if ( (tbls = InitFireEnvTables()) == NULL )	{
+		ERR_ERROR("Unable to initialize FireEnvTables from properties HashTable. \n", ERR_ENOMEM);
+		}
+
+	/* read the wind azimuth tables of the wind azimuth type, RANDU reads none */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_WAZTYP), (void *)&entry) )	{
+		FreeFireEnvTables(tbls);
+		ERR_ERROR("Unable to retrieve WIND_AZIMUTH_TYPE property for FireEnvTables. \n", ERR_EFAILED);
+		}
+	if ( strcmp(entry->val, GetFireVal(VAL_FIXED)) == 0)	{
+		status = SetWindAzimuthTablesFIXEDFromProps(tbls->waz, proptbl);
+		}
+	else if ( strcmp(entry->val, GetFireVal(VAL_RANDH)) == 0)	{
+		status = SetWindAzimuthTablesRANDHFromProps(tbls->waz, proptbl);
+		}		
+	else if ( strcmp(entry->val, GetFireVal(VAL_SPATIAL)) == 0)	{
+		status = SetWindAzimuthTablesSPATIALFromProps(tbls->waz, proptbl);
+		}
+	if ( status )	{
+		FreeFireEnvTables(tbls);
+		ERR_ERROR("Unable to read wind azimuth tables for FireEnvTables. \n", ERR_EFAILED);
+		}
+
+	/* read the windspeed tables of the wind speed type */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_WSPDTYP), (void *)&entry) )	{
+		FreeFireEnvTables(tbls);
+		ERR_ERROR("Unable to retrieve WIND_SPEED_TYPE property for FireEnvTables. \n", ERR_EFAILED);
+		}
+	if ( strcmp(entry->val, GetFireVal(VAL_FIXED)) == 0)	{
+		status = SetWindSpdTablesFIXEDFromProps(tbls->wsp, proptbl);
+		}
+	else if ( strcmp(entry->val, GetFireVal(VAL_RANDU)) == 0)	{
+		status = SetWindSpdTablesRANDUFromProps(tbls->wsp, proptbl);
+		}
+	else if ( strcmp(entry->val, GetFireVal(VAL_RANDH)) == 0)	{
+		status = SetWindSpdTablesRANDHFromProps(tbls->wsp, proptbl);
+		}		
+	else if ( strcmp(entry->val, GetFireVal(VAL_SPATIAL)) == 0)	{
+		status = SetWindSpdTablesSPATIALFromProps(tbls->wsp, proptbl);
+		}
+	if ( status )	{
+		FreeFireEnvTables(tbls);
+		ERR_ERROR("Unable to read windspeed tables for FireEnvTables. \n", ERR_EFAILED);
+		}
+
+	/* read the dead fuel moisture tables of the dead fuel moisture type */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_DFMTYP), (void *)&entry) )	{
+		FreeFireEnvTables(tbls);
+		ERR_ERROR("Unable to retrieve DEAD_FUEL_MOIST_TYPE property for FireEnvTables. \n", ERR_EFAILED);
+		}
+	if ( strcmp(entry->val, GetFireVal(VAL_FIXED)) == 0)	{
+		status = SetDeadFuelMoistTablesFIXEDFromProps(tbls->dfm, proptbl);
+		}
+	else if ( strcmp(entry->val, GetFireVal(VAL_RANDH)) == 0)	{
+		status = SetDeadFuelMoistTablesRANDHFromProps(tbls->dfm, proptbl);
+		}		
+	else if ( strcmp(entry->val, GetFireVal(VAL_SPATIAL)) == 0)	{
+		status = SetDeadFuelMoistTablesSPATIALFromProps(tbls->dfm, proptbl);
+		}
+	if ( status )	{
+		FreeFireEnvTables(tbls);
+		ERR_ERROR("Unable to read dead fuel moisture tables for FireEnvTables. \n", ERR_EFAILED);
+		}
+
+	/* read the live fuel moisture tables of the live fuel moisture type */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_LFMTYP), (void *)&entry) )	{
+		FreeFireEnvTables(tbls);
+		ERR_ERROR("Unable to retrieve LIVE_FUEL_MOIST_TYPE property for FireEnvTables. \n", ERR_EFAILED);
+		}
+	if ( strcmp(entry->val, GetFireVal(VAL_FIXED)) == 0)	{
+		status = SetLiveFuelMoistTablesFIXEDFromProps(tbls->lfm, proptbl);
+		}
+	else if ( strcmp(entry->val, GetFireVal(VAL_RANDH)) == 0)	{
+		status = SetLiveFuelMoistTablesRANDHFromProps(tbls->lfm, proptbl);
+		}		
+	else if ( strcmp(entry->val, GetFireVal(VAL_SPATIAL)) == 0)	{
+		status = SetLiveFuelMoistTablesSPATIALFromProps(tbls->lfm, proptbl);
+		}
+	if ( status )	{
+		FreeFireEnvTables(tbls);
+		ERR_ERROR("Unable to read live fuel moisture tables for FireEnvTables. \n", ERR_EFAILED);
+		}
+
+	/* Santa Ana tables are only needed if Santa Ana events occur */
+	if ( UNITS_FP_GT_ZERO(cfg->sa_freq_yr) && SetSantaAnaTablesFromProps(tbls->sa, proptbl) )	{
+		FreeFireEnvTables(tbls);
+		ERR_ERROR("Unable to read Santa Ana tables for FireEnvTables. \n", ERR_EFAILED);
+		}
+
+	*fet = tbls;
+
+	return ERR_SUCCESS;
+	}
+
+int InitFireEnvFromPropsFireConfig(ChHashTable * proptbl, const SimConfig * cfg, const FireEnvTables * fet, FireEnv ** fe)		{
 	KeyVal * entry	= NULL;
 
-	if ( proptbl == NULL || (*fe = InitFireEnv()) == NULL )	{
+	if ( proptbl == NULL || cfg == NULL || fet == NULL || (*fe = InitFireEnv()) == NULL )	{
 		ERR_ERROR("Unable to initialize FireEnv from properties HashTable. \n", ERR_EINVAL);
 		}
 		
@@ -271,25 +661,24 @@ int InitFireEnvFromPropsFireConfig(ChHashTable * proptbl, FireEnv ** fe)		{
 		ERR_ERROR("Unable to retrieve FUELS_REGROWTH_TYPE property for FireEnv. \n", ERR_EFAILED);	
 		}
 		
-	/* determine ignition type and set the appropriate function pointer in FireEnv */
-	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_IGTYP), (void *)&entry) )	{
-		ERR_ERROR("Unable to retrieve IGNITION_TYPE property for FireEnv. \n", ERR_EFAILED);
-		}
-	if ( strcmp(entry->val, GetFireVal(VAL_FIXED)) == 0)	{
-		(*fe)->IsIgnitionNowFromProps 	= IsIgnitionNowFIXEDFromProps;
-		(*fe)->GetIgnitionLocFromProps 	= GetIgnitionLocFIXEDFromProps;	
-		}
-	else if ( strcmp(entry->val, GetFireVal(VAL_RANDU)) == 0)	{
-		(*fe)->IsIgnitionNowFromProps 	= IsIgnitionNowRANDFromProps;
-		(*fe)->GetIgnitionLocFromProps 	= GetIgnitionLocRANDUFromProps;	
-		}
-	else if ( strcmp(entry->val, GetFireVal(VAL_RANDS)) == 0)	{
-		(*fe)->IsIgnitionNowFromProps 	= IsIgnitionNowRANDFromProps;	
-		(*fe)->GetIgnitionLocFromProps 	= GetIgnitionLocRANDSFromProps;	
-		}
-	else	{
-		FreeFireEnv(*fe);
-		ERR_ERROR("Unable to retrieve IGNITION_TYPE property for FireEnv. \n", ERR_EFAILED);	
+	/* ignition type was resolved when SimConfig was loaded, set the appropriate function pointer in FireEnv */
+	switch(cfg->ig_type)	{
+		case EnumIgnitionFixed:
+			(*fe)->IsIgnitionNowFromProps 	= IsIgnitionNowFIXEDFromProps;
+			(*fe)->GetIgnitionLocFromProps 	= GetIgnitionLocFIXEDFromProps;	
+			break;
+		case EnumIgnitionRandU:
+			(*fe)->IsIgnitionNowFromProps 	= IsIgnitionNowRANDFromProps;
+			(*fe)->GetIgnitionLocFromProps 	= GetIgnitionLocRANDUFromProps;	
+			break;
+		case EnumIgnitionRandS:
+			(*fe)->IsIgnitionNowFromProps 	= IsIgnitionNowRANDFromProps;	
+			(*fe)->GetIgnitionLocFromProps 	= GetIgnitionLocRANDSFromProps;	
+			break;
+		default:
+			FreeFireEnv(*fe);
+			ERR_ERROR("Unrecognized ignition type of SimConfig for FireEnv. \n", ERR_EINVAL);	
+			break;
 		}
 	
 	/* determine wind azimuth type and set the appropriate function pointer in FireEnv */
@@ -370,36 +759,111 @@ int InitFireEnvFromPropsFireConfig(ChHashTable * proptbl, FireEnv ** fe)		{
 		ERR_ERROR("Unable to retrieve LIVE_FUEL_MOIST_TYPE property for FireEnv. \n", ERR_EFAILED);	
 		}
 					
-	/* determine Santa Ana type and set the appropriate function pointer in FireEnv */
-	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SANAFREQ), (void *)&entry) )	{
-		ERR_ERROR("Unable to retrieve SANTA_ANA_FREQUENCY_PER_YEAR property for FireEnv. \n", ERR_EFAILED);
+	/* windspeed adjustment factor and dead fuel moisture increments were validated when SimConfig was loaded */
+	if ( SetWindSpdStateFromSimConfig((*fe)->wsp, cfg) || SetDeadFuelMoistStateFromSimConfig((*fe)->dfm, cfg) )	{
+		FreeFireEnv(*fe);
+		ERR_ERROR("Unable to set windspeed and dead fuel moisture state of FireEnv. \n", ERR_EFAILED);
+		}
+
+	/* Santa Ana frequency and duration were validated when SimConfig was loaded */
+	if ( SetSantaAnaStateFromSimConfig((*fe)->sa, cfg) )	{
+		FreeFireEnv(*fe);
+		ERR_ERROR("Unable to set Santa Ana state of FireEnv. \n", ERR_EFAILED);
 		}
 	(*fe)->IsSantaAnaNowFromProps = IsSantaAnaNowFromProps;
 	(*fe)->GetSantaAnaEnvFromProps = GetSantaAnaEnvFromProps;
+
+	/* link the state of each function to the tables shared by every simulation */
+	if ( SetWindAzimuthStateFromTables((*fe)->waz, fet->waz) || SetWindSpdStateFromTables((*fe)->wsp, fet->wsp)
+			|| SetDeadFuelMoistStateFromTables((*fe)->dfm, fet->dfm) || SetLiveFuelMoistStateFromTables((*fe)->lfm, fet->lfm)
+			|| SetSantaAnaStateFromTables((*fe)->sa, fet->sa) )	{
+		FreeFireEnv(*fe);
+		ERR_ERROR("Unable to link FireEnv to FireEnvTables. \n", ERR_EFAILED);
+		}
 						
 	return ERR_SUCCESS;
 	}
 
-int InitRandNumGenFromPropsFireConfig(ChHashTable * proptbl, void(*RandInit)(long int seed))	{
-	long int seed = 0;
+int InitRandStreamFromSimConfigFireConfig(const SimConfig * cfg, long int * seed, RandStream * rs)	{
+	/* check args */
+	if ( (cfg == NULL) || (seed == NULL) || (rs == NULL) )	{
+		ERR_ERROR("Unable to initialize random number stream from SimConfig. \n", ERR_EINVAL);
+		}
+
+	if ( cfg->rng_seed_table )	{
+		*seed = GetSeedRandRecordRandSeedTable();
+		}
+	else	{
+		*seed = cfg->rng_seed;
+		}
+		
+	return InitRandStream(*seed, rs);
+	}
+		
+int InitThreadPoolFromSimConfigFireConfig(const SimConfig * cfg, ThreadPool ** tp)	{
+	/* check args */
+	if ( cfg == NULL || tp == NULL )	{
+		ERR_ERROR("Unable to initialize ThreadPool from SimConfig. \n", ERR_EINVAL);
+		}
+
+	if ( (*tp = InitThreadPool(cfg->num_threads)) == NULL )	{
+		ERR_ERROR("Unable to initialize ThreadPool. \n", ERR_EFAILED);
+		}
+		
+	return ERR_SUCCESS;
+	}
+		
+int InitEnsembleFromPropsFireConfig(ChHashTable * proptbl, Ensemble ** ens)	{
+	int num_replicates = 0;
+	int is_null;
 	KeyVal * entry	= NULL;	
 	
 	/* check args */
-	if ( (proptbl == NULL) || (RandInit == NULL) )	{
-		ERR_ERROR("Unable to initialize Random Number Generator from properties HashTable. \n", ERR_EINVAL);
+	if ( proptbl == NULL || ens == NULL )	{
+		ERR_ERROR("Unable to initialize Ensemble from properties HashTable. \n", ERR_EINVAL);
 		}
+	*ens = NULL;
 
-	/* retrieve random number seed type */		
-	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SIMRNGSD), (void *)&entry) )	{
-		ERR_ERROR("Unable to retrieve SIMULATION_RAND_NUM_SEED property. \n", ERR_EFAILED);
+	/* retrieve number of replicates, NULL implies a single run */
+	if ( IsNullPropFireConfig(proptbl, PROP_ENSNUMREP, &is_null) )	{
+		ERR_ERROR("Unable to retrieve ENSEMBLE_NUM_REPLICATES property. \n", ERR_EFAILED);
 		}
+	if ( is_null )	{
+		return ERR_SUCCESS;
+		}
+	if ( GetIntPropFireConfig(proptbl, PROP_ENSNUMREP, 1, ENSEMBLE_MAX_REPLICATES, &num_replicates) )	{
+		ERR_ERROR("ENSEMBLE_NUM_REPLICATES property out of range. \n", ERR_ERANGE);
+		}
+
+	/* retrieve directory of ensemble output */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_ENSOUTDIR), (void *)&entry)
+			|| strcmp(entry->val, GetFireVal(VAL_NULL)) == 0 )	{
+		ERR_ERROR("ENSEMBLE_OUTPUT_DIR property required when ENSEMBLE_NUM_REPLICATES is set. \n", ERR_EINVAL);
+		}
+
+	if ( (*ens = InitEnsemble(num_replicates, entry->val)) == NULL )	{
+		ERR_ERROR("Unable to initialize Ensemble. \n", ERR_EFAILED);
+		}
+		
+	return ERR_SUCCESS;
+	}
 		
-	if ( strcmp(entry->val, GetFireVal(VAL_TABLE)) == 0 )	{
-		RandInit(GetSeedRandRecordRandSeedTable());
+int InitRothSpreadTableFromSimConfigFireConfig(const SimConfig * cfg, List * fmlist, int num_workers, RothSpreadTable ** rst)	{
+	/* check args */
+	if ( cfg == NULL || fmlist == NULL || rst == NULL )	{
+		ERR_ERROR("Unable to initialize RothSpreadTable from SimConfig. \n", ERR_EINVAL);
 		}
-	else	{
-		seed = atol(entry->val);
-		RandInit(seed);
+	*rst = NULL;
+
+	/* NULL table type implies direct calculation */
+	if ( cfg->ros_tbl_type == EnumRosTableNone )	{
+		return ERR_SUCCESS;
+		}
+
+	if ( (*rst = InitRothSpreadTable(num_workers, LIST_SIZE(fmlist), cfg->ros_tbl_entries,
+			cfg->ros_tbl_moist_step, cfg->ros_tbl_wsp_step, cfg->ros_tbl_az_step, cfg->ros_tbl_slp_step,
+			cfg->ell_adj, cfg->ros_tbl_type == EnumRosTableValidate, cfg->ros_tbl_max_rel_err)) == NULL )	{
+		ERR_ERROR("Unable to initialize RothSpreadTable. \n", ERR_EFAILED);
 		}
 		
 	return ERR_SUCCESS;
@@ -444,4 +908,118 @@ void FireConfigDumpFuelModelListToStream(List * fmlist, FILE * fstream)	{
 	return;	
 	}
 		
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Converts the value of a property to an integer and tests that it lies within [min, max].
+ * The entire value must be consumed by the conversion, so trailing characters are an error.
+ *
+ * Arguments:
+ * proptbl- HashTable of simulation properties
+ * prop- property being converted
+ * min- smallest valid value
+ * max- largest valid value
+ * val- receives converted value
+ *
+ * Returns:
+ * ERR_SUCCESS(0) if value valid, an error code otherwise.
+ */
+static int GetIntPropFireConfig(ChHashTable * proptbl, EnumFireProp prop, int min, int max, int * val)	{
+	KeyVal * entry	= NULL;
+	char * end		= NULL;
+	char msg[FIRE_CONFIG_ERR_MSG_SIZE];
+	long lval;
+
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(prop), (void *)&entry) )	{
+		sprintf(msg, "Unable to retrieve property %s. \n", GetFireProp(prop));
+		ERR_ERROR(msg, ERR_EFAILED);
+		}
+	errno = 0;
+	lval = strtol((char *) entry->val, &end, 10);
+	if ( end == (char *) entry->val || *end != '\0' || errno == ERANGE )	{
+		sprintf(msg, "Property %s value %.64s is not an integer. \n", GetFireProp(prop), (char *) entry->val);
+		ERR_ERROR(msg, ERR_EINVAL);
+		}
+	if ( lval < (long) min || lval > (long) max )	{
+		sprintf(msg, "Property %s value %.64s out of range. \n", GetFireProp(prop), (char *) entry->val);
+		ERR_ERROR(msg, ERR_ERANGE);
+		}
+	*val = (int) lval;
+
+	return ERR_SUCCESS;
+	}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Converts the value of a property to a double and tests that it is not less than min.
+ * The entire value must be consumed by the conversion, so trailing characters are an error.
+ *
+ * Arguments:
+ * proptbl- HashTable of simulation properties
+ * prop- property being converted
+ * min- smallest valid value
+ * val- receives converted value
+ *
+ * Returns:
+ * ERR_SUCCESS(0) if value valid, an error code otherwise.
+ */
+static int GetDoublePropFireConfig(ChHashTable * proptbl, EnumFireProp prop, double min, double * val)	{
+	KeyVal * entry	= NULL;
+	char * end		= NULL;
+	char msg[FIRE_CONFIG_ERR_MSG_SIZE];
+	double dval;
+
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(prop), (void *)&entry) )	{
+		sprintf(msg, "Unable to retrieve property %s. \n", GetFireProp(prop));
+		ERR_ERROR(msg, ERR_EFAILED);
+		}
+	errno = 0;
+	dval = strtod((char *) entry->val, &end);
+	if ( end == (char *) entry->val || *end != '\0' || errno == ERANGE )	{
+		sprintf(msg, "Property %s value %.64s is not a number. \n", GetFireProp(prop), (char *) entry->val);
+		ERR_ERROR(msg, ERR_EINVAL);
+		}
+	if ( dval < min )	{
+		sprintf(msg, "Property %s value %.64s out of range. \n", GetFireProp(prop), (char *) entry->val);
+		ERR_ERROR(msg, ERR_ERANGE);
+		}
+	*val = dval;
+
+	return ERR_SUCCESS;
+	}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Tests whether the value of a property is the NULL string.
+ *
+ * Arguments:
+ * proptbl- HashTable of simulation properties
+ * prop- property being tested
+ * is_null- receives 1 if value is NULL, 0 otherwise
+ *
+ * Returns:
+ * ERR_SUCCESS(0) if property retrieved, an error code otherwise.
+ */
+static int IsNullPropFireConfig(ChHashTable * proptbl, EnumFireProp prop, int * is_null)	{
+	KeyVal * entry	= NULL;
+	char msg[FIRE_CONFIG_ERR_MSG_SIZE];
+
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(prop), (void *)&entry) )	{
+		sprintf(msg, "Unable to retrieve property %s. \n", GetFireProp(prop));
+		ERR_ERROR(msg, ERR_EFAILED);
+		}
+	*is_null = ( strcmp(entry->val, GetFireVal(VAL_NULL)) == 0 );
+
+	return ERR_SUCCESS;
+	}
+
 /* end of FireConfig.c */
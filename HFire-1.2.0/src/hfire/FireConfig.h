@@ -29,6 +29,9 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <limits.h>
 
 /* configuration headers */
 #include "FireProp.h"
@@ -37,9 +40,14 @@
 /* simulation support headers */
 #include "FireEnv.h"
 #include "FireTimer.h"
+#include "SimConfig.h"
+#include "CellPlane.h"
 
 /* abstract FuelModel headers */
 #include "FuelModel.h"
+#include "RothSpreadTable.h"
+#include "TerrainDist.h"
+#include "Ensemble.h"
 
 /* FireEnv headers */
 #include "FuelsRegrowth.h"
@@ -58,6 +66,8 @@
 #include "KeyVal.h"
 #include "FStreamIO.h"
 #include "RandSeedTable.h"
+#include "RandStream.h"
+#include "ThreadPool.h"
 #include "Err.h"
 
 /*
@@ -78,6 +88,9 @@
 #define FIRE_CONFIG_COMMENT_CHAR							("#")
 #define FIRE_CONFIG_SEPARATOR_CHARS							(" =,\t")
 
+/* size of buffer holding error messages which name the offending property */
+#define FIRE_CONFIG_ERR_MSG_SIZE							(256)
+
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
  
 /*
@@ -114,12 +127,33 @@
  */ 
 int InitPropsFromFireConfig(ChHashTable ** proptbl, char * cfg_fname);
 
-/*! \fn int InitGridsFromPropsFireConfig(ChHashTable * proptbl, GridData ** elev, GridData ** slope, GridData ** aspect)
+/*! \fn int InitSimConfigFromPropsFireConfig(ChHashTable * proptbl, SimConfig ** cfg)
+ *	\brief Converts and validates the simulation properties read during a run.
+ *
+ *	Every value is range checked and must be consumed entirely by the conversion, so an 
+ *	invalid configuration fails when it is loaded rather than part way through the simulation.
+ *	\sa ChHashTable
+ *	\sa SimConfig
+ *	\sa Check the \htmlonly <a href="config_file_doc.html">config file documentation</a> \endhtmlonly 
+ *	\param proptbl ChHashTable of simulation properties
+ *	\param cfg if function returns without error, initialized SimConfig
+ *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
+ *	\note Best use of this facility is as follows:
+ *	\code	
+ *			int error_status = SomeFunctionXXX();
+ *			if ( error_status )
+ *				// something bad happened
+ *	\endcode
+ */
+int InitSimConfigFromPropsFireConfig(ChHashTable * proptbl, SimConfig ** cfg);
+
+/*! \fn int InitGridsFromPropsFireConfig(ChHashTable * proptbl, const SimConfig * cfg, GridData ** elev, GridData ** slope, GridData ** aspect)
  *	\brief Loads terrain-related raster data required for fire prediction.
  *	\sa ChHashTable
  *	\sa GridData
  *	\sa Check the \htmlonly <a href="config_file_doc.html#RASTER">config file documentation</a> \endhtmlonly 
  *	\param proptbl ChHashTable of simulation properties
+ *	\param cfg SimConfig of simulation
  *	\param elev if function returns without error, initialized GridData of elevation values
  *	\param slope if function returns without error, initialized GridData of slope values 
  *	\param aspect if function returns without error, initialized GridData of aspect values 
@@ -131,14 +165,35 @@ int InitPropsFromFireConfig(ChHashTable ** proptbl, char * cfg_fname);
  *				// something bad happened
  *	\endcode
  */
-int InitGridsFromPropsFireConfig(ChHashTable * proptbl, GridData ** elev, GridData ** slope, GridData ** aspect);
+int InitGridsFromPropsFireConfig(ChHashTable * proptbl, const SimConfig * cfg, GridData ** elev, GridData ** slope, GridData ** aspect);
 
-/*! \fn int InitFireTimerFromPropsFireConfig(ChHashTable * proptbl, FireTimer ** ft)
- *	\brief Initializes FireTimer structure used by simulation.
+/*! \fn int InitTerrainDistFromPropsFireConfig(ChHashTable * proptbl, GridData * elev, TerrainDist ** td)
+ *	\brief Precomputes distance along the ground between neighboring cells of the elevation raster.
+ *
+ *	The distances are computed when TERRAIN_DIST_CACHE_TYPE is FLOAT or HALF.  When the property 
+ *	is NULL no distances are stored, td is set to NULL, and distances are calculated as needed.
  *	\sa ChHashTable
+ *	\sa TerrainDist
+ *	\sa Check the \htmlonly <a href="config_file_doc.html#RASTER">config file documentation</a> \endhtmlonly 
+ *	\param proptbl ChHashTable of simulation properties
+ *	\param elev GridData of elevation values
+ *	\param td if function returns without error, initialized TerrainDist or NULL
+ *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
+ *	\note Best use of this facility is as follows:
+ *	\code	
+ *			int error_status = SomeFunctionXXX();
+ *			if ( error_status )
+ *				// something bad happened
+ *	\endcode
+ */
+int InitTerrainDistFromPropsFireConfig(ChHashTable * proptbl, GridData * elev, TerrainDist ** td);
+
+/*! \fn int InitFireTimerFromSimConfigFireConfig(const SimConfig * cfg, FireTimer ** ft)
+ *	\brief Initializes FireTimer structure used by simulation from the start and end in SimConfig.
+ *	\sa SimConfig
  *	\sa FireTimer
  *	\sa Check the \htmlonly <a href="config_file_doc.html#SIMULATION">config file documentation</a> \endhtmlonly 
- *	\param proptbl ChHashTable of simulation properties
+ *	\param cfg SimConfig of simulation
  *	\param ft if function returns without error, initialized simulation FireTimer
  *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
  *	\note Best use of this facility is as follows:
@@ -148,7 +203,7 @@ int InitGridsFromPropsFireConfig(ChHashTable * proptbl, GridData ** elev, GridDa
  *				// something bad happened
  *	\endcode
  */
-int InitFireTimerFromPropsFireConfig(ChHashTable * proptbl, FireTimer ** ft);
+int InitFireTimerFromSimConfigFireConfig(const SimConfig * cfg, FireTimer ** ft);
 
 /*! \fn int InitFuelModelHashTableFromFuelModelListFireConfig(List * fmlist, ChHashTable ** fmtble)
  *	\brief Initializes ChHashTable of FuelModels indexed by model number, using the supplied List.
@@ -168,12 +223,13 @@ int InitFireTimerFromPropsFireConfig(ChHashTable * proptbl, FireTimer ** ft);
  */
 int InitFuelModelHashTableFromFuelModelListFireConfig(List * fmlist, ChHashTable ** fmtble);
 
-/*! \fn int InitStandAgeFromPropsFireConfig(ChHashTable * proptbl, GridData * elev, GridData ** std_age)
+/*! \fn int InitStandAgeFromPropsFireConfig(ChHashTable * proptbl, const SimConfig * cfg, GridData * elev, GridData ** std_age)
  *	\brief Loads stand age data for generating age-dependent fuels.
  *	\sa ChHashTable
  *	\sa GridData
  *	\sa Check the \htmlonly <a href="config_file_doc.html#STAND_AGE">config file documentation</a> \endhtmlonly 
  *	\param proptbl ChHashTable of simulation properties
+ *	\param cfg SimConfig of simulation
  *	\param elev GridData of terrain elevation used to define the simulation boundaries
  *	\param std_age if function returns without error, initialized GridData of current stand age for each cell 
  *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
@@ -184,14 +240,41 @@ int InitFuelModelHashTableFromFuelModelListFireConfig(List * fmlist, ChHashTable
  *				// something bad happened
  *	\endcode
  */
-int InitStandAgeFromPropsFireConfig(ChHashTable * proptbl, GridData * elev, GridData ** std_age);
+int InitStandAgeFromPropsFireConfig(ChHashTable * proptbl, const SimConfig * cfg, GridData * elev, GridData ** std_age);
+
+/*! \fn int InitFireEnvTablesFromPropsFireConfig(ChHashTable * proptbl, const SimConfig * cfg, FireEnvTables ** fet)
+ *	\brief Reads the tables of the wind, fuel moisture and Santa Ana types named in the user configuration.
+ *
+ *	The tables are read once and shared by the FireEnv of every simulation.  SPATIAL types only
+ *	index their atm tables here, the rasters are read as simulations reach them.  Santa Ana tables
+ *	are read only if Santa Ana events occur.
+ *	\sa ChHashTable
+ *	\sa FireEnvTables
+ *	\sa Check the \htmlonly <a href="config_file_doc.html">config file documentation</a> \endhtmlonly 
+ *	\param proptbl ChHashTable of simulation properties
+ *	\param cfg SimConfig of simulation
+ *	\param fet if function returns without error, initialized FireEnvTables structure 
+ *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
+ *	\note Best use of this facility is as follows:
+ *	\code	
+ *			int error_status = SomeFunctionXXX();
+ *			if ( error_status )
+ *				// something bad happened
+ *	\endcode
+ */
+int InitFireEnvTablesFromPropsFireConfig(ChHashTable * proptbl, const SimConfig * cfg, FireEnvTables ** fet);
 
-/*! \fn int InitFireEnvFromPropsFireConfig(ChHashTable * proptbl, FireEnv ** fe)
+/*! \fn int InitFireEnvFromPropsFireConfig(ChHashTable * proptbl, const SimConfig * cfg, const FireEnvTables * fet, FireEnv ** fe)
  *	\brief Assigns appropriate function pointers to FireEnv structure based upon user configuration.
+ *
+ *	The Santa Ana frequency and duration of the FireEnv state are set from cfg, and the state of
+ *	each function is linked to the shared tables in fet.
  *	\sa ChHashTable
  *	\sa FireEnv
  *	\sa Check the \htmlonly <a href="config_file_doc.html">config file documentation</a> \endhtmlonly 
  *	\param proptbl ChHashTable of simulation properties
+ *	\param cfg SimConfig of simulation
+ *	\param fet FireEnvTables read by InitFireEnvTablesFromPropsFireConfig, must outlive the FireEnv
  *	\param fe if function returns without error, initialized FireEnv structure 
  *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
  *	\note Best use of this facility is as follows:
@@ -201,14 +284,81 @@ int InitStandAgeFromPropsFireConfig(ChHashTable * proptbl, GridData * elev, Grid
  *				// something bad happened
  *	\endcode
  */
-int InitFireEnvFromPropsFireConfig(ChHashTable * proptbl, FireEnv ** fe);
+int InitFireEnvFromPropsFireConfig(ChHashTable * proptbl, const SimConfig * cfg, const FireEnvTables * fet, FireEnv ** fe);
 
-/*! \fn int InitRandNumGenFromPropsFireConfig(ChHashTable * proptbl, void(*RandInit)(long int seed))
- *	\brief Initializes simulation random number generator with user supplied seed or from seed table.
+/*! \fn int InitRandStreamFromSimConfigFireConfig(const SimConfig * cfg, long int * seed, RandStream * rs)
+ *	\brief Initializes root random number stream of simulation with user supplied seed or from seed table.
+ *
+ *	A seed of TABLE is drawn from the seed table once, every stream used during the simulation is
+ *	split from the root stream so the seed alone reproduces the simulation.
+ *	\sa SimConfig
+ *	\sa Check the \htmlonly <a href="config_file_doc.html#SIMULATION">config file documentation</a> \endhtmlonly 
+ *	\param cfg SimConfig of simulation
+ *	\param seed seed of the root stream
+ *	\param rs root stream
+ *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
+ *	\note Best use of this facility is as follows:
+ *	\code	
+ *			int error_status = SomeFunctionXXX();
+ *			if ( error_status )
+ *				// something bad happened
+ *	\endcode
+ */
+int InitRandStreamFromSimConfigFireConfig(const SimConfig * cfg, long int * seed, RandStream * rs);
+
+/*! \fn int InitThreadPoolFromSimConfigFireConfig(const SimConfig * cfg, ThreadPool ** tp)
+ *	\brief Initializes pool of worker threads used to process the burning cells of the fire front.
+ *
+ *	The number of workers is the SIMULATION_NUM_THREADS validated in SimConfig.  When the property
+ *	is NULL a single worker is used and the simulation runs entirely on the calling thread.
+ *	\sa SimConfig
+ *	\sa ThreadPool
+ *	\sa Check the \htmlonly <a href="config_file_doc.html#SIMULATION">config file documentation</a> \endhtmlonly 
+ *	\param cfg SimConfig of simulation
+ *	\param tp if function returns without error, initialized ThreadPool
+ *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
+ *	\note Best use of this facility is as follows:
+ *	\code	
+ *			int error_status = SomeFunctionXXX();
+ *			if ( error_status )
+ *				// something bad happened
+ *	\endcode
+ */
+int InitThreadPoolFromSimConfigFireConfig(const SimConfig * cfg, ThreadPool ** tp);
+
+/*! \fn int InitEnsembleFromPropsFireConfig(ChHashTable * proptbl, Ensemble ** ens)
+ *	\brief Initializes ensemble of replicates run in a single process.
+ *
+ *	The number of replicates is read from ENSEMBLE_NUM_REPLICATES and the directory of ensemble
+ *	output from ENSEMBLE_OUTPUT_DIR.  When ENSEMBLE_NUM_REPLICATES is NULL a single run is made,
+ *	exporting to the directories and files named in the configuration file, and ens is set to NULL.
  *	\sa ChHashTable
+ *	\sa Ensemble
  *	\sa Check the \htmlonly <a href="config_file_doc.html#SIMULATION">config file documentation</a> \endhtmlonly 
  *	\param proptbl ChHashTable of simulation properties
- *	\param RandInit pointer to random number generating function to use during simulation 
+ *	\param ens if function returns without error, initialized Ensemble or NULL
+ *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
+ *	\note Best use of this facility is as follows:
+ *	\code	
+ *			int error_status = SomeFunctionXXX();
+ *			if ( error_status )
+ *				// something bad happened
+ *	\endcode
+ */
+int InitEnsembleFromPropsFireConfig(ChHashTable * proptbl, Ensemble ** ens);
+
+/*! \fn int InitRothSpreadTableFromSimConfigFireConfig(const SimConfig * cfg, List * fmlist, int num_workers, RothSpreadTable ** rst)
+ *	\brief Initializes table of precomputed Rothermel rate of spread used in place of the spread equations.
+ *
+ *	The table is enabled when ROS_TABLE_TYPE validated in SimConfig is LOOKUP or VALIDATE.  When the 
+ *	property is NULL no table is created, rst is set to NULL, and rate of spread is calculated directly.
+ *	\sa SimConfig
+ *	\sa RothSpreadTable
+ *	\sa Check the \htmlonly <a href="config_file_doc.html#FUEL">config file documentation</a> \endhtmlonly 
+ *	\param cfg SimConfig of simulation
+ *	\param fmlist List of FuelModels used in simulation
+ *	\param num_workers number of workers which will use the table concurrently
+ *	\param rst if function returns without error, initialized RothSpreadTable or NULL
  *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
  *	\note Best use of this facility is as follows:
  *	\code	
@@ -217,7 +367,7 @@ int InitFireEnvFromPropsFireConfig(ChHashTable * proptbl, FireEnv ** fe);
  *				// something bad happened
  *	\endcode
  */
-int InitRandNumGenFromPropsFireConfig(ChHashTable * proptbl, void(*RandInit)(long int seed));
+int InitRothSpreadTableFromSimConfigFireConfig(const SimConfig * cfg, List * fmlist, int num_workers, RothSpreadTable ** rst);
 
 /*! \fn void FireConfigDumpPropsToStream(ChHashTable * proptbl, FILE * fstream)
  *	\brief Dumps ChHashTable of current simulation configuration properties to stream.
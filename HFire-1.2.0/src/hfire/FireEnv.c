@@ -24,6 +24,43 @@
  
 #include "FireEnv.h"
 
+FireEnvTables * InitFireEnvTables()		{
+	FireEnvTables * fet 			= NULL;
+		
+	if ( (fet = (FireEnvTables *) malloc(sizeof(FireEnvTables))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to initialize FireEnvTables, memory allocation failed. \n", ERR_ENOMEM);
+		return fet;	
+		}
+	/* tables of each environment function */
+	fet->waz = NULL;
+	fet->wsp = NULL;
+	fet->dfm = NULL;
+	fet->lfm = NULL;
+	fet->sa = NULL;
+	if ( (fet->waz = InitWindAzimuthTables()) == NULL || (fet->wsp = InitWindSpdTables()) == NULL
+			|| (fet->dfm = InitDeadFuelMoistTables()) == NULL || (fet->lfm = InitLiveFuelMoistTables()) == NULL
+			|| (fet->sa = InitSantaAnaTables()) == NULL )	{
+		FreeFireEnvTables(fet);
+		ERR_ERROR_CONTINUE("Unable to initialize FireEnvTables, memory allocation failed. \n", ERR_ENOMEM);
+		return NULL;
+		}
+
+	return fet; 
+	}
+
+void FreeFireEnvTables(FireEnvTables * fet)	{
+	if ( fet != NULL )	{
+		FreeWindAzimuthTables(fet->waz);
+		FreeWindSpdTables(fet->wsp);
+		FreeDeadFuelMoistTables(fet->dfm);
+		FreeLiveFuelMoistTables(fet->lfm);
+		FreeSantaAnaTables(fet->sa);
+		free(fet);
+		}
+	fet = NULL;
+	return;
+	}
+
 FireEnv * InitFireEnv()		{
 	FireEnv * fe 					= NULL;
 		
@@ -41,12 +78,54 @@ FireEnv * InitFireEnv()		{
 	fe->GetLiveFuelMoistFromProps	= NULL;	
 	fe->IsSantaAnaNowFromProps		= NULL;
 	fe->GetSantaAnaEnvFromProps		= NULL;
+	/* state of each environment function */
+	fe->ig = NULL;
+	fe->waz = NULL;
+	fe->wsp = NULL;
+	fe->dfm = NULL;
+	fe->lfm = NULL;
+	fe->sa = NULL;
+	fe->ext = NULL;
+	if ( (fe->ig = InitIgnitionState()) == NULL || (fe->waz = InitWindAzimuthState()) == NULL
+			|| (fe->wsp = InitWindSpdState()) == NULL || (fe->dfm = InitDeadFuelMoistState()) == NULL
+			|| (fe->lfm = InitLiveFuelMoistState()) == NULL || (fe->sa = InitSantaAnaState()) == NULL
+			|| (fe->ext = InitExtinctionState()) == NULL )	{
+		FreeFireEnv(fe);
+		ERR_ERROR_CONTINUE("Unable to initialize FireEnv, memory allocation failed. \n", ERR_ENOMEM);
+		return NULL;
+		}
 
 	return fe; 
 	}
 
+int FireEnvSetRandStream(FireEnv * fe, const RandStream * rs)	{
+	/* check args */
+	if ( fe == NULL || rs == NULL )	{
+		ERR_ERROR("Arguments supplied to set random number streams of FireEnv invalid. \n", ERR_EINVAL);
+		}
+
+	if ( InitRandStreamSplit(rs, EnumFireEnvRandStreamIgnitionTime, &fe->ig->rs_time)
+			|| InitRandStreamSplit(rs, EnumFireEnvRandStreamIgnitionLoc, &fe->ig->rs_loc)
+			|| InitRandStreamSplit(rs, EnumFireEnvRandStreamWindAzimuth, &fe->waz->rs)
+			|| InitRandStreamSplit(rs, EnumFireEnvRandStreamWindSpd, &fe->wsp->rs)
+			|| InitRandStreamSplit(rs, EnumFireEnvRandStreamDeadFuelMoist, &fe->dfm->rs)
+			|| InitRandStreamSplit(rs, EnumFireEnvRandStreamLiveFuelMoist, &fe->lfm->rs)
+			|| InitRandStreamSplit(rs, EnumFireEnvRandStreamSantaAna, &fe->sa->rs) )	{
+		ERR_ERROR("Unable to set random number streams of FireEnv. \n", ERR_EFAILED);
+		}
+
+	return ERR_SUCCESS;
+	}
+
 void FreeFireEnv(FireEnv * fe)	{
 	if ( fe != NULL )	{
+		FreeIgnitionState(fe->ig);
+		FreeWindAzimuthState(fe->waz);
+		FreeWindSpdState(fe->wsp);
+		FreeDeadFuelMoistState(fe->dfm);
+		FreeLiveFuelMoistState(fe->lfm);
+		FreeSantaAnaState(fe->sa);
+		FreeExtinctionState(fe->ext);
 		free(fe);
 		}
 	fe = NULL;
@@ -33,6 +33,15 @@
 #include "GridData.h"
 #include "FireYear.h"
 #include "List.h"
+#include "SimConfig.h"
+#include "Ignition.h"
+#include "WindAzimuth.h"
+#include "WindSpd.h"
+#include "DeadFuelMoist.h"
+#include "LiveFuelMoist.h"
+#include "SantaAna.h"
+#include "Extinction.h"
+#include "RandStream.h"
 #include "Err.h"
 
 /*
@@ -40,6 +49,21 @@
  * DEFINES, ENUMS
  *********************************************************
  */
+
+/*! \enum EnumFireEnvRandStream_
+ *	\brief identifies the purpose of each child random number stream split from the stream of a FireEnv
+ *	Values are the ids passed to InitRandStreamSplit and must not change, otherwise a seed no longer
+ *	reproduces the simulations run with it.
+ */
+enum EnumFireEnvRandStream_	{
+	EnumFireEnvRandStreamIgnitionTime	= 1,	/*!< time of ignitions */
+	EnumFireEnvRandStreamIgnitionLoc	= 2,	/*!< location of ignitions */
+	EnumFireEnvRandStreamWindAzimuth	= 3,	/*!< wind azimuth */
+	EnumFireEnvRandStreamWindSpd		= 4,	/*!< windspeed */
+	EnumFireEnvRandStreamDeadFuelMoist	= 5,	/*!< dead fuel moisture */
+	EnumFireEnvRandStreamLiveFuelMoist	= 6,	/*!< live fuel moisture */
+	EnumFireEnvRandStreamSantaAna		= 7		/*!< Santa Ana occurence and environment */
+	};
  
 /*
  *********************************************************
@@ -47,6 +71,34 @@
  *********************************************************
  */
 
+/*! Type name for EnumFireEnvRandStream_
+ *	\sa For a list of constants goto EnumFireEnvRandStream_
+ */
+typedef enum EnumFireEnvRandStream_ EnumFireEnvRandStream;
+
+/*! Type name for FireEnvTables_ 
+ *	\sa For a list of members got FireEnvTables_
+ */
+typedef struct FireEnvTables_ FireEnvTables;
+
+/*!	\struct FireEnvTables_ FireEnv.h "FireEnv.h"
+ *	\brief tables read by the environment functions
+ *	The tables are read once, before any simulation starts, and are not modified afterwards, so the
+ *	FireEnv of every simulation shares them.  Only the tables of the configured types are read.
+ */
+struct FireEnvTables_	{
+	/*! tables of the wind azimuth functions */
+	WindAzimuthTables * waz;
+	/*! tables of the windspeed functions */
+	WindSpdTables * wsp;
+	/*! tables of the dead fuel moisture functions */
+	DeadFuelMoistTables * dfm;
+	/*! tables of the live fuel moisture functions */
+	LiveFuelMoistTables * lfm;
+	/*! tables of the Santa Ana functions */
+	SantaAnaTables * sa;
+	};
+
 /*! Type name for FireEnv_ 
  *	\sa For a list of members got FireEnv_
  */
@@ -54,36 +106,53 @@ typedef struct FireEnv_ FireEnv;
 
 /*!	\struct FireEnv_ FireEnv.h "FireEnv.h"
  *	\brief structure stores pointers to functions that retrieve environmental parameters during simulation
+ *	The state each function keeps between calls (last date retrieved, random numbers) is owned by
+ *	the FireEnv and passed to the function, so two FireEnv never share state.  The tables the
+ *	functions read are shared through FireEnvTables.
  *	\sa Check the \htmlonly <a href="config_file_doc.html">config file documentation</a> \endhtmlonly 
  */
 struct FireEnv_	{
-	/*! retrieves a (potentially) time and space dependent fuels dataset */
-	int			(* GetFuelsRegrowthFromProps)		(ChHashTable * proptbl, GridData * std_age, GridData ** fuels);
+	/*! retrieves a (potentially) time and space dependent fuels dataset, refilling fuels of previous year */
+	int			(* GetFuelsRegrowthFromProps)		(ChHashTable * proptbl, const SimConfig * cfg, GridData * std_age, GridData ** fuels, int * is_changed);
 	/*! retrieves a (potentially) time dependent ignition occurence */
-	int			(* IsIgnitionNowFromProps)			(ChHashTable * proptbl);
+	int			(* IsIgnitionNowFromProps)			(IgnitionState * st, const SimConfig * cfg);
 	/*! retrieves a (potentially) space dependent ignition location */
-	int			(* GetIgnitionLocFromProps)			(ChHashTable * proptbl, FireYear * fy, List ** rwxylist);
+	int			(* GetIgnitionLocFromProps)			(IgnitionState * st, ChHashTable * proptbl, const SimConfig * cfg, FireYear * fy, List ** rwxylist);
 	/*! retrieves a (potentially) time and space dependent wind direction */	
-	int 		(* GetWindAzimuthFromProps)			(ChHashTable * proptbl, int month, int day, int hour, 
+	int 		(* GetWindAzimuthFromProps)			(WindAzimuthState * st, ChHashTable * proptbl, int month, int day, int hour, 
 														double rwx, double rwy, double * waz);
 	/*! retrieves a (potentially) time and space dependent windspeed in mps */
-	int 		(* GetWindSpeedMpsFromProps)		(ChHashTable * proptbl, double fbedhgtm, 
+	int 		(* GetWindSpeedMpsFromProps)		(WindSpdState * st, ChHashTable * proptbl, double fbedhgtm, 
 														int month, int day, int hour, 
 														double rwx, double rwy, double * wspmps);
 	/*! retrieves a (potentially) time and space dependent dead fuel moisture */
-	int			(* GetDeadFuelMoistFromProps)		(ChHashTable * proptbl, int month, int day, int hour, 
+	int			(* GetDeadFuelMoistFromProps)		(DeadFuelMoistState * st, ChHashTable * proptbl, int month, int day, int hour, 
 														double rwx, double rwy, 
                             double * d1hfm, double * d10hfm, double * d100hfm);
 	/*! retrieves a (potentially) time and space dependent live fuel moisture */
-	int 		(* GetLiveFuelMoistFromProps)		(ChHashTable * proptbl, int year, int month, int day, int hour,
+	int 		(* GetLiveFuelMoistFromProps)		(LiveFuelMoistState * st, ChHashTable * proptbl, int year, int month, int day, int hour,
 														double rwx, double rwy, 
 														double * lhfm, double * lwfm);																									
 	/*! retrieves a (potentially) time dependent Santa Ana occurence */
-	int			(* IsSantaAnaNowFromProps)			(ChHashTable * proptbl, int year, int month, int day);
+	int			(* IsSantaAnaNowFromProps)			(SantaAnaState * st, ChHashTable * proptbl, int year, int month, int day);
 	/*! retrieves a (potentially) time dependent Santa Ana wind direction, speed, and dead fuel moisture */
-	int			(* GetSantaAnaEnvFromProps)			(ChHashTable * proptbl, int month, int day, int hour,
+	int			(* GetSantaAnaEnvFromProps)			(SantaAnaState * st, ChHashTable * proptbl, int month, int day, int hour,
 														double * waz, double fbedhgtm, double * wspmps,
 														double * d1hfm, double * d10hfm, double * d100hfm);
+	/*! state of the ignition functions */
+	IgnitionState * ig;
+	/*! state of the wind azimuth functions */
+	WindAzimuthState * waz;
+	/*! state of the windspeed functions */
+	WindSpdState * wsp;
+	/*! state of the dead fuel moisture functions */
+	DeadFuelMoistState * dfm;
+	/*! state of the live fuel moisture functions */
+	LiveFuelMoistState * lfm;
+	/*! state of the Santa Ana functions */
+	SantaAnaState * sa;
+	/*! state of the extinction of cells by hours burning */
+	ExtinctionState * ext;
 	};
 	 
 /*
@@ -98,15 +167,44 @@ struct FireEnv_	{
  *********************************************************
  */
 
+/*!	\fn FireEnvTables * InitFireEnvTables()
+ * 	\brief Initializes a FireEnvTables structure with empty tables for each environment function.
+ * 	\sa FireEnvTables
+ * 	\retval FireEnvTables* Ptr to initialized FireEnvTables structure, or NULL if unable to allocate
+ */
+FireEnvTables * InitFireEnvTables();
+
+/*! \fn void FreeFireEnvTables(FireEnvTables * fet)
+ * 	\brief Frees memory associated with a FireEnvTables structure and the tables of each environment function
+ *
+ *	Every FireEnv using the tables must be freed first.
+ *	\sa FireEnvTables
+ * 	\param fet FireEnvTables struct to free memory of
+ */ 							
+void FreeFireEnvTables(FireEnvTables * fet); 
+
 /*!	\fn FireEnv * InitFireEnv()
- * 	\brief Initializes an empty FireEnv structure.
+ * 	\brief Initializes an empty FireEnv structure with the initial state of each environment function.
  * 	\sa FireEnv
- * 	\retval FireEnv* Ptr to initialized FireEnv structure
+ * 	\retval FireEnv* Ptr to initialized FireEnv structure, or NULL if unable to allocate
  */
 FireEnv * InitFireEnv();
 
+/*!	\fn int FireEnvSetRandStream(FireEnv * fe, const RandStream * rs)
+ * 	\brief Sets the random numbers drawn by each environment function from child streams of rs.
+ *
+ *	Each purpose in EnumFireEnvRandStream draws from its own child stream, so the numbers drawn
+ *	for one purpose do not depend on how many numbers other purposes drew.  Call once after the
+ *	FireEnv is initialized and before the simulation starts.
+ * 	\sa FireEnv
+ * 	\param fe FireEnv
+ * 	\param rs stream of the simulation, not modified
+ *	\retval int ERR_SUCCESS(0) if successful, an error code otherwise
+ */
+int FireEnvSetRandStream(FireEnv * fe, const RandStream * rs);
+
 /*! \fn void FreeFireEnv(FireEnv * fe)
- * 	\brief Frees memory associated with a FireEnv structure
+ * 	\brief Frees memory associated with a FireEnv structure and the state of each environment function
  *
  *  Subsequent calls to methods taking FuelModel as argument will not work. 
  *	\sa FireEnv
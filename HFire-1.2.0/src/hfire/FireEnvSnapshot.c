@@ -0,0 +1,214 @@
+/*!
+ * \file FireEnvSnapshot.c
+ * \brief Environmental parameters evaluated once per timestep for use by every burning cell.
+ *
+ * \author Marco Morais
+ * \date 2000-2001
+ *
+ *	HFire (Highly Optmized Tolerance Fire Spread Model) Library
+ *	Copyright (C) 2001 Marco Morais
+ *
+ *	This library is free software; you can redistribute it and/or
+ *	modify it under the terms of the GNU Lesser General Public
+ *	License as published by the Free Software Foundation; either
+ *	version 2.1 of the License, or (at your option) any later version.
+ *
+ *	This library is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *	Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public
+ *	License along with this library; if not, write to the Free Software
+ *	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "FireEnvSnapshot.h"
+
+FireEnvSnapshot * InitFireEnvSnapshot(FireEnv * fe, List * fmlist)	{
+	FireEnvSnapshot * fes = NULL;
+	ListElmt * lel = NULL;
+	FuelModel * fm = NULL;
+	int n;
+
+	/* check args */
+	if ( fe == NULL || fmlist == NULL )	{
+		ERR_ERROR_CONTINUE("Arguments supplied to FireEnvSnapshot not initialized. \n", ERR_EINVAL);
+		return fes;
+		}
+
+	if ( (fes = (FireEnvSnapshot *) malloc(sizeof(FireEnvSnapshot))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to allocate memory for FireEnvSnapshot. \n", ERR_ENOMEM);
+		return fes;
+		}
+	fes->fm = NULL;
+	fes->fbedhgtm = NULL;
+	fes->wspmps = NULL;
+	fes->is_sa = 0;
+	fes->waz = fes->d1hfm = fes->d10hfm = fes->d100hfm = fes->lhfm = fes->lwfm = 0.0;
+
+	/* parameters read from spatial datasets must be retrieved at each cell */
+	fes->is_spatial_waz = ( fe->GetWindAzimuthFromProps == GetWindAzimuthSPATIALFromProps );
+	fes->is_spatial_wsp = ( fe->GetWindSpeedMpsFromProps == GetWindSpeedMpsSPATIALFromProps );
+	fes->is_spatial_dfm = ( fe->GetDeadFuelMoistFromProps == GetDeadFuelMoistSPATIALFromProps );
+	fes->is_spatial_lfm = ( fe->GetLiveFuelMoistFromProps == GetLiveFuelMoistSPATIALFromProps );
+
+	/* index fuel models by number */
+	fes->max_fmnum = -1;
+	for(lel = LIST_HEAD(fmlist); lel != NULL; lel = LIST_GET_NEXT_ELMT(lel))	{
+		fm = (FuelModel *) LIST_GET_DATA(lel);
+		if ( fm->model_num > fes->max_fmnum )	{
+			fes->max_fmnum = fm->model_num;
+			}
+		}
+	n = fes->max_fmnum + 1;
+	if ( n < 1
+			|| (fes->fm = (FuelModel **) calloc(n, sizeof(FuelModel *))) == NULL
+			|| (fes->fbedhgtm = (double *) calloc(n, sizeof(double))) == NULL
+			|| (fes->wspmps = (double *) calloc(n, sizeof(double))) == NULL )	{
+		FreeFireEnvSnapshot(fes);
+		ERR_ERROR_CONTINUE("Unable to allocate memory for FireEnvSnapshot fuel models. \n", ERR_ENOMEM);
+		return NULL;
+		}
+	for(lel = LIST_HEAD(fmlist); lel != NULL; lel = LIST_GET_NEXT_ELMT(lel))	{
+		fm = (FuelModel *) LIST_GET_DATA(lel);
+		if ( fm->model_num < 0 || fm->rfm == NULL )	{
+			continue;
+			}
+		fes->fm[fm->model_num] = fm;
+		fes->fbedhgtm[fm->model_num] = fm->rfm->fdepth;
+		if ( fm->rfm->units == EnumEnglishUnits )	{
+			fes->fbedhgtm[fm->model_num] = UNITS_FT_TO_M(fes->fbedhgtm[fm->model_num]);
+			}
+		}
+
+	return fes;
+	}
+
+int FireEnvSnapshotUpdate(FireEnvSnapshot * fes, FireEnv * fe, ChHashTable * proptbl, FireTimer * ft)	{
+	int k;
+
+	/* check args */
+	if ( fes == NULL || fe == NULL || proptbl == NULL || ft == NULL )	{
+		ERR_ERROR("Arguments supplied to update FireEnvSnapshot not initialized. \n", ERR_EINVAL);
+		}
+
+	/* retrieve Santa Ana time-dependent attributes */
+	fes->is_sa = IsSantaAnaNowFromProps(fe->sa, proptbl, ft->sim_cur_yr, ft->sim_cur_mo, ft->sim_cur_dy);
+	if ( fes->is_sa )	{
+		for(k = 0; k <= fes->max_fmnum; k++)	{
+			if ( fes->fm[k] == NULL )	{
+				continue;
+				}
+			if ( GetSantaAnaEnvFromProps(fe->sa, proptbl, ft->sim_cur_mo, ft->sim_cur_dy, ft->sim_cur_hr, &fes->waz,
+					fes->fbedhgtm[k], &fes->wspmps[k], &fes->d1hfm, &fes->d10hfm, &fes->d100hfm) )	{
+				ERR_ERROR("Unable to retrieve Santa Ana environment for FireEnvSnapshot. \n", ERR_EFAILED);
+				}
+			}
+		}
+	/* retrieve non Santa Ana time-dependent attributes */
+	else	{
+		if ( ! fes->is_spatial_dfm
+				&& fe->GetDeadFuelMoistFromProps(fe->dfm, proptbl, ft->sim_cur_mo, ft->sim_cur_dy, ft->sim_cur_hr, 0.0, 0.0,
+						&fes->d1hfm, &fes->d10hfm, &fes->d100hfm) )	{
+			ERR_ERROR("Unable to retrieve dead fuel moisture for FireEnvSnapshot. \n", ERR_EFAILED);
+			}
+		if ( ! fes->is_spatial_waz
+				&& fe->GetWindAzimuthFromProps(fe->waz, proptbl, ft->sim_cur_mo, ft->sim_cur_dy, ft->sim_cur_hr, 0.0, 0.0, &fes->waz) )	{
+			ERR_ERROR("Unable to retrieve wind azimuth for FireEnvSnapshot. \n", ERR_EFAILED);
+			}
+		if ( ! fes->is_spatial_wsp )	{
+			for(k = 0; k <= fes->max_fmnum; k++)	{
+				if ( fes->fm[k] == NULL )	{
+					continue;
+					}
+				if ( fe->GetWindSpeedMpsFromProps(fe->wsp, proptbl, fes->fbedhgtm[k], ft->sim_cur_mo, ft->sim_cur_dy, ft->sim_cur_hr,
+						0.0, 0.0, &fes->wspmps[k]) )	{
+					ERR_ERROR("Unable to retrieve wind speed for FireEnvSnapshot. \n", ERR_EFAILED);
+					}
+				}
+			}
+		}
+	/* retrieve live fuel moisture */
+	if ( ! fes->is_spatial_lfm
+			&& fe->GetLiveFuelMoistFromProps(fe->lfm, proptbl, ft->sim_cur_yr, ft->sim_cur_mo, ft->sim_cur_dy, ft->sim_cur_hr,
+					0.0, 0.0, &fes->lhfm, &fes->lwfm) )	{
+		ERR_ERROR("Unable to retrieve live fuel moisture for FireEnvSnapshot. \n", ERR_EFAILED);
+		}
+
+	return ERR_SUCCESS;
+	}
+
+int FireEnvSnapshotGetCell(const FireEnvSnapshot * fes, FireEnv * fe, ChHashTable * proptbl, FireTimer * ft,
+							int fmnum, double rwx, double rwy, double * waz, double * wspmps,
+							double * d1hfm, double * d10hfm, double * d100hfm, double * lhfm, double * lwfm)	{
+	/* check args */
+	if ( FIRE_ENV_SNAPSHOT_GET_FUEL_MODEL(fes, fmnum) == NULL )	{
+		ERR_ERROR("Fuel model supplied to FireEnvSnapshot not defined. \n", ERR_EINVAL);
+		}
+
+	/* Santa Ana parameters do not vary in space */
+	if ( fes->is_sa )	{
+		*waz = fes->waz;
+		*wspmps = fes->wspmps[fmnum];
+		*d1hfm = fes->d1hfm;
+		*d10hfm = fes->d10hfm;
+		*d100hfm = fes->d100hfm;
+		}
+	else	{
+		if ( fes->is_spatial_dfm )	{
+			if ( fe->GetDeadFuelMoistFromProps(fe->dfm, proptbl, ft->sim_cur_mo, ft->sim_cur_dy, ft->sim_cur_hr, rwx, rwy, d1hfm, d10hfm, d100hfm) )	{
+				return ERR_EFAILED;
+				}
+			}
+		else	{
+			*d1hfm = fes->d1hfm;
+			*d10hfm = fes->d10hfm;
+			*d100hfm = fes->d100hfm;
+			}
+		if ( fes->is_spatial_waz )	{
+			if ( fe->GetWindAzimuthFromProps(fe->waz, proptbl, ft->sim_cur_mo, ft->sim_cur_dy, ft->sim_cur_hr, rwx, rwy, waz) )	{
+				return ERR_EFAILED;
+				}
+			}
+		else	{
+			*waz = fes->waz;
+			}
+		if ( fes->is_spatial_wsp )	{
+			if ( fe->GetWindSpeedMpsFromProps(fe->wsp, proptbl, fes->fbedhgtm[fmnum], ft->sim_cur_mo, ft->sim_cur_dy, ft->sim_cur_hr, rwx, rwy, wspmps) )	{
+				return ERR_EFAILED;
+				}
+			}
+		else	{
+			*wspmps = fes->wspmps[fmnum];
+			}
+		}
+	if ( fes->is_spatial_lfm )	{
+		if ( fe->GetLiveFuelMoistFromProps(fe->lfm, proptbl, ft->sim_cur_yr, ft->sim_cur_mo, ft->sim_cur_dy, ft->sim_cur_hr, rwx, rwy, lhfm, lwfm) )	{
+			return ERR_EFAILED;
+			}
+		}
+	else	{
+		*lhfm = fes->lhfm;
+		*lwfm = fes->lwfm;
+		}
+
+	return ERR_SUCCESS;
+	}
+
+void FreeFireEnvSnapshot(void * vptr)	{
+	FireEnvSnapshot * fes = NULL;
+
+	if ( vptr != NULL )	{
+		fes = (FireEnvSnapshot *) vptr;
+		if ( fes->fm != NULL )			free(fes->fm);
+		if ( fes->fbedhgtm != NULL )	free(fes->fbedhgtm);
+		if ( fes->wspmps != NULL )		free(fes->wspmps);
+		free(fes);
+		}
+	fes = NULL;
+
+	return;
+	}
+
+/* end of FireEnvSnapshot.c */
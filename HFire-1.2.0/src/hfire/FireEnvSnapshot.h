@@ -0,0 +1,165 @@
+/*!
+ * \file FireEnvSnapshot.h
+ * \brief Environmental parameters evaluated once per timestep for use by every burning cell.
+ *
+ * \author Marco Morais
+ * \date 2000-2001
+ *
+ *	HFire (Highly Optmized Tolerance Fire Spread Model) Library
+ *	Copyright (C) 2001 Marco Morais
+ *
+ *	This library is free software; you can redistribute it and/or
+ *	modify it under the terms of the GNU Lesser General Public
+ *	License as published by the Free Software Foundation; either
+ *	version 2.1 of the License, or (at your option) any later version.
+ *
+ *	This library is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *	Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public
+ *	License along with this library; if not, write to the Free Software
+ *	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef	FireEnvSnapshot_H
+#define FireEnvSnapshot_H
+
+#include <stdlib.h>
+
+#include "ChHashTable.h"
+#include "List.h"
+#include "FireEnv.h"
+#include "FireTimer.h"
+#include "FuelModel.h"
+#include "WindAzimuth.h"
+#include "WindSpd.h"
+#include "DeadFuelMoist.h"
+#include "LiveFuelMoist.h"
+#include "SantaAna.h"
+#include "Units.h"
+#include "Err.h"
+
+/*
+ *********************************************************
+ * DEFINES, ENUMS
+ *********************************************************
+ */
+
+/*
+ *********************************************************
+ * STRUCTS, TYPEDEFS
+ *********************************************************
+ */
+
+/*! Type name for FireEnvSnapshot_
+ *	\sa For a list of members goto FireEnvSnapshot_
+ */
+typedef struct FireEnvSnapshot_ FireEnvSnapshot;
+
+/*! \struct FireEnvSnapshot_ FireEnvSnapshot.h "FireEnvSnapshot.h"
+ *	\brief environmental parameters of the current timestep and the fuel model of each fuel model number
+ *
+ *	Parameters which do not vary in space are retrieved once per timestep, and wind speed is stored
+ *	for the fuel bed height of each fuel model.  Parameters read from spatial datasets are flagged
+ *	and retrieved at each cell from the FireEnv.  The environment functions are called in the same
+ *	order as when they were called for each cell, so random draws are unchanged.
+ */
+struct FireEnvSnapshot_	{
+	/*! largest fuel model number */
+	int max_fmnum;
+	/*! FuelModel of each fuel model number, NULL if not defined */
+	FuelModel ** fm;
+	/*! fuel bed height of each fuel model number, in m */
+	double * fbedhgtm;
+	/*! wind speed at fuel bed height of each fuel model number, in m/s */
+	double * wspmps;
+	/*! flag set during Santa Ana event */
+	int is_sa;
+	/*! wind azimuth varies in space */
+	int is_spatial_waz;
+	/*! wind speed varies in space */
+	int is_spatial_wsp;
+	/*! dead fuel moisture varies in space */
+	int is_spatial_dfm;
+	/*! live fuel moisture varies in space */
+	int is_spatial_lfm;
+	/*! wind azimuth */
+	double waz;
+	/*! dead fuel moisture, 1 hour, 10 hour, and 100 hour */
+	double d1hfm, d10hfm, d100hfm;
+	/*! live fuel moisture, herbaceous and woody */
+	double lhfm, lwfm;
+	};
+
+/*
+ *********************************************************
+ * MACROS
+ *********************************************************
+ */
+
+/*! \def FIRE_ENV_SNAPSHOT_GET_FUEL_MODEL
+ *	\brief ptr to FuelModel of fuel model number fmnum, NULL if not defined
+ */
+#define FIRE_ENV_SNAPSHOT_GET_FUEL_MODEL(fes, fmnum)		(((fmnum) >= 0 && (fmnum) <= (fes)->max_fmnum) ? (fes)->fm[(fmnum)] : NULL)
+
+/*
+ *********************************************************
+ * PUBLIC FUNCTIONS
+ *********************************************************
+ */
+
+/*! \fn FireEnvSnapshot * InitFireEnvSnapshot(FireEnv * fe, List * fmlist)
+ * 	\brief Initializes a snapshot for the fuel models in fmlist and the environment functions of fe.
+ *
+ * 	\param fe FireEnv used during simulation
+ * 	\param fmlist list of FuelModels
+ * 	\retval FireEnvSnapshot* Ptr to FireEnvSnapshot, or NULL if unable to initialize
+ */
+FireEnvSnapshot * InitFireEnvSnapshot(FireEnv * fe, List * fmlist);
+
+/*! \fn int FireEnvSnapshotUpdate(FireEnvSnapshot * fes, FireEnv * fe, ChHashTable * proptbl, FireTimer * ft)
+ * 	\brief Retrieves the environmental parameters which do not vary in space at the current simulation time.
+ *
+ * 	\param fes FireEnvSnapshot
+ * 	\param fe FireEnv used during simulation
+ * 	\param proptbl simulation properties
+ * 	\param ft FireTimer storing current simulation time
+ *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
+ */
+int FireEnvSnapshotUpdate(FireEnvSnapshot * fes, FireEnv * fe, ChHashTable * proptbl, FireTimer * ft);
+
+/*! \fn int FireEnvSnapshotGetCell(const FireEnvSnapshot * fes, FireEnv * fe, ChHashTable * proptbl, FireTimer * ft, int fmnum, double rwx, double rwy, double * waz, double * wspmps, double * d1hfm, double * d10hfm, double * d100hfm, double * lhfm, double * lwfm)
+ * 	\brief Retrieves the environmental parameters of a single cell.
+ *
+ *	Values which do not vary in space are copied from the snapshot, the remainder are retrieved from fe.
+ * 	\param fes FireEnvSnapshot updated for the current simulation time
+ * 	\param fe FireEnv used during simulation
+ * 	\param proptbl simulation properties
+ * 	\param ft FireTimer storing current simulation time
+ * 	\param fmnum fuel model number of cell
+ * 	\param rwx real world x coordinate of cell
+ * 	\param rwy real world y coordinate of cell
+ * 	\param waz receives wind azimuth
+ * 	\param wspmps receives wind speed at fuel bed height, in m/s
+ * 	\param d1hfm receives dead 1 hour fuel moisture
+ * 	\param d10hfm receives dead 10 hour fuel moisture
+ * 	\param d100hfm receives dead 100 hour fuel moisture
+ * 	\param lhfm receives live herbaceous fuel moisture
+ * 	\param lwfm receives live woody fuel moisture
+ *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
+ */
+int FireEnvSnapshotGetCell(const FireEnvSnapshot * fes, FireEnv * fe, ChHashTable * proptbl, FireTimer * ft,
+							int fmnum, double rwx, double rwy, double * waz, double * wspmps,
+							double * d1hfm, double * d10hfm, double * d100hfm, double * lhfm, double * lwfm);
+
+/*! \fn void FreeFireEnvSnapshot(void * vptr)
+ * 	\brief Frees memory associated with FireEnvSnapshot structure.
+ *
+ *	\sa FireEnvSnapshot
+ * 	\param vptr ptr to FireEnvSnapshot
+ */
+void FreeFireEnvSnapshot(void * vptr);
+
+#endif FireEnvSnapshot_H		/* end of FireEnvSnapshot.h */
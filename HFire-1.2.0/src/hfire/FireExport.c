@@ -84,6 +84,8 @@ FireExport * InitFireExport(ChHashTable * proptbl)		{
 	fe->fyr 						= NULL;
 	fe->fuels						= NULL;
 	fe->std_age						= NULL;
+	fe->exp_month					= 0;
+	fe->exp_day						= 0;
 	/* set all function pointers */
 	fe->FireExportFireIDAscRaster	= FireExportFireIDAscRaster;
   fe->FireExportSantaAnaAscRaster = FireExportSantaAnaAscRaster;
@@ -99,10 +101,6 @@ FireExport * InitFireExport(ChHashTable * proptbl)		{
 }
 	
 int FireExportSpatialData(ChHashTable * proptbl, FireExport * fe)	{
-	/* static variables used to store state across function calls */
-	static int smonth 				= 0;
-	static int sday 				= 0;
-	static int shour 				= 0;
 	/* stack variables */
 	int do_export					= 0;
 	
@@ -121,11 +119,11 @@ int FireExportSpatialData(ChHashTable * proptbl, FireExport * fe)	{
 			do_export = 1;
 			break;
 		case EnumFreqDaily:
-			if ( (smonth != fe->ft->sim_cur_mo) || (sday != fe->ft->sim_cur_dy) )	{
+			if ( (fe->exp_month != fe->ft->sim_cur_mo) || (fe->exp_day != fe->ft->sim_cur_dy) )	{
 				do_export = 1;
 				/* set {month, day} for future calls */			
-				smonth = fe->ft->sim_cur_mo;
-				sday = fe->ft->sim_cur_dy;
+				fe->exp_month = fe->ft->sim_cur_mo;
+				fe->exp_day = fe->ft->sim_cur_dy;
 				}
 			break;
 		case EnumFreqAnnual:
@@ -210,7 +208,9 @@ int FireExportFireIDAscRaster(ChHashTable * proptbl, FireYear * fyr, FireTimer *
 int FireExportSantaAnaAscRaster(ChHashTable * proptbl, FireYear * fyr, FireTimer * ft) {
 	KeyVal * entry										= NULL;				/* key/val instances from table */
 	char sana_fname[FIRE_EXPORT_DEFAULT_FILENAME_SIZE] 	= {'\0'};
+	IntTwoDArray * sana = NULL;
 	int mt = 0;
+	int i, j, status;
 
 	/* check args */	
 	if ( proptbl == NULL  || ChHashTableRetrieve(proptbl, GetFireProp(PROP_EXPSADIR), (void *)&entry) )	{
@@ -231,9 +231,21 @@ int FireExportSantaAnaAscRaster(ChHashTable * proptbl, FireYear * fyr, FireTimer
 	sprintf(sana_fname, "%s//sana%d%02d%02d%04d.asc", entry->val, ft->sim_cur_yr, ft->sim_cur_mo, ft->sim_cur_dy, mt);
 	#endif
 	
+	/* unpack santa ana history from cell plane */
+	if ( (sana = InitIntTwoDArraySizeEmpty(fyr->plane->nrows, fyr->plane->ncols)) == NULL )	{
+		ERR_ERROR("Unable to allocate memory for santa ana data in function FireExportSantaAnaAscRaster. \n", ERR_ENOMEM);
+	}
+	for(i = 0; i < fyr->plane->nrows; i++)	{
+		for(j = 0; j < fyr->plane->ncols; j++)	{
+			INTTWODARRAY_SET_DATA(sana, i, j, FIRE_YEAR_GET_SANTA_ANA(fyr, i, j));
+		}
+	}
+
 	/* export data */
-	if ( ExportIntTwoDArrayAsAsciiRaster(fyr->santa_ana, fyr->xllcorner, fyr->yllcorner, 
-											fyr->cellsize, FIRE_YEAR_CELL_UNBURNABLE, sana_fname) )	{
+	status = ExportIntTwoDArrayAsAsciiRaster(sana, fyr->xllcorner, fyr->yllcorner, 
+											fyr->cellsize, FIRE_YEAR_CELL_UNBURNABLE, sana_fname);
+	FreeIntTwoDArray(sana);
+	if ( status )	{
 		ERR_ERROR("Unable to export santa ana data in function FireExportSantaAnaAscRaster. \n", ERR_EBADFUNC);
 	}
 			 		
@@ -404,11 +416,10 @@ int FireExportSantaAnaEvtTxtFile(ChHashTable * proptbl, int duration, int year,
 	return ERR_SUCCESS;				
 }
 
-int FireExportFireAreaTxtFile(ChHashTable * proptbl, FireYear * fy) {
+int FireExportFireAreaTxtFile(ChHashTable * proptbl, FireYear * fy, StandAgeYearStats * stats) {
 	KeyVal * entry					= NULL;				/* key/val instances from table */
 	FILE * fstream					= NULL;				/* file stream */
-	int i, j, id;
-  long int num_unburned = 0L, num_unburnable = 0L;
+	int i;
 
 	/* check args */	
 	if ( proptbl == NULL  || ChHashTableRetrieve(proptbl, GetFireProp(PROP_EXPFAREAF), (void *)&entry) )	{
@@ -420,19 +431,6 @@ int FireExportFireAreaTxtFile(ChHashTable * proptbl, FireYear * fy) {
 		return ERR_SUCCESS;
 	}
 
-  /* compute the count of unburnable and unburned cells */
-  for ( i = 0; i < fy->id->size_rows; ++i ) {
-    for ( j = 0; j < fy->id->size_cols; ++j ) {
-      /* increment the count of cells with matching id */
-      id = INTTWODARRAY_GET_DATA(fy->id, i, j);
-      if        ( id == FIRE_YEAR_ID_UNBURNABLE ) {
-        ++num_unburnable;
-      } else if ( id == FIRE_YEAR_ID_DEFAULT ) {
-        ++num_unburned;
-      }
-    }
-  }
-
 	/* open append stream to fire area file */
 	if ( (fstream = fopen((char *) entry->val, "a")) == NULL )	{	
 		ERR_ERROR("Unable to append to file containing Fire Area. \n", ERR_EIOFAIL);
@@ -440,9 +438,9 @@ int FireExportFireAreaTxtFile(ChHashTable * proptbl, FireYear * fy) {
 
   /* print the count of unburnable and unburned cells */
   fprintf(fstream, "%04d, %d, %ld, %ld\n", 
-    fy->year, FIRE_YEAR_ID_UNBURNABLE, num_unburnable, 0L);
+    fy->year, FIRE_YEAR_ID_UNBURNABLE, stats->num_unburnable, 0L);
   fprintf(fstream, "%04d, %d, %ld, %ld\n", 
-    fy->year, FIRE_YEAR_ID_DEFAULT, num_unburned, 0L);
+    fy->year, FIRE_YEAR_ID_DEFAULT, stats->num_unburned, 0L);
 
   /* use the counts from the fire info structure for burned cells */
   for ( i = 1 ; i <= fy->num_fires; ++i ) {
@@ -491,15 +489,10 @@ int FireExportFireInfoTxtFile(ChHashTable * proptbl, FireYear * fy) {
 	return ERR_SUCCESS;	
 }
 
-int FireExportAgeAtBurnHistTxtFile(ChHashTable * proptbl, FireYear * fy, GridData * std_age) {
+int FireExportAgeAtBurnHistTxtFile(ChHashTable * proptbl, FireYear * fy, StandAgeYearStats * stats) {
 	KeyVal * entry					= NULL;				/* key/val instances from table */
 	FILE * fstream					= NULL;				/* file stream */
-  long int 
-    num_unburned[AGE_AT_BURN_NUM_HIST_BINS], 
-    num_burned[AGE_AT_BURN_NUM_HIST_BINS], 
-    num_burned_sa[AGE_AT_BURN_NUM_HIST_BINS];
-	int i, j, id, sana;
-  long int age;
+	int i;
 
 	/* check args */	
 	if ( proptbl == NULL  || ChHashTableRetrieve(proptbl, GetFireProp(PROP_EXPAABHF), (void *)&entry) )	{
@@ -511,57 +504,19 @@ int FireExportAgeAtBurnHistTxtFile(ChHashTable * proptbl, FireYear * fy, GridDat
 		return ERR_SUCCESS;
 	}
 
-  /* initialize the state of all of the bins in the age at burn histograms */
-  memset(&num_unburned,  0,  sizeof(num_unburned[0])  * AGE_AT_BURN_NUM_HIST_BINS);
-  memset(&num_burned,    0,  sizeof(num_burned[0])    * AGE_AT_BURN_NUM_HIST_BINS);
-  memset(&num_burned_sa, 0,  sizeof(num_burned_sa[0]) * AGE_AT_BURN_NUM_HIST_BINS);
-
 	/* open append stream to fire info file */
 	if ( (fstream = fopen((char *) entry->val, "a")) == NULL )	{		
 		ERR_ERROR("Unable to append to file containing age at burn histogram. \n", ERR_EIOFAIL);
 	}
 
-  /* increment the counts in each bin based upon the fire year rasters */
-  for ( i = 0; i < fy->id->size_rows; ++i ) {
-    for ( j = 0; j < fy->id->size_cols; ++j ) {
-      /* extract the fire id at the cell */
-      id   = INTTWODARRAY_GET_DATA(fy->id, i, j);
-
-      /* cell is unburnable, skip analysis */
-      if ( id == FIRE_YEAR_ID_UNBURNABLE ) {
-        continue;
-      }
-
-      /* extract the stand age and saturate to histogram limits */
-      GRID_DATA_GET_DATA(std_age, i, j, age);
-      if      ( age < 1 )     
-        { age = 1; }      /* should not happen */
-      else if ( age > AGE_AT_BURN_NUM_HIST_BINS ) 
-        { age = AGE_AT_BURN_NUM_HIST_BINS; }
-
-      /* cell was not burned */
-      if ( id == FIRE_YEAR_ID_DEFAULT ) {
-        ++num_unburned[age-1];      
-      }
-      /* cell was burned */
-      else {
-        ++num_burned[age-1];
-        sana = INTTWODARRAY_GET_DATA(fy->santa_ana, i, j);
-        if ( sana == FIRE_YEAR_CELL_BURNED_SA ) {
-          ++num_burned_sa[age-1];
-        }
-      }
-    }
-  }
-
   /* print the contents of the histogram to file */
   for ( i = 0; i < AGE_AT_BURN_NUM_HIST_BINS; ++i ) {
     fprintf(fstream, "%04d, %ld, %ld, %ld, %ld\n",
       fy->year,
       i+1, /* stand age */
-      num_unburned[i],
-      num_burned[i],
-      num_burned_sa[i]);
+      stats->hist_unburned[i],
+      stats->hist_burned[i],
+      stats->hist_burned_sa[i]);
   }
   fclose(fstream);
 
@@ -39,6 +39,7 @@
 
 #include "FireTimer.h"
 #include "FireYear.h"
+#include "StandAge.h"
 #include "FireProp.h"
 #include "GridData.h"
 #include "ChHashTable.h"
@@ -59,7 +60,7 @@
 #define FIRE_EXPORT_DEFAULT_TITLE_SIZE							(40)
 
 /* number of bins in the age at burn histogram */
-#define AGE_AT_BURN_NUM_HIST_BINS                   (100)
+#define AGE_AT_BURN_NUM_HIST_BINS                   (STAND_AGE_NUM_HIST_BINS)
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
@@ -105,6 +106,10 @@ struct FireExport_	{
 	GridData * fuels;
 	/*! ptr to stand age dataset */
 	GridData * std_age;
+	/*! month of the last daily export */
+	int exp_month;
+	/*! day of the last daily export */
+	int exp_day;
 	/*! function ptr to fire id export */
 	int (* FireExportFireIDAscRaster)	(ChHashTable * proptbl, FireYear * fyr, FireTimer * ft);
 	/*! function ptr to santa ana export */
@@ -246,11 +251,11 @@ int FireExportIgLocsTxtFile(ChHashTable * proptbl, int id, double rwx, double rw
  */
 int FireExportSantaAnaEvtTxtFile(ChHashTable * proptbl, int duration, int year, int month, int day);
 
-int FireExportFireAreaTxtFile(ChHashTable * proptbl, FireYear * fy);
+int FireExportFireAreaTxtFile(ChHashTable * proptbl, FireYear * fy, StandAgeYearStats * stats);
 
 int FireExportFireInfoTxtFile(ChHashTable * proptbl, FireYear * fy);
 
-int FireExportAgeAtBurnHistTxtFile(ChHashTable * proptbl, FireYear * fy, GridData * std_age);
+int FireExportAgeAtBurnHistTxtFile(ChHashTable * proptbl, FireYear * fy, StandAgeYearStats * stats);
 
 /*! \fn void FreeFireExport(FireExport * fe)
  * 	\brief Frees memory associated with FireExport structure.
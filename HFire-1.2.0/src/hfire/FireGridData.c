@@ -24,16 +24,17 @@
  
 #include "FireGridData.h"
 	
-GridData * GetGridDataFromPropsFireGridData(ChHashTable * proptbl, char * data_keyword)	{
+GridData * GetGridDataFromPropsFireGridData(ChHashTable * proptbl, const SimConfig * cfg, char * data_keyword)	{
 	GridData * grid 		= NULL;					/* returned grid */
 	EnumGridType grid_type 	= EnumFltGrid;			/* default grid type is float */
 	int is_ascii 			= -1;					/* raster data format set invalid by default */
+	int is_tiled			= 0;					/* binary raster read as tiles on demand */
 	char * main_fname 		= NULL;					/* name of main file */
 	char * hdr_fname 		= NULL;					/* name of hdr file if is_ascii == 0 */
 	KeyVal * entry			= NULL;					/* entry retrieved from Hash Table */
 	char key[FIRE_PROP_MAX_SIZE_KEYWORD];
 
-	if ( proptbl == NULL || data_keyword == NULL )	{
+	if ( proptbl == NULL || cfg == NULL || data_keyword == NULL )	{
 		ERR_ERROR_CONTINUE("Unable to initialize GridData with table. \n", ERR_EINVAL);
 		return grid;
 		}	
@@ -52,6 +53,11 @@ GridData * GetGridDataFromPropsFireGridData(ChHashTable * proptbl, char * data_k
 	else if ( strcmp(entry->val, GetFireVal(VAL_BINARY)) == 0  )	{
 		is_ascii = 0;
 		}
+	else if ( strcmp(entry->val, GetFireVal(VAL_TILED)) == 0  )	{
+		/* TILED reads a BINARY raster through a tiled copy of it */
+		is_ascii = 0;
+		is_tiled = 1;
+		}
 	else	{
 		ERR_ERROR_CONTINUE("Unrecognized RASTER_FORMAT property for GridData. \n", ERR_EINVAL);
 		return grid;
@@ -69,7 +75,7 @@ GridData * GetGridDataFromPropsFireGridData(ChHashTable * proptbl, char * data_k
 	
 	/* determine HDR_FILE */
 	if ( is_ascii == 0 )	{
-		/* only BINARY files have separate human readable header files */
+		/* only BINARY and TILED files have separate human readable header files */
 		key[0] = '\0';
 		strcpy(key, data_keyword);
 		strcat(key, FIRE_GRIDDATA_HEADER_FILE);
@@ -106,19 +112,48 @@ GridData * GetGridDataFromPropsFireGridData(ChHashTable * proptbl, char * data_k
 	/* construct an instance of the grid */
 	switch(is_ascii)	{
 		case 1:
-			grid = InitGridDataFromAsciiRaster(main_fname, grid_type);
+			grid = InitGridDataFromAsciiRasterFireGridData(proptbl, main_fname, grid_type);
 			break;
 		case 0:
-			grid = InitGridDataFromBinaryRaster(main_fname, hdr_fname, grid_type);
+			if ( is_tiled )	{
+				grid = InitGridDataFromBinaryRasterTilesFireGridData(cfg, main_fname, hdr_fname, grid_type);
+				}
+			else	{
+				grid = InitGridDataFromBinaryRaster(main_fname, hdr_fname, grid_type);
+				}
 			break;
 		default:
-			ERR_ERROR_CONTINUE("Raster format specified in config file should be ASCII or BINARY. \n", ERR_EFAILED);
+			ERR_ERROR_CONTINUE("Raster format specified in config file should be ASCII, BINARY or TILED. \n", ERR_EFAILED);
 			break;
 		}
 	
 	return grid;	
 	}
 
+GridData * InitGridDataFromAsciiRasterFireGridData(ChHashTable * proptbl, char * main_fname, EnumGridType grid_type)	{
+	KeyVal * entry			= NULL;					/* entry retrieved from Hash Table */
+
+	/* NULL RASTER_CACHE_DIR parses the raster on every run */
+	if ( proptbl == NULL 
+			|| ChHashTableRetrieve(proptbl, GetFireProp(PROP_RASTCACHE), (void *)&entry) 
+			|| strcmp(entry->val, GetFireVal(VAL_NULL)) == 0 )	{
+		return InitGridDataFromAsciiRaster(main_fname, grid_type);
+		}
+	
+	return InitGridDataFromAsciiRasterCache(main_fname, (char *) entry->val, grid_type);
+	}
+
+GridData * InitGridDataFromBinaryRasterTilesFireGridData(const SimConfig * cfg, char * main_fname, char * hdr_fname, EnumGridType grid_type)	{
+	int cache_mb			= 0;					/* 0 selects default memory used by tiles */
+
+	/* RASTER_TILE_CACHE_MB was range checked when SimConfig was loaded */
+	if ( cfg != NULL )	{
+		cache_mb = cfg->tile_cache_mb;
+		}
+
+	return InitGridDataFromBinaryRasterTiles(main_fname, hdr_fname, grid_type, cache_mb);
+	}
+
 int IsGridDataMatchingFireGridData(GridData * agd, GridData * bgd)	{
 	if ( agd != NULL && bgd != NULL )	{
 		if ( agd->ghdr->nrows == bgd->ghdr->nrows 
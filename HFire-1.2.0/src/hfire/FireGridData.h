@@ -30,6 +30,8 @@
 
 #include "FireProp.h"
 #include "GridData.h"
+#include "GridDataCache.h"
+#include "SimConfig.h"
 #include "ChHashTable.h"
 #include "KeyVal.h"
 #include "Err.h"
@@ -75,7 +77,36 @@
  *********************************************************
  */
 
-GridData * GetGridDataFromPropsFireGridData(ChHashTable * proptbl, char * data_keyword);
+GridData * GetGridDataFromPropsFireGridData(ChHashTable * proptbl, const SimConfig * cfg, char * data_keyword);
+
+/*! \fn GridData * InitGridDataFromAsciiRasterFireGridData(ChHashTable * proptbl, char * main_fname, EnumGridType grid_type)
+ *	\brief Initializes GridData from an ascii raster, through the binary cache in RASTER_CACHE_DIR when set.
+ *
+ *	A cache matching the size and checksum of the raster is mapped into memory, otherwise the
+ *	raster is parsed and its cache rewritten.  When RASTER_CACHE_DIR is NULL the raster is parsed.
+ *	\sa GridData
+ *	\sa Check the \htmlonly <a href="config_file_doc.html#RASTER">config file documentation</a> \endhtmlonly 
+ *	\param proptbl simulation properties
+ *	\param main_fname name of ascii raster
+ *	\param grid_type enumeration of grid data type
+ *	\retval GridData* Ptr to GridData, or NULL if unable to initialize
+ */
+GridData * InitGridDataFromAsciiRasterFireGridData(ChHashTable * proptbl, char * main_fname, EnumGridType grid_type);
+
+/*! \fn GridData * InitGridDataFromBinaryRasterTilesFireGridData(const SimConfig * cfg, char * main_fname, char * hdr_fname, EnumGridType grid_type)
+ *	\brief Initializes GridData from a binary raster whose cells are read in tiles as they are accessed.
+ *
+ *	A tiled copy of the raster is written next to it when missing or older than the raster.  Memory
+ *	used by tiles held at once is RASTER_TILE_CACHE_MB, or a default when NULL.
+ *	\sa GridData
+ *	\sa Check the \htmlonly <a href="config_file_doc.html#RASTER">config file documentation</a> \endhtmlonly 
+ *	\param cfg SimConfig holding the tile cache size
+ *	\param main_fname name of binary raster
+ *	\param hdr_fname name of header of binary raster
+ *	\param grid_type enumeration of grid data type
+ *	\retval GridData* Ptr to GridData, or NULL if unable to initialize
+ */
+GridData * InitGridDataFromBinaryRasterTilesFireGridData(const SimConfig * cfg, char * main_fname, char * hdr_fname, EnumGridType grid_type);
 
 /*! \fn int IsGridDataMatchingFireGridData(GridData * agd, GridData * bgd)
  *	\brief Tests two GridData rasters to ensure header information identical for each.
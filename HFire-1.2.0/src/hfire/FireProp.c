@@ -122,7 +122,22 @@ static const char * propstr [] = {
   "EXPORT_FIRE_INFO_FILE",
   "FIRE_FAILED_IGNITION_NUM_CELLS",
   "EXPORT_SANTA_ANA_RASTER_DIR",
-  "EXPORT_AGE_AT_BURN_HIST_FILE"
+  "EXPORT_AGE_AT_BURN_HIST_FILE",
+  "SIMULATION_NUM_THREADS",
+  "ROS_TABLE_TYPE",
+  "ROS_TABLE_ENTRIES_PER_FUEL_MODEL",
+  "ROS_TABLE_MOIST_STEP",
+  "ROS_TABLE_WIND_SPEED_STEP",
+  "ROS_TABLE_AZIMUTH_STEP",
+  "ROS_TABLE_SLOPE_STEP",
+  "ROS_TABLE_MAX_REL_ERROR",
+  "TERRAIN_DIST_CACHE_TYPE",
+  "SIMULATION_SPREAD_ENGINE",
+  "SIMULATION_ADAPTIVE_TIMESTEP",
+  "RASTER_CACHE_DIR",
+  "RASTER_TILE_CACHE_MB",
+  "ENSEMBLE_NUM_REPLICATES",
+  "ENSEMBLE_OUTPUT_DIR"
 };
 
 static const char * valstr [] =	{
@@ -160,7 +175,15 @@ static const char * valstr [] =	{
 	"PHYS",
   "AB79",
   "BHP",
-  "NOWAF"
+  "NOWAF",
+  "LOOKUP",
+  "VALIDATE",
+  "HALF",
+  "SWEEP",
+  "EVENT",
+  "GLOBAL",
+  "FIRE",
+  "TILED"
 };
 	
 const char * GetFireProp(EnumFireProp p)	{
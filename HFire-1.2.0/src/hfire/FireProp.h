@@ -146,7 +146,22 @@ enum EnumFireProp_ {
   PROP_FFIGNCELLS = 95,       /*"FIRE_FAILED_IGNITION_NUM_CELLS"*/
   PROP_EXPSADIR   = 96,       /*"EXPORT_SANTA_ANA_RASTER_DIR"*/
   PROP_EXPAABHF   = 97,       /*"EXPORT_AGE_AT_BURN_HIST_FILE"*/
-	PROP_UP_BOUND	  = 98				/* DO NOT EDIT- UPPER ENUMERATION BOUNDS */	
+  PROP_SIMNUMTHRD = 98,       /*"SIMULATION_NUM_THREADS"*/
+  PROP_ROSTBLTYP  = 99,       /*"ROS_TABLE_TYPE"*/
+  PROP_ROSTBLSZ   = 100,      /*"ROS_TABLE_ENTRIES_PER_FUEL_MODEL"*/
+  PROP_ROSTBLMST  = 101,      /*"ROS_TABLE_MOIST_STEP"*/
+  PROP_ROSTBLWSP  = 102,      /*"ROS_TABLE_WIND_SPEED_STEP"*/
+  PROP_ROSTBLAZ   = 103,      /*"ROS_TABLE_AZIMUTH_STEP"*/
+  PROP_ROSTBLSLP  = 104,      /*"ROS_TABLE_SLOPE_STEP"*/
+  PROP_ROSTBLERR  = 105,      /*"ROS_TABLE_MAX_REL_ERROR"*/
+  PROP_TDCTYP     = 106,      /*"TERRAIN_DIST_CACHE_TYPE"*/
+  PROP_SIMENGINE  = 107,      /*"SIMULATION_SPREAD_ENGINE"*/
+  PROP_SIMADAPT   = 108,      /*"SIMULATION_ADAPTIVE_TIMESTEP"*/
+  PROP_RASTCACHE  = 109,      /*"RASTER_CACHE_DIR"*/
+  PROP_RASTTILEMB = 110,      /*"RASTER_TILE_CACHE_MB"*/
+  PROP_ENSNUMREP  = 111,      /*"ENSEMBLE_NUM_REPLICATES"*/
+  PROP_ENSOUTDIR  = 112,      /*"ENSEMBLE_OUTPUT_DIR"*/
+	PROP_UP_BOUND	  = 113				/* DO NOT EDIT- UPPER ENUMERATION BOUNDS */	
 };
 
 /*! \enum EnumFireVal_
@@ -190,7 +205,15 @@ enum EnumFireVal_	{
   VAL_AB79        = 32,       /*"AB79"*/
   VAL_BHP         = 33,       /*"BHP"*/
   VAL_NOWAF       = 34,       /*"NOWAF"*/
-	VAL_UP_BOUND	  = 35				/* DO NOT EDIT- UPPER ENUMERATION BOUNDS */		
+  VAL_LOOKUP      = 35,       /*"LOOKUP"*/
+  VAL_VALIDATE    = 36,       /*"VALIDATE"*/
+  VAL_HALF        = 37,       /*"HALF"*/
+  VAL_SWEEP       = 38,       /*"SWEEP"*/
+  VAL_EVENT       = 39,       /*"EVENT"*/
+  VAL_GLOBAL      = 40,       /*"GLOBAL"*/
+  VAL_FIRE        = 41,       /*"FIRE"*/
+  VAL_TILED       = 42,       /*"TILED"*/
+	VAL_UP_BOUND	  = 43				/* DO NOT EDIT- UPPER ENUMERATION BOUNDS */		
 };
 	 
 /*
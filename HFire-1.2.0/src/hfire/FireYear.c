@@ -26,11 +26,29 @@
 
 #include <string.h>
 
+/* state shared with the workers initializing fire ids from fuels */
+typedef struct	{
+	FireYear * fy;								/* fire year being initialized */
+	GridData * fuels;							/* fuels spatial data */
+	ChHashTable * fmtble;						/* table of FuelModels */
+	int * fm_rows;								/* one row of fuel model nums for each worker */
+}
+fire_year_fuels_job_t;
+
+static int SetFireYearFuelsThreadPool(ThreadPool * tp, FireYear * fy, GridData * fuels, ChHashTable * fmtble);
+
+static int InitFireYearFuelsRows(void * arg, int worker, int begin, int end);
+
+static void FireYearAddTouchedCell(FireYear * fy, int i, int j);
+
+static void FireYearResetFailedIgnitionCell(FireYear * fy, int i, int j);
+
 FireYear * InitFireYearFuels(int year, GridData * fuels, ChHashTable * fmtble)	{
+	return InitFireYearFuelsThreadPool(NULL, year, fuels, fmtble, NULL);
+}
+
+FireYear * InitFireYearFuelsThreadPool(ThreadPool * tp, int year, GridData * fuels, ChHashTable * fmtble, CellPlane * plane)	{
 	FireYear * fy 	= NULL;
-	FuelModel * fm 	= NULL;
-	int cell_fm_num;
-	int i, j;
 	
 	/* check args */
 	if ( fuels == NULL )	{
@@ -41,6 +59,10 @@ FireYear * InitFireYearFuels(int year, GridData * fuels, ChHashTable * fmtble)	{
 		ERR_ERROR_CONTINUE("Unable to intialize FireYear, year cannot be less than 0. \n", ERR_EINVAL);
 		return fy;
 	}
+	if ( plane != NULL && (plane->nrows != fuels->ghdr->nrows || plane->ncols != fuels->ghdr->ncols) )	{
+		ERR_ERROR_CONTINUE("Unable to initialize FireYear, CellPlane not same size as fuels. \n", ERR_EINVAL);
+		return fy;
+	}
 		
 	/* allocate memory for structure */
 	if ( (fy = (FireYear *) malloc(sizeof(FireYear))) == NULL )	{
@@ -54,9 +76,12 @@ FireYear * InitFireYearFuels(int year, GridData * fuels, ChHashTable * fmtble)	{
 	fy->xllcorner = fuels->ghdr->xllcorner;
 	fy->yllcorner = fuels->ghdr->yllcorner;
 	fy->cellsize = fuels->ghdr->cellsize;
+	fy->touched = NULL;
+	fy->num_touched = 0;
+	fy->cap_touched = 0;
 	
-	/* allocate memory for fire ids */
-	fy->id 	= InitIntTwoDArraySizeIniValue(fuels->ghdr->nrows, fuels->ghdr->ncols, FIRE_YEAR_ID_DEFAULT);
+	/* allocate memory for fire ids, every id is set from fuels below */
+	fy->id 	= InitIntTwoDArraySizeEmpty(fuels->ghdr->nrows, fuels->ghdr->ncols);
 	if ( fy->id == NULL )	{
 		ERR_ERROR_CONTINUE("Unable to allocate memory for fire ID raster. \n", ERR_ENOMEM);	
 		if ( fy != NULL ) {
@@ -66,9 +91,14 @@ FireYear * InitFireYearFuels(int year, GridData * fuels, ChHashTable * fmtble)	{
 		return fy;
 	}
 
-  /* allocate memory for santa ana history */
-  fy->santa_ana = InitIntTwoDArraySizeIniValue(fuels->ghdr->nrows, fuels->ghdr->ncols, FIRE_YEAR_CELL_NOT_BURNED);
-  if ( fy->santa_ana == NULL ) {
+  /* santa ana history is kept in the plane shared across years, allocated here if none supplied */
+  fy->plane = plane;
+  fy->owns_plane = 0;
+  if ( plane == NULL ) {
+    fy->plane = InitCellPlane(fuels->ghdr->nrows, fuels->ghdr->ncols);
+    fy->owns_plane = 1;
+  }
+  if ( fy->plane == NULL ) {
     ERR_ERROR_CONTINUE("Unable to allocate memory for santa ana history raster. \n", ERR_ENOMEM);
     FreeIntTwoDArray(fy->id );
     if ( fy != NULL ) {
@@ -78,25 +108,10 @@ FireYear * InitFireYearFuels(int year, GridData * fuels, ChHashTable * fmtble)	{
     return fy;
   }
 
-	/* initialize fire ids and santa ana history rasters */
-	for(i = 0; i < fuels->ghdr->nrows; i++)	{
-		for(j = 0; j < fuels->ghdr->ncols; j++)	{
-			/* retrieve fuel model attribute data */
-			GRID_DATA_GET_DATA(fuels, i, j, cell_fm_num);
-			if ( ChHashTableRetrieve(fmtble, &cell_fm_num, (void *)&fm) )	{
-				ERR_ERROR_CONTINUE("Unable to retrieve fuel model from fuels GridData. \n", ERR_EBADFUNC);
-				continue;
-			}
-			/* set fire id to unburnable */			
-			if ( fm->type == EnumRoth && fm->rfm->brntype == EnumRothUnBurnable )	{
-				INTTWODARRAY_SET_DATA(fy->id, i, j, FIRE_YEAR_ID_UNBURNABLE);
-        INTTWODARRAY_SET_DATA(fy->santa_ana, i, j, FIRE_YEAR_CELL_UNBURNABLE);
-			}
-			else if ( fm->type == EnumPhys && fm->pfm->brntype == EnumPhysUnBurnable )	{
-				INTTWODARRAY_SET_DATA(fy->id, i, j, FIRE_YEAR_ID_UNBURNABLE);
-        INTTWODARRAY_SET_DATA(fy->santa_ana, i, j, FIRE_YEAR_CELL_UNBURNABLE);
-			}
-		}
+	/* initialize fire ids and reset cell plane */
+	if ( SetFireYearFuelsThreadPool(tp, fy, fuels, fmtble) == ERR_ENOMEM )	{
+		FreeFireYear(fy);
+		return NULL;
 	}
 
   /* initialize the fire info */
@@ -105,6 +120,167 @@ FireYear * InitFireYearFuels(int year, GridData * fuels, ChHashTable * fmtble)	{
 	return fy;
 }	
 
+int ResetFireYearFuelsThreadPool(ThreadPool * tp, FireYear * fy, int year, GridData * fuels, ChHashTable * fmtble, int is_fuels_changed)	{
+	long int k;
+	int i, j, is_unburnable;
+
+	/* check args */
+	if ( fy == NULL || fy->id == NULL || fuels == NULL || year < 0 )	{
+		ERR_ERROR("Unable to reset FireYear, FireYear or fuels not initialized. \n", ERR_EINVAL);
+	}
+	if ( fuels->ghdr->nrows != INTTWODARRAY_SIZE_ROW(fy->id) || fuels->ghdr->ncols != INTTWODARRAY_SIZE_COL(fy->id) )	{
+		ERR_ERROR("Unable to reset FireYear, fuels not same size as FireYear. \n", ERR_EINVAL);
+	}
+
+	fy->year = year;
+	fy->xllcorner = fuels->ghdr->xllcorner;
+	fy->yllcorner = fuels->ghdr->yllcorner;
+	fy->cellsize = fuels->ghdr->cellsize;
+
+  /* only the fire info of fires in the previous year was set */
+  memset(&fy->finfo[0], 0, sizeof(FireInfo) * (fy->num_fires + 1));
+  fy->num_fires = 0;
+
+	if ( is_fuels_changed || fy->cap_touched < 0 )	{
+		/* every cell is reset from the new fuels */
+		if ( SetFireYearFuelsThreadPool(tp, fy, fuels, fmtble) )	{
+			ERR_ERROR("Unable to reset fire ids from fuels GridData. \n", ERR_EBADFUNC);
+		}
+		if ( fy->cap_touched < 0 )	{
+			fy->cap_touched = 0;
+		}
+	}
+	else	{
+		/* cells untouched in the previous year are already in their initial state */
+		for(k = 0; k < fy->num_touched; k++)	{
+			i = (int) (fy->touched[k] / INTTWODARRAY_SIZE_COL(fy->id));
+			j = (int) (fy->touched[k] % INTTWODARRAY_SIZE_COL(fy->id));
+			is_unburnable = CELL_PLANE_IS_UNBURNABLE(fy->plane, i, j);
+			INTTWODARRAY_SET_DATA(fy->id, i, j, ( is_unburnable ) ? FIRE_YEAR_ID_UNBURNABLE : FIRE_YEAR_ID_DEFAULT);
+			CELL_PLANE_INIT_CELL(fy->plane, i, j, is_unburnable);
+		}
+	}
+	fy->num_touched = 0;
+
+	return ERR_SUCCESS;
+}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Sets the fire id of every cell and resets every cell of the plane from fuels, rows of fuels
+ * divided among the workers of tp.
+ *
+ * Arguments:
+ * tp- workers sharing the rows of fuels, NULL to use the calling thread only
+ * fy- FireYear
+ * fuels- fuels spatial data
+ * fmtble- table of FuelModels
+ *
+ * Returns:
+ * ERR_SUCCESS(0) if operation successful, ERR_ENOMEM if no memory for rows of fuels, an error code otherwise
+ */
+static int SetFireYearFuelsThreadPool(ThreadPool * tp, FireYear * fy, GridData * fuels, ChHashTable * fmtble)	{
+	fire_year_fuels_job_t job;
+	int num_workers = THREAD_POOL_NUM_WORKERS(tp);
+
+	/* fuels are retrieved one row at a time by each worker */
+	job.fy = fy;
+	job.fuels = fuels;
+	job.fmtble = fmtble;
+	if ( (job.fm_rows = (int *) malloc(sizeof(int) * num_workers * fuels->ghdr->ncols)) == NULL )	{
+		ERR_ERROR("Unable to allocate memory for row of fuels. \n", ERR_ENOMEM);
+	}
+
+	/* initialize fire ids and reset cell plane, each worker over its own rows */
+	if ( ThreadPoolParallelFor(tp, fuels->ghdr->nrows, FIRE_YEAR_ROWS_PER_JOB, InitFireYearFuelsRows, &job) )	{
+		free(job.fm_rows);
+		ERR_ERROR("Unable to initialize fire ids from fuels GridData. \n", ERR_EBADFUNC);
+	}
+	free(job.fm_rows);
+
+	return ERR_SUCCESS;
+}
+
+/* ThreadPoolFunc setting fire ids from fuels and resetting cell plane in rows [begin, end) */
+static int InitFireYearFuelsRows(void * arg, int worker, int begin, int end)	{
+	fire_year_fuels_job_t * job = (fire_year_fuels_job_t *) arg;
+	int * fm_row = job->fm_rows + (size_t) worker * job->fuels->ghdr->ncols;
+	FuelModel * fm 	= NULL;
+	int cell_fm_num, last_fm_num = 0;
+	int is_unburnable = 0, is_last = 0;
+	int i, j;
+
+	for(i = begin; i < end; i++)	{
+		GetRowAsIntGridData(job->fuels, i, fm_row);
+		for(j = 0; j < job->fuels->ghdr->ncols; j++)	{
+			/* fuel model attribute data retrieved only when fuel model num changes along the row */
+			cell_fm_num = fm_row[j];
+			if ( !is_last || cell_fm_num != last_fm_num )	{
+				if ( ChHashTableRetrieve(job->fmtble, &cell_fm_num, (void *)&fm) )	{
+					ERR_ERROR_CONTINUE("Unable to retrieve fuel model from fuels GridData. \n", ERR_EBADFUNC);
+					INTTWODARRAY_SET_DATA(job->fy->id, i, j, FIRE_YEAR_ID_DEFAULT);
+					CELL_PLANE_INIT_CELL(job->fy->plane, i, j, 0);
+					is_last = 0;
+					continue;
+				}
+				is_unburnable = ( (fm->type == EnumRoth && fm->rfm->brntype == EnumRothUnBurnable)
+									|| (fm->type == EnumPhys && fm->pfm->brntype == EnumPhysUnBurnable) );
+				last_fm_num = cell_fm_num;
+				is_last = 1;
+			}
+			/* set fire id to unburnable, or to no fire */			
+			INTTWODARRAY_SET_DATA(job->fy->id, i, j, ( is_unburnable ) ? FIRE_YEAR_ID_UNBURNABLE : FIRE_YEAR_ID_DEFAULT);
+			/* cell state, santa ana history and hours burning start the year unburned */
+			CELL_PLANE_INIT_CELL(job->fy->plane, i, j, is_unburnable);
+		}
+	}
+
+	return ERR_SUCCESS;
+}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Adds a cell to the list of cells reset at the start of the next year.  If the list cannot grow
+ * it is discarded, and every cell is reset at the start of the next year.
+ *
+ * Arguments:
+ * fy- FireYear
+ * i- row index of cell
+ * j- column index of cell
+ *
+ * Returns:
+ * None
+ */
+static void FireYearAddTouchedCell(FireYear * fy, int i, int j)	{
+	long int * touched = NULL;
+	long int cap;
+
+	if ( fy->cap_touched < 0 )	{
+		return;
+	}
+	if ( fy->num_touched == fy->cap_touched )	{
+		cap = ( fy->cap_touched > 0 ) ? 2 * fy->cap_touched : FIRE_YEAR_TOUCHED_INI_CAP;
+		if ( (touched = (long int *) realloc(fy->touched, sizeof(long int) * cap)) == NULL )	{
+			free(fy->touched);
+			fy->touched = NULL;
+			fy->num_touched = 0;
+			fy->cap_touched = -1;
+			return;
+		}
+		fy->touched = touched;
+		fy->cap_touched = cap;
+	}
+	fy->touched[fy->num_touched++] = (long int) i * INTTWODARRAY_SIZE_COL(fy->id) + j;
+
+	return;
+}
+
 int FireYearGetCellIDRowCol(FireYear * fy, int i, int j, int * id)	{
 	/* check args */
 	if ( fy == NULL || fy->id == NULL )	{
@@ -192,6 +368,9 @@ int FireYearSetCellNewFireIDRealWorld(FireYear * fy, double rwx, double rwy, Fir
 		ERR_ERROR("Unable to set cell fire ID, real world coordinates out of range. \n", ERR_ERANGE);
 	}		
 
+  /* ignited cell is reset at the start of the next year, even if unburnable */
+  FireYearAddTouchedCell(fy, i, j);
+
   /* get the fire id at the cell */
   id = INTTWODARRAY_GET_DATA(fy->id, i, j);
 
@@ -213,10 +392,10 @@ int FireYearSetCellNewFireIDRealWorld(FireYear * fy, double rwx, double rwy, Fir
 
       if ( is_sa ) {
         fy->finfo[id].num_cells_burned_sa = 1;
-        INTTWODARRAY_SET_DATA(fy->santa_ana, i, j, FIRE_YEAR_CELL_BURNED_SA);
+        CELL_PLANE_SET_SA(fy->plane, i, j, FIRE_YEAR_CELL_BURNED_SA);
       }
       else {
-        INTTWODARRAY_SET_DATA(fy->santa_ana, i, j, FIRE_YEAR_CELL_BURNED_NO_SA);
+        CELL_PLANE_SET_SA(fy->plane, i, j, FIRE_YEAR_CELL_BURNED_NO_SA);
       }
     }
 
@@ -244,6 +423,11 @@ void FireYearSetCellFireIDRowCol(FireYear * fy, int i, int j, int id, FireTimer
     fy->finfo[id].end_hr != ft->sim_cur_hr;
   */
 
+  /* cell burned for the first time this year is reset at the start of the next year */
+  if ( INTTWODARRAY_GET_DATA(fy->id, i, j) == FIRE_YEAR_ID_DEFAULT ) {
+    FireYearAddTouchedCell(fy, i, j);
+  }
+
   /* set the fire id in the raster */
   INTTWODARRAY_SET_DATA(fy->id, i, j, id);
 
@@ -257,17 +441,18 @@ void FireYearSetCellFireIDRowCol(FireYear * fy, int i, int j, int id, FireTimer
   /* increment the count of cells that have burned during a santa ana */
   if ( is_sa ) {
     fy->finfo[id].num_cells_burned_sa += 1;
-    INTTWODARRAY_SET_DATA(fy->santa_ana, i, j, FIRE_YEAR_CELL_BURNED_SA);
+    CELL_PLANE_SET_SA(fy->plane, i, j, FIRE_YEAR_CELL_BURNED_SA);
   }
   else {
-    INTTWODARRAY_SET_DATA(fy->santa_ana, i, j, FIRE_YEAR_CELL_BURNED_NO_SA);
+    CELL_PLANE_SET_SA(fy->plane, i, j, FIRE_YEAR_CELL_BURNED_NO_SA);
   }  
 }
 
 void FireYearSetFailedIgnitions(ChHashTable * proptbl, FireYear * fy) {
 	KeyVal * entry					= NULL;				/* key/val instances from obtain */
   long failed_ig_num_cells;
-  int i, j, id;
+  long int k;
+  int i, j;
 
   /* retrieve the number of cells used as the failed ignition threshold */
   if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_FFIGNCELLS), (void *)&entry) ) {
@@ -283,20 +468,51 @@ void FireYearSetFailedIgnitions(ChHashTable * proptbl, FireYear * fy) {
     }
   }
 
-  /* iterate through the fire year raster */
-  for ( i = 0; i < fy->id->size_rows; ++i ) {
-    for ( j = 0; j < fy->id->size_cols; ++j ) {
-      /* search for cells that have been burned */
-      if ( FireYearIsCellBurnedRowCol(fy, i, j) ) {
-        id = INTTWODARRAY_GET_DATA(fy->id, i, j);
-        if ( fy->finfo[id].is_failed_ig ) {
-          /* reset the fire id in the cell to the default, meaning 'no fire' */
-		      INTTWODARRAY_SET_DATA(fy->id, i, j, FIRE_YEAR_ID_DEFAULT);
-          INTTWODARRAY_SET_DATA(fy->santa_ana, i, j, FIRE_YEAR_CELL_NOT_BURNED);
-        }
+  /* only cells touched during the year may have burned */
+  if ( fy->cap_touched >= 0 ) {
+    for ( k = 0; k < fy->num_touched; ++k ) {
+      FireYearResetFailedIgnitionCell(fy, (int) (fy->touched[k] / fy->id->size_cols), (int) (fy->touched[k] % fy->id->size_cols));
+    }
+  }
+  else {
+    /* iterate through the fire year raster */
+    for ( i = 0; i < fy->id->size_rows; ++i ) {
+      for ( j = 0; j < fy->id->size_cols; ++j ) {
+        FireYearResetFailedIgnitionCell(fy, i, j);
       }
     }
-  }          
+  }
+
+  return;
+}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Resets a cell burned by a failed ignition to the default fire id, meaning 'no fire'.
+ *
+ * Arguments:
+ * fy- FireYear
+ * i- row index of cell
+ * j- column index of cell
+ *
+ * Returns:
+ * None
+ */
+static void FireYearResetFailedIgnitionCell(FireYear * fy, int i, int j) {
+  int id;
+
+  /* search for cells that have been burned */
+  if ( FireYearIsCellBurnedRowCol(fy, i, j) ) {
+    id = INTTWODARRAY_GET_DATA(fy->id, i, j);
+    if ( fy->finfo[id].is_failed_ig ) {
+      /* reset the fire id in the cell to the default, meaning 'no fire' */
+      INTTWODARRAY_SET_DATA(fy->id, i, j, FIRE_YEAR_ID_DEFAULT);
+      CELL_PLANE_SET_SA(fy->plane, i, j, FIRE_YEAR_CELL_NOT_BURNED);
+    }
+  }
 
   return;
 }
@@ -306,8 +522,11 @@ void FreeFireYear(FireYear * fy)	{
 		if ( fy->id != NULL )	{
 			FreeIntTwoDArray(fy->id);
 		}
-    if ( fy->santa_ana != NULL ) {
-      FreeIntTwoDArray(fy->santa_ana);
+    if ( fy->owns_plane ) {
+      FreeCellPlane(fy->plane);
+    }
+    if ( fy->touched != NULL ) {
+      free(fy->touched);
     }
 		free(fy);
 	}		
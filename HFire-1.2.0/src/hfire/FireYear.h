@@ -36,6 +36,8 @@
 #include "KeyVal.h"
 #include "FuelModel.h"
 #include "CoordTrans.h"
+#include "ThreadPool.h"
+#include "CellPlane.h"
 #include "Err.h"
 
 /*
@@ -79,6 +81,16 @@
  */
 #define FIRE_YEAR_CELL_UNBURNABLE       (-9999)
 
+/*! \def FIRE_YEAR_ROWS_PER_JOB
+ *  \brief number of rows handed to a worker each time it requests work
+ */
+#define FIRE_YEAR_ROWS_PER_JOB          (16)
+
+/*! \def FIRE_YEAR_TOUCHED_INI_CAP
+ *  \brief number of cells initially allocated to the list of cells touched during a year
+ */
+#define FIRE_YEAR_TOUCHED_INI_CAP       (1024)
+
 /*
  *********************************************************
  * STRUCTS, TYPEDEFS
@@ -139,8 +151,16 @@ struct FireYear_ {
 	int cellsize;					
 	/*! each contiguous fire area stored with unique ID */			
 	IntTwoDArray * id;
-  /*! santa ana fire history */
-  IntTwoDArray * santa_ana;
+  /*! santa ana fire history of each cell, packed with the other per cell state of the year */
+  CellPlane * plane;
+  /*! 1 if plane allocated with this FireYear, 0 if plane is shared across years */
+  int owns_plane;
+  /*! row-major index of each cell ignited or assigned a fire id during the year */
+  long int * touched;
+  /*! number of cells in touched */
+  long int num_touched;
+  /*! number of cells allocated in touched, -1 if a cell could not be added and touched is incomplete */
+  long int cap_touched;
   /*! array of FireInfo structures */
   FireInfo finfo[FIRE_YEAR_ID_MAX+1];
 };
@@ -150,6 +170,12 @@ struct FireYear_ {
  * MACROS
  *********************************************************
  */
+
+/*! \def FIRE_YEAR_GET_SANTA_ANA
+ *	\brief santa ana fire history of cell at array i,j location, FIRE_YEAR_CELL_UNBURNABLE if fuel in cell is unburnable
+ */
+#define FIRE_YEAR_GET_SANTA_ANA(fy, i, j)	( CELL_PLANE_IS_UNBURNABLE((fy)->plane, i, j) ? FIRE_YEAR_CELL_UNBURNABLE 	\
+												: CELL_PLANE_GET_SA((fy)->plane, i, j) )
 	
 /*
  *********************************************************
@@ -174,6 +200,42 @@ struct FireYear_ {
  */	
 FireYear * InitFireYearFuels(int year, GridData * fuels, ChHashTable * fmtble);
 
+/*!	\fn FireYear * InitFireYearFuelsThreadPool(ThreadPool * tp, int year, GridData * fuels, ChHashTable * fmtble, CellPlane * plane)
+ * 	\brief Allocate memory for a FireYear structure as InitFireYearFuels, with rows of fuels divided among the workers of tp.
+ *
+ *	Fuel models are retrieved from fmtble only where the fuel model num changes along a row.  Every
+ *	cell of plane is reset in the same pass, setting the unburnable mask from fuels, so a plane
+ *	allocated once may be shared by the FireYear and CellState of every year of simulation.
+ *	\sa FireYear
+ *	\sa ThreadPool
+ *	\sa CellPlane
+ *	\param tp workers sharing the rows of fuels, NULL to use the calling thread only
+ * 	\param year year for which this FireYear structure describes the fire history
+ * 	\param fuels fuels spatial data
+ * 	\param fmtble ChHashTable of FuelModels used to determine if num from fuels is burnable
+ *	\param plane CellPlane of same size as fuels, NULL to allocate a CellPlane owned by the FireYear
+ * 	\retval FireYear* Ptr to initialized FireYear structure
+ */	
+FireYear * InitFireYearFuelsThreadPool(ThreadPool * tp, int year, GridData * fuels, ChHashTable * fmtble, CellPlane * plane);
+
+/*!	\fn int ResetFireYearFuelsThreadPool(ThreadPool * tp, FireYear * fy, int year, GridData * fuels, ChHashTable * fmtble, int is_fuels_changed)
+ * 	\brief Resets a FireYear of a previous year in place for a new year of simulation.
+ *
+ *	When the fuels are unchanged only the cells touched during the previous year are reset, restoring
+ *	the fire id and the cell of the plane from the unburnable mask.  Otherwise every cell is reset from
+ *	fuels as InitFireYearFuelsThreadPool.
+ *	\sa FireYear
+ *	\sa ThreadPool
+ *	\param tp workers sharing the rows of fuels, NULL to use the calling thread only
+ * 	\param fy FireYear of previous year
+ * 	\param year year for which this FireYear structure describes the fire history
+ * 	\param fuels fuels spatial data, same size as fuels of previous year
+ * 	\param fmtble ChHashTable of FuelModels used to determine if num from fuels is burnable
+ *	\param is_fuels_changed 1 if any cell of fuels differs from the previous year, 0 otherwise
+ *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
+ */
+int ResetFireYearFuelsThreadPool(ThreadPool * tp, FireYear * fy, int year, GridData * fuels, ChHashTable * fmtble, int is_fuels_changed);
+
 /*! \fn int FireYearGetCellIDRowCol(FireYear * fy, int i, int j, int * id)
  *	\brief Retrieves the id of the fire ignited inside of a cell at index i,j, if any.
  *	\sa FireYear
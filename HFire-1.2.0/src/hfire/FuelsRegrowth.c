@@ -24,85 +24,140 @@
  
 #include "FuelsRegrowth.h"
 
-int GetFuelsRegrowthFIXEDFromProps(ChHashTable * proptbl, GridData * std_age, GridData ** fuels)	{
+/*
+ *********************************************************
+ * NON PUBLIC FUNCTIONS
+ *********************************************************
+ */
+
+static int InitFuelsViewFuelsRegrowth(GridData * std_age, GridData ** fuels, GridDataView * view, int * is_changed);
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Prepares the fuels GridData refilled each year by FIXED and PNV regrowth.  The fuels of the previous
+ * year are reused when held in memory as integers with the dimensions of std_age.  Otherwise any
+ * previous fuels are freed and a new GridData is allocated, in which case is_changed is set.
+ *
+ * Arguments:
+ * std_age- stand age GridData
+ * fuels- fuels of previous year or NULL, receives fuels to refill
+ * view- receives view of cells of fuels
+ * is_changed- set to 1 if new fuels are allocated
+ *
+ * Returns:
+ * ERR_SUCCESS(0) if operation successful, an error code otherwise
+ */
+static int InitFuelsViewFuelsRegrowth(GridData * std_age, GridData ** fuels, GridDataView * view, int * is_changed)	{
 	IntTwoDArray * farr 	= NULL;				/* temp array used to initialize fuels */
-	KeyVal * entry			= NULL;				/* key/val instances from table */
+
+	/* reuse fuels of previous year */
+	if ( *fuels != NULL && InitGridDataView(*fuels, view) == ERR_SUCCESS 
+			&& view->gtype == EnumIntGrid && view->cells != NULL
+			&& view->nrows == std_age->ghdr->nrows && view->ncols == std_age->ghdr->ncols )	{
+		return ERR_SUCCESS;
+		}
+	if ( *fuels != NULL )	{
+		FreeGridData(*fuels);
+		*fuels = NULL;
+		}
+
+	/* every cell is assigned by the caller */
+	if ( (farr = InitIntTwoDArraySizeEmpty(std_age->ghdr->nrows, std_age->ghdr->ncols)) == NULL )	{
+		ERR_ERROR("Unable to allocate memory for fuels TwoDArray. \n", ERR_ENOMEM);
+		}
+	*fuels = InitGridDataFromIntTwoDArray(farr, std_age->ghdr->xllcorner, std_age->ghdr->yllcorner, 
+								std_age->ghdr->cellsize, std_age->ghdr->NODATA_value);
+	FreeIntTwoDArray(farr);
+	if ( *fuels == NULL || InitGridDataView(*fuels, view) )	{
+		ERR_ERROR("Unable to allocate memory for fuels GridData. \n", ERR_ENOMEM);
+		}
+	*is_changed = 1;
+
+	return ERR_SUCCESS;
+	}
+
+int GetFuelsRegrowthFIXEDFromProps(ChHashTable * proptbl, const SimConfig * cfg, GridData * std_age, GridData ** fuels, int * is_changed)	{
+	GridDataView fview;							/* cells of fuels refilled in place */
+	int * age_row			= NULL;				/* stand age of one row of cells */
 	int domain_rows, domain_cols, fixed_fnum;
-	int i, j, adata;
+	int i, j, fnum;
 	
 	/* check args */
-	if ( proptbl == NULL || std_age == NULL )	{
+	if ( proptbl == NULL || cfg == NULL || std_age == NULL || fuels == NULL || is_changed == NULL )	{
 		ERR_ERROR("Arguments supplied to initialize fuels data invalid. \n", ERR_EINVAL);
 		}
+	*is_changed = 0;
 
-	/* retrieve fixed num */
-	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_FIXFNUM), (void *)&entry) 
-			|| strcmp(entry->val, GetFireVal(VAL_NULL)) == 0 )	{
-		ERR_ERROR("Unable to retrieve FUELS_FIXED_MODEL_NUM property. \n", ERR_EFAILED);
-		}
-	fixed_fnum = atoi(entry->val);
+	/* fixed num was range checked when SimConfig was loaded */
+	fixed_fnum = cfg->fuels_fixed_num;
 
 	/* get dimensions of fuels from stand age */	
 	domain_rows = std_age->ghdr->nrows; 
 	domain_cols = std_age->ghdr->ncols;
 		
-	/* create temp array to initialize fuels GridData */
-	if ( (farr = InitIntTwoDArraySizeEmpty(domain_rows, domain_cols)) == NULL )	{
-		ERR_ERROR("Unable to allocate memory for fuels TwoDArray. \n", ERR_ENOMEM);
+	/* fuels of previous year are refilled in place */
+	if ( InitFuelsViewFuelsRegrowth(std_age, fuels, &fview, is_changed) )	{
+		ERR_ERROR("Unable to allocate memory for fuels GridData. \n", ERR_ENOMEM);
+		}
+	if ( (age_row = (int *) malloc(sizeof(int) * domain_cols)) == NULL )	{
+		ERR_ERROR("Unable to allocate memory for row of stand age. \n", ERR_ENOMEM);
 		}
 
-	/* insert fuels values into array */
+	/* insert fuels values into fuels, noting any cell that differs from the previous year */
 	for(i = 0; i < domain_rows; i++)	{
+		GetRowAsIntGridData(std_age, i, age_row);
 		for(j = 0; j < domain_cols; j++)	{
-			GRID_DATA_GET_DATA(std_age, i, j, adata);
-			if ( adata == std_age->ghdr->NODATA_value )	{
-				INTTWODARRAY_SET_DATA(farr, i, j, std_age->ghdr->NODATA_value);
-				}
-			else	{
-				INTTWODARRAY_SET_DATA(farr, i, j, fixed_fnum);
+			fnum = ( age_row[j] == std_age->ghdr->NODATA_value ) ? std_age->ghdr->NODATA_value : fixed_fnum;
+			if ( GRID_DATA_VIEW_INT(&fview, i, j) != fnum )	{
+				GRID_DATA_VIEW_INT(&fview, i, j) = fnum;
+				*is_changed = 1;
 				}
 			}
 		}
-
-	/* initialize the fuels GridData from array */
-	if ( (*fuels = InitGridDataFromIntTwoDArray(farr, std_age->ghdr->xllcorner, std_age->ghdr->yllcorner, 
-								std_age->ghdr->cellsize, std_age->ghdr->NODATA_value)) == NULL )	{
-		FreeIntTwoDArray(farr);
-		ERR_ERROR("Unable to allocate memory for fuels GridData. \n", ERR_ENOMEM);
-		}
-	 	
-	/* free the temp array */
-	FreeIntTwoDArray(farr);
+	free(age_row);
 						
 	return ERR_SUCCESS;
 	}
 
-int GetFuelsRegrowthSTATICFromProps(ChHashTable * proptbl, GridData * std_age, GridData ** fuels)	{
-	if ( proptbl == NULL || std_age == NULL )	{
+int GetFuelsRegrowthSTATICFromProps(ChHashTable * proptbl, const SimConfig * cfg, GridData * std_age, GridData ** fuels, int * is_changed)	{
+	if ( proptbl == NULL || cfg == NULL || std_age == NULL || fuels == NULL || is_changed == NULL )	{
 		ERR_ERROR("Arguments supplied to initialize fuels data invalid. \n", ERR_EINVAL);
 		}
+
+	/* static fuels are read once and kept for every year */
+	*is_changed = 0;
+	if ( *fuels != NULL )	{
+		return ERR_SUCCESS;
+		}
 		
 	/* retrieve fuels data */
-	*fuels = GetGridDataFromPropsFireGridData(proptbl, FIRE_GRIDDATA_FUELS_STATIC_DATA);
+	*fuels = GetGridDataFromPropsFireGridData(proptbl, cfg, FIRE_GRIDDATA_FUELS_STATIC_DATA);
+	*is_changed = 1;
 		
 	return ERR_SUCCESS;
 	}
 
-int GetFuelsRegrowthPNVFromProps(ChHashTable * proptbl, GridData * std_age, GridData ** fuels)	{
+int GetFuelsRegrowthPNVFromProps(ChHashTable * proptbl, const SimConfig * cfg, GridData * std_age, GridData ** fuels, int * is_changed)	{
+	GridDataView fview;							/* cells of fuels refilled in place */
 	GridData * pnv			= NULL;				/* (temp) pnv spatial data used to initialize fuels */
 	IntTwoDArray * rgr_tbl 	= NULL;				/* (temp) parsed index table references pnv to fuel model num */
-	IntTwoDArray * farr		= NULL;				/* (temp) underlying array of fuel values */
 	KeyVal * entry			= NULL;				/* key/val instances from properties table */
 	FILE * fstream			= NULL;				/* file ptr to rgr file */
+	int * age_row			= NULL;				/* (temp) stand age of one row of cells */
+	int * pnv_row			= NULL;				/* (temp) pnv of one row of cells */
 	int domain_rows, domain_cols;
 	int i, j, r;
 	int pnv_cell = 0, age_cell = 0, fnum_cell = 0;
 	int found_fnum = 0;
 
 	/* check args */		
-	if ( proptbl == NULL || std_age == NULL )	{
+	if ( proptbl == NULL || cfg == NULL || std_age == NULL || fuels == NULL || is_changed == NULL )	{
 		ERR_ERROR("Arguments supplied to initialize fuels data invalid. \n", ERR_EINVAL);
 		}
+	*is_changed = 0;
 
 	/* retrieve rgr file name */
 	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_RGRFILE), (void *)&entry)
@@ -127,29 +182,40 @@ int GetFuelsRegrowthPNVFromProps(ChHashTable * proptbl, GridData * std_age, Grid
 	domain_rows = std_age->ghdr->nrows; 
 	domain_cols = std_age->ghdr->ncols;
 	
-	/* create temp fuels array to initialize a fuels GridData */
-	if ( (farr = InitIntTwoDArraySizeEmpty(domain_rows, domain_cols)) == NULL )	{
+	/* fuels of previous year are refilled in place */
+	if ( InitFuelsViewFuelsRegrowth(std_age, fuels, &fview, is_changed) )	{
 		FreeIntTwoDArray(rgr_tbl);
-		ERR_ERROR("Unable to allocate memory for fuels TwoDArray. \n", ERR_ENOMEM);
+		ERR_ERROR("Unable to allocate memory for fuels GridData. \n", ERR_ENOMEM);
 		}
 	 	
 	/* create temp pnv grid containing the potential natural vegetation class numbers */
-	if ( (pnv = GetGridDataFromPropsFireGridData(proptbl, FIRE_GRIDDATA_FUELS_PNV_DATA)) == NULL )	{
-		FreeIntTwoDArray(farr);
+	if ( (pnv = GetGridDataFromPropsFireGridData(proptbl, cfg, FIRE_GRIDDATA_FUELS_PNV_DATA)) == NULL )	{
 		FreeIntTwoDArray(rgr_tbl);	
 		ERR_ERROR("Unable to initialize PNV raster spatial dataset. \n", ERR_EBADFUNC);
 		}
 
-	/* iterate through the pnv grid assigning fuel model numbers to fuels array based upon rgr table */
+	/* create temp rows of stand age and pnv, each retrieved one row at a time */
+	if ( (age_row = (int *) malloc(sizeof(int) * domain_cols)) == NULL 
+			|| (pnv_row = (int *) malloc(sizeof(int) * domain_cols)) == NULL )	{
+		if ( age_row != NULL )
+			free(age_row);
+		FreeGridData(pnv);
+		FreeIntTwoDArray(rgr_tbl);	
+		ERR_ERROR("Unable to allocate memory for rows of stand age and pnv. \n", ERR_ENOMEM);
+		}
+
+	/* iterate through the pnv grid assigning fuel model numbers to fuels based upon rgr table */
 	for(i = 0; i < domain_rows; i++)	{
+		GetRowAsIntGridData(std_age, i, age_row);
+		GetRowAsIntGridData(pnv, i, pnv_row);
 		for(j = 0; j < domain_cols; j++)	{
 			/* retrieve stand age at cell */
-			GRID_DATA_GET_DATA(std_age, i, j, age_cell);
+			age_cell = age_row[j];
 			/* try to assign a fuel model num */
 			if (  age_cell != std_age->ghdr->NODATA_value )	{
 				found_fnum = 0;
 				/* retrieve pnv at cell */
-				GRID_DATA_GET_DATA(pnv, i, j, pnv_cell);
+				pnv_cell = pnv_row[j];
 				/* retrieve the fuel model num from rgr_tbl */
 				for(r = 0; r < INTTWODARRAY_SIZE_ROW(rgr_tbl); r++)	{
 					if ( INTTWODARRAY_GET_DATA(rgr_tbl, r, 0) == pnv_cell )	{
@@ -163,37 +229,31 @@ int GetFuelsRegrowthPNVFromProps(ChHashTable * proptbl, GridData * std_age, Grid
 						break;
 						}
 					}
-				/* assign fuel model num to fuels array */
-				if ( found_fnum == 1 )	{
-					INTTWODARRAY_SET_DATA(farr, i, j, fnum_cell);
-					}
 				/* pnv num not found in rgr_tbl */
-				else	{
+				if ( found_fnum == 0 )	{
+					free(age_row);
+					free(pnv_row);
 					FreeIntTwoDArray(rgr_tbl);
-					FreeIntTwoDArray(farr);
 					FreeGridData(pnv);
 					ERR_ERROR("Unable to find pnv number in rgr table. \n", ERR_EFAILED);
 					}
 				}
 			else	{
 				/* assign NO DATA */			
-				INTTWODARRAY_SET_DATA(farr, i, j, std_age->ghdr->NODATA_value);
+				fnum_cell = std_age->ghdr->NODATA_value;
+				}
+			/* assign fuel model num to fuels, noting any cell that differs from the previous year */
+			if ( GRID_DATA_VIEW_INT(&fview, i, j) != fnum_cell )	{
+				GRID_DATA_VIEW_INT(&fview, i, j) = fnum_cell;
+				*is_changed = 1;
 				}
 			}
 		}
-
-	/* initialize the fuels GridData from array */
-	if ( (*fuels = InitGridDataFromIntTwoDArray(farr, std_age->ghdr->xllcorner, std_age->ghdr->yllcorner, 
-								std_age->ghdr->cellsize, std_age->ghdr->NODATA_value)) == NULL )	{
-		FreeIntTwoDArray(rgr_tbl);
-		FreeIntTwoDArray(farr);
-		FreeGridData(pnv);
-		ERR_ERROR("Unable to allocate memory for fuels GridData. \n", ERR_ENOMEM);
-		}
+	free(age_row);
+	free(pnv_row);
 		
 	/* free memory associated with temp data structures */
 	FreeIntTwoDArray(rgr_tbl);
-	FreeIntTwoDArray(farr);	
 	FreeGridData(pnv);
 	
 	return ERR_SUCCESS;
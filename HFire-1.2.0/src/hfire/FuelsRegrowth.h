@@ -32,6 +32,7 @@
 #include "FireYear.h"
 #include "FireProp.h"
 #include "FireGridData.h"
+#include "SimConfig.h"
 #include "ChHashTable.h"
 #include "GridData.h"
 #include "KeyVal.h"
@@ -69,17 +70,20 @@
  *********************************************************
  */
 
-/*!	\fn int GetFuelsRegrowthFIXEDFromProps(ChHashTable * proptbl, GridData * std_age, GridData ** fuels)
+/*!	\fn int GetFuelsRegrowthFIXEDFromProps(ChHashTable * proptbl, const SimConfig * cfg, GridData * std_age, GridData ** fuels, int * is_changed)
  * 	\brief Returns fuels raster spatial data based upon values set in Hash Table property table.
  *
- * 	For FIXED implementations fuel model number from keyword FUELS_FIXED_MODEL_NUM is 
+ * 	For FIXED implementations fuel model number from keyword FUELS_FIXED_MODEL_NUM, held in SimConfig, is
  * 	assigned to every cell that is not NO DATA in the std_age GridData.
+ * 	Fuels of the previous year held in memory are refilled in place rather than reallocated.
  *	\sa ChHashTable
  *	\sa GridData
  *	\sa Check the \htmlonly <a href="config_file_doc.html#FUELS_REGROWTH">config file documentation</a> \endhtmlonly 
  * 	\param proptbl HashTable of simulation properties
+ * 	\param cfg SimConfig of simulation
  * 	\param std_age stand age GridData
- * 	\param fuels returned fuels GridData
+ * 	\param fuels fuels GridData of previous year refilled in place, or NULL to allocate new fuels
+ * 	\param is_changed set to 1 if any cell of fuels differs from the previous year, 0 otherwise
  *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
  *	\note Best use of this facility is as follows:
  *	\code	
@@ -88,18 +92,21 @@
  *				// something bad happened
  *	\endcode
  */  
-int GetFuelsRegrowthFIXEDFromProps(ChHashTable * proptbl, GridData * std_age, GridData ** fuels);
+int GetFuelsRegrowthFIXEDFromProps(ChHashTable * proptbl, const SimConfig * cfg, GridData * std_age, GridData ** fuels, int * is_changed);
 
-/*!	\fn int GetFuelsRegrowthSTATICFromProps(ChHashTable * proptbl, GridData * std_age, GridData ** fuels)
+/*!	\fn int GetFuelsRegrowthSTATICFromProps(ChHashTable * proptbl, const SimConfig * cfg, GridData * std_age, GridData ** fuels, int * is_changed)
  * 	\brief Returns fuels raster spatial data based upon values set in Hash Table property table.
  *
  * 	For STATIC implementations keyword FUELS_STATIC_XXX is used to create fuel raster data.
+ * 	The fuels are read during the first year only and are unchanged in every following year.
  *	\sa ChHashTable
  *	\sa GridData
  *	\sa Check the \htmlonly <a href="config_file_doc.html#FUELS_REGROWTH">config file documentation</a> \endhtmlonly 
  * 	\param proptbl HashTable of simulation properties
+ * 	\param cfg SimConfig of simulation
  * 	\param std_age stand age GridData
- * 	\param fuels returned fuels GridData
+ * 	\param fuels fuels GridData of previous year refilled in place, or NULL to allocate new fuels
+ * 	\param is_changed set to 1 if any cell of fuels differs from the previous year, 0 otherwise
  *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
  *	\note Best use of this facility is as follows:
  *	\code	
@@ -108,19 +115,21 @@ int GetFuelsRegrowthFIXEDFromProps(ChHashTable * proptbl, GridData * std_age, Gr
  *				// something bad happened
  *	\endcode
  */  
-int GetFuelsRegrowthSTATICFromProps(ChHashTable * proptbl, GridData * std_age, GridData ** fuels);
+int GetFuelsRegrowthSTATICFromProps(ChHashTable * proptbl, const SimConfig * cfg, GridData * std_age, GridData ** fuels, int * is_changed);
 
-/*!	\fn int GetFuelsRegrowthPNVFromProps(ChHashTable * proptbl, GridData * std_age, GridData ** fuels)
+/*!	\fn int GetFuelsRegrowthPNVFromProps(ChHashTable * proptbl, const SimConfig * cfg, GridData * std_age, GridData ** fuels, int * is_changed)
  * 	\brief Returns fuels raster spatial data based upon values set in Hash Table property table.
  *
  * 	For PNV implementations raster data in FUELS_PNV_XXX is indexed against the 
- * 	FUELS_PNV_RGR_FILE file contents to create a new fuels array.
+ * 	FUELS_PNV_RGR_FILE file contents to assign fuels, refilled in place when held in memory.
  *	\sa ChHashTable
  *	\sa GridData
  *	\sa Check the \htmlonly <a href="config_file_doc.html#FUELS_REGROWTH">config file documentation</a> \endhtmlonly
  * 	\param proptbl HashTable of simulation properties
+ * 	\param cfg SimConfig of simulation
  * 	\param std_age stand age GridData
- * 	\param fuels returned fuels GridData
+ * 	\param fuels fuels GridData of previous year refilled in place, or NULL to allocate new fuels
+ * 	\param is_changed set to 1 if any cell of fuels differs from the previous year, 0 otherwise
  *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
  *	\note Best use of this facility is as follows:
  *	\code	
@@ -129,6 +138,6 @@ int GetFuelsRegrowthSTATICFromProps(ChHashTable * proptbl, GridData * std_age, G
  *				// something bad happened
  *	\endcode
  */  												
-int GetFuelsRegrowthPNVFromProps(ChHashTable * proptbl, GridData * std_age, GridData ** fuels);
+int GetFuelsRegrowthPNVFromProps(ChHashTable * proptbl, const SimConfig * cfg, GridData * std_age, GridData ** fuels, int * is_changed);
 																				
 #endif FuelsRegrowth_H		/* end of FuelsRegrowth.h */
@@ -59,118 +59,761 @@ void TimeStamp(FireTimer * ft, char * message)
   return;
 }
 
-/* structure used to store burning cell parameters */
+/* structure used to share simulation state with the workers computing the fire front */
 typedef struct
 {
-  int i;                                        /* cell row */
-  int j;                                        /* cell col */
-  double rwx;                                   /* cell real-world x coordinate */
-  double rwy;                                   /* cell real-world y coordinate */
-  double max_rosmps;                            /* maximum rate of spread */
-  int    max_ros_az;                            /* azimuth of maximum rate of spread */
-  double eccen;                                 /* eccentricity of fire */
-  double rosmps[EIGHTNBR_NUM_NBR_CELLS];        /* rate of spread in direction of neighbor, in m/s */
-  double distm[EIGHTNBR_NUM_NBR_CELLS];         /* distance spread in direction of neighbor, in m */
-  double dist2ctrm[EIGHTNBR_NUM_NBR_CELLS];     /* distance to neighboring cell center, in m */
+  ChHashTable * proptbl;                        /* simulation properties read from file */
+  const SimConfig * cfg;                        /* simulation properties converted at load */
+  FireEnv * fe;                                 /* table of function ptrs for environment vars */
+  FireEnvSnapshot * fes;                        /* environment vars of the current timestep */
+  FireTimer * ft;                               /* stores simulation time */
+  ChHashTable * fmtble;                         /* table of FuelModels */
+  GridDataView elev;                            /* elev spatial data */
+  GridDataView slope;                           /* slope spatial data */
+  GridDataView aspect;                          /* aspect spatial data */
+  GridDataView fuels;                           /* fuels spatial data */
+  CellState * cs;                               /* cell state */
+  int domain_rows, domain_cols;                 /* simulation domain size */
+  double cellsz;                                /* simulation cell resolution, in m */
+  double xulcntr, yulcntr;                      /* simulation upper left coordinates */
+  double ell_adj;                               /* fire ellipse adjustment factor */
+  RothSpreadTable * rst;                        /* precomputed rate of spread, or NULL */
+  int worker;                                   /* worker running the replicate, added to the worker of the fire front */
+  TerrainDist * td;                             /* precomputed distance between cells, or NULL */
+  BurnFront * bf;                               /* burning cells */
+  int first;                                    /* index of burning cell at item 0 of the current job */
+  int * items;                                  /* indices of burning cells of the current job, or NULL if consecutive */
 }
-brn_cell_t;
+sweep_t;
 
-int main(int argc, char * argv[])
-{
-  ChHashTable * proptbl = NULL;                 /* simulation properties read from file */
-  GridData * elev = NULL;                       /* elev spatial data */
-  GridData * slope = NULL;                      /* slope spatial data */
-  GridData * aspect = NULL;                     /* aspect spatial data */
-  GridData * std_age = NULL;                    /* stand age spatial data */
-  GridData * fuels = NULL;                      /* fuels spatial data */
-  FireTimer * ft = NULL;                        /* stores simulation time */
-  FireEnv * fe = NULL;                          /* table of function ptrs for environment vars */
-  List * fmlist = NULL;                         /* list of FuelModels */
-  ChHashTable * fmtble = NULL;                  /* table of FuelModels */
-  FireExport * fex = NULL;                      /* wrapper for program export */
+/* 1 if cell i,j lies inside the simulation domain, only such cells may be read */
+#define SWEEP_IN_DOMAIN(sw, i, j)     ( (i) >= 0 && (j) >= 0 && (i) < (sw)->domain_rows && (j) < (sw)->domain_cols )
 
-  KeyVal * entry = NULL;                        /* ptr to hash table entry */
-  ListElmt * lel = NULL, * prev = NULL;         /* ptr to single element in a list */
+/* 1 if cell i,j lies inside the simulation domain and off its boundary, only such cells may receive fire */
+#define SWEEP_IN_INTERIOR(sw, i, j)   ( (i) > 0 && (j) > 0 && (i) < (sw)->domain_rows - 1 && (j) < (sw)->domain_cols - 1 )
 
-  int timestep;                                 /* duration of simulation timestep */
-  double exp_secs, iter_secs;                   /* duration of iteration during timestep */
-  int domain_rows, domain_cols;                 /* simulation domain size */
-  double cellsz;                                /* simulation cell resolution, in m */
-  double xulcntr, yulcntr;                      /* simulation upper left coordinates */
-  double rwx, rwy;                              /* real world xy coord pair */
-  FireYear * fyr = NULL;                        /* ids of burned cells */
-  CellState * cs = NULL;                        /* cell state */
-  ByteTwoDArray * hrs_brn = NULL;               /* hours cell has been burning */
-  List * brn_cells_list = NULL;                 /* list of burning cell parameters */
-  brn_cell_t ** brn_cells_map = NULL;           /* array of pointers to burning cell parameters */
+/* inputs loaded once and shared by every replicate of the simulation */
+typedef struct
+{
+  const SimConfig * cfg;                        /* simulation properties converted at load */
+  List * fmlist;                                /* list of FuelModels */
+  ChHashTable * fmtble;                         /* table of FuelModels */
+  GridData * elev;                              /* elev spatial data */
+  GridData * slope;                             /* slope spatial data */
+  GridData * aspect;                            /* aspect spatial data */
+  TerrainDist * td;                             /* precomputed distance between cells, or NULL */
+  RothSpreadTable * rst;                        /* precomputed rate of spread, or NULL */
+  FireEnvTables * fet;                          /* weather and fuel moisture tables read by the environment functions */
+  ThreadPool * tp;                              /* workers used to compute the fire front or to run replicates */
+  RandStream rs;                                /* root random number stream, each run draws from child rep */
+}
+shared_t;
 
-  List * ig_cells_list = NULL;                  /* list of xy coordinates for ignited cells */
-  double * ig_rwx, * ig_rwy;                    /* real world xy coordinate pair for ignited cell */
+/* replicates of an ensemble handed to the workers, each replicate runs on a single worker */
+typedef struct
+{
+  shared_t * sh;                                /* inputs shared by every replicate */
+  ThreadPool * tp;                              /* workers used to compute the fire front, NULL if replicates run concurrently */
+  ChHashTable * proptbl;                        /* simulation properties read from file */
+  Ensemble * ens;                               /* replicates and their aggregate statistics */
+  long int seed;                                /* seed of the root random number stream */
+}
+replicates_t;
 
-  double ell_adj;                               /* fire ellipse adjustment factor */
-  double max_rosmps;                            /* maximum rate of spread, in m/s */
+/*
+** Computes the maximum rate of spread of a single burning cell and the rate of spread and
+** distance to each neighbor which may receive fire during the current iteration.
+**
+** The function only writes to burning cell idx and may be called concurrently for
+** different cells once the FireEnvSnapshot has been updated and a first cell computed for the current hour.
+** Environment vars which do not vary in space are read from the snapshot rather than retrieved for each cell.
+** Rate of spread is evaluated with the reentrant Rothermel functions, which only read the shared
+** fuel bed and write results to the stack, so the result does not depend on the order of calls.
+** When a RothSpreadTable is in use the rate of spread is retrieved from the table of the worker,
+** offset by the worker running the replicate when replicates run concurrently.
+** Neighbors which are already burning are evaluated since they may revert to the unburned
+** state when fire extinction is applied, the caller zeroes any that remain ineligible.
+*/
+static int SweepComputeCell(sweep_t * sw, int worker, int idx)
+{
+  ChHashTable * proptbl = sw->proptbl;
+  FireTimer * ft = sw->ft;
   int i, j;                                     /* spatial row and col */
+  double rwx, rwy;                              /* real world xy coord pair */
   double cell_elev;                             /* cell elevation, in m */
   double cell_slope;                            /* cell slope */
   double cell_aspect;                           /* cell aspect */
   int cell_fmnum;                               /* cell fuel model number */
   FuelModel * fm = NULL;                        /* ptr to FuelModel */
-  double fbedhgtm;                              /* fuel bed height, in m */
+  RothSpread rs;                                /* rate of spread results for this cell */
+  RothSpreadLookup lk;                          /* rate of spread toward each neighbor, from table or calculated */
   double d1hfm, d10hfm, d100hfm;                /* dead fuel moisture, 1 hour, 10 hour, and 100 hour */
   double lhfm, lwfm;                            /* live fuel moisture */
   double waz;                                   /* wind azimuth */
   double wspmps, wspfpm;                        /* wind speed, in m/s and ft/min */
-  double rosfpm, rosmps;                        /* rate of fire spread, in ft/min and m/s */
-  brn_cell_t * brn_cell, * new_brn_cell;        /* burning cell parameters */
-  brn_cell_t * nbr_brn_cell;
+  double rosfpm;                                /* rate of fire spread, in ft/min */
   double az;                                    /* floating point azimuth */
   int cell_az;                                  /* stores cell azimuth */
-  int cell, nbr_az[3], brn_az[3];               /* stores neighbor and burning azimuths */
   int nbr_i, nbr_j;                             /* stores nbr cell index i,j */
-  double nbr_elev;                              /* neighbor elevation, in m */
-  double dist2ctrm;                             /* distance along the ground between cells, in m */
+  int nbr_state;                                /* state of neighbor cell */
+  double nbr_elev[EIGHTNBR_NUM_NBR_CELLS];      /* neighbor elevation, in m */
+  double * rosmps = BURN_FRONT_NBR_ARRAY(sw->bf, rosmps, idx);
+  double * dist2ctrm = BURN_FRONT_NBR_ARRAY(sw->bf, dist2ctrm, idx);
+
+  /* retrieve coordinate information for burning cell */
+  i = sw->bf->i[idx];
+  j = sw->bf->j[idx];
+  /* retrieve real-world coordinates of cell */
+  if ( CoordTransSixParamRasterToRealWorld(i, j, sw->cellsz, sw->cellsz, sw->xulcntr, sw->yulcntr, 0.0, 0.0, &rwx, &rwy) )
+  {
+    return ERR_EFAILED;
+  }
+  /* retrieve spatial attribute data */
+  GRID_DATA_VIEW_GET_DATA(&sw->slope, i, j, cell_slope);
+  GRID_DATA_VIEW_GET_DATA(&sw->aspect, i, j, cell_aspect);
+  GRID_DATA_VIEW_GET_DATA(&sw->fuels, i, j, cell_fmnum);
+  /* retrieve fuel model attribute data */
+  if ( (fm = FIRE_ENV_SNAPSHOT_GET_FUEL_MODEL(sw->fes, cell_fmnum)) == NULL )
+  {
+    return ERR_EFAILED;
+  }
+  /* retrieve time-dependent attributes, only those read from spatial datasets are retrieved for this cell */
+  if ( FireEnvSnapshotGetCell(sw->fes, sw->fe, proptbl, ft, cell_fmnum, rwx, rwy, &waz, &wspmps, &d1hfm, &d10hfm, &d100hfm, &lhfm, &lwfm) )
+  {
+    return ERR_EFAILED;
+  }
+  wspfpm = UNITS_MPSEC_TO_FTPMIN(wspmps);
+  /* retrieve rate of spread from table */
+  if ( sw->rst != NULL )
+  {
+    if ( RothSpreadTableGet(sw->rst, sw->worker + worker, cell_fmnum, fm->rfm->fb, d1hfm, d10hfm, d100hfm, lhfm, lwfm, wspfpm, waz, cell_slope, cell_aspect, &lk) )
+    {
+      return ERR_EFAILED;
+    }
+    rs.ros_max = lk.ros_max;
+    rs.ros_az_max = lk.ros_az_max;
+    rs.eccen = lk.eccen;
+  }
+  else
+  {
+    /* calculate the no-wind and no-slope rate of spread */
+    if ( Roth1972SpreadNoWindNoSlope(fm->rfm->fb, d1hfm, d10hfm, d100hfm, lhfm, lwfm, &rs) )
+    {
+      return ERR_EFAILED;
+    }
+    /* calculate maximum rate of spread */
+    if ( Roth1972SpreadWindSlopeMax(fm->rfm->fb, wspfpm, waz, cell_slope, cell_aspect, sw->ell_adj, &rs) )
+    {
+      return ERR_EFAILED;
+    }
+    /* calculate rate of spread toward every neighbor */
+    if ( Roth1972SpreadGetAtEightNbr(&rs, lk.ros_nbr) )
+    {
+      return ERR_EFAILED;
+    }
+  }
+  rosfpm = rs.ros_max;
+  sw->bf->max_rosmps[idx] = UNITS_FTPMIN_TO_MPSEC(rosfpm);
+  /* set the azimuth of the maximum rate of spread */
+  az = rs.ros_az_max / 45.0;
+  if ( az < 0.5 )       sw->bf->max_ros_az[idx] = 0; /*   0 */
+  else if ( az < 1.5 )  sw->bf->max_ros_az[idx] = 1; /*  45 */
+  else if ( az < 2.5 )  sw->bf->max_ros_az[idx] = 2; /*  90 */
+  else if ( az < 3.5 )  sw->bf->max_ros_az[idx] = 3; /* 135 */
+  else if ( az < 4.5 )  sw->bf->max_ros_az[idx] = 4; /* 180 */
+  else if ( az < 5.5 )  sw->bf->max_ros_az[idx] = 5; /* 225 */
+  else if ( az < 6.5 )  sw->bf->max_ros_az[idx] = 6; /* 270 */
+  else if ( az < 7.5 )  sw->bf->max_ros_az[idx] = 7; /* 315 */
+  else                  sw->bf->max_ros_az[idx] = 0; /* 360 */
+  /* set the eccentricity of the burning fire */
+  sw->bf->eccen[idx] = (float) rs.eccen;
+  /* get terrain distance (xyz) to all neighbor cell centers */
+  if ( sw->td != NULL )
+  {
+    TerrainDistGetEightNbr(sw->td, i, j, dist2ctrm);
+  }
+  else
+  {
+    /* retrieve elevation of cell and all neighbors, cells outside the domain never receive fire */
+    GRID_DATA_VIEW_GET_DATA(&sw->elev, i, j, cell_elev);
+    for (cell_az = 0; cell_az < EIGHTNBR_NUM_NBR_CELLS; cell_az++)
+    {
+      nbr_i = EIGHTNBR_ROW_INDEX_AT_AZIMUTH(i, cell_az);
+      nbr_j = EIGHTNBR_COL_INDEX_AT_AZIMUTH(j, cell_az);
+      nbr_elev[cell_az] = cell_elev;
+      if ( SWEEP_IN_DOMAIN(sw, nbr_i, nbr_j) )
+      {
+        GRID_DATA_VIEW_GET_DATA(&sw->elev, nbr_i, nbr_j, nbr_elev[cell_az]);
+      }
+    }
+    EightNbrCalcTerrainDist(sw->cellsz, cell_elev, nbr_elev, dist2ctrm);
+  }
+  /* get rate of spread to all neighbor cell centers in one pass */
+  for (cell_az = 0; cell_az < EIGHTNBR_NUM_NBR_CELLS; cell_az++)
+  {
+    rosmps[cell_az] = UNITS_FTPMIN_TO_MPSEC(lk.ros_nbr[cell_az]);
+  }
+  /* zero out the rate of spread into neighbors which may not receive fire */
+  for (cell_az = 0; cell_az < EIGHTNBR_NUM_NBR_CELLS; cell_az++)
+  {
+    /* retrieve coordinate information for neighbor cell */
+    nbr_i = EIGHTNBR_ROW_INDEX_AT_AZIMUTH(i, cell_az);
+    nbr_j = EIGHTNBR_COL_INDEX_AT_AZIMUTH(j, cell_az);
+    /* skip boundary cells, and cells outside the domain when the burning cell is on the boundary */
+    if ( !SWEEP_IN_INTERIOR(sw, nbr_i, nbr_j) )
+    {
+      rosmps[cell_az] = 0.0;
+      continue;
+    }
+    /* skip cells that are not burnable or consumed */
+    nbr_state = CELL_STATE_GET_DATA(sw->cs, nbr_i, nbr_j);
+    if ( nbr_state != EnumNoFireCellState && nbr_state != EnumHasFireCellState )
+    {
+      rosmps[cell_az] = 0.0;
+    }
+  }
+
+  return ERR_SUCCESS;
+}
+
+/* ThreadPoolFunc computing the burning cells [begin, end) of the current job */
+static int SweepComputeCells(void * arg, int worker, int begin, int end)
+{
+  sweep_t * sw = (sweep_t *) arg;
+  int k;
+
+  for ( k = begin; k < end; k++ )
+  {
+    if ( SweepComputeCell(sw, worker, (sw->items != NULL) ? sw->items[sw->first + k] : sw->first + k) )
+    {
+      return ERR_EFAILED;
+    }
+  }
+
+  return ERR_SUCCESS;
+}
+
+/*
+** Applies the state of the neighbors and fire extinction to burning cell idx.
+**
+** Rate of spread into neighbors which are not in the unburned state is zeroed.  A cell without
+** any neighbor that may receive fire is consumed, and a cell meeting the rate of spread criteria
+** is extinguished.  Returns 1 if the cell was removed from the front, 0 otherwise.
+*/
+static int SweepExtinguishCell(sweep_t * sw, int idx)
+{
+  BurnFront * bf = sw->bf;
+  double * rosmps = BURN_FRONT_NBR_ARRAY(bf, rosmps, idx);
+  int i = bf->i[idx];                           /* spatial row */
+  int j = bf->j[idx];                           /* spatial col */
+  int cell_az;                                  /* stores cell azimuth */
+  int nbr_i, nbr_j;                             /* stores nbr cell index i,j */
   int num_nbr;                                  /* count of cells which are not burnable, already ignited, or consumed */
-  int is_sa = 0;                                /* flag to indicate santa ana is active */
 
-  void (*RandInit)(long int seed) = randinit;   /* rng seed function from NLIBRand.h */
+  /* iterate through all neighboring cell azimuths  */
+  for (cell_az = 0, num_nbr = 0; cell_az < EIGHTNBR_NUM_NBR_CELLS; cell_az++) 
+  {
+    /* retrieve coordinate information for neighbor cell */
+    nbr_i = EIGHTNBR_ROW_INDEX_AT_AZIMUTH(i, cell_az);
+    nbr_j = EIGHTNBR_COL_INDEX_AT_AZIMUTH(j, cell_az);
+    /* no spread into cells outside the domain, or that are not burnable, already ignited, or consumed */
+    if ( !SWEEP_IN_DOMAIN(sw, nbr_i, nbr_j) || CELL_STATE_GET_DATA(sw->cs, nbr_i, nbr_j) != EnumNoFireCellState ) 
+    {
+      rosmps[cell_az] = 0.0;
+      ++num_nbr;
+      continue;
+    }
+    /* no spread into boundary cells */
+    if ( !SWEEP_IN_INTERIOR(sw, nbr_i, nbr_j) )
+    {
+      ++num_nbr;
+      continue;
+    }
+  }
+  /* transition this cell to consumed state */
+  if ( num_nbr == EIGHTNBR_NUM_NBR_CELLS )
+  {
+    CELL_STATE_SET_DATA(sw->cs, i, j, EnumConsumedCellState);
+    /* remove cell from front of burning cells */
+    BurnFrontRemove(bf, idx);
+    return 1;
+  }
+  /* check for fire extinction */
+  if ( UpdateExtinctionROS(sw->cfg, i, j, bf->max_rosmps[idx], sw->cs) )
+  {
+    /* remove cell from front of burning cells */
+    BurnFrontRemove(bf, idx);
+    return 1;
+  }
 
-  char status_msg[HFIRE_STATUS_LINE_LENGTH] = {'\0'};
+  return 0;
+}
+
+/*
+** Increments the distance travelled from burning cell idx toward each unburned neighbor during
+** iter_secs, and ignites the neighbors whose cell center has been reached.
+**
+** Ignited cells are appended to the front, with the distance travelled past the cell center
+** carried over to the new cell in the same direction.
+*/
+static int SweepSpreadCell(sweep_t * sw, FireYear * fyr, int idx, double iter_secs, int is_sa)
+{
+  BurnFront * bf = sw->bf;
+  int i = bf->i[idx];                           /* spatial row */
+  int j = bf->j[idx];                           /* spatial col */
+  double * rosmps = BURN_FRONT_NBR_ARRAY(bf, rosmps, idx);
+  double * distm = BURN_FRONT_NBR_ARRAY(bf, distm, idx);
+  double * dist2ctrm = BURN_FRONT_NBR_ARRAY(bf, dist2ctrm, idx);
+  int new_idx;                                  /* index of ignited cell parameters */
+  int cell_az;                                  /* stores cell azimuth */
+  int nbr_i, nbr_j;                             /* stores nbr cell index i,j */
+
+  for (cell_az = 0; cell_az < EIGHTNBR_NUM_NBR_CELLS; cell_az++) 
+  {
+    /* retrieve coordinate information for neighbor cell */
+    nbr_i = EIGHTNBR_ROW_INDEX_AT_AZIMUTH(i, cell_az);
+    nbr_j = EIGHTNBR_COL_INDEX_AT_AZIMUTH(j, cell_az);
+    /* skip computation for boundary cells and cells outside the domain */
+    if ( !SWEEP_IN_INTERIOR(sw, nbr_i, nbr_j) )
+    {
+      continue;
+    }
+    /* update the distance spread from the burning cell */
+    switch ( CELL_STATE_GET_DATA(sw->cs, nbr_i, nbr_j) )
+    {
+    case EnumUnBurnableCellState:
+      /* cell is not burnable, do nothing */
+      break;
+    case EnumConsumedCellState:
+      /* cell is consumed, do nothing */
+      break;
+    case EnumHasFireCellState:
+      /* cell is already burning, do nothing */
+      break;
+    case EnumNoFireCellState:
+      /* skip computation if rate of spread is zero */
+      if ( rosmps[cell_az] > 0.0 )
+      {
+        /* cell is not yet burning, increment the distance traveled to this cell during this iteration */
+        distm[cell_az] += rosmps[cell_az] * iter_secs;
+        /* compare the distance traveled with the distance to the cell center */
+        if ( distm[cell_az] > dist2ctrm[cell_az] )
+        {
+          /* set the cell state to ignited */
+          CELL_STATE_SET_DATA(sw->cs, nbr_i, nbr_j, EnumHasFireCellState);
+          /* assign the cell the same fire id as the cell from which the fire came */
+          FireYearSetCellFireIDRowCol(fyr, nbr_i, nbr_j, INTTWODARRAY_GET_DATA(fyr->id, i, j), sw->ft, is_sa);
+          /* add new burning cell to front of burning cells, which may move its arrays */
+          if ( (new_idx = BurnFrontAdd(bf, nbr_i, nbr_j)) < 0 )
+          {
+            return ERR_ENOMEM;
+          }
+          rosmps = BURN_FRONT_NBR_ARRAY(bf, rosmps, idx);
+          distm = BURN_FRONT_NBR_ARRAY(bf, distm, idx);
+          dist2ctrm = BURN_FRONT_NBR_ARRAY(bf, dist2ctrm, idx);
+          BURN_FRONT_NBR_ARRAY(bf, distm, new_idx)[cell_az] = distm[cell_az] - dist2ctrm[cell_az]; /* slop over */
+        }
+      }
+      break;
+    }
+  }
+
+  return ERR_SUCCESS;
+}
+
+/*
+** Advances a single fire through one timestep with iterations sized by its own rate of spread.
+**
+** On entry items holds the burning cells of the fire, cells ignited by the fire are appended to
+** items as they are added to the front, and cells removed from the front are squeezed out.
+*/
+static int LocalSpreadFire(sweep_t * sw, ThreadPool * tp, FireYear * fyr, int timestep,
+                           int is_sa, int ** items, int * cap_items, int num_items, int * num_iter)
+{
+  BurnFront * bf = sw->bf;
+  double exp_secs, iter_secs;                   /* duration of iteration during timestep */
+  double max_rosmps;                            /* maximum rate of spread of fire, in m/s */
+  int * tmp = NULL;
+  int idx, k, n, size;
 
   /*
-  ** Command line arguments
-  **
-  ** argc   = number of arguments (should be 2)
-  ** argv[0]  = "name of executable"
-  ** argv[1]  = "configuration file name"
-  ** argv[2]  = NULL
+  ** Loop Over Each Iteration of the Fire in a Timestep
   */
-  if ( argc != 2 )
+  for ( exp_secs = 0.0; exp_secs < (double) timestep && num_items > 0; exp_secs += iter_secs )
   {
-    printf("Usage: %s <configuration filename> \n", argv[0]);
-    return 0;
+    /* compute the rate of fire spread from every burning cell of the fire to its neighbors */
+    sw->items = *items;
+    sw->first = 0;
+    k = ThreadPoolParallelFor(tp, num_items, 0, SweepComputeCells, sw);
+    sw->items = NULL;
+    if ( k )
+    {
+      return ERR_EFAILED;
+    }
+
+    /* apply neighbor states and extinction, removed cells are squeezed out of the fire */
+    for ( k = 0, n = 0, max_rosmps = 0.0; k < num_items; k++ )
+    {
+      idx = (*items)[k];
+      if ( bf->max_rosmps[idx] > max_rosmps )
+      {
+        max_rosmps = bf->max_rosmps[idx];
+      }
+      if ( SweepExtinguishCell(sw, idx) == 0 )
+      {
+        (*items)[n++] = idx;
+      }
+    }
+    num_items = n;
+
+    /* compute the elapsed time during the current iteration from the rate of spread of this fire */
+    if ( max_rosmps > 0.0 )
+    {
+      iter_secs = (sw->cellsz / max_rosmps) * 0.25;
+      if ( (exp_secs + iter_secs) > (double) timestep )
+      {
+        iter_secs = (double) timestep - exp_secs + HFIRE_EPSILON;
+      }
+    }
+    else
+    {
+      iter_secs = (double) timestep - exp_secs + HFIRE_EPSILON;
+    }
+
+    /* compute the distance traveled, cells ignited are appended to the fire */
+    size = BURN_FRONT_SIZE(bf);
+    for ( k = 0; k < num_items; k++ )
+    {
+      if ( SweepSpreadCell(sw, fyr, (*items)[k], iter_secs, is_sa) )
+      {
+        return ERR_ENOMEM;
+      }
+    }
+    if ( num_items + BURN_FRONT_SIZE(bf) - size > *cap_items )
+    {
+      n = 2 * (num_items + BURN_FRONT_SIZE(bf) - size);
+      if ( (tmp = (int *) realloc(*items, sizeof(int) * n)) == NULL )
+      {
+        ERR_ERROR("Unable to allocate memory for burning cells of fire.\n", ERR_ENOMEM);
+      }
+      *items = tmp;
+      *cap_items = n;
+    }
+    for ( idx = size; idx < BURN_FRONT_SIZE(bf); idx++ )
+    {
+      (*items)[num_items++] = idx;
+    }
+    ++(*num_iter);
+  } /* End Iteration */
+
+  return ERR_SUCCESS;
+}
+
+/*
+** Advances each fire through one timestep with iterations sized by the rate of spread of that fire.
+**
+** Burning cells are grouped by fire id, and each fire iterates over the timestep independently,
+** so a fast fire does not force slow fires elsewhere in the domain to take the same small steps.
+** Fires are advanced one after another in order of fire id and only synchronize at the end of the
+** timestep, a fire sees cells ignited by fires advanced before it as already burning.
+*/
+static int LocalSpreadTimestep(sweep_t * sw, ThreadPool * tp, FireYear * fyr,
+                               int timestep, int is_sa)
+{
+  BurnFront * bf = sw->bf;
+  int num_brn = BURN_FRONT_SIZE(bf);            /* number of burning cells at start of timestep */
+  int num_grp = fyr->num_fires + 1;             /* number of fire ids, id 0 collects cells without a fire */
+  int * grp_start = NULL;                       /* first entry of each fire in order */
+  int * grp_fill = NULL;                        /* next free entry of each fire in order */
+  int * order = NULL;                           /* burning cells at start of timestep grouped by fire */
+  int * items = NULL;                           /* burning cells of the fire being advanced */
+  int cap_items = num_brn;                      /* number of entries allocated in items */
+  int grp, fid, idx;
+  int num_iter = 0;                             /* total number of iterations of all fires */
+  int status = ERR_SUCCESS;
+  char status_msg[HFIRE_STATUS_LINE_LENGTH] = {'\0'};
+
+  if ( num_brn == 0 )
+  {
+    TimeStamp(sw->ft, "NO CELLS BURNING");
+    return ERR_SUCCESS;
   }
 
-  /* load properties from configuration file */
-  if ( InitPropsFromFireConfig(&proptbl, argv[1]) )
+  /* first cell is computed on this thread, so spatial environment datasets are loaded only once */
+  if ( SweepComputeCell(sw, 0, 0) )
   {
-    QuitFatal(NULL);
+    return ERR_EFAILED;
   }
-  FireConfigDumpPropsToStream(proptbl, stdout);
 
-  /* load fuel models from properties */
-  if ( InitRothFuelModelListFromProps(proptbl, &fmlist) )
+  grp_start = (int *) calloc(num_grp + 1, sizeof(int));
+  grp_fill = (int *) malloc(sizeof(int) * num_grp);
+  order = (int *) malloc(sizeof(int) * num_brn);
+  items = (int *) malloc(sizeof(int) * cap_items);
+  if ( grp_start == NULL || grp_fill == NULL || order == NULL || items == NULL )
+  {
+    ERR_ERROR_CONTINUE("Unable to allocate memory for burning cells of fire.\n", ERR_ENOMEM);
+    status = ERR_ENOMEM;
+  }
+  else
+  {
+    /* group the burning cells by fire id, preserving order of ignition within each fire */
+    for ( idx = 0; idx < num_brn; idx++ )
+    {
+      fid = INTTWODARRAY_GET_DATA(fyr->id, bf->i[idx], bf->j[idx]);
+      grp_start[((fid > 0 && fid < num_grp) ? fid : 0) + 1]++;
+    }
+    for ( grp = 0; grp < num_grp; grp++ )
+    {
+      grp_start[grp + 1] += grp_start[grp];
+      grp_fill[grp] = grp_start[grp];
+    }
+    for ( idx = 0; idx < num_brn; idx++ )
+    {
+      fid = INTTWODARRAY_GET_DATA(fyr->id, bf->i[idx], bf->j[idx]);
+      order[grp_fill[(fid > 0 && fid < num_grp) ? fid : 0]++] = idx;
+    }
+
+    /* advance each fire with its own iterations */
+    for ( grp = 0; grp < num_grp && status == ERR_SUCCESS; grp++ )
+    {
+      if ( grp_start[grp + 1] > grp_start[grp] )
+      {
+        memcpy(items, order + grp_start[grp], sizeof(int) * (grp_start[grp + 1] - grp_start[grp]));
+        status = LocalSpreadFire(sw, tp, fyr, timestep, is_sa, &items, &cap_items,
+                                 grp_start[grp + 1] - grp_start[grp], &num_iter);
+      }
+    }
+
+    /* squeeze removed cells out of the front, remaining cells keep their order */
+    BurnFrontCompact(bf);
+
+    /* signal user */
+    sprintf(status_msg, "N_brn: %d N_iter: %d", num_brn, num_iter);
+    TimeStamp(sw->ft, status_msg);
+  }
+
+  if ( items != NULL )      free(items);
+  if ( order != NULL )      free(order);
+  if ( grp_fill != NULL )   free(grp_fill);
+  if ( grp_start != NULL )  free(grp_start);
+
+  return status;
+}
+
+/*
+** Schedules the arrival of fire from burning cell idx at the center of each unburned neighbor.
+**
+** Arrival time is measured from the start of the timestep, and accounts for the distance the
+** fire has already travelled toward the neighbor as of the ignition time of the cell.
+*/
+static int EventScheduleCell(sweep_t * sw, EventQueue * eq, int idx)
+{
+  BurnFront * bf = sw->bf;
+  double * rosmps = BURN_FRONT_NBR_ARRAY(bf, rosmps, idx);
+  double * distm = BURN_FRONT_NBR_ARRAY(bf, distm, idx);
+  double * dist2ctrm = BURN_FRONT_NBR_ARRAY(bf, dist2ctrm, idx);
+  double remm;                                  /* distance remaining to neighbor cell center, in m */
+  int cell_az;                                  /* stores cell azimuth */
+
+  for (cell_az = 0; cell_az < EIGHTNBR_NUM_NBR_CELLS; cell_az++)
+  {
+    /* rate of spread is zero into neighbors which may not receive fire */
+    if ( rosmps[cell_az] > 0.0 )
+    {
+      remm = HFIRE_MAX(dist2ctrm[cell_az] - distm[cell_az], 0.0);
+      if ( EventQueuePush(eq, bf->ign_secs[idx] + remm / rosmps[cell_az], idx, cell_az) )
+      {
+        return ERR_ENOMEM;
+      }
+    }
+  }
+
+  return ERR_SUCCESS;
+}
+
+/*
+** Advances the fire front through one timestep by processing ignitions in order of arrival time.
+**
+** Rate of spread is evaluated once per timestep for cells burning at the start of the timestep,
+** and once for each cell when it ignites, so the cost of the timestep is proportional to the number
+** of cells on the perimeter rather than the number of iterations required by the fastest cell.
+** Burning cells are computed by the pool, ignitions are processed on this thread in order of
+** arrival time with ties broken by position in the front, so results do not depend on the number
+** of workers.  Distance travelled toward neighbors which have not ignited by the end of the
+** timestep is carried into the next timestep.
+*/
+static int EventSpreadTimestep(sweep_t * sw, ThreadPool * tp, FireYear * fyr,
+                               EventQueue * eq, int timestep, int is_sa)
+{
+  BurnFront * bf = sw->bf;
+  Event ev;                                     /* earliest ignition */
+  int num_brn;                                  /* number of burning cells at start of timestep */
+  int num_ign = 0;                              /* number of cells ignited during timestep */
+  int idx, new_idx;                             /* index of burning cell parameters */
+  int nbr_i, nbr_j;                             /* stores nbr cell index i,j */
+  double * rosmps, * distm;                     /* neighbor parameters of burning cell */
+  int cell_az;                                  /* stores cell azimuth */
+  char status_msg[HFIRE_STATUS_LINE_LENGTH] = {'\0'};
+
+  /* compute the rate of fire spread from every burning cell to its neighbors */
+  num_brn = BURN_FRONT_SIZE(bf);
+  if ( num_brn > 0 )
+  {
+    /* first cell is computed on this thread, so spatial environment datasets are loaded only once */
+    if ( SweepComputeCell(sw, 0, 0) )
+    {
+      return ERR_EFAILED;
+    }
+    /* remaining cells only read environment state and are computed by the pool */
+    sw->first = 1;
+    if ( ThreadPoolParallelFor(tp, num_brn - 1, 0, SweepComputeCells, sw) )
+    {
+      return ERR_EFAILED;
+    }
+  }
+
+  /* apply neighbor states and extinction to every burning cell, in order of ignition */
+  for ( idx = 0; idx < BURN_FRONT_SIZE(bf); idx++ )
+  {
+    SweepExtinguishCell(sw, idx);
+  }
+  BurnFrontCompact(bf);
+
+  /* schedule arrival of fire at neighbors of every burning cell */
+  EVENT_QUEUE_CLEAR(eq);
+  for ( idx = 0; idx < BURN_FRONT_SIZE(bf); idx++ )
+  {
+    bf->ign_secs[idx] = 0.0;
+    if ( EventScheduleCell(sw, eq, idx) )
+    {
+      return ERR_ENOMEM;
+    }
+  }
+
+  /* ignite cells in order of arrival time */
+  while ( !EVENT_QUEUE_IS_EMPTY(eq) && EVENT_QUEUE_PEEK(eq)->time < (double) timestep )
+  {
+    EventQueuePop(eq, &ev);
+    nbr_i = EIGHTNBR_ROW_INDEX_AT_AZIMUTH(bf->i[ev.src], ev.dst);
+    nbr_j = EIGHTNBR_COL_INDEX_AT_AZIMUTH(bf->j[ev.src], ev.dst);
+    /* neighbor already ignited by an earlier arrival */
+    if ( CELL_STATE_GET_DATA(sw->cs, nbr_i, nbr_j) != EnumNoFireCellState )
+    {
+      continue;
+    }
+    /* set the cell state to ignited */
+    CELL_STATE_SET_DATA(sw->cs, nbr_i, nbr_j, EnumHasFireCellState);
+    /* assign the cell the same fire id as the cell from which the fire came */
+    FireYearSetCellFireIDRowCol(fyr, nbr_i, nbr_j, INTTWODARRAY_GET_DATA(fyr->id, bf->i[ev.src], bf->j[ev.src]), sw->ft, is_sa);
+    /* add new burning cell to front of burning cells */
+    if ( (new_idx = BurnFrontAdd(bf, nbr_i, nbr_j)) < 0 )
+    {
+      return ERR_ENOMEM;
+    }
+    bf->ign_secs[new_idx] = ev.time;
+    ++num_ign;
+    /* compute the rate of spread from the new cell and schedule its neighbors */
+    if ( SweepComputeCell(sw, 0, new_idx) )
+    {
+      return ERR_EFAILED;
+    }
+    if ( SweepExtinguishCell(sw, new_idx) == 0 && EventScheduleCell(sw, eq, new_idx) )
+    {
+      return ERR_ENOMEM;
+    }
+  }
+
+  /* carry the distance travelled toward unburned neighbors into the next timestep */
+  for ( idx = 0; idx < BURN_FRONT_SIZE(bf); idx++ )
+  {
+    if ( BURN_FRONT_IS_REMOVED(bf, idx) )
+    {
+      continue;
+    }
+    rosmps = BURN_FRONT_NBR_ARRAY(bf, rosmps, idx);
+    distm = BURN_FRONT_NBR_ARRAY(bf, distm, idx);
+    for (cell_az = 0; cell_az < EIGHTNBR_NUM_NBR_CELLS; cell_az++)
+    {
+      if ( rosmps[cell_az] > 0.0 )
+      {
+        distm[cell_az] += rosmps[cell_az] * ((double) timestep - bf->ign_secs[idx]);
+      }
+    }
+  }
+  /* squeeze out cells extinguished as they ignited */
+  BurnFrontCompact(bf);
+
+  /* signal user */
+  sprintf(status_msg, "N_brn: %d N_ign: %d", num_brn, num_ign);
+  TimeStamp(sw->ft, status_msg);
+
+  return ERR_SUCCESS;
+}
+
+/*
+** Runs the simulation from start to end year with the properties of a single run or replicate.
+**
+** Inputs which do not change during the simulation are loaded once by the caller and shared by every
+** replicate, the rate of spread table is filled by whichever replicate first visits an entry.  State
+** which evolves during the simulation, the clock, stand age, environment vars, and fires, is loaded
+** from proptbl for each run so replicates do not depend on the replicates run before them.  Random numbers
+** are drawn from child stream rep of the root stream, so a run is reproduced by the seed and rep regardless
+** of the number of workers or the replicates run before it.  When ens is not NULL the fires of each year
+** are aggregated over the ensemble as replicate rep.
+**
+** The fire front is computed by the workers of tp.  When replicates run concurrently tp is NULL and the
+** run uses only the RothSpreadTable of worker, the worker of the pool running the replicate.
+*/
+static void RunSimulation(shared_t * sh, ThreadPool * tp, int worker, ChHashTable * proptbl, Ensemble * ens, int rep)
+{
+  const SimConfig * cfg = sh->cfg;              /* simulation properties converted at load */
+  GridData * std_age = NULL;                    /* stand age spatial data */
+  GridData * fuels = NULL;                      /* fuels spatial data */
+  FireTimer * ft = NULL;                        /* stores simulation time */
+  FireEnv * fe = NULL;                          /* table of function ptrs for environment vars */
+  FireExport * fex = NULL;                      /* wrapper for program export */
+  FireEnvSnapshot * fes = NULL;                 /* environment vars of the current timestep */
+  EventQueue * eq = NULL;                       /* pending ignitions of the event spread engine */
+  RandStream rs;                                /* random numbers of the run, split by purpose in fe */
+
+  ListElmt * lel = NULL;                        /* ptr to single element in a list */
+
+  double exp_secs, iter_secs;                   /* duration of iteration during timestep */
+  int domain_rows, domain_cols;                 /* simulation domain size */
+  double cellsz;                                /* simulation cell resolution, in m */
+  double xulcntr, yulcntr;                      /* simulation upper left coordinates */
+  FireYear * fyr = NULL;                        /* ids of burned cells */
+  CellState * cs = NULL;                        /* cell state */
+  CellPlane * plane = NULL;                     /* packed cell state, shared by every year */
+  BurnFront * bf = NULL;                        /* burning cell parameters, in order of ignition */
+  int is_fuels_changed = 0;                     /* 1 if fuels of the year differ from the previous year */
+  int num_brn;                                  /* number of burning cells at start of iteration */
+  sweep_t sweep;                                /* state shared with workers computing the fire front */
+  StandAgeYearStats std_age_stats;              /* counts of cells by fire id and stand age at end of year */
+
+  List * ig_cells_list = NULL;                  /* list of xy coordinates for ignited cells */
+  double * ig_rwx, * ig_rwy;                    /* real world xy coordinate pair for ignited cell */
+
+  double max_rosmps;                            /* maximum rate of spread, in m/s */
+  int i, j;                                     /* spatial row and col */
+  int idx;                                      /* index of burning cell parameters */
+  int cell, nbr_az[3], brn_az[3];               /* stores neighbor and burning azimuths */
+  int is_sa = 0;                                /* flag to indicate santa ana is active */
+
+  char status_msg[HFIRE_STATUS_LINE_LENGTH] = {'\0'};
+
+  /* load state which evolves during the simulation from properties */
+  if (    InitFireTimerFromSimConfigFireConfig(cfg, &ft)
+      ||  InitStandAgeFromPropsFireConfig(proptbl, cfg, sh->elev, &std_age)
+      ||  InitFireEnvFromPropsFireConfig(proptbl, cfg, sh->fet, &fe)
+      ||  InitRandStreamSplit(&sh->rs, (unsigned long) rep, &rs)
+      ||  FireEnvSetRandStream(fe, &rs)  )
   {
     QuitFatal(NULL);
   }
-  FireConfigDumpFuelModelListToStream(fmlist, stdout);
 
-  /* load initialization parameters from properties */
-  if (    InitGridsFromPropsFireConfig(proptbl, &elev, &slope, &aspect)
-      ||  InitFireTimerFromPropsFireConfig(proptbl, &ft)
-      ||  InitFuelModelHashTableFromFuelModelListFireConfig(fmlist, &fmtble)
-      ||  InitStandAgeFromPropsFireConfig(proptbl, elev, &std_age)
-      ||  InitFireEnvFromPropsFireConfig(proptbl, &fe)
-      ||  InitRandNumGenFromPropsFireConfig(proptbl, randinit)  )
+  /* initialize storage for environment vars evaluated once per timestep */
+  if ( (fes = InitFireEnvSnapshot(fe, sh->fmlist)) == NULL )
   {
     QuitFatal(NULL);
   }
@@ -183,23 +826,28 @@ int main(int argc, char * argv[])
   FIRE_EXPORT_SET_FIRE_TIMER(fex, ft);
   FIRE_EXPORT_SET_STAND_AGE(fex, std_age);
 
-  /* set simulation timestep */
-  if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SIMTSSEC), (void *)&entry) )
+  /* initialize queue of pending ignitions used by the event spread engine */
+  if ( cfg->spread_engine == EnumSpreadEngineEvent && (eq = InitEventQueue()) == NULL )
   {
-    ERR_ERROR_CONTINUE("Unable to retrieve SIMULATION_TIMESTEP_SECS property.\n", ERR_EINVAL);
     QuitFatal(NULL);
   }
-  timestep = atoi(entry->val);
 
-  /* set fire ellipse adjustment factor */
-  if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_FEAF), (void *)&entry) )
-  {
-    ell_adj = 1.0;
-  }
-  else
+  /* set fire front state which does not change during simulation */
+  memset(&sweep, 0, sizeof(sweep_t));
+  sweep.proptbl = proptbl;
+  sweep.cfg = cfg;
+  sweep.fe = fe;
+  sweep.fes = fes;
+  sweep.ft = ft;
+  sweep.fmtble = sh->fmtble;
+  if ( InitGridDataView(sh->elev, &sweep.elev) || InitGridDataView(sh->slope, &sweep.slope) || InitGridDataView(sh->aspect, &sweep.aspect) )
   {
-    ell_adj = atof(entry->val);
+    QuitFatal(NULL);
   }
+  sweep.ell_adj = cfg->ell_adj;
+  sweep.rst = sh->rst;
+  sweep.worker = worker;
+  sweep.td = sh->td;
 
   /*
   ** Loop Over Each Year in a Simulation
@@ -214,8 +862,8 @@ int main(int argc, char * argv[])
     /* signal user */
     TimeStamp(ft, "START SIM YEAR");
 
-    /* initialize fuels to be used during this year of simulation */
-    if ( fe->GetFuelsRegrowthFromProps(proptbl, std_age, &fuels) )
+    /* initialize fuels to be used during this year of simulation, refilling fuels of the previous year */
+    if ( fe->GetFuelsRegrowthFromProps(proptbl, cfg, std_age, &fuels, &is_fuels_changed) || fuels == NULL )
     {
       QuitFatal(NULL);
     }
@@ -228,28 +876,54 @@ int main(int argc, char * argv[])
     xulcntr = COORD_TRANS_XLLCORNER_TO_XULCNTR(fuels->ghdr->xllcorner, cellsz);
     yulcntr = COORD_TRANS_YLLCORNER_TO_YULCNTR(fuels->ghdr->yllcorner, cellsz, fuels->ghdr->nrows);
 
-    /* initialize a fire year structure for year in simulation */
-    fyr = InitFireYearFuels(ft->sim_cur_yr, fuels, fmtble);
-    FIRE_EXPORT_SET_FIRE_YEAR(fex, fyr);
+    if ( fyr == NULL )
+    {
+      /* allocate the yearly structures once, they are reset in place at the start of each following year */
+      if ( (plane = InitCellPlane(domain_rows, domain_cols)) == NULL )
+      {
+        QuitFatal(NULL);
+      }
+
+      /* initialize a fire year structure for year in simulation */
+      fyr = InitFireYearFuelsThreadPool(tp, ft->sim_cur_yr, fuels, sh->fmtble, plane);
 
-    /* initialize a cell state structure for year in simulation */
-    cs = InitCellStateFuels(fuels, fmtble);
+      /* initialize a cell state structure for year in simulation */
+      cs = InitCellStateFireYear(fyr, fuels);
 
-    /* initialize array to store number of hours a cell has been burning */
-    hrs_brn = InitByteTwoDArraySizeIniValue(domain_rows, domain_cols, 0);
+      /* initialize an empty front of burning cells */
+      bf = InitBurnFront(domain_rows, domain_cols);
 
-    /* initialize an empty list of burning cells */
-    brn_cells_list = InitListEmpty(free);
+      /* ensure all structures properly initialized */
+      if ( fyr == NULL || cs == NULL || bf == NULL )
+      {
+        QuitFatal(NULL);
+      }
+    }
+    else
+    {
+      /* reset only the cells burned in the previous year, unless the fuels changed */
+      if ( ResetFireYearFuelsThreadPool(tp, fyr, ft->sim_cur_yr, fuels, sh->fmtble, is_fuels_changed) )
+      {
+        QuitFatal(NULL);
+      }
 
-    /* initialize an array of pointers to burning cells */
-    brn_cells_map = malloc(sizeof(brn_cell_t *) * domain_rows * domain_cols);
-    if ( brn_cells_map != NULL ) memset(brn_cells_map, 0, sizeof(brn_cell_t *) * domain_rows * domain_cols);
+      /* empty the front of burning cells */
+      ResetBurnFront(bf);
+    }
+    FIRE_EXPORT_SET_FIRE_YEAR(fex, fyr);
 
-    /* ensure all structures properly initialized */
-    if ( fyr == NULL || cs == NULL || hrs_brn == NULL || brn_cells_list == NULL || brn_cells_map == NULL )
+    /* set fire front state which does not change during year */
+    sweep.cs = cs;
+    if ( InitGridDataView(fuels, &sweep.fuels) )
     {
       QuitFatal(NULL);
     }
+    sweep.domain_rows = domain_rows;
+    sweep.domain_cols = domain_cols;
+    sweep.cellsz = cellsz;
+    sweep.xulcntr = xulcntr;
+    sweep.yulcntr = yulcntr;
+    sweep.bf = bf;
 
     /*
     ** Loop Over Each Timestep in a Year
@@ -257,10 +931,10 @@ int main(int argc, char * argv[])
     while( !FireTimerIsSimCurYearTimeExpired(ft) )
     {
       /* determine if ignition occurs during this timestep */
-      if ( fe->IsIgnitionNowFromProps(proptbl) )
+      if ( fe->IsIgnitionNowFromProps(fe->ig, cfg) )
       {
         /* obtain coordinates of ignited cells */
-        if ( fe->GetIgnitionLocFromProps(proptbl, fyr, &ig_cells_list) )
+        if ( fe->GetIgnitionLocFromProps(fe->ig, proptbl, cfg, fyr, &ig_cells_list) )
         {
           QuitFatal(NULL);
         }
@@ -284,299 +958,121 @@ int main(int argc, char * argv[])
             QuitFatal(NULL);
           }
           FireExportIgLocsTxtFile(proptbl, fyr->num_fires, *ig_rwx, *ig_rwy, ft);
-          /* initialize a new burning cell structure */
-          if ( (new_brn_cell = malloc(sizeof(brn_cell_t))) == NULL )
+          /* add new burning cell to front of burning cells */
+          if ( BurnFrontAdd(bf, i, j) < 0 )
           {
             QuitFatal(NULL);
           }
-          memset(new_brn_cell, 0, sizeof(brn_cell_t));
-          new_brn_cell->i = i;
-          new_brn_cell->j = j;
-          new_brn_cell->rwx = *ig_rwx;
-          new_brn_cell->rwy = *ig_rwy;
-          /* add new burning cell to list of burning cells */
-          ListInsertNext(brn_cells_list, LIST_TAIL(brn_cells_list), new_brn_cell);
-          /* insert pointer to burning cell into map */
-          brn_cells_map[i * domain_cols + j] = new_brn_cell;
         }
 
         /* empty the list of ignited cells */
         FreeList(ig_cells_list);
       }
 
-      /*
-      ** Loop Over Each Iteration in a Timestep
-      */
-      for ( exp_secs = 0.0; exp_secs < (double) timestep; exp_secs += iter_secs ) 
+      /* retrieve environment vars which do not vary in space once for all burning cells */
+      if ( BURN_FRONT_SIZE(bf) > 0 )
       {
-        /* reset the maximum rate of fire spread this iteration */
-        max_rosmps = 0.0;
+        if ( FireEnvSnapshotUpdate(fes, fe, proptbl, ft) )
+        {
+          QuitFatal(NULL);
+        }
+        is_sa = fes->is_sa;
+      }
 
-        /* compute the rate of fire spread from every burning cell to its neighbors */
-        for( lel = LIST_HEAD(brn_cells_list), prev = NULL; lel != NULL;  )
+      if ( cfg->spread_engine == EnumSpreadEngineEvent )
+      {
+        /* advance the fire front in order of ignition time */
+        if ( EventSpreadTimestep(&sweep, tp, fyr, eq, cfg->timestep_secs, is_sa) )
         {
-          brn_cell = LIST_GET_DATA(lel);
-          /* retrieve coordinate information for burning cell */
-          i = brn_cell->i;
-          j = brn_cell->j;
-          /* retrieve real-world coordinates of cell */
-          if ( CoordTransSixParamRasterToRealWorld(i, j, cellsz, cellsz, xulcntr, yulcntr,0.0, 0.0, &rwx, &rwy) )
-          {
-            QuitFatal(NULL);
-          }
-          brn_cell->rwx = rwx;
-          brn_cell->rwy = rwy;
-          /* retrieve spatial attribute data */
-          GRID_DATA_GET_DATA(elev, i, j, cell_elev);              
-          GRID_DATA_GET_DATA(slope, i, j, cell_slope);
-          GRID_DATA_GET_DATA(aspect, i, j, cell_aspect);                                  
-          GRID_DATA_GET_DATA(fuels, i, j, cell_fmnum);
-          /* retrieve fuel model attribute data */
-          if ( ChHashTableRetrieve(fmtble, &cell_fmnum, (void *)&fm) )
-          {
-            QuitFatal(NULL);
-          }
-          fbedhgtm = fm->rfm->fdepth;
-          if ( fm->rfm->units == EnumEnglishUnits ) fbedhgtm = UNITS_FT_TO_M(fbedhgtm);
-          /* retrieve Santa Ana time-dependent attributes */
-          is_sa = IsSantaAnaNowFromProps(proptbl, ft->sim_cur_yr, ft->sim_cur_mo, ft->sim_cur_dy);
-          if ( is_sa )  
-          {
-            if ( GetSantaAnaEnvFromProps(proptbl, ft->sim_cur_mo, ft->sim_cur_dy, ft->sim_cur_hr, &waz, fbedhgtm, &wspmps, &d1hfm, &d10hfm, &d100hfm) )
-            {
-              QuitFatal(NULL);
-            }
-            wspfpm = UNITS_MPSEC_TO_FTPMIN(wspmps);                 
-          }
-          /* retrieve non Santa Ana time-dependent attributes */
-          else  
-          {
-            if ( fe->GetDeadFuelMoistFromProps(proptbl, ft->sim_cur_mo, ft->sim_cur_dy, ft->sim_cur_hr, rwx, rwy, &d1hfm, &d10hfm, &d100hfm) )
-            {
-              QuitFatal(NULL);
-            }
-            if ( fe->GetWindAzimuthFromProps(proptbl, ft->sim_cur_mo, ft->sim_cur_dy, ft->sim_cur_hr, rwx, rwy, &waz) )
-            {
-              QuitFatal(NULL);
-            }
-            if ( fe->GetWindSpeedMpsFromProps(proptbl, fbedhgtm, ft->sim_cur_mo, ft->sim_cur_dy, ft->sim_cur_hr, rwx, rwy, &wspmps) )
-            {
-              QuitFatal(NULL);
-            }
-            wspfpm = UNITS_MPSEC_TO_FTPMIN(wspmps); 
-          }
-          /* retrieve live fuel moisture */
-          if ( fe->GetLiveFuelMoistFromProps(proptbl, ft->sim_cur_yr, ft->sim_cur_mo, ft->sim_cur_dy, ft->sim_cur_hr, rwx, rwy, &lhfm, &lwfm) )
-          {
-            QuitFatal(NULL);
-          }
-          /* calculate the no-wind and no-slope rate of spread */
-          if ( Roth1972FireSpreadNoWindNoSlope(fm->rfm, d1hfm, d10hfm, d100hfm, lhfm, lwfm) ) 
-          {
-            QuitFatal(NULL);
-          }
-          /* calculate maximum rate of spread */
-          if ( Roth1972FireSpreadWindSlopeMax(fm->rfm, wspfpm, waz, cell_slope, cell_aspect, ell_adj) )
-          {
-            QuitFatal(NULL);
-          }
-          rosfpm = fm->rfm->rp->ros_max;
-          rosmps = UNITS_FTPMIN_TO_MPSEC(rosfpm);
-          brn_cell->max_rosmps = rosmps;
-          /* compare rate of spread to maximum observed during iteration */
-          if ( brn_cell->max_rosmps > max_rosmps )
-          {
-            max_rosmps = brn_cell->max_rosmps;
-          }
-          /* set the azimuth of the maximum rate of spread */
-          az = fm->rfm->rp->ros_az_max / 45.0;
-          if ( az < 0.5 )       brn_cell->max_ros_az = 0; /*   0 */
-          else if ( az < 1.5 )  brn_cell->max_ros_az = 1; /*  45 */
-          else if ( az < 2.5 )  brn_cell->max_ros_az = 2; /*  90 */
-          else if ( az < 3.5 )  brn_cell->max_ros_az = 3; /* 135 */
-          else if ( az < 4.5 )  brn_cell->max_ros_az = 4; /* 180 */
-          else if ( az < 5.5 )  brn_cell->max_ros_az = 5; /* 225 */
-          else if ( az < 6.5 )  brn_cell->max_ros_az = 6; /* 270 */
-          else if ( az < 7.5 )  brn_cell->max_ros_az = 7; /* 315 */
-          else                  brn_cell->max_ros_az = 0; /* 360 */
-          /* set the eccentricity of the burning fire */
-          brn_cell->eccen = fm->rfm->rp->eccen;
-          /* iterate through all neighboring cell azimuths  */
-          for (cell_az = 0, num_nbr = 0; cell_az < EIGHTNBR_NUM_NBR_CELLS; cell_az++) 
+          QuitFatal(NULL);
+        }
+      }
+      else if ( cfg->adaptive_timestep == EnumAdaptiveTimestepFire )
+      {
+        /* advance each fire with iterations sized by its own rate of spread */
+        if ( LocalSpreadTimestep(&sweep, tp, fyr, cfg->timestep_secs, is_sa) )
+        {
+          QuitFatal(NULL);
+        }
+      }
+      else
+      {
+        /*
+        ** Loop Over Each Iteration in a Timestep
+        */
+        for ( exp_secs = 0.0; exp_secs < (double) cfg->timestep_secs; exp_secs += iter_secs ) 
+        {
+          /* reset the maximum rate of fire spread this iteration */
+          max_rosmps = 0.0;
+
+          /* number of burning cells, cells ignited during this iteration are appended after them */
+          num_brn = BURN_FRONT_SIZE(bf);
+
+          /* compute the rate of fire spread from every burning cell to its neighbors */
+          if ( num_brn > 0 )
           {
-            /* retrieve coordinate information for neighbor cell */
-            nbr_i = EIGHTNBR_ROW_INDEX_AT_AZIMUTH(i, cell_az);
-            nbr_j = EIGHTNBR_COL_INDEX_AT_AZIMUTH(j, cell_az);
-            /* zero out the rate of spread into neighbor for this iteration */
-            brn_cell->rosmps[cell_az] = 0.0;
-            /* skip computation for cells that are not burnable, already ignited, or consumed */
-            if ( BYTETWODARRAY_GET_DATA(cs->state, nbr_i, nbr_j) != EnumNoFireCellState ) 
-            {
-              ++num_nbr;
-              continue;
-            }
-            /* skip computation for boundary cells */
-            if ( nbr_i == 0 || nbr_j == 0 || nbr_i == (domain_rows - 1) || nbr_j == (domain_cols - 1) )
-            {
-              ++num_nbr;
-              continue;
-            }
-            /* compute the rate of spread in direction of neighbor */
-            if ( Roth1972FireSpreadGetAtAzimuth(fm->rfm, EIGHTNBR_AZIMUTH_AS_DBL(cell_az)) ) 
+            /* first cell is computed on this thread, so spatial environment datasets are loaded only once */
+            if ( SweepComputeCell(&sweep, 0, 0) )
             {
               QuitFatal(NULL);
             }
-            rosfpm = fm->rfm->rp->ros_any;
-            brn_cell->rosmps[cell_az] = UNITS_FTPMIN_TO_MPSEC(rosfpm);
-            /* get terrain distance (xyz) to cell center */
-            GRID_DATA_GET_DATA(elev, nbr_i, nbr_j, nbr_elev);
-            if ( dxyzCalcDist(j * cellsz, i * cellsz, cell_elev, nbr_j * cellsz, nbr_i * cellsz, nbr_elev, &dist2ctrm) )
+            /* remaining cells only read environment state and are computed by the pool */
+            sweep.first = 1;
+            if ( ThreadPoolParallelFor(tp, num_brn - 1, 0, SweepComputeCells, &sweep) )
             {
               QuitFatal(NULL);
             }
-            brn_cell->dist2ctrm[cell_az] = dist2ctrm;
           }
-          /* transition this cell to consumed state */
-          if ( num_nbr == EIGHTNBR_NUM_NBR_CELLS )
+
+          /* apply neighbor states and extinction to every burning cell, in order of ignition */
+          for ( idx = 0; idx < BURN_FRONT_SIZE(bf); idx++ )
           {
-            BYTETWODARRAY_SET_DATA(cs->state, i, j, EnumConsumedCellState);
-            /* clear pointer to burning cell in map */
-            brn_cells_map[i * domain_cols + j] = NULL;
-            /* remove cell from list of burning cells */
-            if ( lel == LIST_HEAD(brn_cells_list) )
-            {
-              ListRemoveNext(brn_cells_list, NULL, &brn_cell);
-              lel = LIST_HEAD(brn_cells_list);
-              prev = NULL;
-            }
-            else
-            {
-              ListRemoveNext(brn_cells_list, prev, &brn_cell);
-              lel = LIST_GET_NEXT_ELMT(prev);
-            }
-            if ( brn_cell != NULL )
+            /* compare rate of spread to maximum observed during iteration */
+            if ( bf->max_rosmps[idx] > max_rosmps )
             {
-              free(brn_cell);
+              max_rosmps = bf->max_rosmps[idx];
             }
+            SweepExtinguishCell(&sweep, idx);
           }
-          /* check for fire extinction */
-          else if ( UpdateExtinctionROS(proptbl, i, j, brn_cell->max_rosmps, cs, hrs_brn) )
+          /* squeeze removed cells out of the front, remaining cells keep their order */
+          BurnFrontCompact(bf);
+
+          /* compute the elapsed time during the current iteration */
+          if ( max_rosmps > 0.0 )
           {
-            /* clear pointer to burning cell in map */
-            brn_cells_map[i * domain_cols + j] = NULL;
-            /* remove cell from list of burning cells */
-            if ( lel == LIST_HEAD(brn_cells_list) )
-            {
-              ListRemoveNext(brn_cells_list, NULL, &brn_cell);
-              lel = LIST_HEAD(brn_cells_list);
-              prev = NULL;
-            }
-            else
-            {
-              ListRemoveNext(brn_cells_list, prev, &brn_cell);
-              lel = LIST_GET_NEXT_ELMT(prev);
-            }
-            if ( brn_cell != NULL )
+            iter_secs = (cellsz / max_rosmps) * 0.25; /* try scaling the iteration timestep to help distortion */
+            /* saturate the elapsed time so that it does not exceed the current timestep */
+            if ( (exp_secs + iter_secs) > (double) cfg->timestep_secs )
             {
-              free(brn_cell);
+              iter_secs = (double) cfg->timestep_secs - exp_secs + HFIRE_EPSILON;
             }
           }
-          /* cell will continue to burn */
           else
           {
-            prev = lel;
-            lel = LIST_GET_NEXT_ELMT(lel);
+            TimeStamp(ft, "NO CELLS BURNING");
+            iter_secs = (double) cfg->timestep_secs - exp_secs + HFIRE_EPSILON;
           }
-        }
 
-        /* compute the elapsed time during the current iteration */
-        if ( max_rosmps > 0.0 )
-        {
-          iter_secs = (cellsz / max_rosmps) * 0.25; /* try scaling the iteration timestep to help distortion */
-          /* saturate the elapsed time so that it does not exceed the current timestep */
-          if ( (exp_secs + iter_secs) > (double) timestep )
+          /* compute the distance traveled from the computed rate and elapsed time */
+          for ( idx = 0, num_brn = BURN_FRONT_SIZE(bf); idx < num_brn; idx++ )
           {
-            iter_secs = (double) timestep - exp_secs + HFIRE_EPSILON;
-          }
-        }
-        else
-        {
-          TimeStamp(ft, "NO CELLS BURNING");
-          iter_secs = (double) timestep - exp_secs + HFIRE_EPSILON;
-        }
-
-        /* compute the distance traveled from the computed rate and elapsed time */
-        for( lel = LIST_HEAD(brn_cells_list); lel != NULL; lel = LIST_GET_NEXT_ELMT(lel) )
-        {
-          brn_cell = LIST_GET_DATA(lel);
-          /* retrieve coordinate information for burning cell */
-          i = brn_cell->i;
-          j = brn_cell->j;
-          for (cell_az = 0; cell_az < EIGHTNBR_NUM_NBR_CELLS; cell_az++) 
-          {
-            /* retrieve coordinate information for neighbor cell */
-            nbr_i = EIGHTNBR_ROW_INDEX_AT_AZIMUTH(i, cell_az);
-            nbr_j = EIGHTNBR_COL_INDEX_AT_AZIMUTH(j, cell_az);
-            /* skip computation for boundary cells */
-            if ( nbr_i == 0 || nbr_j == 0 || nbr_i == (domain_rows - 1) || nbr_j == (domain_cols - 1) )
-            {
-              continue;
-            }
-            /* update the distance spread from the burning cell */
-            switch ( BYTETWODARRAY_GET_DATA(cs->state, nbr_i, nbr_j) )
+            if ( SweepSpreadCell(&sweep, fyr, idx, iter_secs, is_sa) )
             {
-            case EnumUnBurnableCellState:
-              /* cell is not burnable, do nothing */
-              break;
-            case EnumConsumedCellState:
-              /* cell is consumed, do nothing */
-              break;
-            case EnumHasFireCellState:
-              /* cell is already burning, do nothing */
-              break;
-            case EnumNoFireCellState:
-              /* skip computation if rate of spread is zero */
-              if ( brn_cell->rosmps[cell_az] > 0.0 )
-              {
-                /* cell is not yet burning, increment the distance traveled to this cell during this iteration */
-                brn_cell->distm[cell_az] += brn_cell->rosmps[cell_az] * iter_secs;
-                /* compare the distance traveled with the distance to the cell center */
-                if ( brn_cell->distm[cell_az] > brn_cell->dist2ctrm[cell_az] )
-                {
-                  /* set the cell state to ignited */
-                  BYTETWODARRAY_SET_DATA(cs->state, nbr_i, nbr_j, EnumHasFireCellState);
-                  /* assign the cell the same fire id as the cell from which the fire came */
-                  FireYearSetCellFireIDRowCol(fyr, nbr_i, nbr_j, INTTWODARRAY_GET_DATA(fyr->id, i, j), ft, is_sa);
-                  /* initialize a new burning cell structure */
-                  if ( (new_brn_cell = malloc(sizeof(brn_cell_t))) == NULL )
-                  {
-                    QuitFatal(NULL);
-                  }
-                  memset(new_brn_cell, 0, sizeof(brn_cell_t));
-                  new_brn_cell->i = nbr_i;
-                  new_brn_cell->j = nbr_j;
-                  new_brn_cell->distm[cell_az] = brn_cell->distm[cell_az] - brn_cell->dist2ctrm[cell_az]; /* slop over */
-                  /* add new burning cell to list of burning cells */
-                  ListInsertNext(brn_cells_list, LIST_TAIL(brn_cells_list), new_brn_cell);
-                  /* insert pointer to burning cell into map */
-                  brn_cells_map[nbr_i * domain_cols + nbr_j] = new_brn_cell;
-                }
-              }
-              break;
+              QuitFatal(NULL);
             }
           }
-        }
 
-        /* signal user */
-        sprintf(status_msg, "T_exp: %f T_adapt: %f", exp_secs, iter_secs);
-        TimeStamp(ft, status_msg);
-      } /* End Iteration */
+          /* signal user */
+          sprintf(status_msg, "T_exp: %f T_adapt: %f", exp_secs, iter_secs);
+          TimeStamp(ft, status_msg);
+        } /* End Iteration */
+      }
 
       /* increment simulation clock */
-      FireTimerIncrementSeconds(ft, timestep);
+      FireTimerIncrementSeconds(ft, cfg->timestep_secs);
 
       /* increment cell extinction clock */
-      if ( UpdateExtinctionHOURS(proptbl, ft->sim_cur_mo, ft->sim_cur_dy, ft->sim_cur_hr, cs, hrs_brn) )
+      if ( UpdateExtinctionHOURS(fe->ext, cfg, ft->sim_cur_mo, ft->sim_cur_dy, ft->sim_cur_hr, cs, bf) )
       {
         QuitFatal(NULL);
       }
@@ -600,8 +1096,20 @@ int main(int argc, char * argv[])
       QuitFatal(NULL);
     }
 
+    /* aggregate fires of the year over every replicate */
+    if ( ens != NULL && EnsembleAddFireYear(ens, rep, fyr) )
+    {
+      QuitFatal(NULL);
+    }
+
+    /* count cells by fire id and stand age, then increment stand age, in a single pass */
+    if ( IncrementStandAgeYearStats(tp, fyr, std_age, &std_age_stats) )
+    {
+      QuitFatal(NULL);
+    }
+
     /* export fire area */
-    if ( FireExportFireAreaTxtFile(proptbl, fyr) )
+    if ( FireExportFireAreaTxtFile(proptbl, fyr, &std_age_stats) )
     {
       QuitFatal(NULL);
     }
@@ -613,26 +1121,11 @@ int main(int argc, char * argv[])
     }
 
     /* export age at burn histogram file */
-    if ( FireExportAgeAtBurnHistTxtFile(proptbl, fyr, std_age) )
+    if ( FireExportAgeAtBurnHistTxtFile(proptbl, fyr, &std_age_stats) )
     {
       QuitFatal(NULL);
     }
 
-    /* free pointers to burning cells */
-    if ( brn_cells_map != NULL ) free(brn_cells_map);
-
-    /* empty the list of burning cells */
-    FreeList(brn_cells_list);
-
-    /* increment stand age */
-    IncrementStandAge(fyr, std_age);  
-
-    /* free memory for short-term (yearly) data structures */
-    FreeGridData(fuels);
-    FreeFireYear(fyr);
-    FreeCellState(cs);
-    FreeByteTwoDArray(hrs_brn);
-
     /* signal user */
     TimeStamp(ft, "END SIM YEAR");
 
@@ -640,15 +1133,172 @@ int main(int argc, char * argv[])
     ft->sim_cur_yr += 1;
   } /* End Year */
 
-  /* free all memory */
+  /* free memory of the run */
+  FreeBurnFront(bf);
+  FreeCellState(cs);
+  FreeFireYear(fyr);
+  FreeCellPlane(plane);
+  FreeGridData(fuels);
+  FreeEventQueue(eq);
+  FreeFireEnvSnapshot(fes);
   FreeFireExport(fex);
   FreeFireEnv(fe);
   FreeGridData(std_age);
-  FreeChHashTable(fmtble);
   FreeFireTimer(ft);
-  FreeGridData(aspect);
-  FreeGridData(slope);
-  FreeGridData(elev);
+
+  return;
+}
+
+/* ThreadPoolFunc running the replicates [begin, end) of an ensemble */
+static int RunReplicates(void * arg, int worker, int begin, int end)
+{
+  replicates_t * reps = (replicates_t *) arg;
+  EnsembleReplicate * er = NULL;                /* properties of the current replicate */
+  int rep;                                      /* index of replicate */
+
+  for ( rep = begin; rep < end; rep++ )
+  {
+    if ( (er = InitEnsembleReplicate(reps->ens, reps->proptbl, rep)) == NULL )
+    {
+      QuitFatal(NULL);
+    }
+    fprintf(stdout, "START REPLICATE... %d SEED: %ld DIR: %s \n", rep, reps->seed, er->dir);
+    RunSimulation(reps->sh, reps->tp, worker, er->proptbl, reps->ens, rep);
+    FreeEnsembleReplicate(er);
+  }
+
+  return ERR_SUCCESS;
+}
+
+int main(int argc, char * argv[])
+{
+  ChHashTable * proptbl = NULL;                 /* simulation properties read from file */
+  SimConfig * cfg = NULL;                       /* simulation properties converted at load */
+  List * fmlist = NULL;                         /* list of FuelModels */
+  shared_t shared;                              /* inputs shared by every replicate */
+  Ensemble * ens = NULL;                        /* replicates and their aggregate statistics, or NULL */
+  replicates_t reps;                            /* replicates handed to the workers */
+  long int seed;                                /* seed of the root random number stream */
+
+  /*
+  ** Command line arguments
+  **
+  ** argc   = number of arguments (should be 2)
+  ** argv[0]  = "name of executable"
+  ** argv[1]  = "configuration file name"
+  ** argv[2]  = NULL
+  */
+  if ( argc != 2 )
+  {
+    printf("Usage: %s <configuration filename> \n", argv[0]);
+    return 0;
+  }
+
+  /* load properties from configuration file */
+  if ( InitPropsFromFireConfig(&proptbl, argv[1]) )
+  {
+    QuitFatal(NULL);
+  }
+  FireConfigDumpPropsToStream(proptbl, stdout);
+
+  /* convert and validate properties read during simulation */
+  if ( InitSimConfigFromPropsFireConfig(proptbl, &cfg) )
+  {
+    QuitFatal(NULL);
+  }
+  SimConfigDumpToStream(cfg, stdout);
+
+  /* load fuel models from properties */
+  if ( InitRothFuelModelListFromProps(proptbl, &fmlist) )
+  {
+    QuitFatal(NULL);
+  }
+  FireConfigDumpFuelModelListToStream(fmlist, stdout);
+
+  /* load inputs shared by every replicate from properties */
+  memset(&shared, 0, sizeof(shared_t));
+  shared.cfg = cfg;
+  shared.fmlist = fmlist;
+  if (    InitGridsFromPropsFireConfig(proptbl, cfg, &shared.elev, &shared.slope, &shared.aspect)
+      ||  InitTerrainDistFromPropsFireConfig(proptbl, shared.elev, &shared.td)
+      ||  InitFuelModelHashTableFromFuelModelListFireConfig(fmlist, &shared.fmtble)
+      ||  InitFireEnvTablesFromPropsFireConfig(proptbl, cfg, &shared.fet)
+      ||  InitThreadPoolFromSimConfigFireConfig(cfg, &shared.tp)
+      ||  InitRandStreamFromSimConfigFireConfig(cfg, &seed, &shared.rs)
+      ||  InitEnsembleFromPropsFireConfig(proptbl, &ens)  )
+  {
+    QuitFatal(NULL);
+  }
+  fprintf(stdout, "RANDOM NUMBER SEED: %ld \n", seed);
+  if ( ens != NULL )
+  {
+    ens->seed = seed;
+  }
+  TerrainDistDumpToStream(shared.td, stdout);
+
+  /* initialize rate of spread table, one per worker */
+  if ( InitRothSpreadTableFromSimConfigFireConfig(cfg, fmlist, THREAD_POOL_NUM_WORKERS(shared.tp), &shared.rst) )
+  {
+    QuitFatal(NULL);
+  }
+
+  if ( ens == NULL )
+  {
+    /* single run exporting to the files named in the properties */
+    RunSimulation(&shared, shared.tp, 0, proptbl, NULL, 0);
+  }
+  else
+  {
+    /*
+    ** Run Replicates of an Ensemble
+    **
+    ** With more than one worker and more than one replicate, replicates are handed to the workers
+    ** one at a time and each computes its fire front on its own worker.  Otherwise replicates run
+    ** in order on this thread with the workers computing the fire front.
+    */
+    memset(&reps, 0, sizeof(replicates_t));
+    reps.sh = &shared;
+    reps.proptbl = proptbl;
+    reps.ens = ens;
+    reps.seed = seed;
+    if ( THREAD_POOL_NUM_WORKERS(shared.tp) > 1 && ens->num_replicates > 1 )
+    {
+      reps.tp = NULL;
+      if ( ThreadPoolParallelFor(shared.tp, ens->num_replicates, 1, RunReplicates, &reps) )
+      {
+        QuitFatal(NULL);
+      }
+    }
+    else
+    {
+      reps.tp = shared.tp;
+      if ( RunReplicates(&reps, 0, 0, ens->num_replicates) )
+      {
+        QuitFatal(NULL);
+      }
+    }
+
+    /* export burn probability and fire size distribution over every replicate */
+    if ( EnsembleExport(ens) )
+    {
+      QuitFatal(NULL);
+    }
+  }
+
+  /* report use of rate of spread table */
+  RothSpreadTableDumpStats(shared.rst, stdout);
+
+  /* free all memory */
+  FreeEnsemble(ens);
+  FreeSimConfig(cfg);
+  FreeRothSpreadTable(shared.rst);
+  FreeFireEnvTables(shared.fet);
+  FreeTerrainDist(shared.td);
+  FreeThreadPool(shared.tp);
+  FreeChHashTable(shared.fmtble);
+  FreeGridData(shared.aspect);
+  FreeGridData(shared.slope);
+  FreeGridData(shared.elev);
   FreeList(fmlist);
   FreeChHashTable(proptbl);
 
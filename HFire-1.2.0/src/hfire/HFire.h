@@ -39,14 +39,17 @@
 /* fire code headers */
 #include "CellState.h"
 #include "FireEnv.h"
+#include "FireEnvSnapshot.h"
 #include "FireExport.h"
 #include "FireTimer.h"
+#include "SimConfig.h"
 #include "FireYear.h"
 #include "FuelsRegrowth.h"
 #include "StandAge.h"
 #include "Ignition.h"
 #include "Extinction.h"
 #include "EightNbr.h"
+#include "BurnFront.h"
 #include "FuelModel.h"
 #include "Roth1972.h"
 #include "FireRoth1972Config.h"
@@ -62,7 +65,9 @@
 #include "GridData.h"
 #include "List.h"
 #include "ChHashTable.h"
-#include "NLIBRand.h"
+#include "RandStream.h"
+#include "ThreadPool.h"
+#include "EventQueue.h"
 #include "Err.h"
 #include "Units.h"
 
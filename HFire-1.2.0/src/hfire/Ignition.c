@@ -24,82 +24,48 @@
  
 #include "Ignition.h"
 	
-int IsIgnitionNowFIXEDFromProps(ChHashTable * proptbl)	{
-	KeyVal * entry			= NULL;				/* key/val instances from table */
-	static int fixed_ig_occured = 0;
-	
-	/* check args and retrieve frequency per day */
-	if ( proptbl == NULL || ChHashTableRetrieve(proptbl, GetFireProp(PROP_IGTYP), (void *)&entry) )	{
-		ERR_ERROR_CONTINUE("Unable to retrieve IGNITION_TYPE property. \n", ERR_EINVAL);
+IgnitionState * InitIgnitionState()	{
+	IgnitionState * st = NULL;
+
+	if ( (st = (IgnitionState *) calloc(1, sizeof(IgnitionState))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to allocate memory for IgnitionState. \n", ERR_ENOMEM);
+		return st;
+		}
+	st->prob_ig_ts = -1.0;
+
+	return st;
+	}
+
+int IsIgnitionNowFIXEDFromProps(IgnitionState * st, const SimConfig * cfg)	{
+	/* check args */
+	if ( cfg == NULL )	{
+		ERR_ERROR_CONTINUE("Arguments supplied to determine Ignition invalid. \n", ERR_EINVAL);
 		return 0;
 		}
 		
 	/* test if FIXED ignition specified */
-	if ( strcmp(entry->val, GetFireVal(VAL_FIXED)) == 0 && fixed_ig_occured == 0)	{
-		fixed_ig_occured = 1;
+	if ( cfg->ig_type == EnumIgnitionFixed && st->fixed_ig_occured == 0)	{
+		st->fixed_ig_occured = 1;
 		return 1;	
 		}
 
 	return 0;
 	}
 
-int IsIgnitionNowRANDFromProps(ChHashTable * proptbl)	{
-	KeyVal * entry					= NULL;				/* key/val instances from table */
-	int	st_mo, st_dy, end_mo, end_dy;					/* start and end month and day of simulation */		
-	double ig_freq_yr, timestep;						/* ig freq and length of sim timestep */
-	/* static variables used to store state across function calls */	
-	static double sprob_ig_ts		= -1.0;				/* ignition probability per timestep */	
-	
+int IsIgnitionNowRANDFromProps(IgnitionState * st, const SimConfig * cfg)	{
 	/* check args */
-	if ( proptbl == NULL ) 	{
+	if ( cfg == NULL ) 	{
 		ERR_ERROR_CONTINUE("Arguments supplied to determine Ignition Frequency invalid. \n", ERR_EINVAL);
 		return 0;
 		}
 
-	/* retrieve frequency per year */		
-	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_IGFREQYR), (void *)&entry) )	{
-		ERR_ERROR_CONTINUE("Unable to retrieve IGNITION_FREQUENCY_PER_YEAR property. \n", ERR_EINVAL);
-		return 0;
-		}
-	ig_freq_yr = atof((char *) entry->val);	
-	
-	if ( UNITS_FP_GT_ZERO(ig_freq_yr) )	{
-		/* retrieve num days in simulation year and calculate ignition probability per timestep, only done once */
-		if ( UNITS_FP_LT_ZERO(sprob_ig_ts) )	{
-			/* retrieve timestep */
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SIMTSSEC), (void *)&entry) )	{
-				ERR_ERROR_CONTINUE("Unable to retrieve SIMULATION_TIMESTEP_SECS property. \n", ERR_EINVAL);
-				return 0;
-				}	
-			timestep = atof(entry->val);		
-			/* find simulation start month */		
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SIMSTMO), (void *)&entry) )	{
-				ERR_ERROR_CONTINUE("Unable to retrieve SIMULATION_START_MONTH property. \n", ERR_EINVAL);
-				return 0;
-				}
-			st_mo = atoi((char *) entry->val);
-			/* find simulation start day */
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SIMSTDY), (void *)&entry) )	{
-				ERR_ERROR_CONTINUE("Unable to retrieve SIMULATION_START_DAY property. \n", ERR_EINVAL);
-				return 0;
-				}
-			st_dy = atoi((char *) entry->val);
-			/* find simulation end month */
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SIMEDMO), (void *)&entry) )	{
-				ERR_ERROR_CONTINUE("Unable to retrieve SIMULATION_END_MONTH property. \n", ERR_EINVAL);
-				return 0;
-				}
-			end_mo = atoi((char *) entry->val);
-			/* find simulation end day */
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SIMEDDY), (void *)&entry) )	{
-				ERR_ERROR_CONTINUE("Unable to retrieve SIMULATION_END_DAY property. \n", ERR_EINVAL);
-				return 0;
-				}
-			end_dy = atoi((char *) entry->val);
-			/* calculate probability per timestep */			 
-			sprob_ig_ts = ig_freq_yr / 
-						  FireTimerGetDaysDifftime(st_mo, st_dy, end_mo, end_dy) / 
-						  (IGNITION_SECS_PER_DAY / timestep);
+	/* frequency per year, timestep, and simulation dates were range checked when SimConfig was loaded */		
+	if ( UNITS_FP_GT_ZERO(cfg->ig_freq_yr) )	{
+		/* calculate ignition probability per timestep from num days in simulation year, only done once */
+		if ( UNITS_FP_LT_ZERO(st->prob_ig_ts) )	{
+			st->prob_ig_ts = cfg->ig_freq_yr / 
+						  FireTimerGetDaysDifftime(cfg->start_mo, cfg->start_dy, cfg->end_mo, cfg->end_dy) / 
+						  (IGNITION_SECS_PER_DAY / (double) cfg->timestep_secs);
 			}
 		}
 	else	{
@@ -108,13 +74,13 @@ int IsIgnitionNowRANDFromProps(ChHashTable * proptbl)	{
 		}
 		
 	/* test for ignition */
-	if ( randu(0.0, 1.0) < (sprob_ig_ts) )
+	if ( RandStreamUniform(&st->rs_time, 0.0, 1.0) < (st->prob_ig_ts) )
 		return 1;
 
 	return 0;
 	}
 
-int GetIgnitionLocFIXEDFromProps(ChHashTable * proptbl, FireYear * fy, List ** rwxylist)	{
+int GetIgnitionLocFIXEDFromProps(IgnitionState * st, ChHashTable * proptbl, const SimConfig * cfg, FireYear * fy, List ** rwxylist)	{
 	KeyVal * entry			= NULL;				/* key/val instances from table */	
 	DblTwoDArray * da		= NULL;				/* (temp) array of ignition locations retrieved from file */
 	FILE * fstream 			= NULL;
@@ -163,7 +129,7 @@ int GetIgnitionLocFIXEDFromProps(ChHashTable * proptbl, FireYear * fy, List ** r
 	return ERR_SUCCESS;
 	}
 
-int GetIgnitionLocRANDUFromProps(ChHashTable * proptbl, FireYear * fy, List ** rwxylist)	{
+int GetIgnitionLocRANDUFromProps(IgnitionState * st, ChHashTable * proptbl, const SimConfig * cfg, FireYear * fy, List ** rwxylist)	{
 	ListElmt * lel 		= NULL;
 	double * rw 		= NULL;
 	double llx, lly, urx, ury;
@@ -185,8 +151,8 @@ int GetIgnitionLocRANDUFromProps(ChHashTable * proptbl, FireYear * fy, List ** r
 	/* keep retrieving numbers until one inside MASK found or num_trials exceeded */
 	for (num_trials = 0; num_trials < IGNITION_RANDU_MAX_TRIALS; num_trials++)	{
 		/* generate urn within range [llx, urx] and [lly, ury] */
-		rwx = randu(llx, urx);
-		rwy = randu(lly, ury);
+		rwx = RandStreamUniform(&st->rs_loc, llx, urx);
+		rwy = RandStreamUniform(&st->rs_loc, lly, ury);
 		
 		/* return id at urn */
 		if ( FireYearGetCellIDRealWorld(fy, rwx, rwy, &id) )	{
@@ -221,8 +187,7 @@ int GetIgnitionLocRANDUFromProps(ChHashTable * proptbl, FireYear * fy, List ** r
 	return ERR_SUCCESS;
 	}
 
-int GetIgnitionLocRANDSFromProps(ChHashTable * proptbl, FireYear * fy, List ** rwxylist)	{
-	static GridData * igprob	= NULL;							/* grid of ignition probabilities */
+int GetIgnitionLocRANDSFromProps(IgnitionState * st, ChHashTable * proptbl, const SimConfig * cfg, FireYear * fy, List ** rwxylist)	{
 	ListElmt * lel 		= NULL;
 	double * rwx, * rwy;
 	int i, j;	
@@ -230,13 +195,13 @@ int GetIgnitionLocRANDSFromProps(ChHashTable * proptbl, FireYear * fy, List ** r
 	long int num_trials;
 		
 	/* check args */
-	if ( proptbl == NULL || fy == NULL )	{
+	if ( proptbl == NULL || cfg == NULL || fy == NULL )	{
 		ERR_ERROR("Arguments supplied to determine Ignition Location invalid. \n", ERR_EINVAL);
 		}
 
-  if ( igprob == NULL ) {
+  if ( st->igprob == NULL ) {
 	  /* initialize ignition probability Grid */	
-	  if ( (igprob = GetGridDataFromPropsFireGridData(proptbl, FIRE_GRIDDATA_IGNITION_RSP_DATA)) == NULL )	{
+	  if ( (st->igprob = GetGridDataFromPropsFireGridData(proptbl, cfg, FIRE_GRIDDATA_IGNITION_RSP_DATA)) == NULL )	{
 		  ERR_ERROR("Unable to initialize ignition probability raster spatial dataset. \n", ERR_EBADFUNC);
 		  }
   }
@@ -244,7 +209,7 @@ int GetIgnitionLocRANDSFromProps(ChHashTable * proptbl, FireYear * fy, List ** r
 	/* keep retrieving numbers until ignition within probability or num_trials exceeded */	
 	for (num_trials = 0; num_trials < IGNITION_RANDS_MAX_TRIALS; num_trials++)	{
 		/* get ignition location in real world units */
-		if ( GetIgnitionLocRANDUFromProps(proptbl, fy, rwxylist) )	{
+		if ( GetIgnitionLocRANDUFromProps(st, proptbl, cfg, fy, rwxylist) )	{
 			ERR_ERROR_CONTINUE("Unable to determine random Ignition Location, repeating trial. \n", ERR_EFAILED);
 			continue;
 			}
@@ -253,18 +218,18 @@ int GetIgnitionLocRANDSFromProps(ChHashTable * proptbl, FireYear * fy, List ** r
 		lel = LIST_GET_NEXT_ELMT(lel);
 		rwy = LIST_GET_DATA(lel);
 		/* transform real world units to ignition probability grid cell index */
-		if ( CoordTransRealWorldToRaster(*rwx, *rwy, igprob->ghdr->cellsize, igprob->ghdr->cellsize,
-			COORD_TRANS_XLLCORNER_TO_XULCNTR(igprob->ghdr->xllcorner, igprob->ghdr->cellsize), 
-			COORD_TRANS_YLLCORNER_TO_YULCNTR(igprob->ghdr->yllcorner, igprob->ghdr->cellsize, igprob->ghdr->nrows), 
+		if ( CoordTransRealWorldToRaster(*rwx, *rwy, st->igprob->ghdr->cellsize, st->igprob->ghdr->cellsize,
+			COORD_TRANS_XLLCORNER_TO_XULCNTR(st->igprob->ghdr->xllcorner, st->igprob->ghdr->cellsize), 
+			COORD_TRANS_YLLCORNER_TO_YULCNTR(st->igprob->ghdr->yllcorner, st->igprob->ghdr->cellsize, st->igprob->ghdr->nrows), 
       &i, &j) )		{
 			FreeList(*rwxylist);
 			ERR_ERROR_CONTINUE("Unable to transform Ignition Location, repeating trial. \n", ERR_EFAILED);
 			continue;			
 			}
 		/* retrieve probability at location */
-		GRID_DATA_GET_DATA(igprob, i, j, xyprob);
+		GRID_DATA_GET_DATA(st->igprob, i, j, xyprob);
 		/* test probability against u.r.n.g */
-		if ( randu(0.0,1.0) < xyprob )	{
+		if ( RandStreamUniform(&st->rs_loc, 0.0, 1.0) < xyprob )	{
 			break;
 			}
 		/* trial failed, try again */
@@ -279,4 +244,17 @@ int GetIgnitionLocRANDSFromProps(ChHashTable * proptbl, FireYear * fy, List ** r
 	return ERR_SUCCESS;
 	}
 	
+void FreeIgnitionState(void * vptr)	{
+	IgnitionState * st = NULL;
+
+	if ( vptr != NULL )	{
+		st = (IgnitionState *) vptr;
+		if ( st->igprob != NULL )	FreeGridData(st->igprob);
+		free(st);
+		}
+	st = NULL;
+
+	return;
+	}
+
 /* end of Ignition.c */
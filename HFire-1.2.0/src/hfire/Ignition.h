@@ -32,11 +32,12 @@
 #include "FireYear.h"
 #include "FireTimer.h"
 #include "GridData.h"
-#include "NLIBRand.h"
+#include "RandStream.h"
 #include "ChHashTable.h"
 #include "KeyVal.h"
 #include "FireProp.h"
 #include "FireGridData.h"
+#include "SimConfig.h"
 #include "List.h"
 #include "FStreamIO.h"
 #include "Err.h"
@@ -72,7 +73,29 @@
  * STRUCTS, TYPEDEFS
  *********************************************************
  */
- 
+
+/*! Type name for IgnitionState_
+ *	\sa For a list of members goto IgnitionState_
+ */
+typedef struct IgnitionState_ IgnitionState;
+
+/*!	\struct IgnitionState_ Ignition.h "Ignition.h"
+ *	\brief ignitions retrieved by the ignition functions
+ *	Stored by FireEnv in place of function statics so each simulation owns its state.
+ */
+struct IgnitionState_	{
+	/*! flag set once the FIXED ignition has occured */
+	int fixed_ig_occured;
+	/*! ignition probability per timestep */
+	double prob_ig_ts;
+	/*! grid of RANDS ignition probabilities */
+	GridData * igprob;
+	/*! random numbers deciding when ignitions occur */
+	RandStream rs_time;
+	/*! random numbers deciding where ignitions occur */
+	RandStream rs_loc;
+	};
+
 /*
  *********************************************************
  * MACROS
@@ -85,32 +108,51 @@
  *********************************************************
  */
 
-/*!	\fn int IsIgnitionNowFIXEDFromProps(ChHashTable * proptbl)
+/*! \fn IgnitionState * InitIgnitionState()
+ *	\brief Initializes the ignition state of a simulation.
+ *
+ *	Tables are read on the first call to the functions taking IgnitionState as argument.
+ *	\sa IgnitionState
+ *	\retval IgnitionState* Ptr to initialized IgnitionState, or NULL if unable to allocate
+ */
+IgnitionState * InitIgnitionState();
+
+/*! \fn void FreeIgnitionState(void * vptr)
+ *	\brief Frees memory associated with IgnitionState structure.
+ *
+ *	\sa IgnitionState
+ *	\param vptr ptr to IgnitionState
+ */
+void FreeIgnitionState(void * vptr);
+
+/*!	\fn int IsIgnitionNowFIXEDFromProps(IgnitionState * st, const SimConfig * cfg)
  * 	\brief Tests whether an ignition occurs during current timestep.
  *
  * 	For FIXED implementations this method returns 1 (true) if FIXED supplied for IGNITION_TYPE keyword
  * 	AND if this the first time it has been called.  Otherwise this method returns 0.
- *	\sa ChHashTable
+ *	\sa SimConfig
  *	\sa Check the \htmlonly <a href="config_file_doc.html#IGNITION">config file documentation</a> \endhtmlonly 
- * 	\param proptbl HashTable of simulation properties
+ * 	\param st IgnitionState storing the ignitions between calls
+ * 	\param cfg SimConfig of simulation
  *	\retval 1 (true) or 0 (false).
  */  
-int IsIgnitionNowFIXEDFromProps(ChHashTable * proptbl);
+int IsIgnitionNowFIXEDFromProps(IgnitionState * st, const SimConfig * cfg);
 
-/*!	\fn int IsIgnitionNowRANDFromProps(ChHashTable * proptbl)
+/*!	\fn int IsIgnitionNowRANDFromProps(IgnitionState * st, const SimConfig * cfg)
  * 	\brief Tests whether an ignition occurs during current timestep.
  *
- * 	For RAND implementations this method converts the value of the keyword IGNITION_FREQUENCY_PER_DAY
- * 	to a probability in units per hour and uses a uniform random number generator to determine if
+ * 	For RAND implementations this method converts the IGNITION_FREQUENCY_PER_YEAR held in SimConfig
+ * 	to a probability per timestep and uses a uniform random number generator to determine if
  * 	an ignition occurs this timestep.
- *	\sa ChHashTable
+ *	\sa SimConfig
  *	\sa Check the \htmlonly <a href="config_file_doc.html#IGNITION">config file documentation</a> \endhtmlonly 
- * 	\param proptbl HashTable of simulation properties
+ * 	\param st IgnitionState storing the ignitions between calls
+ * 	\param cfg SimConfig of simulation
  *	\retval 1 (true) or 0 (false).
  */  
-int IsIgnitionNowRANDFromProps(ChHashTable * proptbl);
+int IsIgnitionNowRANDFromProps(IgnitionState * st, const SimConfig * cfg);
  
-/*!	\fn int GetIgnitionLocFIXEDFromProps(ChHashTable * proptbl, FireYear * fy, List ** rwxylist)
+/*!	\fn int GetIgnitionLocFIXEDFromProps(IgnitionState * st, ChHashTable * proptbl, const SimConfig * cfg, FireYear * fy, List ** rwxylist)
  * 	\brief Returns a list of ignition locations in real world coordinates.
  *
  * 	For FIXED implementations this method retrieves contents of keyword IGNITION_FIXED_IGS_FILE file
@@ -119,7 +161,9 @@ int IsIgnitionNowRANDFromProps(ChHashTable * proptbl);
  * 	by the user is not performed by this function.
  *	\sa ChHashTable
  *	\sa Check the \htmlonly <a href="config_file_doc.html#IGNITION">config file documentation</a> \endhtmlonly 
+ * 	\param st IgnitionState storing the ignitions between calls
  * 	\param proptbl HashTable of simulation properties
+ * 	\param cfg SimConfig of simulation
  *	\param fy FireYear of all currently burning cells in simulation domain
  * 	\param rwxylist List of real world x and y coordinate locations returned by function
  *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
@@ -130,9 +174,9 @@ int IsIgnitionNowRANDFromProps(ChHashTable * proptbl);
  *				// something bad happened
  *	\endcode
  */	
-int GetIgnitionLocFIXEDFromProps(ChHashTable * proptbl, FireYear * fy, List ** rwxylist);
+int GetIgnitionLocFIXEDFromProps(IgnitionState * st, ChHashTable * proptbl, const SimConfig * cfg, FireYear * fy, List ** rwxylist);
 
-/*!	\fn int GetIgnitionLocRANDUFromProps(ChHashTable * proptbl, FireYear * fy, List ** rwxylist)
+/*!	\fn int GetIgnitionLocRANDUFromProps(IgnitionState * st, ChHashTable * proptbl, const SimConfig * cfg, FireYear * fy, List ** rwxylist)
  * 	\brief Returns a list of ignition locations in real world coordinates.
  *
  * 	For RANDU implementations this method draws two uniform random numbers having ranges of
@@ -142,7 +186,9 @@ int GetIgnitionLocFIXEDFromProps(ChHashTable * proptbl, FireYear * fy, List ** r
  * 	world coordinate location is chosen that falls inside a burnable fuel cell.
  *	\sa ChHashTable
  *	\sa Check the \htmlonly <a href="config_file_doc.html#IGNITION">config file documentation</a> \endhtmlonly 
+ * 	\param st IgnitionState storing the ignitions between calls
  * 	\param proptbl HashTable of simulation properties
+ * 	\param cfg SimConfig of simulation
  *	\param fy FireYear of all currently burning cells in simulation domain
  * 	\param rwxylist List of real world x and y coordinate locations returned by function
  *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
@@ -153,9 +199,9 @@ int GetIgnitionLocFIXEDFromProps(ChHashTable * proptbl, FireYear * fy, List ** r
  *				// something bad happened
  *	\endcode
  */	
-int GetIgnitionLocRANDUFromProps(ChHashTable * proptbl, FireYear * fy, List ** rwxylist);
+int GetIgnitionLocRANDUFromProps(IgnitionState * st, ChHashTable * proptbl, const SimConfig * cfg, FireYear * fy, List ** rwxylist);
 
-/*!	\fn int GetIgnitionLocRANDSFromProps(ChHashTable * proptbl, FireYear * fy, List ** rwxylist)
+/*!	\fn int GetIgnitionLocRANDSFromProps(IgnitionState * st, ChHashTable * proptbl, const SimConfig * cfg, FireYear * fy, List ** rwxylist)
  * 	\brief Returns a list of ignition locations in real world coordinates.
  *
  * 	Two tests must be completed successfully for the RANDS function to return without error.
@@ -169,7 +215,9 @@ int GetIgnitionLocRANDUFromProps(ChHashTable * proptbl, FireYear * fy, List ** r
  * 	the entire process is repeated until a successful trial occurs.
  *	\sa ChHashTable
  *	\sa Check the \htmlonly <a href="config_file_doc.html#IGNITION">config file documentation</a> \endhtmlonly 
+ * 	\param st IgnitionState storing the ignitions between calls
  * 	\param proptbl HashTable of simulation properties
+ * 	\param cfg SimConfig of simulation
  *	\param fy FireYear of all currently burning cells in simulation domain
  * 	\param rwxylist List of real world x and y coordinate locations returned by function
  *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
@@ -180,6 +228,6 @@ int GetIgnitionLocRANDUFromProps(ChHashTable * proptbl, FireYear * fy, List ** r
  *				// something bad happened
  *	\endcode
  */	
-int GetIgnitionLocRANDSFromProps(ChHashTable * proptbl, FireYear * fy, List ** rwxylist);
+int GetIgnitionLocRANDSFromProps(IgnitionState * st, ChHashTable * proptbl, const SimConfig * cfg, FireYear * fy, List ** rwxylist);
 
 #endif Ignition_H		/* end of Ignition.h */
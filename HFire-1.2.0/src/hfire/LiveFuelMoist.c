@@ -24,395 +24,379 @@
  
 #include "LiveFuelMoist.h"
 
-static int AdvanceRecToDate(DblTwoDArray * da, int month, int day, int * rec);
+LiveFuelMoistTables * InitLiveFuelMoistTables()	{
+	LiveFuelMoistTables * tbls = NULL;
 
-int GetLiveFuelMoistFIXEDFromProps(ChHashTable * proptbl, int year, int month, int day, int hour,
-											double rwx, double rwy, 
-											double * lhfm, double * lwfm)	{
-	/* static variables used to store state across function calls */
-	static int syear				= -1;
-	static int smonth 				= 0;
-	static int sday 				= 0;
-	static int slh_srec				= 0;
-	static int slw_srec				= 0;
-	static double slhfm				= 0.0;
-	static double slwfm				= 0.0;
-	static DblTwoDArray * slhfm_tbl = NULL;
-	static DblTwoDArray * slwfm_tbl	= NULL;
+	if ( (tbls = (LiveFuelMoistTables *) calloc(1, sizeof(LiveFuelMoistTables))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to allocate memory for LiveFuelMoistTables. \n", ERR_ENOMEM);
+		return tbls;
+		}
+	tbls->lh_amean = -1.0;
+	tbls->lh_asdev = -1.0;
+	tbls->lw_amean = -1.0;
+	tbls->lw_asdev = -1.0;
+
+	return tbls;
+	}
+
+int SetLiveFuelMoistTablesFIXEDFromProps(LiveFuelMoistTables * tbls, ChHashTable * proptbl)	{
 	/* stack variables */
 	KeyVal * entry					= NULL;				/* key/val instances from table */
 	FILE * fstream					= NULL;				/* file stream */
-	
-	if ( (smonth != month) || (sday != day) )	{
-		/* new live herbaceous fuel moisture table needed */
-		if ( slhfm_tbl == NULL )	{
-			/* lh annual mean only needs to be initialized once */
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_LFMHFILE), (void *)&entry) )	{
-				ERR_ERROR("Unable to retrieve LIVE_FUEL_MOIST_HERB_FILE property. \n", ERR_EINVAL);
-				}
-			/* open file */
-			if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
-				ERR_ERROR("Unable to open file containing live herbaceous fuel moistures. \n", ERR_EIOFAIL);
-				}		
-			/* create the table of values */
-			if ( (slhfm_tbl = GetDblTwoDArrayTableFStreamIO(fstream, 
-					LIVE_FUEL_MOIST_SEP_CHARS, LIVE_FUEL_MOIST_COMMENT_CHAR)) == NULL )	{
-				fclose(fstream);
-				ERR_ERROR("Unable to initialize historical Live Fuel Moisture table. \n", ERR_EFAILED);
-				}
-			fclose(fstream);
-			}
-		/* new live woody fuel moisture table needed */
-		if ( slwfm_tbl == NULL )	{
-			/* lw annual stdev only needs to be initialized once */
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_LFMWFILE), (void *)&entry) )	{
-				ERR_ERROR("Unable to retrieve LIVE_FUEL_MOIST_WOOD_FILE property. \n", ERR_EINVAL);
-				}
-			/* open file */
-			if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
-				ERR_ERROR("Unable to open file containing live woody fuel moistures. \n", ERR_EIOFAIL);
-				}
-			/* create the table of values */
-			if ( (slwfm_tbl = GetDblTwoDArrayTableFStreamIO(fstream, 
-					LIVE_FUEL_MOIST_SEP_CHARS, LIVE_FUEL_MOIST_COMMENT_CHAR)) == NULL )	{
-				fclose(fstream);
-				ERR_ERROR("Unable to initialize historical Live Fuel Moisture table. \n", ERR_EFAILED);
-				}
-			fclose(fstream);					
-			}		
-		
-		/* start new year */
-		if ( syear != year )	{
-			/* set current record numbers */
-			slh_srec = 0;
-			slw_srec = 0;
-			/* advance to current date in table */
-			if ( AdvanceRecToDate(slhfm_tbl, month, day, &slh_srec) 
-				|| AdvanceRecToDate(slwfm_tbl, month, day, &slw_srec) )	{
-				ERR_ERROR("Unable to find current date in data table. \n", ERR_EBADFUNC);
-				}
-			/* get first live herb */
-			slhfm = DBLTWODARRAY_GET_DATA(slhfm_tbl, slh_srec, LIVE_FUEL_MOIST_FIXED_VAL_TBL_INDEX);
-			slhfm /= 100.0;
-			slh_srec++;			
-			/* get first live woody */
-			slwfm = DBLTWODARRAY_GET_DATA(slwfm_tbl, slw_srec, LIVE_FUEL_MOIST_FIXED_VAL_TBL_INDEX);
-			slwfm /= 100.0;
-			slw_srec++;			
-			/* set year */
-			syear = year;		
-			}
-		
-		/* see if live herb table contains value for this day */
-		if ( (slh_srec < DBLTWODARRAY_SIZE_ROW(slhfm_tbl))
-				&& (month == DBLTWODARRAY_GET_DATA(slhfm_tbl, slh_srec, LIVE_FUEL_MOIST_MO_TBL_INDEX))
-				&& (day == DBLTWODARRAY_GET_DATA(slhfm_tbl, slh_srec, LIVE_FUEL_MOIST_DY_TBL_INDEX)) )	{
-			slhfm = DBLTWODARRAY_GET_DATA(slhfm_tbl, slh_srec, LIVE_FUEL_MOIST_FIXED_VAL_TBL_INDEX);
-			slhfm /= 100.0;
-			slh_srec++;
+	DblTwoDArray * lfm_tbl			= NULL;				/* contents of lfm file */
+
+	/* retrieve herbaceous filename */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_LFMHFILE), (void *)&entry) )	{
+		ERR_ERROR("Unable to retrieve LIVE_FUEL_MOIST_HERB_FILE property. \n", ERR_EINVAL);
+		}
+	/* open file */
+	if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
+		ERR_ERROR("Unable to open file containing live herbaceous fuel moistures. \n", ERR_EIOFAIL);
+		}
+	/* create the table of values */
+	if ( (lfm_tbl = GetDblTwoDArrayTableFStreamIO(fstream, 
+			LIVE_FUEL_MOIST_SEP_CHARS, LIVE_FUEL_MOIST_COMMENT_CHAR)) == NULL )	{
+		fclose(fstream);
+		ERR_ERROR("Unable to initialize historical Live Fuel Moisture table. \n", ERR_EFAILED);
+		}
+	fclose(fstream);
+	/* index table by month and day */
+	if ( (tbls->lhfm_dt = InitDateTable(lfm_tbl, LIVE_FUEL_MOIST_MO_TBL_INDEX,
+				LIVE_FUEL_MOIST_DY_TBL_INDEX)) == NULL )	{
+		ERR_ERROR("Unable to index historical Live Fuel Moisture table. \n", ERR_EFAILED);
+		}
+	/* retrieve woody filename */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_LFMWFILE), (void *)&entry) )	{
+		ERR_ERROR("Unable to retrieve LIVE_FUEL_MOIST_WOOD_FILE property. \n", ERR_EINVAL);
+		}
+	/* open file */
+	if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
+		ERR_ERROR("Unable to open file containing live woody fuel moistures. \n", ERR_EIOFAIL);
+		}
+	/* create the table of values */
+	if ( (lfm_tbl = GetDblTwoDArrayTableFStreamIO(fstream, 
+			LIVE_FUEL_MOIST_SEP_CHARS, LIVE_FUEL_MOIST_COMMENT_CHAR)) == NULL )	{
+		fclose(fstream);
+		ERR_ERROR("Unable to initialize historical Live Fuel Moisture table. \n", ERR_EFAILED);
+		}
+	fclose(fstream);
+	/* index table by month and day */
+	if ( (tbls->lwfm_dt = InitDateTable(lfm_tbl, LIVE_FUEL_MOIST_MO_TBL_INDEX,
+				LIVE_FUEL_MOIST_DY_TBL_INDEX)) == NULL )	{
+		ERR_ERROR("Unable to index historical Live Fuel Moisture table. \n", ERR_EFAILED);
+		}
+
+	return ERR_SUCCESS;
+	}
+
+int SetLiveFuelMoistTablesRANDHFromProps(LiveFuelMoistTables * tbls, ChHashTable * proptbl)	{
+	/* stack variables */
+	KeyVal * entry					= NULL;				/* key/val instances from table */
+	char * val						= NULL;				/* val associated with keywords in file */
+	FILE * fstream					= NULL;				/* file stream */
+	DblTwoDArray * lfm_tbl			= NULL;				/* contents of lfm file */
+
+	/* retrieve herbaceous filename */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_LFMHFILE), (void *)&entry) )	{
+		ERR_ERROR("Unable to retrieve LIVE_FUEL_MOIST_HERB_FILE property. \n", ERR_EINVAL);
+		}
+	/* open file */
+	if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
+		ERR_ERROR("Unable to open file containing live herbaceous fuel moistures. \n", ERR_EIOFAIL);
+		}
+	/* retrieve string mean stored in */
+	if ( (val = GetValFromKeyStringFStreamIO(fstream, LIVE_FUEL_MOIST_KEYWORD_ANNMEAN, 
+							LIVE_FUEL_MOIST_SEP_CHARS, LIVE_FUEL_MOIST_COMMENT_CHAR)) == NULL )	{
+		fclose(fstream);
+		ERR_ERROR("Unable to retrieve annual mean from LIVE_FUEL_MOIST_HERB_FILE. \n", ERR_EINVAL);
+		}
+	tbls->lh_amean = atof(val);
+	free(val);
+	/* retrieve string stdev stored in */
+	if ( (val = GetValFromKeyStringFStreamIO(fstream, LIVE_FUEL_MOIST_KEYWORD_ANNSTDEV, 
+							LIVE_FUEL_MOIST_SEP_CHARS, LIVE_FUEL_MOIST_COMMENT_CHAR)) == NULL )	{
+		fclose(fstream);
+		ERR_ERROR("Unable to retrieve annual standard deviation from LIVE_FUEL_MOIST_HERB_FILE. \n", ERR_EINVAL);
+		}
+	tbls->lh_asdev = atof(val);
+	free(val);
+	/* create the table of values */
+	if ( (lfm_tbl = GetDblTwoDArrayTableFStreamIO(fstream, 
+			LIVE_FUEL_MOIST_SEP_CHARS, LIVE_FUEL_MOIST_COMMENT_CHAR)) == NULL )	{
+		fclose(fstream);
+		ERR_ERROR("Unable to initialize historical Live Fuel Moisture table. \n", ERR_EFAILED);
+		}
+	fclose(fstream);
+	/* index table by month and day */
+	if ( (tbls->lhfm_dt = InitDateTable(lfm_tbl, LIVE_FUEL_MOIST_MO_TBL_INDEX,
+				LIVE_FUEL_MOIST_DY_TBL_INDEX)) == NULL )	{
+		ERR_ERROR("Unable to index historical Live Fuel Moisture table. \n", ERR_EFAILED);
+		}
+	/* retrieve woody filename */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_LFMWFILE), (void *)&entry) )	{
+		ERR_ERROR("Unable to retrieve LIVE_FUEL_MOIST_WOOD_FILE property. \n", ERR_EINVAL);
+		}
+	/* open file */
+	if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
+		ERR_ERROR("Unable to open file containing live woody fuel moistures. \n", ERR_EIOFAIL);
+		}
+	/* retrieve string mean stored in */
+	if ( (val = GetValFromKeyStringFStreamIO(fstream, LIVE_FUEL_MOIST_KEYWORD_ANNMEAN, 
+							LIVE_FUEL_MOIST_SEP_CHARS, LIVE_FUEL_MOIST_COMMENT_CHAR)) == NULL )	{
+		fclose(fstream);
+		ERR_ERROR("Unable to retrieve annual mean from LIVE_FUEL_MOIST_WOOD_FILE. \n", ERR_EINVAL);
+		}
+	tbls->lw_amean = atof(val);
+	free(val);
+	/* retrieve string stdev stored in */
+	if ( (val = GetValFromKeyStringFStreamIO(fstream, LIVE_FUEL_MOIST_KEYWORD_ANNSTDEV, 
+							LIVE_FUEL_MOIST_SEP_CHARS, LIVE_FUEL_MOIST_COMMENT_CHAR)) == NULL )	{
+		fclose(fstream);
+		ERR_ERROR("Unable to retrieve annual standard deviation from LIVE_FUEL_MOIST_WOOD_FILE. \n", ERR_EINVAL);
+		}
+	tbls->lw_asdev = atof(val);
+	free(val);
+	/* create the table of values */
+	if ( (lfm_tbl = GetDblTwoDArrayTableFStreamIO(fstream, 
+			LIVE_FUEL_MOIST_SEP_CHARS, LIVE_FUEL_MOIST_COMMENT_CHAR)) == NULL )	{
+		fclose(fstream);
+		ERR_ERROR("Unable to initialize historical Live Fuel Moisture table. \n", ERR_EFAILED);
+		}
+	fclose(fstream);
+	/* index table by month and day */
+	if ( (tbls->lwfm_dt = InitDateTable(lfm_tbl, LIVE_FUEL_MOIST_MO_TBL_INDEX,
+				LIVE_FUEL_MOIST_DY_TBL_INDEX)) == NULL )	{
+		ERR_ERROR("Unable to index historical Live Fuel Moisture table. \n", ERR_EFAILED);
+		}
+
+	return ERR_SUCCESS;
+	}
+
+int SetLiveFuelMoistTablesSPATIALFromProps(LiveFuelMoistTables * tbls, ChHashTable * proptbl)	{
+	/* stack variables */
+	KeyVal * entry					= NULL;				/* key/val instances from table */
+	FILE * fstream					= NULL;				/* file stream */
+	StrTwoDArray * atm_tbl			= NULL;				/* contents of lfm file */
+	int file_col[2]					= { LIVE_FUEL_MOIST_RAST_LFM_LFH_FILE_TBL_INDEX, LIVE_FUEL_MOIST_RAST_LFM_LFW_FILE_TBL_INDEX };
+
+	/* retriev lfm filename from properties */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_LFMSPFILE), (void *)&entry) )	{
+		ERR_ERROR("Unable to retrieve LIVE_FUEL_MOIST_SPATIAL_FILE property. \n", ERR_EINVAL);
+		}
+	/* open lfm file */
+	if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
+		ERR_ERROR("Unable to open LIVE_FUEL_MOIST_SPATIAL_FILE. \n", ERR_EIOFAIL);
+		}
+	/* retrieve contents of lfm file */
+	if ( (atm_tbl = GetStrTwoDArrayTableFStreamIO(fstream, LIVE_FUEL_MOIST_RAST_LFM_SEP_CHARS, 
+				LIVE_FUEL_MOIST_RAST_LFM_COMMENT_CHAR)) == NULL )	{
+		fclose(fstream);
+		ERR_ERROR("Unable to parse LIVE_FUEL_MOIST_SPATIAL_FILE. \n", ERR_EINVAL);
+		}
+	/* cleanup */
+	fclose(fstream);
+	/* index lfm table, rasters are read as simulations reach them */
+	if ( (tbls->lfm_ws = InitWeatherStream(proptbl, atm_tbl, LIVE_FUEL_MOIST_RAST_LFM_MO_TBL_INDEX, LIVE_FUEL_MOIST_RAST_LFM_DY_TBL_INDEX,
+				LIVE_FUEL_MOIST_RAST_LFM_HR_TBL_INDEX, file_col, 2)) == NULL )	{
+		ERR_ERROR("Unable to index LIVE_FUEL_MOIST_SPATIAL_FILE. \n", ERR_EINVAL);
+		}
+
+	return ERR_SUCCESS;
+	}
+
+void FreeLiveFuelMoistTables(void * vptr)	{
+	LiveFuelMoistTables * tbls = NULL;
+
+	if ( vptr != NULL )	{
+		tbls = (LiveFuelMoistTables *) vptr;
+		if ( tbls->lhfm_dt != NULL )	FreeDateTable(tbls->lhfm_dt);
+		if ( tbls->lwfm_dt != NULL )	FreeDateTable(tbls->lwfm_dt);
+		if ( tbls->lfm_ws != NULL )		FreeWeatherStream(tbls->lfm_ws);
+		free(tbls);
+		}
+	tbls = NULL;
+
+	return;
+	}
+
+LiveFuelMoistState * InitLiveFuelMoistState()	{
+	LiveFuelMoistState * st = NULL;
+
+	if ( (st = (LiveFuelMoistState *) calloc(1, sizeof(LiveFuelMoistState))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to allocate memory for LiveFuelMoistState. \n", ERR_ENOMEM);
+		return st;
+		}
+	st->year = -1;
+	st->lh_Z = -1.0;
+	st->lw_Z = -1.0;
+
+	return st;
+	}
+
+int SetLiveFuelMoistStateFromTables(LiveFuelMoistState * st, const LiveFuelMoistTables * tbls)	{
+	/* check args */
+	if ( st == NULL || tbls == NULL )	{
+		ERR_ERROR("Arguments supplied to set LiveFuelMoistState invalid. \n", ERR_EINVAL);
+		}
+
+	st->tbls = tbls;
+	/* rasters of the first record are read now, later records as the simulation reaches them */
+	if ( tbls->lfm_ws != NULL )	{
+		if ( (st->lfm_wc = InitWeatherStreamCursor(tbls->lfm_ws)) == NULL )	{
+			ERR_ERROR("Unable to initialize GridData from file listed in LIVE_FUEL_MOIST_SPATIAL_FILE. \n", ERR_EINVAL);
 			}
+		}
+
+	return ERR_SUCCESS;
+	}
+
+int GetLiveFuelMoistFIXEDFromProps(LiveFuelMoistState * st, ChHashTable * proptbl, int year, int month, int day, int hour,
+											double rwx, double rwy, 
+											double * lhfm, double * lwfm)	{
+	int lh_rec, lw_rec;
 
-		/* see if live woody table contains value for this day */
-		if ( (slw_srec < DBLTWODARRAY_SIZE_ROW(slwfm_tbl))
-				&& (month == DBLTWODARRAY_GET_DATA(slwfm_tbl, slw_srec, LIVE_FUEL_MOIST_MO_TBL_INDEX))
-				&& (day == DBLTWODARRAY_GET_DATA(slwfm_tbl, slw_srec, LIVE_FUEL_MOIST_DY_TBL_INDEX)) )	{
-			slwfm = DBLTWODARRAY_GET_DATA(slwfm_tbl, slw_srec, LIVE_FUEL_MOIST_FIXED_VAL_TBL_INDEX);
-			slwfm /= 100.0;
-			slw_srec++;
+	if ( st->tbls == NULL || st->tbls->lhfm_dt == NULL || st->tbls->lwfm_dt == NULL )	{
+		ERR_ERROR("Live Fuel Moisture tables not initialized. \n", ERR_EINVAL);
+		}
+	
+	if ( (st->month != month) || (st->day != day) )	{
+		/* records of the last date listed on or before this day */
+		if ( (lh_rec = DateTableGetRecInEffect(st->tbls->lhfm_dt, month, day)) == DATE_TABLE_NO_REC
+			|| (lw_rec = DateTableGetRecInEffect(st->tbls->lwfm_dt, month, day)) == DATE_TABLE_NO_REC )	{
+			ERR_ERROR("Unable to find current date in data table. \n", ERR_EBADFUNC);
 			}
+
+		/* live herb */
+		st->lhfm = DATE_TABLE_GET_DATA(st->tbls->lhfm_dt, lh_rec, LIVE_FUEL_MOIST_FIXED_VAL_TBL_INDEX);
+		st->lhfm /= 100.0;
+
+		/* live woody */
+		st->lwfm = DATE_TABLE_GET_DATA(st->tbls->lwfm_dt, lw_rec, LIVE_FUEL_MOIST_FIXED_VAL_TBL_INDEX);
+		st->lwfm /= 100.0;
 					
 		/* set {month, day} for future calls */
-		smonth = month;
-		sday = day;
+		st->month = month;
+		st->day = day;
 		}
 
-	*lhfm = slhfm;
-	*lwfm = slwfm;
+	*lhfm = st->lhfm;
+	*lwfm = st->lwfm;
 		
 	return ERR_SUCCESS;
 	}
 																					
-int GetLiveFuelMoistRANDHFromProps(ChHashTable * proptbl, int year, int month, int day, int hour,
+int GetLiveFuelMoistRANDHFromProps(LiveFuelMoistState * st, ChHashTable * proptbl, int year, int month, int day, int hour,
 											double rwx, double rwy, 
 											double * lhfm, double * lwfm)	{
-	/* static variables used to store state across function calls */
-	static int syear				= -1;
-	static int smonth 				= 0;
-	static int sday 				= 0;
-	static int slh_srec				= 0;
-	static int slw_srec				= 0;
-	static double slhfm				= 0.0;
-	static double slwfm				= 0.0;
-	static DblTwoDArray * slhfm_tbl = NULL;
-	static DblTwoDArray * slwfm_tbl	= NULL;
-	static double slh_amean			= -1.0;
-	static double slh_asdev			= -1.0;
-	static double slw_amean			= -1.0;
-	static double slw_asdev			= -1.0;	
-	static double slh_Z				= -1.0;
-	static double slw_Z				= -1.0;
-	/* stack variables */
-	KeyVal * entry					= NULL;				/* key/val instances from table */
-	char * val						= NULL;				/* val associated with keywords in file */
-	FILE * fstream					= NULL;				/* file stream */
+	int lh_rec, lw_rec;
+
+	if ( st->tbls == NULL || st->tbls->lhfm_dt == NULL || st->tbls->lwfm_dt == NULL )	{
+		ERR_ERROR("Live Fuel Moisture tables not initialized. \n", ERR_EINVAL);
+		}
 	
-	if ( (smonth != month) || (sday != day) )	{
-		/* new live herbaceous fuel moisture table needed */
-		if ( slhfm_tbl == NULL )	{
-			/* lh annual mean only needs to be initialized once */
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_LFMHFILE), (void *)&entry) )	{
-				ERR_ERROR("Unable to retrieve LIVE_FUEL_MOIST_HERB_FILE property. \n", ERR_EINVAL);
-				}
-			/* open file */
-			if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
-				ERR_ERROR("Unable to open file containing live herbaceous fuel moistures. \n", ERR_EIOFAIL);
-				}
-			/* retrieve string mean stored in */
-			val = GetValFromKeyStringFStreamIO(fstream, LIVE_FUEL_MOIST_KEYWORD_ANNMEAN, 
-									LIVE_FUEL_MOIST_SEP_CHARS, LIVE_FUEL_MOIST_COMMENT_CHAR);
-			slh_amean = atof(val);
-			free(val);
-			/* retrieve string stdev stored in */
-			val = GetValFromKeyStringFStreamIO(fstream, LIVE_FUEL_MOIST_KEYWORD_ANNSTDEV, 
-									LIVE_FUEL_MOIST_SEP_CHARS, LIVE_FUEL_MOIST_COMMENT_CHAR);
-			slh_asdev = atof(val);
-			free(val);
-			/* create the table of values */
-			if ( (slhfm_tbl = GetDblTwoDArrayTableFStreamIO(fstream, 
-					LIVE_FUEL_MOIST_SEP_CHARS, LIVE_FUEL_MOIST_COMMENT_CHAR)) == NULL )	{
-				fclose(fstream);
-				ERR_ERROR("Unable to initialize historical Live Fuel Moisture table. \n", ERR_EFAILED);
-				}
-			fclose(fstream);
-			}
-		/* new live woody fuel moisture table needed */
-		if ( slwfm_tbl == NULL )	{
-			/* lw annual mean only needs to be initialized once */
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_LFMWFILE), (void *)&entry) )	{
-				ERR_ERROR("Unable to retrieve LIVE_FUEL_MOIST_WOOD_FILE property. \n", ERR_EINVAL);
-				}
-			/* open file */
-			if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
-				ERR_ERROR("Unable to open file containing live woody fuel moistures. \n", ERR_EIOFAIL);
-				}
-			/* retrieve string mean stored in */
-			val = GetValFromKeyStringFStreamIO(fstream, LIVE_FUEL_MOIST_KEYWORD_ANNMEAN, 
-									LIVE_FUEL_MOIST_SEP_CHARS, LIVE_FUEL_MOIST_COMMENT_CHAR);
-			slw_amean = atof(val);
-			free(val);
-			/* retrieve string stdev stored in */
-			val = GetValFromKeyStringFStreamIO(fstream, LIVE_FUEL_MOIST_KEYWORD_ANNSTDEV, 
-									LIVE_FUEL_MOIST_SEP_CHARS, LIVE_FUEL_MOIST_COMMENT_CHAR);
-			slw_asdev = atof(val);
-			free(val);
-			/* create the table of values */
-			if ( (slwfm_tbl = GetDblTwoDArrayTableFStreamIO(fstream, 
-					LIVE_FUEL_MOIST_SEP_CHARS, LIVE_FUEL_MOIST_COMMENT_CHAR)) == NULL )	{
-				fclose(fstream);
-				ERR_ERROR("Unable to initialize historical Live Fuel Moisture table. \n", ERR_EFAILED);
-				}
-			fclose(fstream);					
-			}		
-		
+	if ( (st->month != month) || (st->day != day) )	{
 		/* start new year */
-		if ( syear != year )	{
+		if ( st->year != year )	{
 			/* set annual normalization factors */
-			slh_Z = (randg(slh_amean, slh_asdev) - slh_amean) / slh_asdev;
-			slw_Z = (randg(slw_amean, slw_asdev) - slw_amean) / slw_asdev;
-			/* set current record numbers */
-			slh_srec = 0;
-			slw_srec = 0;
-			/* advance to current date in table */
-			if ( AdvanceRecToDate(slhfm_tbl, month, day, &slh_srec) 
-				|| AdvanceRecToDate(slwfm_tbl, month, day, &slw_srec) )	{
-				ERR_ERROR("Unable to find current date in data table. \n", ERR_EBADFUNC);
-				}
-			/* get first live herb */
-			slhfm = (slh_Z * DBLTWODARRAY_GET_DATA(slhfm_tbl, slh_srec, LIVE_FUEL_MOIST_STDEV_TBL_INDEX)) +
-					DBLTWODARRAY_GET_DATA(slhfm_tbl, slh_srec, LIVE_FUEL_MOIST_MEAN_TBL_INDEX);
-			slhfm /= 100.0;
-			slh_srec++;			
-			/* get first live woody */
-			slwfm = (slw_Z * DBLTWODARRAY_GET_DATA(slwfm_tbl, slw_srec, LIVE_FUEL_MOIST_STDEV_TBL_INDEX)) +
-					DBLTWODARRAY_GET_DATA(slwfm_tbl, slw_srec, LIVE_FUEL_MOIST_MEAN_TBL_INDEX);
-			slwfm /= 100.0;
-			slw_srec++;						
+			st->lh_Z = RandStreamGauss(&st->rs, 0.0, 1.0);
+			st->lw_Z = RandStreamGauss(&st->rs, 0.0, 1.0);
 			/* set year */			
-			syear = year;
+			st->year = year;
 			}
 		
-		/* see if live herb table contains value for this day */
-		if ( (slh_srec < DBLTWODARRAY_SIZE_ROW(slhfm_tbl))
-				&& (month == DBLTWODARRAY_GET_DATA(slhfm_tbl, slh_srec, LIVE_FUEL_MOIST_MO_TBL_INDEX))
-				&& (day == DBLTWODARRAY_GET_DATA(slhfm_tbl, slh_srec, LIVE_FUEL_MOIST_DY_TBL_INDEX)) )	{
-			slhfm = (slh_Z * DBLTWODARRAY_GET_DATA(slhfm_tbl, slh_srec, LIVE_FUEL_MOIST_STDEV_TBL_INDEX)) +
-					DBLTWODARRAY_GET_DATA(slhfm_tbl, slh_srec, LIVE_FUEL_MOIST_MEAN_TBL_INDEX);
-			slhfm /= 100.0;
-			slh_srec++;
+		/* records of the last date listed on or before this day */
+		if ( (lh_rec = DateTableGetRecInEffect(st->tbls->lhfm_dt, month, day)) == DATE_TABLE_NO_REC
+			|| (lw_rec = DateTableGetRecInEffect(st->tbls->lwfm_dt, month, day)) == DATE_TABLE_NO_REC )	{
+			ERR_ERROR("Unable to find current date in data table. \n", ERR_EBADFUNC);
 			}
 
-		/* see if live woody table contains value for this day */
-		if ( (slw_srec < DBLTWODARRAY_SIZE_ROW(slwfm_tbl))
-				&& (month == DBLTWODARRAY_GET_DATA(slwfm_tbl, slw_srec, LIVE_FUEL_MOIST_MO_TBL_INDEX))
-				&& (day == DBLTWODARRAY_GET_DATA(slwfm_tbl, slw_srec, LIVE_FUEL_MOIST_DY_TBL_INDEX)) )	{
-			slwfm = (slw_Z * DBLTWODARRAY_GET_DATA(slwfm_tbl, slw_srec, LIVE_FUEL_MOIST_STDEV_TBL_INDEX)) +
-					DBLTWODARRAY_GET_DATA(slwfm_tbl, slw_srec, LIVE_FUEL_MOIST_MEAN_TBL_INDEX);
-			slwfm /= 100.0;
-			slw_srec++;
-			}
+		/* live herb */
+		st->lhfm = (st->lh_Z * DATE_TABLE_GET_DATA(st->tbls->lhfm_dt, lh_rec, LIVE_FUEL_MOIST_STDEV_TBL_INDEX)) +
+				DATE_TABLE_GET_DATA(st->tbls->lhfm_dt, lh_rec, LIVE_FUEL_MOIST_MEAN_TBL_INDEX);
+		st->lhfm /= 100.0;
+
+		/* live woody */
+		st->lwfm = (st->lw_Z * DATE_TABLE_GET_DATA(st->tbls->lwfm_dt, lw_rec, LIVE_FUEL_MOIST_STDEV_TBL_INDEX)) +
+				DATE_TABLE_GET_DATA(st->tbls->lwfm_dt, lw_rec, LIVE_FUEL_MOIST_MEAN_TBL_INDEX);
+		st->lwfm /= 100.0;
 					
 		/* set {month, day} for future calls */
-		smonth = month;
-		sday = day;
+		st->month = month;
+		st->day = day;
 		}
 
-	*lhfm = slhfm;
-	*lwfm = slwfm;
+	*lhfm = st->lhfm;
+	*lwfm = st->lwfm;
 		
 	return ERR_SUCCESS;
 	}						
 
-int GetLiveFuelMoistSPATIALFromProps(ChHashTable * proptbl, int year, int month, int day, int hour,
+int GetLiveFuelMoistSPATIALFromProps(LiveFuelMoistState * st, ChHashTable * proptbl, int year, int month, int day, int hour,
 											double rwx, double rwy, 
 											double * lhfm, double * lwfm)	{
-	/* static variables used to store state across function calls */
-	static int smonth 			= 0;
-	static int sday 				= 0;
-	static int shour 				= 0;
-	static StrTwoDArray * slfm_tbl	= NULL;
-	static GridData * slh_grid 	= NULL, *slw_grid = NULL;
 	/* stack variables */
-	KeyVal * entry					= NULL;				/* key/val instances from table */
-	FILE * fstream					= NULL;				/* file stream */
+	GridData * lh_grid				= NULL;				/* live herbaceous fuel moisture of the current hour */
+	GridData * lw_grid				= NULL;				/* live woody fuel moisture of the current hour */
 	int i,j;
 
-	/* check to see if new tables are needed */
-	if ( (smonth != month) || (sday != day) || (shour != hour) )	{
-		/* new lfm tbl */
-		if (slfm_tbl == NULL )	{
-			/* retriev lfm filename from properties */
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_LFMSPFILE), (void *)&entry) )	{
-				ERR_ERROR("Unable to retrieve LIVE_FUEL_MOIST_SPATIAL_FILE property. \n", ERR_EINVAL);
-				}
-			/* open lfm file */
-			if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
-				ERR_ERROR("Unable to open LIVE_FUEL_MOIST_SPATIAL_FILE. \n", ERR_EIOFAIL);
-				}
-			/* retrieve contents of lfm file */
-			if ( (slfm_tbl = GetStrTwoDArrayTableFStreamIO(fstream, LIVE_FUEL_MOIST_RAST_LFM_SEP_CHARS, 
-						LIVE_FUEL_MOIST_RAST_LFM_COMMENT_CHAR)) == NULL )	{
-				fclose(fstream);
-				ERR_ERROR("Unable to parse LIVE_FUEL_MOIST_SPATIAL_FILE. \n", ERR_EINVAL);
-				}
-			/* cleanup */
-			fclose(fstream);
-			}							
-		/* new lh grid */
-		if ( slh_grid == NULL )	{
-			if ( (slh_grid = InitGridDataFromAsciiRaster(STRTWODARRAY_GET_DATA(slfm_tbl, 0, LIVE_FUEL_MOIST_RAST_LFM_LFH_FILE_TBL_INDEX), 
-								EnumDblGrid)) == NULL )	{
-				ERR_ERROR("Unable to initialize GridData from file listed in LIVE_FUEL_MOIST_SPATIAL_FILE. \n", ERR_EINVAL);
-				}
-			}
-    /* new lw grid */
-		if ( slw_grid == NULL )	{
-			if ( (slw_grid = InitGridDataFromAsciiRaster(STRTWODARRAY_GET_DATA(slfm_tbl, 0, LIVE_FUEL_MOIST_RAST_LFM_LFW_FILE_TBL_INDEX), 
-								EnumDblGrid)) == NULL )	{
-				ERR_ERROR("Unable to initialize GridData from file listed in LIVE_FUEL_MOIST_SPATIAL_FILE. \n", ERR_EINVAL);
-				}
-			}
-		/* find record in lh table */
-		for(i = 0; i < DBLTWODARRAY_SIZE_ROW(slfm_tbl); i++)	{
-			/* parse the lfm table from strings to numbers */
-			smonth = atoi(STRTWODARRAY_GET_DATA(slfm_tbl, i, LIVE_FUEL_MOIST_RAST_LFM_MO_TBL_INDEX));
-			sday = atoi(STRTWODARRAY_GET_DATA(slfm_tbl, i, LIVE_FUEL_MOIST_RAST_LFM_DY_TBL_INDEX));
-			shour = atoi(STRTWODARRAY_GET_DATA(slfm_tbl, i, LIVE_FUEL_MOIST_RAST_LFM_HR_TBL_INDEX)) / 100;
-			/* find matching month and day and hour */
-			if ( (smonth == month) && (sday == day) && (shour == hour) )	{
-				/* free old grid */
-				FreeGridData(slh_grid);
-				/* initialize new grid */
-				if ( (slh_grid = InitGridDataFromAsciiRaster(STRTWODARRAY_GET_DATA(slfm_tbl, i, LIVE_FUEL_MOIST_RAST_LFM_LFH_FILE_TBL_INDEX), 
-									EnumDblGrid)) == NULL )	{
-					ERR_ERROR("Unable to initialize GridData from file listed in LIVE_FUEL_MOIST_SPATIAL_FILE. \n", ERR_EINVAL);
-					}
-				/* free old grid */
-				FreeGridData(slw_grid);
-				/* initialize new grid */
-				if ( (slw_grid = InitGridDataFromAsciiRaster(STRTWODARRAY_GET_DATA(slfm_tbl, i, LIVE_FUEL_MOIST_RAST_LFM_LFW_FILE_TBL_INDEX), 
-									EnumDblGrid)) == NULL )	{
-					ERR_ERROR("Unable to initialize GridData from file listed in LIVE_FUEL_MOIST_SPATIAL_FILE. \n", ERR_EINVAL);
-					}
-				break;
-				}
+	if ( st->lfm_wc == NULL )	{
+		ERR_ERROR("Live Fuel Moisture rasters not initialized. \n", ERR_EINVAL);
+		}
+
+	/* check to see if new rasters are needed */
+	if ( (st->month != month) || (st->day != day) || (st->hour != hour) )	{
+		/* rasters of the hour listed in the atm table, read in the background when the previous hour was reached */
+		if ( WeatherStreamSeek(st->lfm_wc, month, day, hour) )	{
+			ERR_ERROR("Unable to initialize GridData from file listed in LIVE_FUEL_MOIST_SPATIAL_FILE. \n", ERR_EINVAL);
 			}
 		/* set {month, day, hour} for future calls */
-		smonth = month;
-		sday = day;
-		shour = hour;
+		st->month = month;
+		st->day = day;
+		st->hour = hour;
 		}
+	/* rasters of the current hour */
+	lh_grid = WEATHER_STREAM_GET_GRID(st->lfm_wc, 0);
+	lw_grid = WEATHER_STREAM_GET_GRID(st->lfm_wc, 1);
 
 	/* transform array indecies into spatial coordinates */
-	if ( CoordTransRealWorldToRaster(rwx, rwy, slh_grid->ghdr->cellsize, slh_grid->ghdr->cellsize,
-			COORD_TRANS_XLLCORNER_TO_XULCNTR(slh_grid->ghdr->xllcorner, slh_grid->ghdr->cellsize),
-			COORD_TRANS_YLLCORNER_TO_YULCNTR(slh_grid->ghdr->yllcorner, slh_grid->ghdr->cellsize, slh_grid->ghdr->nrows),
+	if ( CoordTransRealWorldToRaster(rwx, rwy, lh_grid->ghdr->cellsize, lh_grid->ghdr->cellsize,
+			COORD_TRANS_XLLCORNER_TO_XULCNTR(lh_grid->ghdr->xllcorner, lh_grid->ghdr->cellsize),
+			COORD_TRANS_YLLCORNER_TO_YULCNTR(lh_grid->ghdr->yllcorner, lh_grid->ghdr->cellsize, lh_grid->ghdr->nrows),
 			&i, &j) )	{
 		ERR_ERROR("Unable to transform real world coordinates to grid indecies. \n", ERR_ESING);
 		}			
 													
 	/* retrieve lh at coordinate */
-	GRID_DATA_GET_DATA(slh_grid, i, j, *lhfm);
+	GRID_DATA_GET_DATA(lh_grid, i, j, *lhfm);
   *lhfm = *lhfm / 100.0;
 
 	/* transform array indecies into spatial coordinates */
-	if ( CoordTransRealWorldToRaster(rwx, rwy, slw_grid->ghdr->cellsize, slw_grid->ghdr->cellsize,
-			COORD_TRANS_XLLCORNER_TO_XULCNTR(slw_grid->ghdr->xllcorner, slw_grid->ghdr->cellsize),
-			COORD_TRANS_YLLCORNER_TO_YULCNTR(slw_grid->ghdr->yllcorner, slw_grid->ghdr->cellsize, slw_grid->ghdr->nrows),
+	if ( CoordTransRealWorldToRaster(rwx, rwy, lw_grid->ghdr->cellsize, lw_grid->ghdr->cellsize,
+			COORD_TRANS_XLLCORNER_TO_XULCNTR(lw_grid->ghdr->xllcorner, lw_grid->ghdr->cellsize),
+			COORD_TRANS_YLLCORNER_TO_YULCNTR(lw_grid->ghdr->yllcorner, lw_grid->ghdr->cellsize, lw_grid->ghdr->nrows),
 			&i, &j) )	{
 		ERR_ERROR("Unable to transform real world coordinates to grid indecies. \n", ERR_ESING);
 		}			
 													
 	/* retrieve lw at coordinate */
-	GRID_DATA_GET_DATA(slw_grid, i, j, *lwfm);
+	GRID_DATA_GET_DATA(lw_grid, i, j, *lwfm);
   *lwfm = *lwfm / 100.0;
 
 	return ERR_SUCCESS;
 	}
 	
-int AdvanceRecToDate(DblTwoDArray * da, int month, int day, int * rec)	{
-	int found = 0;
-	
-	/*check args */
-	if ( da == NULL || DBLTWODARRAY_SIZE_ROW(da) < 1 )	{
-		ERR_ERROR("Table of array values not initialized, unable to advance to current date in table. \n", ERR_EINVAL);
-		}
-	
-	/* increment records until day and month is found */
-	while ( *rec < DBLTWODARRAY_SIZE_ROW(da) )	{
-		/* identical match found */
-		if ( month == DBLTWODARRAY_GET_DATA(da, *rec, LIVE_FUEL_MOIST_MO_TBL_INDEX)
-			&& day == DBLTWODARRAY_GET_DATA(da, *rec, LIVE_FUEL_MOIST_DY_TBL_INDEX) )	{
-			found = 1;
-			break;
-			}
-		/* no identical match, if possible get previous record in table */
-		if ( month <= DBLTWODARRAY_GET_DATA(da, *rec, LIVE_FUEL_MOIST_MO_TBL_INDEX)
-			&& day <= DBLTWODARRAY_GET_DATA(da, *rec, LIVE_FUEL_MOIST_DY_TBL_INDEX) )	{
-			if ( *rec != 0 )	{
-				*rec = *rec - 1;
-				}
-			found = 1;
-			break;
-			}	
-		*rec = *rec + 1;
-		}
-		
-	/* if day and month were not found, assign last date in file */
-	if ( found == 0 )	{
-		*rec = DBLTWODARRAY_SIZE_ROW(da) - 1;
+void FreeLiveFuelMoistState(void * vptr)	{
+	LiveFuelMoistState * st = NULL;
+
+	if ( vptr != NULL )	{
+		st = (LiveFuelMoistState *) vptr;
+		/* tables are shared and freed by their owner */
+		if ( st->lfm_wc != NULL )	FreeWeatherStreamCursor(st->lfm_wc);
+		free(st);
 		}
-		
-	return ERR_SUCCESS;
-	}						
-											 
+	st = NULL;
+
+	return;
+	}
+
 /* end of LiveFuelMoist.c */
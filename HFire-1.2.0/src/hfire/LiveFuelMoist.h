@@ -33,13 +33,16 @@
 
 #include "CoordTrans.h"
 #include "Units.h"
-#include "NLIBRand.h"
+#include "RandStream.h"
 #include "FireProp.h"
 #include "ChHashTable.h"
 #include "KeyVal.h"
 #include "DblTwoDArray.h"
+#include "DateTable.h"
 #include "StrTwoDArray.h"
 #include "GridData.h"
+#include "FireGridData.h"
+#include "WeatherStream.h"
 #include "FStreamIO.h"
 #include "Err.h"
 
@@ -84,7 +87,67 @@
  * STRUCTS, TYPEDEFS
  *********************************************************
  */
- 
+
+/*! Type name for LiveFuelMoistTables_
+ *	\sa For a list of members goto LiveFuelMoistTables_
+ */
+typedef struct LiveFuelMoistTables_ LiveFuelMoistTables;
+
+/*!	\struct LiveFuelMoistTables_ LiveFuelMoist.h "LiveFuelMoist.h"
+ *	\brief tables of live fuel moistures read once from the files named in the simulation properties
+ *	Not modified once read, so shared by the LiveFuelMoistState of every simulation.
+ */
+struct LiveFuelMoistTables_	{
+	/*! table of live herbaceous fuel moistures indexed by month and day */
+	DateTable * lhfm_dt;
+	/*! table of live woody fuel moistures indexed by month and day */
+	DateTable * lwfm_dt;
+	/*! annual mean of RANDH live herbaceous fuel moisture */
+	double lh_amean;
+	/*! annual standard deviation of RANDH live herbaceous fuel moisture */
+	double lh_asdev;
+	/*! annual mean of RANDH live woody fuel moisture */
+	double lw_amean;
+	/*! annual standard deviation of RANDH live woody fuel moisture */
+	double lw_asdev;
+	/*! atm table of SPATIAL live fuel moistures */
+	WeatherStream * lfm_ws;
+	};
+
+/*! Type name for LiveFuelMoistState_
+ *	\sa For a list of members goto LiveFuelMoistState_
+ */
+typedef struct LiveFuelMoistState_ LiveFuelMoistState;
+
+/*!	\struct LiveFuelMoistState_ LiveFuelMoist.h "LiveFuelMoist.h"
+ *	\brief live fuel moisture retrieved by the live fuel moisture functions
+ *	Stored by FireEnv in place of function statics so each simulation owns its state.
+ */
+struct LiveFuelMoistState_	{
+	/*! year of the last call */
+	int year;
+	/*! month of the last call */
+	int month;
+	/*! day of the last call */
+	int day;
+	/*! hour of the last call */
+	int hour;
+	/*! live herbaceous fuel moisture of the last call */
+	double lhfm;
+	/*! live woody fuel moisture of the last call */
+	double lwfm;
+	/*! tables shared by every simulation */
+	const LiveFuelMoistTables * tbls;
+	/*! standard normal deviate of RANDH live herbaceous fuel moisture for the year */
+	double lh_Z;
+	/*! standard normal deviate of RANDH live woody fuel moisture for the year */
+	double lw_Z;
+	/*! rasters of SPATIAL live fuel moistures at the current hour */
+	WeatherStreamCursor * lfm_wc;
+	/*! random numbers drawing RANDH deviates */
+	RandStream rs;
+	};
+
 /*
  *********************************************************
  * MACROS
@@ -97,7 +160,86 @@
  *********************************************************
  */
 
-/*! \fn int GetLiveFuelMoistFIXEDFromProps(ChHashTable * proptbl, int year, int month, int day,
+/*! \fn LiveFuelMoistTables * InitLiveFuelMoistTables()
+ *	\brief Initializes an empty set of live fuel moisture tables.
+ *
+ *	\sa LiveFuelMoistTables
+ *	\retval LiveFuelMoistTables* Ptr to initialized LiveFuelMoistTables, or NULL if unable to allocate
+ */
+LiveFuelMoistTables * InitLiveFuelMoistTables();
+
+/*! \fn int SetLiveFuelMoistTablesFIXEDFromProps(LiveFuelMoistTables * tbls, ChHashTable * proptbl)
+ *	\brief Reads the tables named by LIVE_FUEL_MOIST_HERB_FILE and LIVE_FUEL_MOIST_WOOD_FILE and indexes them by month and day.
+ *
+ *	\sa LiveFuelMoistTables
+ *	\param tbls LiveFuelMoistTables
+ *	\param proptbl ChHashTable of simulation properties
+ *	\retval int ERR_SUCCESS(0) if successful, an error code otherwise
+ */
+int SetLiveFuelMoistTablesFIXEDFromProps(LiveFuelMoistTables * tbls, ChHashTable * proptbl);
+
+/*! \fn int SetLiveFuelMoistTablesRANDHFromProps(LiveFuelMoistTables * tbls, ChHashTable * proptbl)
+ *	\brief Reads the annual mean and standard deviation and the tables named by LIVE_FUEL_MOIST_HERB_FILE
+ *	and LIVE_FUEL_MOIST_WOOD_FILE, and indexes the tables by month and day.
+ *
+ *	\sa LiveFuelMoistTables
+ *	\param tbls LiveFuelMoistTables
+ *	\param proptbl ChHashTable of simulation properties
+ *	\retval int ERR_SUCCESS(0) if successful, an error code otherwise
+ */
+int SetLiveFuelMoistTablesRANDHFromProps(LiveFuelMoistTables * tbls, ChHashTable * proptbl);
+
+/*! \fn int SetLiveFuelMoistTablesSPATIALFromProps(LiveFuelMoistTables * tbls, ChHashTable * proptbl)
+ *	\brief Reads the atm table named by LIVE_FUEL_MOIST_SPATIAL_FILE and indexes it by month, day and hour.
+ *
+ *	The rasters listed in the atm table are read as simulations reach them.
+ *	\sa LiveFuelMoistTables
+ *	\sa WeatherStream
+ *	\param tbls LiveFuelMoistTables
+ *	\param proptbl ChHashTable of simulation properties
+ *	\retval int ERR_SUCCESS(0) if successful, an error code otherwise
+ */
+int SetLiveFuelMoistTablesSPATIALFromProps(LiveFuelMoistTables * tbls, ChHashTable * proptbl);
+
+/*! \fn void FreeLiveFuelMoistTables(void * vptr)
+ *	\brief Frees memory associated with LiveFuelMoistTables structure.
+ *
+ *	Every LiveFuelMoistState using the tables must be freed first.
+ *	\sa LiveFuelMoistTables
+ *	\param vptr ptr to LiveFuelMoistTables
+ */
+void FreeLiveFuelMoistTables(void * vptr);
+
+/*! \fn LiveFuelMoistState * InitLiveFuelMoistState()
+ *	\brief Initializes the live fuel moisture state of a simulation.
+ *
+ *	\sa LiveFuelMoistState
+ *	\retval LiveFuelMoistState* Ptr to initialized LiveFuelMoistState, or NULL if unable to allocate
+ */
+LiveFuelMoistState * InitLiveFuelMoistState();
+
+/*! \fn void FreeLiveFuelMoistState(void * vptr)
+ *	\brief Frees memory associated with LiveFuelMoistState structure.
+ *
+ *	\sa LiveFuelMoistState
+ *	\param vptr ptr to LiveFuelMoistState
+ */
+void FreeLiveFuelMoistState(void * vptr);
+
+/*! \fn int SetLiveFuelMoistStateFromTables(LiveFuelMoistState * st, const LiveFuelMoistTables * tbls)
+ *	\brief Links the live fuel moisture state of a simulation to the shared live fuel moisture tables.
+ *
+ *	Call once before the first call to the functions taking LiveFuelMoistState as argument.
+ *	The tables must outlive the state.
+ *	\sa LiveFuelMoistState
+ *	\sa LiveFuelMoistTables
+ *	\param st LiveFuelMoistState
+ *	\param tbls LiveFuelMoistTables read for the live fuel moisture type of the simulation
+ *	\retval int ERR_SUCCESS(0) if successful, an error code otherwise
+ */
+int SetLiveFuelMoistStateFromTables(LiveFuelMoistState * st, const LiveFuelMoistTables * tbls);
+
+/*! \fn int GetLiveFuelMoistFIXEDFromProps(LiveFuelMoistState * st, ChHashTable * proptbl, int year, int month, int day,
  											unsigned int row, unsigned int col, 
 											double * lhfm, double * lwfm)
  *	\brief retrieves time and space dependent live fuel moisture value at a cell
@@ -106,6 +248,7 @@
  * 	moisture based upon index into a table of historical values
  *	\sa ChHashTable
  *	\sa Check the \htmlonly <a href="config_file_doc.html#LIVE_FUEL">config file documentation</a> \endhtmlonly
+ *	\param st LiveFuelMoistState storing the live fuel moisture between calls
  *	\param proptbl ChHashTable of simulation properties
  *	\param year date to retreive live fuel moisture for
  *	\param month date to retreive live fuel moisture for 
@@ -123,11 +266,11 @@
  *				// something bad happened
  *	\endcode
  */
-int GetLiveFuelMoistFIXEDFromProps(ChHashTable * proptbl, int year, int month, int day, int hour,
+int GetLiveFuelMoistFIXEDFromProps(LiveFuelMoistState * st, ChHashTable * proptbl, int year, int month, int day, int hour,
 											double rwx, double rwy, 
 											double * lhfm, double * lwfm);
 
-/*! \fn int GetLiveFuelMoistRANDHFromProps(ChHashTable * proptbl, int year, int month, int day,
+/*! \fn int GetLiveFuelMoistRANDHFromProps(LiveFuelMoistState * st, ChHashTable * proptbl, int year, int month, int day,
  											unsigned int row, unsigned int col,
 											double * lhfm, double * lwfm)
  *	\brief retrieves time and space dependent live fuel moisture value at a cell
@@ -136,6 +279,7 @@ int GetLiveFuelMoistFIXEDFromProps(ChHashTable * proptbl, int year, int month, i
  * 	moisture based upon a probablity function of historical live fuel moisture values
  *	\sa ChHashTable
  *	\sa Check the \htmlonly <a href="config_file_doc.html#LIVE_FUEL">config file documentation</a> \endhtmlonly
+ *	\param st LiveFuelMoistState storing the live fuel moisture between calls
  *	\param proptbl ChHashTable of simulation properties
  *	\param year date to retreive live fuel moisture for
  *	\param month date to retreive live fuel moisture for 
@@ -153,11 +297,11 @@ int GetLiveFuelMoistFIXEDFromProps(ChHashTable * proptbl, int year, int month, i
  *				// something bad happened
  *	\endcode
  */			
-int GetLiveFuelMoistRANDHFromProps(ChHashTable * proptbl, int year, int month, int day, int hour,
+int GetLiveFuelMoistRANDHFromProps(LiveFuelMoistState * st, ChHashTable * proptbl, int year, int month, int day, int hour,
 											double rwx, double rwy, 
 											double * lhfm, double * lwfm);
 
-/*! \fn int GetLiveFuelMoistSPATIALFromProps(ChHashTable * proptbl, int year, int month, int day,
+/*! \fn int GetLiveFuelMoistSPATIALFromProps(LiveFuelMoistState * st, ChHashTable * proptbl, int year, int month, int day,
  											unsigned int row, unsigned int col,
 											double * lhfm, double * lwfm)
  *	\brief retrieves time and space dependent live fuel moisture value at a cell
@@ -166,6 +310,7 @@ int GetLiveFuelMoistRANDHFromProps(ChHashTable * proptbl, int year, int month, i
  * 	moisture based upon lookup into a raster of live fuel moisture values
  *	\sa ChHashTable
  *	\sa Check the \htmlonly <a href="config_file_doc.html#LIVE_FUEL">config file documentation</a> \endhtmlonly
+ *	\param st LiveFuelMoistState storing the live fuel moisture between calls
  *	\param proptbl ChHashTable of simulation properties
  *	\param year date to retreive live fuel moisture for
  *	\param month date to retreive live fuel moisture for 
@@ -183,7 +328,7 @@ int GetLiveFuelMoistRANDHFromProps(ChHashTable * proptbl, int year, int month, i
  *				// something bad happened
  *	\endcode
  */
-int GetLiveFuelMoistSPATIALFromProps(ChHashTable * proptbl, int year, int month, int day, int hour,
+int GetLiveFuelMoistSPATIALFromProps(LiveFuelMoistState * st, ChHashTable * proptbl, int year, int month, int day, int hour,
 											double rwx, double rwy, 
 											double * lhfm, double * lwfm);
   
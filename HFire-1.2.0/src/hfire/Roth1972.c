@@ -27,22 +27,27 @@
 #define ROTH_1972_WTG_CLASSES			(6)
 static const int   TimeLagClass			[ROTH_1972_WTG_CLASSES] = {0, 0, 1, 1, 2, 2};
 static const float WtgSzClassEnglish	[ROTH_1972_WTG_CLASSES] = {1200.0,  192.0,   96.0,   48.0,  16.0,  0.0};
-static const float WtgSzClassMetric		[ROTH_1972_WTG_CLASSES] = {3633.61, 581.37, 290.68, 145.34, 48.44, 0.0};
 
-int Roth1972FireSpreadSetFuelBed(RothFuelModel * rfm)	{
+static void RothPipelineToSpread(RothFuelModel * rfm, RothSpread * rs);
+static void RothSpreadToPipeline(RothSpread * rs, RothFuelModel * rfm);
+
+int Roth1972FuelBedSet(const RothFuelModel * rfm, RothFuelBed * fb)	{
 	double lload, 	dload;
 	double lhc, 	dhc;
 	double lseff, 	dseff;
 	double letas, 	detas;
 
 	double flive, beta_opt, ratio, aa, sigma_15, gamma, gamma_max, c, e;
+	int i, j, sz_cls;
 
 	/* check args */
-	if ( rfm == NULL ) 	{
-		ERR_ERROR("RothFuelModel not initialized, FuelBed step in FireSpread Pipeline failed. \n", ERR_EINVAL);
+	if ( rfm == NULL || fb == NULL ) 	{
+		ERR_ERROR("Arguments supplied to set RothFuelBed invalid. \n", ERR_EINVAL);
 		}
-	if ( rfm->rp == NULL )	{
-		ERR_ERROR("RothPipeline not initialized, FuelBed step in FireSpread Pipeline failed. \n", ERR_EINVAL);
+	
+	/* reset fuel bed to default (unburnable) state */
+	if ( RothFuelBedSetDefaultValues(fb) )	{
+		ERR_ERROR("Unable to set RothFuelBed. \n", ERR_EBADFUNC);
 		}
 	
 	/* return if RothFuelModel represents unburnable fuel */	
@@ -50,21 +55,32 @@ int Roth1972FireSpreadSetFuelBed(RothFuelModel * rfm)	{
 		return ERR_SUCCESS;
 		}
 	
-	/* reset pipeline to defualt state */
-	if ( RothPipelineSetDefaultValues(rfm->rp) )	{
-		ERR_ERROR("FuelBed step in FireSpread Pipeline failed. \n", ERR_EBADFUNC);
+	/* all calculations done in ENGLISH units */
+	if ( rfm->units != EnumEnglishUnits )	{
+		ERR_ERROR("RothFuelModel must be in ENGLISH units to set RothFuelBed. \n", ERR_EUNITS);
 		}
 	
-	/* set pipeline state */
-	rfm->rp->pipe = EnumSetFuelBedPipe;
-		
-	/* all calculations done in ENGLISH units */
-	if ( rfm->units == EnumMetricUnits )	{
-		if ( RothFuelModelMetricToEnglish(rfm) )	{
-			ERR_ERROR("FuelBed step in FireSpread Pipeline failed. \n", ERR_EBADFUNC);
+	/* copy the particle attributes needed to compute spread */
+	fb->unburnable = 0;
+	fb->mex = rfm->mex;
+	fb->fdens = rfm->fdens;
+	fb->larea = rfm->larea;
+	fb->darea = rfm->darea;
+	for(i = 0; i < EnumNumSizeClasses; i++)		{
+		fb->load[i] = rfm->load[i];
+		fb->effhn[i] = rfm->effhn[i];
+		fb->awtg[i] = rfm->awtg[i];
+		/* timelag class of particle depends only upon sav */
+		sz_cls = 0;
+		for(j = 0; j < ROTH_1972_WTG_CLASSES; j++)	{
+			if ( rfm->sav[i] > WtgSzClassEnglish[j] )	{
+				sz_cls = j;
+				break;
+				}
 			}
+		fb->tlag[i] = TimeLagClass[sz_cls];
 		}
-	
+		
     /* if fuel bed has no surface area go no further */
 	if ( UNITS_FP_IS_ZERO(rfm->larea + rfm->darea) )	{
 		return ERR_SUCCESS;
@@ -109,14 +125,14 @@ int Roth1972FireSpreadSetFuelBed(RothFuelModel * rfm)	{
 		}
 		
 	/* rx factors */
-	rfm->rp->lrx = lload * lhc * letas;	
-	rfm->rp->drx = dload * dhc * detas;
+	fb->lrx = lload * lhc * letas;	
+	fb->drx = dload * dhc * detas;
 	
 	/* residence time */
-	rfm->rp->taur = 384.0 / rfm->fsav;
+	fb->taur = 384.0 / rfm->fsav;
 	
 	/* propagating flux */
-	rfm->rp->ppflux = exp((0.792 + 0.681 * sqrt(rfm->fsav)) * (rfm->pkrat + 0.1)) / (192.0 + 0.2595 * rfm->fsav);
+	fb->ppflux = exp((0.792 + 0.681 * sqrt(rfm->fsav)) * (rfm->pkrat + 0.1)) / (192.0 + 0.2595 * rfm->fsav);
 	
     /* gamma */
     beta_opt = 3.348 / (pow(rfm->fsav, 0.8189));
@@ -127,16 +143,16 @@ int Roth1972FireSpreadSetFuelBed(RothFuelModel * rfm)	{
     gamma = gamma_max * pow(ratio, aa) * exp(aa * (1.0 - ratio));	
 
 	/* factor gamma into rx factors */
-	rfm->rp->lrx *= gamma;
-	rfm->rp->drx *= gamma;
+	fb->lrx *= gamma;
+	fb->drx *= gamma;
 	
 	/* slope and wind intermediaries */
-	rfm->rp->slp_k = 5.275 * pow(rfm->pkrat, -0.3);
-	rfm->rp->wnd_b = 0.02526 * pow(rfm->fsav, 0.54);
+	fb->slp_k = 5.275 * pow(rfm->pkrat, -0.3);
+	fb->wnd_b = 0.02526 * pow(rfm->fsav, 0.54);
     c = 7.47 * exp(-0.133 * pow(rfm->fsav, 0.55));
     e = 0.715 * exp(-0.000359 * rfm->fsav);
-    rfm->rp->wnd_k = c * pow(ratio, -e);
-    rfm->rp->wnd_e = pow(ratio, e) / c;	
+    fb->wnd_k = c * pow(ratio, -e);
+    fb->wnd_e = pow(ratio, e) / c;	
     
     /* if no live fuels in bed go no further */
     if ( UNITS_FP_IS_ZERO(lload) )	{
@@ -150,142 +166,90 @@ int Roth1972FireSpreadSetFuelBed(RothFuelModel * rfm)	{
     if ( UNITS_FP_GT_ZERO(rfm->sav[EnumLWSizeClass]) )	{
     	flive += rfm->load[EnumLWSizeClass] * exp(-500.0 / rfm->sav[EnumLWSizeClass]);
     	}
-    rfm->rp->fdead = (rfm->load[EnumD1HSizeClass]  * rfm->effhn[EnumD1HSizeClass]) +
-    				 (rfm->load[EnumD10HSizeClass] * rfm->effhn[EnumD10HSizeClass]) +
-    				 (rfm->load[EnumD100HSizeClass] * rfm->effhn[EnumD100HSizeClass]);
+    fb->fdead = (rfm->load[EnumD1HSizeClass]  * rfm->effhn[EnumD1HSizeClass]) +
+    			(rfm->load[EnumD10HSizeClass] * rfm->effhn[EnumD10HSizeClass]) +
+    			(rfm->load[EnumD100HSizeClass] * rfm->effhn[EnumD100HSizeClass]);
     if ( UNITS_FP_GT_ZERO(flive) )	{
-    	rfm->rp->lmex = 2.9 * rfm->rp->fdead / flive;
+    	fb->lmex = 2.9 * fb->fdead / flive;
     	}    				 
 				
 	return ERR_SUCCESS;
 	}
 
-int Roth1972FireSpreadNoWindNoSlope(RothFuelModel * rfm, double d1hfm, double d10hfm, double d100hfm,
- 														double lhfm, double lwfm)	{
+int Roth1972SpreadNoWindNoSlope(const RothFuelBed * fb, double d1hfm, double d10hfm, double d100hfm,
+ 														double lhfm, double lwfm, RothSpread * rs)	{
 	double letam, 	detam;
 	double lm, 		dm;
 	double lmex, 	dmex;
 	 										
  	double wfmd, rbqig, fdmois, qig, ratio;
- 	
- 	int 	sz_cls	[EnumNumSizeClasses] = {0};
- 	double 	tlag_cls[EnumNumSizeClasses] = {0.0};
- 	int i, j;
+ 	double tlag_fm[3];
+ 	int i;
  	
 	/* check args */
-	if ( rfm == NULL ) 	{
-		ERR_ERROR("RothFuelModel not initialized, NoWindNoSlope step in FireSpread Pipeline failed. \n", ERR_EINVAL);
-		}
-	if ( rfm->rp == NULL )	{
-		ERR_ERROR("RothPipeline not initialized, NoWindNoSlope step in FireSpread Pipeline failed. \n", ERR_EINVAL);
+	if ( fb == NULL || rs == NULL ) 	{
+		ERR_ERROR("Arguments supplied to NoWindNoSlope step in FireSpread Pipeline invalid. \n", ERR_EINVAL);
 		}
 	
-	/* return if RothFuelModel represents unburnable fuel */	
-	if ( rfm->brntype == EnumRothUnBurnable )	{
-		return ERR_SUCCESS;
-		}
-	
-	/* check and set pipeline state */
-	if ( rfm->rp->pipe < EnumSetFuelBedPipe )	{
-		ERR_ERROR("SetFuelBed step not complete, unable to execute NoWindNoSlope. \n", ERR_ESANITY);
-		}
-	rfm->rp->pipe = EnumNoWindNoSlopePipe;
+	/* results default to no fire spread */
+	RothSpreadSetDefaultValues(rs);
+	rs->pipe = EnumNoWindNoSlopePipe;
 	
-	/* check for change in moisture */
-	if ( (UNITS_FP_ARE_EQUAL(rfm->rp->d1hfm, d1hfm)) && (UNITS_FP_ARE_EQUAL(rfm->rp->d10hfm, d10hfm)) &&
-		 (UNITS_FP_ARE_EQUAL(rfm->rp->d100hfm, d100hfm)) && (UNITS_FP_ARE_EQUAL(rfm->rp->lhfm, lhfm)) &&
-		 (UNITS_FP_ARE_EQUAL(rfm->rp->lwfm, lwfm)) )	{
+	/* return if RothFuelBed represents unburnable fuel */	
+	if ( fb->unburnable )	{
 		return ERR_SUCCESS;
 		}
-	
-	/* assign new moistures */
-	rfm->rp->d1hfm = d1hfm;
-	rfm->rp->d10hfm = d10hfm;
-	rfm->rp->d100hfm = d100hfm;
-	rfm->rp->lhfm = lhfm;
-	rfm->rp->lwfm = lwfm;
-	
-	/* zero any previously set pipeline vars */
-	rfm->rp->ros_0 = rfm->rp->hpua = rfm->rp->rxint = 0.0;
-	rfm->rp->ros_max = rfm->rp->ros_az_max = 0.0;
-	rfm->rp->ros_any = rfm->rp->ros_az_any = 0.0;
 
 	/* initialize scratch vars */
  	wfmd = rbqig = fdmois = qig = ratio = 0.0;
 	letam = detam = lm = dm = lmex = dmex = 0.0;
 
-	/* accumulate moisture based upon size classes */
-	for(i = 0; i < EnumNumSizeClasses; i++)		{
-		for(j = 0; j < ROTH_1972_WTG_CLASSES; j++)	{
-			if ( rfm->units == EnumEnglishUnits && rfm->sav[i] > WtgSzClassEnglish[j] )	{
-				sz_cls[i] = j;
-				break;
-				}
-			if ( rfm->units == EnumMetricUnits && rfm->sav[i] > WtgSzClassMetric[j] )	{
-				sz_cls[i] = j;			
-				break;
-				}
-			}
-		}
-	for(i = 0; i < EnumNumSizeClasses; i++)		{
-		switch(TimeLagClass[sz_cls[i]])	{
-			case 0:
-				tlag_cls[i] = d1hfm;
-				break;
-			case 1:
-				tlag_cls[i] = d10hfm;
-				break;
-			case 2:
-				tlag_cls[i] = d100hfm;
-				break;
-			default:
-				ERR_ERROR_CONTINUE("Unrecognized TimeLagClass, NoWindNoSlope in FireSpread Pipeline. \n", ERR_WARNING);
-				tlag_cls[i] = 0.0;
-				break;
-			}		
-		}
-	wfmd = 	(tlag_cls[EnumD1HSizeClass] * rfm->effhn[EnumD1HSizeClass] * rfm->load[EnumD1HSizeClass]) +
-			(tlag_cls[EnumD10HSizeClass] * rfm->effhn[EnumD10HSizeClass] * rfm->load[EnumD10HSizeClass]) +
-			(tlag_cls[EnumD100HSizeClass] * rfm->effhn[EnumD100HSizeClass] * rfm->load[EnumD100HSizeClass]);
-	rfm->fm[EnumD1HSizeClass] = tlag_cls[EnumD1HSizeClass];
-	rfm->fm[EnumD10HSizeClass] = tlag_cls[EnumD10HSizeClass];
-	rfm->fm[EnumD100HSizeClass] = tlag_cls[EnumD100HSizeClass];	
-	rfm->fm[EnumLHSizeClass] = lhfm;
-	rfm->fm[EnumLWSizeClass] = lwfm;
+	/* assign moisture to particles based upon timelag class */
+	tlag_fm[0] = d1hfm;
+	tlag_fm[1] = d10hfm;
+	tlag_fm[2] = d100hfm;
+	wfmd = 	(tlag_fm[fb->tlag[EnumD1HSizeClass]] * fb->effhn[EnumD1HSizeClass] * fb->load[EnumD1HSizeClass]) +
+			(tlag_fm[fb->tlag[EnumD10HSizeClass]] * fb->effhn[EnumD10HSizeClass] * fb->load[EnumD10HSizeClass]) +
+			(tlag_fm[fb->tlag[EnumD100HSizeClass]] * fb->effhn[EnumD100HSizeClass] * fb->load[EnumD100HSizeClass]);
+	rs->fm[EnumD1HSizeClass] = tlag_fm[fb->tlag[EnumD1HSizeClass]];
+	rs->fm[EnumD10HSizeClass] = tlag_fm[fb->tlag[EnumD10HSizeClass]];
+	rs->fm[EnumD100HSizeClass] = tlag_fm[fb->tlag[EnumD100HSizeClass]];	
+	rs->fm[EnumLHSizeClass] = lhfm;
+	rs->fm[EnumLWSizeClass] = lwfm;
 	
 	/* live fuel extinction moisture */
-	if ( UNITS_FP_GT_ZERO(rfm->load[EnumLHSizeClass]) || UNITS_FP_GT_ZERO(rfm->load[EnumLWSizeClass]) )	{
-		if ( UNITS_FP_GT_ZERO(rfm->rp->fdead) )		{
-			fdmois = wfmd / rfm->rp->fdead;
+	if ( UNITS_FP_GT_ZERO(fb->load[EnumLHSizeClass]) || UNITS_FP_GT_ZERO(fb->load[EnumLWSizeClass]) )	{
+		if ( UNITS_FP_GT_ZERO(fb->fdead) )		{
+			fdmois = wfmd / fb->fdead;
 			}
 		else	{
 			fdmois = 0.0;
 			}
-		lmex = ((rfm->rp->lmex * (1.0 - fdmois / rfm->mex)) - 0.226);
-		if ( lmex < rfm->mex )	{
-			lmex = rfm->mex;
+		lmex = ((fb->lmex * (1.0 - fdmois / fb->mex)) - 0.226);
+		if ( lmex < fb->mex )	{
+			lmex = fb->mex;
 			}
 		}
 		
 	/* dead fuel extinction moisture */		
-	dmex = rfm->mex;
+	dmex = fb->mex;
 
 	/* accumulate category weighted moisture */
 	for(i = 0; i < EnumNumSizeClasses; i++)	{
-		qig = 250.0 + 1116.0 * rfm->fm[i];
+		qig = 250.0 + 1116.0 * rs->fm[i];
 		if ( i == EnumLHSizeClass || i == EnumLWSizeClass )	{
-			rbqig += qig * rfm->awtg[i] * rfm->larea * rfm->effhn[i];
+			rbqig += qig * fb->awtg[i] * fb->larea * fb->effhn[i];
 			}
 		else	{
-			rbqig += qig * rfm->awtg[i] * rfm->darea * rfm->effhn[i];
+			rbqig += qig * fb->awtg[i] * fb->darea * fb->effhn[i];
 			}
 		}
-	rbqig *= rfm->fdens;
-	lm = (rfm->awtg[EnumLHSizeClass] * rfm->fm[EnumLHSizeClass]) +
-		 (rfm->awtg[EnumLWSizeClass] * rfm->fm[EnumLWSizeClass]);
-	dm = (rfm->awtg[EnumD1HSizeClass] * rfm->fm[EnumD1HSizeClass]) +
-		 (rfm->awtg[EnumD10HSizeClass] * rfm->fm[EnumD10HSizeClass]) +
-		 (rfm->awtg[EnumD100HSizeClass] * rfm->fm[EnumD100HSizeClass]);
+	rbqig *= fb->fdens;
+	lm = (fb->awtg[EnumLHSizeClass] * rs->fm[EnumLHSizeClass]) +
+		 (fb->awtg[EnumLWSizeClass] * rs->fm[EnumLWSizeClass]);
+	dm = (fb->awtg[EnumD1HSizeClass] * rs->fm[EnumD1HSizeClass]) +
+		 (fb->awtg[EnumD10HSizeClass] * rs->fm[EnumD10HSizeClass]) +
+		 (fb->awtg[EnumD100HSizeClass] * rs->fm[EnumD100HSizeClass]);
 
 	/* reaction intensity contributed by live fuels */
 	ratio = 0.0;
@@ -296,7 +260,7 @@ int Roth1972FireSpreadNoWindNoSlope(RothFuelModel * rfm, double d1hfm, double d1
 	if ( lm >= lmex )	{
 		letam = 0.0;
 		}
-	rfm->rp->rxint += rfm->rp->lrx * letam;
+	rs->rxint += fb->lrx * letam;
 	
 	/* reaction intensity contributed by dead fuels */
 	ratio = 0.0;
@@ -307,28 +271,28 @@ int Roth1972FireSpreadNoWindNoSlope(RothFuelModel * rfm, double d1hfm, double d1
 	if ( dm >= dmex )	{
 		detam = 0.0;
 		}
-	rfm->rp->rxint += rfm->rp->drx * detam;
+	rs->rxint += fb->drx * detam;
 	
 	/* heat per unit area */
-	rfm->rp->hpua = rfm->rp->rxint * rfm->rp->taur;
+	rs->hpua = rs->rxint * fb->taur;
 	
 	/* no wind no slope ros */
 	if ( UNITS_FP_GT_ZERO(rbqig) )	{
-		rfm->rp->ros_0 = rfm->rp->rxint * rfm->rp->ppflux / rbqig;
+		rs->ros_0 = rs->rxint * fb->ppflux / rbqig;
 		}
 	else	{
-		rfm->rp->ros_0 = 0.0;
+		rs->ros_0 = 0.0;
 		}
 		
-	/* zero other ros vars */
-	rfm->rp->ros_max = rfm->rp->ros_0;
-	rfm->rp->ros_any = rfm->rp->ros_0;
-	rfm->rp->ros_az_max = rfm->rp->ros_az_any = 0.0;
+	/* maximum spread is no wind no slope spread until wind and slope applied */
+	rs->ros_max = rs->ros_0;
+	rs->ros_az_max = 0.0;
 	
  	return ERR_SUCCESS;									
  	}
  	
-int Roth1972FireSpreadWindSlopeMax(RothFuelModel * rfm, double wnd_fpm, double wnd_az, double slp_pcnt, double asp, double ell_adj)	{
+int Roth1972SpreadWindSlopeMax(const RothFuelBed * fb, double wnd_fpm, double wnd_az, double slp_pcnt, 
+														double asp, double ell_adj, RothSpread * rs)	{
     double upslp, az_max, phi_ew;
     double split_deg, split_rad;
     double slp_rate, wnd_rate, rv, spread_max;
@@ -337,50 +301,43 @@ int Roth1972FireSpreadWindSlopeMax(RothFuelModel * rfm, double wnd_fpm, double w
     int do_eff_wnd, ck_wnd_lim, wnd_lim;
     
 	/* check args */
-	if ( rfm == NULL ) 	{
-		ERR_ERROR("RothFuelModel not initialized, WindSlopeMax step in FireSpread Pipeline failed. \n", ERR_EINVAL);
-		}
-	if ( rfm->rp == NULL )	{
-		ERR_ERROR("RothPipeline not initialized, WindSlopeMax step in FireSpread Pipeline failed. \n", ERR_EINVAL);
-		}
-	
-	/* return if RothFuelModel represents unburnable fuel */	
-	if ( rfm->brntype == EnumRothUnBurnable )	{
-		return ERR_SUCCESS;
+	if ( fb == NULL || rs == NULL ) 	{
+		ERR_ERROR("Arguments supplied to WindSlopeMax step in FireSpread Pipeline invalid. \n", ERR_EINVAL);
 		}
 	
 	/* check and set pipeline state */
-	if ( rfm->rp->pipe < EnumNoWindNoSlopePipe )	{
+	if ( rs->pipe < EnumNoWindNoSlopePipe )	{
 		ERR_ERROR("NoWindNoSlope step not complete, unable to execute WindSlopeMax. \n", ERR_ESANITY);
 		}
-	rfm->rp->pipe = EnumWindSlopeMaxPipe;
+	rs->pipe = EnumWindSlopeMaxPipe;
 
-	/* convert slope to rise/run and check for change in slope */
+	/* return if RothFuelBed represents unburnable fuel */	
+	if ( fb->unburnable )	{
+		return ERR_SUCCESS;
+		}
+	
+	/* convert slope to rise/run */
 	if ( UNITS_FP_LT_ZERO(slp_pcnt) )	{
 		slp_pcnt = 0.0;
 		}
 	slp_pcnt /= 100.0;
-	if ( !UNITS_FP_ARE_EQUAL(rfm->rp->slp, slp_pcnt) )	{
-		rfm->rp->phi_s = rfm->rp->slp_k * slp_pcnt * slp_pcnt;
-		rfm->rp->slp = slp_pcnt;
-		}
+	rs->phi_s = fb->slp_k * slp_pcnt * slp_pcnt;
+	rs->slp = slp_pcnt;
 		
 	/* convert wind direction from 'out of' to 'to' */
 	wnd_az = ((int)(wnd_az + 180.0)) % 360;
 	
-	/* check for change in windspeed */
-	if ( !UNITS_FP_ARE_EQUAL(rfm->rp->wnd_fpm, wnd_fpm) )	{
-		if ( UNITS_FP_GT_ZERO(wnd_fpm) )	{
-			rfm->rp->phi_w = rfm->rp->wnd_k * pow(wnd_fpm, rfm->rp->wnd_b);
-			}
-		else	{
-			rfm->rp->phi_w = 0.0;
-			}
-		rfm->rp->wnd_fpm = wnd_fpm;
+	/* wind factor */
+	if ( UNITS_FP_GT_ZERO(wnd_fpm) )	{
+		rs->phi_w = fb->wnd_k * pow(wnd_fpm, fb->wnd_b);
+		}
+	else	{
+		rs->phi_w = 0.0;
 		}
+	rs->wnd_fpm = wnd_fpm;
 		
 	/* combine wind and slope */
-	phi_ew = rfm->rp->phi_s + rfm->rp->phi_w;
+	phi_ew = rs->phi_s + rs->phi_w;
 	wnd_lim = 0;
 	lw_ratio = 1.0;
 	eccen = 0.0;
@@ -392,7 +349,7 @@ int Roth1972FireSpreadWindSlopeMax(RothFuelModel * rfm, double wnd_fpm, double w
 		}
 		
 	/* Situation 1: no fire spread or reaction intensity */
-	if ( !UNITS_FP_GT_ZERO(rfm->rp->ros_0) )		{
+	if ( !UNITS_FP_GT_ZERO(rs->ros_0) )		{
 		spread_max = az_max = 0.0;
         eff_wnd = 0.0;
         do_eff_wnd = ck_wnd_lim = 0;
@@ -400,26 +357,26 @@ int Roth1972FireSpreadWindSlopeMax(RothFuelModel * rfm, double wnd_fpm, double w
 	/* Situation 2: no wind and no wind */
 	else if ( !UNITS_FP_GT_ZERO(phi_ew) )	{
         phi_ew = eff_wnd = az_max = 0.0;
-        spread_max = rfm->rp->ros_0;
+        spread_max = rs->ros_0;
         do_eff_wnd = ck_wnd_lim = 0;
 		}
 	/* Situation 3: wind with no slope */
 	else if ( !UNITS_FP_GT_ZERO(slp_pcnt) )	{        
         eff_wnd = wnd_fpm;
 		do_eff_wnd = 0;
-		spread_max = rfm->rp->ros_0 * (1.0 + phi_ew);
+		spread_max = rs->ros_0 * (1.0 + phi_ew);
 		az_max = wnd_az;
         ck_wnd_lim = 1;
         }
 	/* Situation 4: slope with no wind */
 	else if ( !UNITS_FP_GT_ZERO(wnd_fpm) )	{
-		spread_max = rfm->rp->ros_0 * (1.0 + phi_ew);
+		spread_max = rs->ros_0 * (1.0 + phi_ew);
 		az_max = upslp;
         do_eff_wnd = ck_wnd_lim = 1;
 		}
 	/* Situation 5: wind blows upslope */
 	else if ( UNITS_FP_ARE_EQUAL(upslp, wnd_az) )	{        
-		spread_max = rfm->rp->ros_0 * (1.0 + phi_ew);
+		spread_max = rs->ros_0 * (1.0 + phi_ew);
 		az_max = upslp;        
         do_eff_wnd = ck_wnd_lim = 1;        
         }
@@ -433,15 +390,15 @@ int Roth1972FireSpreadWindSlopeMax(RothFuelModel * rfm, double wnd_fpm, double w
         	split_deg = 360.0 - upslp + wnd_az;
         	}
 		split_rad = ROTH_1972_DEG_TO_RAD(split_deg);
-		slp_rate = rfm->rp->ros_0 * rfm->rp->phi_s;
-		wnd_rate = rfm->rp->ros_0 * rfm->rp->phi_w;
+		slp_rate = rs->ros_0 * rs->phi_s;
+		wnd_rate = rs->ros_0 * rs->phi_w;
 		x = slp_rate + wnd_rate * cos(split_rad);
 		y = wnd_rate * sin(split_rad);
 		rv = sqrt( (x * x) + (y * y));
-		spread_max = rfm->rp->ros_0 + rv;
+		spread_max = rs->ros_0 + rv;
 
         /* recalculate phi_ew in the optimal direction */
-        phi_ew = spread_max / rfm->rp->ros_0 - 1.0;
+        phi_ew = spread_max / rs->ros_0 - 1.0;
         if ( UNITS_FP_GT_ZERO(phi_ew) )	{
         	do_eff_wnd = 1;
         	}
@@ -477,20 +434,20 @@ int Roth1972FireSpreadWindSlopeMax(RothFuelModel * rfm, double wnd_fpm, double w
     	
     /* recalculate effective windspeed based upon phi_ew */
     if ( do_eff_wnd )	{
-    	eff_wnd = pow((phi_ew * rfm->rp->wnd_e), (1.0 / rfm->rp->wnd_b));
+    	eff_wnd = pow((phi_ew * fb->wnd_e), (1.0 / fb->wnd_b));
     	}
     	
     /* if effective windspeed excedes max windspeed, scale back */
     if ( ck_wnd_lim )	{
-    	max_wnd = 0.9 * rfm->rp->rxint;
+    	max_wnd = 0.9 * rs->rxint;
     	if ( eff_wnd > max_wnd )	{
     		if ( !UNITS_FP_GT_ZERO(max_wnd) )	{
     			phi_ew = 0.0;
     			}
     		else	{
-    			phi_ew = rfm->rp->wnd_k * pow(max_wnd, rfm->rp->wnd_b);
+    			phi_ew = fb->wnd_k * pow(max_wnd, fb->wnd_b);
     			}
-    		spread_max = rfm->rp->ros_0 * (1.0 + phi_ew);
+    		spread_max = rs->ros_0 * (1.0 + phi_ew);
     		eff_wnd = max_wnd;
     		wnd_lim = 1;
     		}
@@ -503,22 +460,235 @@ int Roth1972FireSpreadWindSlopeMax(RothFuelModel * rfm, double wnd_fpm, double w
 		}
 		
 	/* store results */
-	rfm->rp->asp = asp;
-	rfm->rp->wnd_vec = wnd_az;
-	rfm->rp->phi_ew = phi_ew;
-	rfm->rp->wnd_eff = eff_wnd;
-	rfm->rp->wnd_lim = wnd_lim;
-	rfm->rp->ros_max = rfm->rp->ros_any = spread_max;
-	rfm->rp->ros_az_max = rfm->rp->ros_az_any = az_max;
-	rfm->rp->lwratio = lw_ratio;
-	rfm->rp->eccen = eccen;
+	rs->asp = asp;
+	rs->wnd_vec = wnd_az;
+	rs->phi_ew = phi_ew;
+	rs->wnd_eff = eff_wnd;
+	rs->wnd_lim = wnd_lim;
+	rs->ros_max = spread_max;
+	rs->ros_az_max = az_max;
+	rs->lwratio = lw_ratio;
+	rs->eccen = eccen;
 		
 	return ERR_SUCCESS;
 	}
 
-int Roth1972FireSpreadGetAtAzimuth(RothFuelModel * rfm, double az)	{
+int Roth1972SpreadGetAtAzimuth(const RothSpread * rs, double az, double * ros)	{
 	double dir_deg, dir_rad;
 	
+	/* check args */
+	if ( rs == NULL || ros == NULL ) 	{
+		ERR_ERROR("Arguments supplied to GetAtAzimuth step in FireSpread Pipeline invalid. \n", ERR_EINVAL);
+		}
+	if ( rs->pipe < EnumWindSlopeMaxPipe )	{
+		ERR_ERROR("WindSlopeMax step not complete, unable to execute GetAtAzimuth. \n", ERR_ESANITY);
+		}
+
+	/* no fire spread */
+	if ( !UNITS_FP_GT_ZERO(rs->ros_max) )	{
+		*ros = 0.0;
+		}
+	/* combined wind slope factor is 0 or azimuth in direction of max spread */
+	else if ( !UNITS_FP_GT_ZERO(rs->phi_ew) || UNITS_FP_ARE_EQUAL(rs->ros_az_max, az) ) 	{
+		*ros = rs->ros_max;
+		}
+	/* azimuth not in direction of max spread */
+	else	{
+		/* calculate angle btwn max ros and requested az */
+		if ( (dir_deg = fabs(rs->ros_az_max - az)) > 180.0 )	{
+			dir_deg = 360.0 - dir_deg;
+			}
+		dir_rad = ROTH_1972_DEG_TO_RAD(dir_deg);
+		/* calculate ros in this direction */
+		*ros = rs->ros_max * (1.0 - rs->eccen) / (1.0 - rs->eccen * cos(dir_rad));
+		}
+	
+	return ERR_SUCCESS;
+	}
+
+int Roth1972SpreadGetAtEightNbr(const RothSpread * rs, double * ros)	{
+	double max_rad, cos_max, sin_max, ros_num;
+	int k;
+	
+	/* check args */
+	if ( rs == NULL || ros == NULL ) 	{
+		ERR_ERROR("Arguments supplied to GetAtEightNbr step in FireSpread Pipeline invalid. \n", ERR_EINVAL);
+		}
+	if ( rs->pipe < EnumWindSlopeMaxPipe )	{
+		ERR_ERROR("WindSlopeMax step not complete, unable to execute GetAtEightNbr. \n", ERR_ESANITY);
+		}
+
+	/* no fire spread */
+	if ( !UNITS_FP_GT_ZERO(rs->ros_max) )	{
+		for(k = 0; k < EIGHTNBR_NUM_NBR_CELLS; k++)	{
+			ros[k] = 0.0;
+			}
+		}
+	/* combined wind slope factor is 0 */
+	else if ( !UNITS_FP_GT_ZERO(rs->phi_ew) ) 	{
+		for(k = 0; k < EIGHTNBR_NUM_NBR_CELLS; k++)	{
+			ros[k] = rs->ros_max;
+			}
+		}
+	else	{
+		/* cos(max - az) = cos(max) * cos(az) + sin(max) * sin(az) */
+		max_rad = ROTH_1972_DEG_TO_RAD(rs->ros_az_max);
+		cos_max = cos(max_rad);
+		sin_max = sin(max_rad);
+		ros_num = rs->ros_max * (1.0 - rs->eccen);
+		for(k = 0; k < EIGHTNBR_NUM_NBR_CELLS; k++)	{
+			ros[k] = ros_num / (1.0 - rs->eccen * (cos_max * egtnbr_cos[k] + sin_max * egtnbr_sin[k]));
+			}
+		/* neighbor in direction of max spread */
+		for(k = 0; k < EIGHTNBR_NUM_NBR_CELLS; k++)	{
+			if ( UNITS_FP_ARE_EQUAL(rs->ros_az_max, egtnbr_az[k]) )	{
+				ros[k] = rs->ros_max;
+				}
+			}
+		}
+	
+	return ERR_SUCCESS;
+	}
+
+int Roth1972FireSpreadSetFuelBed(RothFuelModel * rfm)	{
+	/* check args */
+	if ( rfm == NULL ) 	{
+		ERR_ERROR("RothFuelModel not initialized, FuelBed step in FireSpread Pipeline failed. \n", ERR_EINVAL);
+		}
+	if ( rfm->rp == NULL || rfm->fb == NULL )	{
+		ERR_ERROR("RothPipeline not initialized, FuelBed step in FireSpread Pipeline failed. \n", ERR_EINVAL);
+		}
+	
+	/* return if RothFuelModel represents unburnable fuel */	
+	if ( rfm->brntype == EnumRothUnBurnable )	{
+		return ERR_SUCCESS;
+		}
+	
+	/* reset pipeline to defualt state */
+	if ( RothPipelineSetDefaultValues(rfm->rp) )	{
+		ERR_ERROR("FuelBed step in FireSpread Pipeline failed. \n", ERR_EBADFUNC);
+		}
+	
+	/* set pipeline state */
+	rfm->rp->pipe = EnumSetFuelBedPipe;
+		
+	/* all calculations done in ENGLISH units */
+	if ( rfm->units == EnumMetricUnits )	{
+		if ( RothFuelModelMetricToEnglish(rfm) )	{
+			ERR_ERROR("FuelBed step in FireSpread Pipeline failed. \n", ERR_EBADFUNC);
+			}
+		}
+	
+	/* compute the fuel bed */
+	if ( Roth1972FuelBedSet(rfm, rfm->fb) )	{
+		ERR_ERROR("FuelBed step in FireSpread Pipeline failed. \n", ERR_EBADFUNC);
+		}
+	
+	/* mirror fuel bed in pipeline */
+	rfm->rp->lrx = rfm->fb->lrx;
+	rfm->rp->drx = rfm->fb->drx;
+	rfm->rp->taur = rfm->fb->taur;
+	rfm->rp->ppflux = rfm->fb->ppflux;
+	rfm->rp->slp_k = rfm->fb->slp_k;
+	rfm->rp->wnd_b = rfm->fb->wnd_b;
+	rfm->rp->wnd_k = rfm->fb->wnd_k;
+	rfm->rp->wnd_e = rfm->fb->wnd_e;
+	rfm->rp->fdead = rfm->fb->fdead;
+	rfm->rp->lmex = rfm->fb->lmex;
+				
+	return ERR_SUCCESS;
+	}
+
+int Roth1972FireSpreadNoWindNoSlope(RothFuelModel * rfm, double d1hfm, double d10hfm, double d100hfm,
+ 														double lhfm, double lwfm)	{
+	RothSpread rs;
+	int i;
+ 	
+	/* check args */
+	if ( rfm == NULL ) 	{
+		ERR_ERROR("RothFuelModel not initialized, NoWindNoSlope step in FireSpread Pipeline failed. \n", ERR_EINVAL);
+		}
+	if ( rfm->rp == NULL )	{
+		ERR_ERROR("RothPipeline not initialized, NoWindNoSlope step in FireSpread Pipeline failed. \n", ERR_EINVAL);
+		}
+	
+	/* return if RothFuelModel represents unburnable fuel */	
+	if ( rfm->brntype == EnumRothUnBurnable )	{
+		return ERR_SUCCESS;
+		}
+	
+	/* check and set pipeline state */
+	if ( rfm->rp->pipe < EnumSetFuelBedPipe )	{
+		ERR_ERROR("SetFuelBed step not complete, unable to execute NoWindNoSlope. \n", ERR_ESANITY);
+		}
+	rfm->rp->pipe = EnumNoWindNoSlopePipe;
+	
+	/* check for change in moisture */
+	if ( (UNITS_FP_ARE_EQUAL(rfm->rp->d1hfm, d1hfm)) && (UNITS_FP_ARE_EQUAL(rfm->rp->d10hfm, d10hfm)) &&
+		 (UNITS_FP_ARE_EQUAL(rfm->rp->d100hfm, d100hfm)) && (UNITS_FP_ARE_EQUAL(rfm->rp->lhfm, lhfm)) &&
+		 (UNITS_FP_ARE_EQUAL(rfm->rp->lwfm, lwfm)) )	{
+		return ERR_SUCCESS;
+		}
+	
+	/* evaluate the fuel bed */
+	if ( Roth1972SpreadNoWindNoSlope(rfm->fb, d1hfm, d10hfm, d100hfm, lhfm, lwfm, &rs) )	{
+		ERR_ERROR("NoWindNoSlope step in FireSpread Pipeline failed. \n", ERR_EBADFUNC);
+		}
+	
+	/* assign new moistures */
+	rfm->rp->d1hfm = d1hfm;
+	rfm->rp->d10hfm = d10hfm;
+	rfm->rp->d100hfm = d100hfm;
+	rfm->rp->lhfm = lhfm;
+	rfm->rp->lwfm = lwfm;
+	
+	/* store results */
+	rfm->rp->rxint = rs.rxint;
+	rfm->rp->hpua = rs.hpua;
+	rfm->rp->ros_0 = rs.ros_0;
+	rfm->rp->ros_max = rfm->rp->ros_any = rs.ros_0;
+	rfm->rp->ros_az_max = rfm->rp->ros_az_any = 0.0;
+	for(i = 0; i < EnumNumSizeClasses; i++)	{
+		rfm->fm[i] = rs.fm[i];
+		}
+	
+ 	return ERR_SUCCESS;									
+ 	}
+ 	
+int Roth1972FireSpreadWindSlopeMax(RothFuelModel * rfm, double wnd_fpm, double wnd_az, double slp_pcnt, double asp, double ell_adj)	{
+	RothSpread rs;
+    
+	/* check args */
+	if ( rfm == NULL ) 	{
+		ERR_ERROR("RothFuelModel not initialized, WindSlopeMax step in FireSpread Pipeline failed. \n", ERR_EINVAL);
+		}
+	if ( rfm->rp == NULL )	{
+		ERR_ERROR("RothPipeline not initialized, WindSlopeMax step in FireSpread Pipeline failed. \n", ERR_EINVAL);
+		}
+	
+	/* return if RothFuelModel represents unburnable fuel */	
+	if ( rfm->brntype == EnumRothUnBurnable )	{
+		return ERR_SUCCESS;
+		}
+	
+	/* check and set pipeline state */
+	if ( rfm->rp->pipe < EnumNoWindNoSlopePipe )	{
+		ERR_ERROR("NoWindNoSlope step not complete, unable to execute WindSlopeMax. \n", ERR_ESANITY);
+		}
+
+	/* evaluate wind and slope */
+	RothPipelineToSpread(rfm, &rs);
+	if ( Roth1972SpreadWindSlopeMax(rfm->fb, wnd_fpm, wnd_az, slp_pcnt, asp, ell_adj, &rs) )	{
+		ERR_ERROR("WindSlopeMax step in FireSpread Pipeline failed. \n", ERR_EBADFUNC);
+		}
+	RothSpreadToPipeline(&rs, rfm);
+		
+	return ERR_SUCCESS;
+	}
+
+int Roth1972FireSpreadGetAtAzimuth(RothFuelModel * rfm, double az)	{
+	RothSpread rs;
+	
 	/* check args */
 	if ( rfm == NULL ) 	{
 		ERR_ERROR("RothFuelModel not initialized, GetAtAzimuth step in FireSpread Pipeline failed. \n", ERR_EINVAL);
@@ -543,25 +713,66 @@ int Roth1972FireSpreadGetAtAzimuth(RothFuelModel * rfm, double az)	{
 		return ERR_SUCCESS;
 		}
 		
-	/* combined wind slope factor is 0 or azimuth in direction of max spread */
-	if ( !UNITS_FP_GT_ZERO(rfm->rp->phi_ew) || UNITS_FP_ARE_EQUAL(rfm->rp->ros_az_max, az) ) 	{
-		rfm->rp->ros_any = rfm->rp->ros_max;
-		}
-	/* azimuth not in direction of max spread */
-	else	{
-		/* calculate angle btwn max ros and requested az */
-		if ( (dir_deg = fabs(rfm->rp->ros_az_max - az)) > 180.0 )	{
-			dir_deg = 360.0 - dir_deg;
-			}
-		dir_rad = ROTH_1972_DEG_TO_RAD(dir_deg);
-		/* calculate ros in this direction */
-		rfm->rp->ros_any = rfm->rp->ros_max * (1.0 - rfm->rp->eccen) / (1.0 - rfm->rp->eccen * cos(dir_rad));
+	/* calculate ros in requested direction and store azimuth */
+	RothPipelineToSpread(rfm, &rs);
+	if ( Roth1972SpreadGetAtAzimuth(&rs, az, &rfm->rp->ros_any) )	{
+		ERR_ERROR("GetAtAzimuth step in FireSpread Pipeline failed. \n", ERR_EBADFUNC);
 		}
-
-	/* store azimuth */		
 	rfm->rp->ros_az_any = az;
 	
 	return ERR_SUCCESS;
 	}
+
+/*
+ * Copies the per-evaluation members of the RothPipeline of a RothFuelModel to a RothSpread.
+ */
+static void RothPipelineToSpread(RothFuelModel * rfm, RothSpread * rs)	{
+	int i;
+
+	rs->pipe = rfm->rp->pipe;
+	for(i = 0; i < EnumNumSizeClasses; i++)	{
+		rs->fm[i] = rfm->fm[i];
+		}
+	rs->rxint = rfm->rp->rxint;
+	rs->ros_0 = rfm->rp->ros_0;
+	rs->hpua = rfm->rp->hpua;
+	rs->slp = rfm->rp->slp;
+	rs->asp = rfm->rp->asp;
+	rs->wnd_fpm = rfm->rp->wnd_fpm;
+	rs->wnd_vec = rfm->rp->wnd_vec;
+	rs->phi_w = rfm->rp->phi_w;
+	rs->phi_s = rfm->rp->phi_s;
+	rs->phi_ew = rfm->rp->phi_ew;
+	rs->wnd_eff = rfm->rp->wnd_eff;
+	rs->wnd_lim = rfm->rp->wnd_lim;
+	rs->ros_max = rfm->rp->ros_max;
+	rs->ros_az_max = rfm->rp->ros_az_max;
+	rs->lwratio = rfm->rp->lwratio;
+	rs->eccen = rfm->rp->eccen;
+
+	return;
+	}
+
+/*
+ * Copies the results of WindSlopeMax held in a RothSpread to the RothPipeline of a RothFuelModel.
+ */
+static void RothSpreadToPipeline(RothSpread * rs, RothFuelModel * rfm)	{
+	rfm->rp->pipe = rs->pipe;
+	rfm->rp->slp = rs->slp;
+	rfm->rp->phi_s = rs->phi_s;
+	rfm->rp->wnd_fpm = rs->wnd_fpm;
+	rfm->rp->phi_w = rs->phi_w;
+	rfm->rp->asp = rs->asp;
+	rfm->rp->wnd_vec = rs->wnd_vec;
+	rfm->rp->phi_ew = rs->phi_ew;
+	rfm->rp->wnd_eff = rs->wnd_eff;
+	rfm->rp->wnd_lim = rs->wnd_lim;
+	rfm->rp->ros_max = rfm->rp->ros_any = rs->ros_max;
+	rfm->rp->ros_az_max = rfm->rp->ros_az_any = rs->ros_az_max;
+	rfm->rp->lwratio = rs->lwratio;
+	rfm->rp->eccen = rs->eccen;
+
+	return;
+	}
  
 /* end of Roth1972.c */
@@ -34,6 +34,7 @@
 #include "Units.h"
 #include "RothFuelModel.h"
 #include "RothPipeline.h"
+#include "EightNbr.h"
 
 /*
  *********************************************************
@@ -74,6 +75,9 @@
  *	Converts RothFuelModel structure containing individual fuel particles comprising
  *	fuel bed into a single representative fuel bed.
  *	If RothFuelModel units are METRIC, then converts values to ENGLISH.
+ *	The fuel bed is stored in both rfm->fb and rfm->rp.  Steps 2 through 4 of this pipeline
+ *	write to rfm and are not safe to call concurrently on the same RothFuelModel, use
+ *	Roth1972SpreadNoWindNoSlope and related functions with rfm->fb for that purpose.
  *	\sa	RothFuelModel
  *	\param rfm RothFuelModel structure containing fuel particle attributes
  *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
@@ -157,4 +161,111 @@ int Roth1972FireSpreadWindSlopeMax(RothFuelModel * rfm, double wnd_fpm, double w
  */
 int Roth1972FireSpreadGetAtAzimuth(RothFuelModel * rfm, double az);
   
+/*! \fn int Roth1972FuelBedSet(const RothFuelModel * rfm, RothFuelBed * fb)
+ *	\brief Reentrant form of Step 1 of FireSpread Pipeline.
+ *
+ *	Converts RothFuelModel structure containing individual fuel particles comprising
+ *	fuel bed into a single representative fuel bed stored in fb.  RothFuelModel is not modified
+ *	and its units must be ENGLISH.  The resulting RothFuelBed holds everything required by the
+ *	remaining steps and is never written by them, so it may be shared by any number of threads.
+ *	\sa	RothFuelModel, RothFuelBed
+ *	\param rfm RothFuelModel structure containing fuel particle attributes
+ *	\param fb RothFuelBed receiving the representative fuel bed
+ *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
+ *	\note Best use of this facility is as follows:
+ *	\code	
+ *			int error_status = SomeFunctionXXX();
+ *			if ( error_status )
+ *				// something bad happened
+ *	\endcode
+ */
+int Roth1972FuelBedSet(const RothFuelModel * rfm, RothFuelBed * fb);
+
+/*! \fn int Roth1972SpreadNoWindNoSlope(const RothFuelBed * fb, double d1hfm, double d10hfm, double d100hfm, double lhfm, double lwfm, RothSpread * rs)
+ *	\brief Reentrant form of Step 2 of FireSpread Pipeline.
+ *
+ *	Calculates the NoWind-NoSlope rate of spread through the fuel bed and stores the result
+ *	in the caller owned RothSpread.  Any previous contents of rs are discarded.
+ *	\sa	RothFuelBed, RothSpread
+ *	\param fb RothFuelBed initialized by Roth1972FuelBedSet
+ *	\param d1hfm dead 1 hour fuel moisture
+ *	\param d10hfm dead 10 hour fuel moisture 
+ *	\param d100hfm dead 100 hour fuel moisture 
+ *	\param lhfm live herb fuel moisture 
+ *	\param lwfm live woody fuel moisture 
+ *	\param rs RothSpread receiving results
+ *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
+ *	\note Best use of this facility is as follows:
+ *	\code	
+ *			int error_status = SomeFunctionXXX();
+ *			if ( error_status )
+ *				// something bad happened
+ *	\endcode
+ */
+int Roth1972SpreadNoWindNoSlope(const RothFuelBed * fb, double d1hfm, double d10hfm, double d100hfm, 
+														double lhfm, double lwfm, RothSpread * rs);
+
+/*! \fn int Roth1972SpreadWindSlopeMax(const RothFuelBed * fb, double wnd_fpm, double wnd_az, double slp_pcnt, double asp, double ell_adj, RothSpread * rs)
+ *	\brief Reentrant form of Step 3 of FireSpread Pipeline.
+ *
+ *	Calculates the maximum rate of spread through the fuel bed given the supplied
+ *	wind and slope related arguments.  Roth1972SpreadNoWindNoSlope must have been called with rs.
+ *	\sa	RothFuelBed, RothSpread
+ *	\param fb RothFuelBed initialized by Roth1972FuelBedSet
+ *	\param wnd_fpm midflame windspeed in ft/min
+ *	\param wnd_az azimuth from which wind is coming (same as measured by RAWS)
+ *	\param slp_pcnt slope percent (as whole number eg 100 corresponds to 100% slope)
+ *	\param asp aspect (eg direction of maximum rate of change of slope aka downslope)
+ *	\param ell_adj fire ellipse adjustment factor, < 1.0 = more circular, > 1.0 = more elliptical  
+ *	\param rs RothSpread holding results of step 2, receives results of step 3
+ *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
+ *	\note Best use of this facility is as follows:
+ *	\code	
+ *			int error_status = SomeFunctionXXX();
+ *			if ( error_status )
+ *				// something bad happened
+ *	\endcode
+ */
+int Roth1972SpreadWindSlopeMax(const RothFuelBed * fb, double wnd_fpm, double wnd_az, double slp_pcnt, 
+														double asp, double ell_adj, RothSpread * rs);
+
+/*! \fn int Roth1972SpreadGetAtAzimuth(const RothSpread * rs, double az, double * ros)
+ *	\brief Reentrant form of Step 4 of FireSpread Pipeline.
+ *
+ *	Calculates the rate of spread in the direction specified as an argument.
+ *	Roth1972SpreadWindSlopeMax must have been called with rs, which is not modified.
+ *	\sa	RothSpread
+ *	\param rs RothSpread holding results of step 3
+ *	\param az azimuth in the direction which rate-of-spread is calculated	 
+ *	\param ros rate of spread at az in ft/min
+ *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
+ *	\note Best use of this facility is as follows:
+ *	\code	
+ *			int error_status = SomeFunctionXXX();
+ *			if ( error_status )
+ *				// something bad happened
+ *	\endcode
+ */
+int Roth1972SpreadGetAtAzimuth(const RothSpread * rs, double az, double * ros);
+
+/*! \fn int Roth1972SpreadGetAtEightNbr(const RothSpread * rs, double * ros)
+ *	\brief Reentrant form of Step 4 of FireSpread Pipeline evaluated toward every neighbor.
+ *
+ *	Calculates the rate of spread at each azimuth of EightNbr in a single pass.  The cosine of the 
+ *	angle between the direction of maximum spread and each neighbor is formed from the precomputed 
+ *	sine and cosine of the neighbor azimuths, so only one sine and cosine are evaluated per call.
+ *	Roth1972SpreadWindSlopeMax must have been called with rs, which is not modified.
+ *	\sa	RothSpread, Roth1972SpreadGetAtAzimuth
+ *	\param rs RothSpread holding results of step 3
+ *	\param ros array of EIGHTNBR_NUM_NBR_CELLS receiving rate of spread toward each neighbor in ft/min
+ *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
+ *	\note Best use of this facility is as follows:
+ *	\code	
+ *			int error_status = SomeFunctionXXX();
+ *			if ( error_status )
+ *				// something bad happened
+ *	\endcode
+ */
+int Roth1972SpreadGetAtEightNbr(const RothSpread * rs, double * ros);
+  
 #endif Roth1972_H		/* end of Roth1972.h */
@@ -46,9 +46,15 @@ RothFuelModel * InitRothFuelModelEmpty()	{
 		rfm->larea = rfm->darea = 0.0;
 		rfm->fm[i] = 0.0;
 		}
+	rfm->fb = NULL;
 	if ( (rfm->rp = InitRothPipelineEmpty()) == NULL )	{
 		free(rfm);
-		return rfm;
+		return NULL;
+		}
+	if ( (rfm->fb = InitRothFuelBedEmpty()) == NULL )	{
+		FreeRothPipeline(rfm->rp);
+		free(rfm);
+		return NULL;
 		}
 		
 	return rfm;
@@ -499,6 +505,9 @@ void FreeRothFuelModel(void * vptr)	{
  			if ( rfm->rp != NULL )	{
  				FreeRothPipeline(rfm->rp);
  				}
+ 			if ( rfm->fb != NULL )	{
+ 				FreeRothFuelBed(rfm->fb);
+ 				}
  			free(rfm);
  			}
  		} 	
@@ -184,6 +184,8 @@ struct RothFuelModel_	{
 	float fm	[EnumNumSizeClasses];		
 	/*! scratch vars for rate-of-spread calcs */
 	RothPipeline * rp;						
+	/*! representative fuel bed, read-only once set by step 1 of pipeline */
+	RothFuelBed * fb;
 	};
 	 
 /*
@@ -62,6 +62,74 @@ int RothPipelineSetDefaultValues(RothPipeline * rp)	{
 	return ERR_SUCCESS;
 	}
 
+RothFuelBed * InitRothFuelBedEmpty()	{
+	RothFuelBed * fb = NULL;
+	
+	if ( (fb = (RothFuelBed *) malloc(sizeof(RothFuelBed))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to allocate memory for RothFuelBed. \n", ERR_ENOMEM);
+		return fb;
+		}
+		
+	if ( RothFuelBedSetDefaultValues(fb) )	{
+		ERR_ERROR_CONTINUE("Initialization of RothFuelBed failed. \n", ERR_EBADFUNC);
+		}
+	
+	return fb;
+	}
+
+int RothFuelBedSetDefaultValues(RothFuelBed * fb)	{
+	int i;
+
+	if ( fb == NULL )	{
+		ERR_ERROR("RothFuelBed not initialized, unable to set default values. \n", ERR_EINVAL);
+		}
+
+	fb->unburnable = 1;
+	fb->mex = fb->fdens = fb->larea = fb->darea = 0.0;
+	for(i = 0; i < EnumNumSizeClasses; i++)	{
+		fb->load[i] = fb->effhn[i] = fb->awtg[i] = 0.0;
+		fb->tlag[i] = 0;
+		}
+    fb->drx = fb->lrx = 0.0;
+    fb->fdead = fb->lmex = fb->taur = 0.0;
+    fb->ppflux = fb->slp_k = fb->wnd_b = fb->wnd_e = fb->wnd_k = 0.0;
+		
+	return ERR_SUCCESS;
+	}
+
+int RothSpreadSetDefaultValues(RothSpread * rs)	{
+	int i;
+
+	if ( rs == NULL )	{
+		ERR_ERROR("RothSpread not initialized, unable to set default values. \n", ERR_EINVAL);
+		}
+
+    rs->pipe = EnumInitPipe;
+	for(i = 0; i < EnumNumSizeClasses; i++)	{
+		rs->fm[i] = 0.0;
+		}
+    rs->rxint = rs->ros_0 = rs->hpua = 0.0;
+    rs->slp = rs->asp = rs->wnd_fpm = rs->wnd_vec = 0.0;
+    rs->phi_w = rs->phi_s = rs->phi_ew = 0.0;
+    rs->wnd_eff = 0.0;
+    rs->wnd_lim = ROTH_PIPELINE_NO_WIND_LIMIT;
+    rs->ros_max = rs->ros_az_max = 0.0;
+    rs->lwratio = 1.0;
+    rs->eccen = 0.0;
+		
+	return ERR_SUCCESS;
+	}
+
+void FreeRothFuelBed(void * vptr)	{
+	RothFuelBed * fb = NULL;
+ 	if ( vptr != NULL )	{
+ 		fb = (RothFuelBed *) vptr;
+ 		free(fb);
+ 		}
+ 	fb = NULL;
+ 	return;	
+ 	}
+
 void FreeRothPipeline(void * vptr)	{
 	RothPipeline * rp = NULL;
  	if ( vptr != NULL )	{
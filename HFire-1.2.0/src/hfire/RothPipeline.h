@@ -29,6 +29,7 @@
 #include <stdlib.h>
 
 #include "Err.h"
+#include "FuelSizeClasses.h"
 
 /*
  *********************************************************
@@ -152,6 +153,109 @@ struct RothPipeline_	{
     double ros_az_any;			
 	};
 	 
+/*! Type name for RothFuelBed_ 
+ *	\sa For a list of members goto RothFuelBed_
+ */
+typedef struct RothFuelBed_ RothFuelBed;
+
+/*! \struct RothFuelBed_ RothPipeline.h "RothPipeline.h"
+ *	\brief structure used to store the representative fuel bed computed in step 1 of the pipeline
+ *
+ *	Values depend only upon the attributes of the fuel particles and never change once the
+ *	fuel bed has been set, so a single RothFuelBed may be read by any number of threads.
+ *	Units are always ENGLISH.
+ */
+struct RothFuelBed_	{
+	/*! is fuel bed unburnable (1) or burnable (0) */
+	int unburnable;
+	/*! dead fuel extinction moisture (fraction odw) */
+	float mex;
+	/*! fuel bed bulk density (lb/ft^3) */
+	float fdens;
+	/*! awtg contributed by live fuels */
+	float larea;
+	/*! awtg contributed by dead fuels */
+	float darea;
+	/*! particle load (lb/ft^2) */
+	float load	[EnumNumSizeClasses];
+	/*! particle effective heating number */
+	float effhn	[EnumNumSizeClasses];
+	/*! particle surface area weighting factor */
+	float awtg	[EnumNumSizeClasses];
+	/*! timelag class (0 = 1h, 1 = 10h, 2 = 100h) used to assign moisture to each particle */
+	int   tlag	[EnumNumSizeClasses];
+	/*! dead fuel rx factors	*/
+	double drx;
+	/*! live fuel rx factors */
+	double lrx;	
+	/*! fine dead fuel ratio */				
+    double fdead;
+    /*! live fuel moisture extinction factor */
+    double lmex;
+    /*! residence time (min) */
+    double taur;
+    /*! propagating flux ratio */
+    double ppflux;
+    /*! slope parameter 'k' */				
+	double slp_k;
+	/*! wind parameter 'b' */				
+	double wnd_b;
+	/*! wind parameter (ratio**e/c) */				
+	double wnd_e;
+	/*! wind parameter (c * ratio**-e) */
+	double wnd_k;
+	};
+
+/*! Type name for RothSpread_ 
+ *	\sa For a list of members goto RothSpread_
+ */
+typedef struct RothSpread_ RothSpread;
+
+/*! \struct RothSpread_ RothPipeline.h "RothPipeline.h"
+ *	\brief structure used to store the results of steps 2 and 3 of the pipeline for one evaluation
+ *
+ *	Owned by the caller, typically on the stack, so that concurrent evaluations of the same
+ *	RothFuelBed never share any writable state.
+ */
+struct RothSpread_	{
+	/*! last step completed */
+    EnumFireSpreadPipe pipe;
+	/*! moisture assigned to each fuel particle (fraction odw) */
+	float fm	[EnumNumSizeClasses];
+    /*! reaction intensity (BTU/sqft/min) */
+    double rxint;
+    /*! no-wind, no-slope spread rate (ft/min) */               
+    double ros_0;             
+    /*! heat per unit area (BTU/sqft) */	
+    double hpua;                
+	/*! slope (rise/run)	*/
+    double slp;					
+	/*! aspect (downslope) azimuth (compass degs) */
+    double asp;					
+	/*! wind speed (ft/min) */
+    double wnd_fpm;				
+	/*! direction wind blows toward (compass degs) */
+    double wnd_vec;				
+	/*! wind factor */
+	double phi_w;				
+	/*! slope factor	*/
+	double phi_s;				
+	/*! combined wind-slope factor */
+	double phi_ew;				
+    /*! effective windspeed */
+    double wnd_eff;            	
+	/*! is wind limit reached on rate-of-spread	*/
+	int    wnd_lim;				
+    /*! spread in direction of max spread (ft/min) */
+    double ros_max;           	
+    /*! direction of maximum spread (degrees) */
+    double ros_az_max;          
+    /*! length-to-width ratio for eff windspeed */
+    double lwratio;             
+	/*! eccentricity of ellipse for eff windspeed */
+	double eccen;				
+	};
+	 
 /*
  *********************************************************
  * MACROS
@@ -187,6 +291,52 @@ RothPipeline * InitRothPipelineEmpty();
  */
 int RothPipelineSetDefaultValues(RothPipeline * rp);
 
+/*! \fn RothFuelBed * InitRothFuelBedEmpty()
+ * 	\brief Initilizes an empty RothFuelBed
+ *
+ * 	\sa RothFuelBed
+ * 	\retval RothFuelBed* Ptr to RothFuelBed structure attributes initilized to default values.
+ */
+RothFuelBed * InitRothFuelBedEmpty();
+
+/*! \fn int RothFuelBedSetDefaultValues(RothFuelBed * fb)
+ * 	\brief Clears RothFuelBed to default values, which describe an unburnable fuel bed.
+ *
+ * 	\param fb RothFuelBed which has already been initialized
+ *	\sa RothFuelBed
+ *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
+ *	\note Best use of this facility is as follows:
+ *	\code	
+ *			int error_status = SomeFunctionXXX();
+ *			if ( error_status )
+ *				// something bad happened
+ *	\endcode
+ */
+int RothFuelBedSetDefaultValues(RothFuelBed * fb);
+
+/*! \fn int RothSpreadSetDefaultValues(RothSpread * rs)
+ * 	\brief Clears RothSpread to default values, which describe no fire spread.
+ *
+ * 	\param rs RothSpread owned by caller
+ *	\sa RothSpread
+ *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
+ *	\note Best use of this facility is as follows:
+ *	\code	
+ *			int error_status = SomeFunctionXXX();
+ *			if ( error_status )
+ *				// something bad happened
+ *	\endcode
+ */
+int RothSpreadSetDefaultValues(RothSpread * rs);
+
+/*! \fn void FreeRothFuelBed(void * vptr)
+ * 	\brief Frees memory associated with RothFuelBed structure.
+ * 
+ *	\sa RothFuelBed
+ * 	\param vptr ptr to RothFuelBed
+ */	
+void FreeRothFuelBed(void * vptr);
+
 /*! \fn void FreeRothPipeline(void * vptr)
  * 	\brief Frees memory associated with RothPipeline structure.
  * 
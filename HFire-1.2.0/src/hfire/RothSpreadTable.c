@@ -0,0 +1,287 @@
+/*!
+ * \file RothSpreadTable.c
+ *
+ * \author Marco Morais
+ * \date 2000-2001
+ *
+ *	HFire (Highly Optmized Tolerance Fire Spread Model) Library
+ *	Copyright (C) 2001 Marco Morais
+ *
+ *	This library is free software; you can redistribute it and/or
+ *	modify it under the terms of the GNU Lesser General Public
+ *	License as published by the Free Software Foundation; either
+ *	version 2.1 of the License, or (at your option) any later version.
+ *
+ *	This library is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *	Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public
+ *	License along with this library; if not, write to the Free Software
+ *	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "RothSpreadTable.h"
+
+static int RothSpreadTableCompute(const RothFuelBed * fb, double d1hfm, double d10hfm, double d100hfm,
+						double lhfm, double lwfm, double wnd_fpm, double wnd_az, double slp_pcnt, double asp,
+						double ell_adj, RothSpreadLookup * lk);
+static void RothSpreadTableValidate(RothSpreadTableStats * st, double max_rel_err,
+						RothSpreadLookup * approx, RothSpreadLookup * exact);
+
+RothSpreadTable * InitRothSpreadTable(int num_workers, int num_fuel_models, int entries_per_fm,
+										double moist_step, double wsp_step, double az_step, double slp_step,
+										double ell_adj, int validate, double max_rel_err)	{
+	RothSpreadTable * rst = NULL;
+	int i;
+
+	/* check args */
+	if ( num_workers < 1 || num_fuel_models < 1 || entries_per_fm < 1 )	{
+		ERR_ERROR_CONTINUE("Size of RothSpreadTable invalid. \n", ERR_EINVAL);
+		return rst;
+		}
+	if ( !UNITS_FP_GT_ZERO(moist_step) || !UNITS_FP_GT_ZERO(wsp_step)
+			|| !UNITS_FP_GT_ZERO(az_step) || !UNITS_FP_GT_ZERO(slp_step) )	{
+		ERR_ERROR_CONTINUE("Quantization steps of RothSpreadTable must be greater than zero. \n", ERR_EINVAL);
+		return rst;
+		}
+
+	if ( (rst = (RothSpreadTable *) malloc(sizeof(RothSpreadTable))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to allocate memory for RothSpreadTable. \n", ERR_ENOMEM);
+		return rst;
+		}
+
+	/* table size is a power of 2 so slots are selected by masking hash */
+	rst->num_workers = num_workers;
+	rst->num_entries = 1;
+	while ( rst->num_entries < num_fuel_models * entries_per_fm && rst->num_entries < (1 << 30) )	{
+		rst->num_entries <<= 1;
+		}
+	rst->mask = (unsigned long) rst->num_entries - 1;
+	rst->moist_step = moist_step / 100.0;
+	rst->wsp_step = UNITS_MPSEC_TO_FTPMIN(wsp_step);
+	rst->az_step = az_step;
+	rst->slp_step = slp_step;
+	rst->ell_adj = ell_adj;
+	rst->validate = validate;
+	rst->max_rel_err = max_rel_err;
+	rst->entries = NULL;
+	rst->stats = NULL;
+
+	if ( (rst->entries = (RothSpreadTableEntry **) calloc(num_workers, sizeof(RothSpreadTableEntry *))) == NULL
+			|| (rst->stats = (RothSpreadTableStats *) calloc(num_workers, sizeof(RothSpreadTableStats))) == NULL )	{
+		FreeRothSpreadTable(rst);
+		ERR_ERROR_CONTINUE("Unable to allocate memory for RothSpreadTable. \n", ERR_ENOMEM);
+		return NULL;
+		}
+	for(i = 0; i < num_workers; i++)	{
+		/* calloc leaves every slot invalid */
+		if ( (rst->entries[i] = (RothSpreadTableEntry *) calloc(rst->num_entries, sizeof(RothSpreadTableEntry))) == NULL )	{
+			FreeRothSpreadTable(rst);
+			ERR_ERROR_CONTINUE("Unable to allocate memory for RothSpreadTable entries. \n", ERR_ENOMEM);
+			return NULL;
+			}
+		}
+
+	return rst;
+	}
+
+int RothSpreadTableGet(RothSpreadTable * rst, int worker, int fmnum, const RothFuelBed * fb,
+						double d1hfm, double d10hfm, double d100hfm, double lhfm, double lwfm,
+						double wnd_fpm, double wnd_az, double slp_pcnt, double asp, RothSpreadLookup * lk)	{
+	int key[ROTH_SPREAD_TABLE_KEY_SIZE];
+	unsigned long h;
+	RothSpreadTableEntry * ent = NULL;
+	RothSpreadLookup exact;
+	int i;
+
+	/* check args */
+	if ( rst == NULL || fb == NULL || lk == NULL || worker < 0 || worker >= rst->num_workers )	{
+		ERR_ERROR("Arguments supplied to retrieve rate of spread from RothSpreadTable invalid. \n", ERR_EINVAL);
+		}
+
+	/* quantize inputs */
+	key[0] = fmnum;
+	key[1] = (int) floor(d1hfm / rst->moist_step + 0.5);
+	key[2] = (int) floor(d10hfm / rst->moist_step + 0.5);
+	key[3] = (int) floor(d100hfm / rst->moist_step + 0.5);
+	key[4] = (int) floor(lhfm / rst->moist_step + 0.5);
+	key[5] = (int) floor(lwfm / rst->moist_step + 0.5);
+	key[6] = (int) floor(wnd_fpm / rst->wsp_step + 0.5);
+	key[7] = (int) floor(wnd_az / rst->az_step + 0.5);
+	key[8] = (int) floor(slp_pcnt / rst->slp_step + 0.5);
+	key[9] = (int) floor(asp / rst->az_step + 0.5);
+
+	/* select slot */
+	h = 0;
+	for(i = 0; i < ROTH_SPREAD_TABLE_KEY_SIZE; i++)	{
+		h = ((h ^ (unsigned long) key[i]) * 2654435761UL) & 0xFFFFFFFFUL;
+		}
+	ent = &rst->entries[worker][(h ^ (h >> 15)) & rst->mask];
+
+	/* test for hit */
+	if ( ent->valid )	{
+		for(i = 0; i < ROTH_SPREAD_TABLE_KEY_SIZE; i++)	{
+			if ( ent->key[i] != key[i] )	{
+				break;
+				}
+			}
+		}
+	if ( ent->valid && i == ROTH_SPREAD_TABLE_KEY_SIZE )	{
+		rst->stats[worker].hits++;
+		}
+	/* compute new entry at quantized inputs, replacing any previous occupant */
+	else	{
+		rst->stats[worker].misses++;
+		ent->valid = 0;
+		if ( RothSpreadTableCompute(fb, key[1] * rst->moist_step, key[2] * rst->moist_step,
+				key[3] * rst->moist_step, key[4] * rst->moist_step, key[5] * rst->moist_step,
+				key[6] * rst->wsp_step, key[7] * rst->az_step, key[8] * rst->slp_step, key[9] * rst->az_step,
+				rst->ell_adj, &ent->val) )	{
+			ERR_ERROR("Unable to compute RothSpreadTable entry. \n", ERR_EBADFUNC);
+			}
+		for(i = 0; i < ROTH_SPREAD_TABLE_KEY_SIZE; i++)	{
+			ent->key[i] = key[i];
+			}
+		ent->valid = 1;
+		}
+
+	/* return table value, or exact value when validating */
+	if ( rst->validate )	{
+		if ( RothSpreadTableCompute(fb, d1hfm, d10hfm, d100hfm, lhfm, lwfm,
+				wnd_fpm, wnd_az, slp_pcnt, asp, rst->ell_adj, &exact) )	{
+			ERR_ERROR("Unable to compute exact rate of spread to validate RothSpreadTable. \n", ERR_EBADFUNC);
+			}
+		RothSpreadTableValidate(&rst->stats[worker], rst->max_rel_err, &ent->val, &exact);
+		*lk = exact;
+		}
+	else	{
+		*lk = ent->val;
+		}
+
+	return ERR_SUCCESS;
+	}
+
+void RothSpreadTableDumpStats(RothSpreadTable * rst, FILE * fstream)	{
+	RothSpreadTableStats tot;
+	double lookups;
+	int i;
+
+	if ( rst == NULL || fstream == NULL )	{
+		return;
+		}
+
+	/* sum the counters of every worker */
+	tot.hits = tot.misses = tot.num_validated = tot.num_exceeded = 0.0;
+	tot.max_abs_err = tot.max_rel_err = 0.0;
+	for(i = 0; i < rst->num_workers; i++)	{
+		tot.hits += rst->stats[i].hits;
+		tot.misses += rst->stats[i].misses;
+		tot.num_validated += rst->stats[i].num_validated;
+		tot.num_exceeded += rst->stats[i].num_exceeded;
+		if ( rst->stats[i].max_abs_err > tot.max_abs_err )	{
+			tot.max_abs_err = rst->stats[i].max_abs_err;
+			}
+		if ( rst->stats[i].max_rel_err > tot.max_rel_err )	{
+			tot.max_rel_err = rst->stats[i].max_rel_err;
+			}
+		}
+	lookups = tot.hits + tot.misses;
+
+	fprintf(fstream, "ROS TABLE... ENTRIES: %d WORKERS: %d LOOKUPS: %.0f HITS: %.0f HIT RATE: %.2f%% \n",
+		rst->num_entries, rst->num_workers, lookups, tot.hits,
+		(lookups > 0.0) ? (100.0 * tot.hits / lookups) : 0.0);
+	if ( rst->validate )	{
+		fprintf(fstream, "ROS TABLE VALIDATION... MAX ABS ERR: %g MPS MAX REL ERR: %g EXCEEDED %g: %.0f OF %.0f \n",
+			UNITS_FTPMIN_TO_MPSEC(tot.max_abs_err), tot.max_rel_err, rst->max_rel_err,
+			tot.num_exceeded, tot.num_validated);
+		}
+
+	return;
+	}
+
+void FreeRothSpreadTable(void * vptr)	{
+	RothSpreadTable * rst = NULL;
+	int i;
+
+	if ( vptr != NULL )	{
+		rst = (RothSpreadTable *) vptr;
+		if ( rst->entries != NULL )	{
+			for(i = 0; i < rst->num_workers; i++)	{
+				if ( rst->entries[i] != NULL )	{
+					free(rst->entries[i]);
+					}
+				}
+			free(rst->entries);
+			}
+		if ( rst->stats != NULL )	{
+			free(rst->stats);
+			}
+		free(rst);
+		}
+	rst = NULL;
+	return;
+	}
+
+/*
+ * Computes the maximum rate of spread and the rate of spread toward every neighbor with
+ * the reentrant Rothermel functions.
+ */
+int RothSpreadTableCompute(const RothFuelBed * fb, double d1hfm, double d10hfm, double d100hfm,
+						double lhfm, double lwfm, double wnd_fpm, double wnd_az, double slp_pcnt, double asp,
+						double ell_adj, RothSpreadLookup * lk)	{
+	RothSpread rs;
+
+	if ( Roth1972SpreadNoWindNoSlope(fb, d1hfm, d10hfm, d100hfm, lhfm, lwfm, &rs)
+			|| Roth1972SpreadWindSlopeMax(fb, wnd_fpm, wnd_az, slp_pcnt, asp, ell_adj, &rs) )	{
+		ERR_ERROR("Unable to compute rate of spread for RothSpreadTable. \n", ERR_EBADFUNC);
+		}
+	lk->ros_max = rs.ros_max;
+	lk->ros_az_max = rs.ros_az_max;
+	lk->eccen = rs.eccen;
+	if ( Roth1972SpreadGetAtEightNbr(&rs, lk->ros_nbr) )	{
+		ERR_ERROR("Unable to compute rate of spread for RothSpreadTable. \n", ERR_EBADFUNC);
+		}
+
+	return ERR_SUCCESS;
+	}
+
+/*
+ * Accumulates the error of a table value relative to the exact value.  Rates of spread
+ * are compared in the direction of maximum spread and toward every neighbor.
+ */
+void RothSpreadTableValidate(RothSpreadTableStats * st, double max_rel_err,
+						RothSpreadLookup * approx, RothSpreadLookup * exact)	{
+	double abs_err, rel_err, worst_rel_err;
+	int i;
+
+	worst_rel_err = 0.0;
+	for(i = -1; i < EIGHTNBR_NUM_NBR_CELLS; i++)	{
+		if ( i < 0 )	{
+			abs_err = fabs(approx->ros_max - exact->ros_max);
+			rel_err = UNITS_FP_GT_ZERO(exact->ros_max) ? abs_err / exact->ros_max : 0.0;
+			}
+		else	{
+			abs_err = fabs(approx->ros_nbr[i] - exact->ros_nbr[i]);
+			rel_err = UNITS_FP_GT_ZERO(exact->ros_nbr[i]) ? abs_err / exact->ros_nbr[i] : 0.0;
+			}
+		if ( abs_err > st->max_abs_err )	{
+			st->max_abs_err = abs_err;
+			}
+		if ( rel_err > worst_rel_err )	{
+			worst_rel_err = rel_err;
+			}
+		}
+	if ( worst_rel_err > st->max_rel_err )	{
+		st->max_rel_err = worst_rel_err;
+		}
+	if ( worst_rel_err > max_rel_err )	{
+		st->num_exceeded++;
+		}
+	st->num_validated++;
+
+	return;
+	}
+
+/* end of RothSpreadTable.c */
@@ -0,0 +1,264 @@
+/*!
+ * \file RothSpreadTable.h
+ * \brief Table of precomputed Rothermel rate of spread keyed on quantized fuel moisture, wind, and terrain.
+ *
+ * \sa For more information consult Roth1972
+ * \author Marco Morais
+ * \date 2000-2001
+ *
+ *	HFire (Highly Optmized Tolerance Fire Spread Model) Library
+ *	Copyright (C) 2001 Marco Morais
+ *
+ *	This library is free software; you can redistribute it and/or
+ *	modify it under the terms of the GNU Lesser General Public
+ *	License as published by the Free Software Foundation; either
+ *	version 2.1 of the License, or (at your option) any later version.
+ *
+ *	This library is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *	Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public
+ *	License along with this library; if not, write to the Free Software
+ *	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef	RothSpreadTable_H
+#define RothSpreadTable_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+
+#include "Err.h"
+#include "Units.h"
+#include "EightNbr.h"
+#include "RothPipeline.h"
+#include "Roth1972.h"
+
+/*
+ *********************************************************
+ * DEFINES, ENUMS
+ *********************************************************
+ */
+
+/*! \def ROTH_SPREAD_TABLE_KEY_SIZE
+ *	\brief number of quantized values identifying an entry: fuel model, 5 moistures, wind speed, wind azimuth, slope, aspect
+ */
+#define ROTH_SPREAD_TABLE_KEY_SIZE					(10)
+
+/*! \def ROTH_SPREAD_TABLE_DEFAULT_ENTRIES
+ *	\brief default number of entries per fuel model
+ */
+#define ROTH_SPREAD_TABLE_DEFAULT_ENTRIES			(4096)
+
+/*! \def ROTH_SPREAD_TABLE_DEFAULT_MOIST_STEP
+ *	\brief default quantization of fuel moistures (percent)
+ */
+#define ROTH_SPREAD_TABLE_DEFAULT_MOIST_STEP		(0.5)
+
+/*! \def ROTH_SPREAD_TABLE_DEFAULT_WSP_STEP
+ *	\brief default quantization of midflame wind speed (m/s)
+ */
+#define ROTH_SPREAD_TABLE_DEFAULT_WSP_STEP			(0.01)
+
+/*! \def ROTH_SPREAD_TABLE_DEFAULT_AZ_STEP
+ *	\brief default quantization of wind azimuth and aspect (degrees)
+ */
+#define ROTH_SPREAD_TABLE_DEFAULT_AZ_STEP			(1.0)
+
+/*! \def ROTH_SPREAD_TABLE_DEFAULT_SLP_STEP
+ *	\brief default quantization of slope (percent)
+ */
+#define ROTH_SPREAD_TABLE_DEFAULT_SLP_STEP			(1.0)
+
+/*! \def ROTH_SPREAD_TABLE_DEFAULT_MAX_REL_ERR
+ *	\brief default relative error in rate of spread above which validation reports a lookup
+ */
+#define ROTH_SPREAD_TABLE_DEFAULT_MAX_REL_ERR		(0.01)
+
+/*
+ *********************************************************
+ * STRUCTS, TYPEDEFS
+ *********************************************************
+ */
+
+/*! Type name for RothSpreadLookup_
+ *	\sa For a list of members goto RothSpreadLookup_
+ */
+typedef struct RothSpreadLookup_ RothSpreadLookup;
+
+/*! \struct RothSpreadLookup_ RothSpreadTable.h "RothSpreadTable.h"
+ *	\brief rate of spread from a cell in the direction of maximum spread and toward each of its neighbors
+ */
+struct RothSpreadLookup_	{
+	/*! spread in direction of max spread (ft/min) */
+	double ros_max;
+	/*! direction of maximum spread (degrees) */
+	double ros_az_max;
+	/*! eccentricity of fire ellipse */
+	double eccen;
+	/*! spread toward each neighbor in EightNbr order (ft/min) */
+	double ros_nbr[EIGHTNBR_NUM_NBR_CELLS];
+	};
+
+/*! Type name for RothSpreadTableEntry_
+ *	\sa For a list of members goto RothSpreadTableEntry_
+ */
+typedef struct RothSpreadTableEntry_ RothSpreadTableEntry;
+
+/*! \struct RothSpreadTableEntry_ RothSpreadTable.h "RothSpreadTable.h"
+ *	\brief single slot in a RothSpreadTable
+ */
+struct RothSpreadTableEntry_	{
+	/*! slot holds a value (1) or is empty (0) */
+	int valid;
+	/*! quantized inputs */
+	int key[ROTH_SPREAD_TABLE_KEY_SIZE];
+	/*! rate of spread computed at the quantized inputs */
+	RothSpreadLookup val;
+	};
+
+/*! Type name for RothSpreadTableStats_
+ *	\sa For a list of members goto RothSpreadTableStats_
+ */
+typedef struct RothSpreadTableStats_ RothSpreadTableStats;
+
+/*! \struct RothSpreadTableStats_ RothSpreadTable.h "RothSpreadTable.h"
+ *	\brief counters kept by each worker using a RothSpreadTable
+ */
+struct RothSpreadTableStats_	{
+	/*! lookups satisfied by the table */
+	double hits;
+	/*! lookups which required computation of a new entry */
+	double misses;
+	/*! lookups compared against the exact calculation */
+	double num_validated;
+	/*! validated lookups with relative error above the bound */
+	double num_exceeded;
+	/*! largest absolute error observed (ft/min) */
+	double max_abs_err;
+	/*! largest relative error observed */
+	double max_rel_err;
+	};
+
+/*! Type name for RothSpreadTable_
+ *	\sa For a list of members goto RothSpreadTable_
+ */
+typedef struct RothSpreadTable_ RothSpreadTable;
+
+/*! \struct RothSpreadTable_ RothSpreadTable.h "RothSpreadTable.h"
+ *	\brief direct mapped tables of rate of spread, one per worker
+ *
+ *	Inputs are rounded to the nearest multiple of their step before the rate of spread is
+ *	computed, so the value stored under a key does not depend upon which inputs filled the slot.
+ *	Each worker owns a separate table, results are therefore identical for any number of workers.
+ */
+struct RothSpreadTable_	{
+	/*! number of workers */
+	int num_workers;
+	/*! number of entries in each worker table, a power of 2 */
+	int num_entries;
+	/*! num_entries - 1 */
+	unsigned long mask;
+	/*! quantization of fuel moistures (fraction odw) */
+	double moist_step;
+	/*! quantization of midflame wind speed (ft/min) */
+	double wsp_step;
+	/*! quantization of wind azimuth and aspect (degrees) */
+	double az_step;
+	/*! quantization of slope (percent) */
+	double slp_step;
+	/*! fire ellipse adjustment factor used to compute all entries */
+	double ell_adj;
+	/*! compare every lookup against exact calculation */
+	int validate;
+	/*! relative error bound checked in validation mode */
+	double max_rel_err;
+	/*! table of each worker */
+	RothSpreadTableEntry ** entries;
+	/*! counters of each worker */
+	RothSpreadTableStats * stats;
+	};
+
+/*
+ *********************************************************
+ * MACROS
+ *********************************************************
+ */
+
+/*
+ *********************************************************
+ * PUBLIC FUNCTIONS
+ *********************************************************
+ */
+
+/*! \fn RothSpreadTable * InitRothSpreadTable(int num_workers, int num_fuel_models, int entries_per_fm, double moist_step, double wsp_step, double az_step, double slp_step, double ell_adj, int validate, double max_rel_err)
+ * 	\brief Initializes empty rate of spread tables for each worker.
+ *
+ *	Each worker table holds entries_per_fm entries for every fuel model, rounded up to a power of 2.
+ * 	\param num_workers number of workers which will use the table concurrently
+ * 	\param num_fuel_models number of fuel models in simulation
+ * 	\param entries_per_fm number of entries for each fuel model
+ * 	\param moist_step quantization of fuel moistures (percent)
+ * 	\param wsp_step quantization of midflame wind speed (m/s)
+ * 	\param az_step quantization of wind azimuth and aspect (degrees)
+ * 	\param slp_step quantization of slope (percent)
+ * 	\param ell_adj fire ellipse adjustment factor
+ * 	\param validate if nonzero every lookup is compared against the exact calculation
+ * 	\param max_rel_err relative error reported by validation
+ * 	\retval RothSpreadTable* Ptr to RothSpreadTable, or NULL if unable to initialize
+ */
+RothSpreadTable * InitRothSpreadTable(int num_workers, int num_fuel_models, int entries_per_fm,
+										double moist_step, double wsp_step, double az_step, double slp_step,
+										double ell_adj, int validate, double max_rel_err);
+
+/*! \fn int RothSpreadTableGet(RothSpreadTable * rst, int worker, int fmnum, const RothFuelBed * fb, double d1hfm, double d10hfm, double d100hfm, double lhfm, double lwfm, double wnd_fpm, double wnd_az, double slp_pcnt, double asp, RothSpreadLookup * lk)
+ *	\brief Retrieves rate of spread from the table of the worker, computing a new entry if necessary.
+ *
+ *	In validation mode the exact rate of spread is also computed and stored in lk, and the
+ *	difference from the table value is accumulated in the statistics of the worker.
+ *	\param rst RothSpreadTable
+ *	\param worker index of the calling worker
+ *	\param fmnum fuel model number
+ *	\param fb RothFuelBed of fuel model fmnum
+ *	\param d1hfm dead 1 hour fuel moisture
+ *	\param d10hfm dead 10 hour fuel moisture
+ *	\param d100hfm dead 100 hour fuel moisture
+ *	\param lhfm live herb fuel moisture
+ *	\param lwfm live woody fuel moisture
+ *	\param wnd_fpm midflame windspeed in ft/min
+ *	\param wnd_az azimuth from which wind is coming
+ *	\param slp_pcnt slope percent
+ *	\param asp aspect
+ *	\param lk receives the rate of spread
+ *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
+ *	\note Best use of this facility is as follows:
+ *	\code
+ *			int error_status = SomeFunctionXXX();
+ *			if ( error_status )
+ *				// something bad happened
+ *	\endcode
+ */
+int RothSpreadTableGet(RothSpreadTable * rst, int worker, int fmnum, const RothFuelBed * fb,
+						double d1hfm, double d10hfm, double d100hfm, double lhfm, double lwfm,
+						double wnd_fpm, double wnd_az, double slp_pcnt, double asp, RothSpreadLookup * lk);
+
+/*! \fn void RothSpreadTableDumpStats(RothSpreadTable * rst, FILE * fstream)
+ * 	\brief Writes hit rate and, in validation mode, observed error of the table to stream.
+ *
+ * 	\param rst RothSpreadTable
+ * 	\param fstream an open stream to dump to, can be stdout, stderr, or open FILE stream
+ */
+void RothSpreadTableDumpStats(RothSpreadTable * rst, FILE * fstream);
+
+/*! \fn void FreeRothSpreadTable(void * vptr)
+ * 	\brief Frees memory associated with RothSpreadTable structure.
+ *
+ *	\sa RothSpreadTable
+ * 	\param vptr ptr to RothSpreadTable
+ */
+void FreeRothSpreadTable(void * vptr);
+
+#endif RothSpreadTable_H		/* end of RothSpreadTable.h */
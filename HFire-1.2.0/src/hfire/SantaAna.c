@@ -27,288 +27,272 @@
 /* constant used to reference units of windspeed  returned by all functions */
 static const EnumUnitVelocity smps = EnumMpsVelocity;
 
-IsSantaAnaNowFromProps(ChHashTable * proptbl, int year, int month, int day)		{
-	/* static variables used to store state across function calls */
-	static int smonth 				= 0;
-	static int sday 				= 0;
-	static int syear				= 0;	
-	static double sprob_sa			= -1.0;				/* daily annual Santa Ana probability */
-	static int sis_sa_now			= 0;				/* flag set during Santa Ana event */
-	static int sexp_sa_dy			= 0;				/* counter tracking expired days during current Santa Ana */
-	/* stack variables */
+SantaAnaTables * InitSantaAnaTables()	{
+	SantaAnaTables * tbls = NULL;
+
+	if ( (tbls = (SantaAnaTables *) calloc(1, sizeof(SantaAnaTables))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to allocate memory for SantaAnaTables. \n", ERR_ENOMEM);
+		return tbls;
+		}
+	tbls->units = EnumUnknownVelocity;
+
+	return tbls;
+	}
+
+int SetSantaAnaTablesFromProps(SantaAnaTables * tbls, ChHashTable * proptbl)	{
+	/* stack variables */	
 	KeyVal * entry					= NULL;				/* key/val instances from table */	
-	double sa_freq_yr				= 0.0;				/* number of Santa Ana events per year (avg) */
-	int	st_mo, st_dy, end_mo, end_dy;					/* start and end month and day of simulation */
+	FILE * fstream					= NULL;				/* file stream */
+	char * units					= NULL;
+	int i,j;
+
+	/* retrieve waz filename */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SANAWAZF), (void *)&entry) )	{
+		ERR_ERROR("Unable to retrieve SANTA_ANA_WIND_AZIMUTH_FILE property. \n", ERR_EINVAL);
+		}
+	/* open file */
+	if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
+		ERR_ERROR("Unable to open SANTA_ANA_WIND_AZIMUTH_FILE. \n", ERR_EIOFAIL);
+		}
+	/* create the table of values */
+	if ( (tbls->waz_tbl = GetDblTwoDArrayTableFStreamIO(fstream, 
+			WIND_AZIMUTH_WAZ_SEP_CHARS, WIND_AZIMUTH_WAZ_COMMENT_CHAR)) == NULL )	{
+		fclose(fstream);
+		ERR_ERROR("Unable to parse SANTA_ANA_WIND_AZIMUTH_FILE. \n", ERR_EFAILED);
+		}
+	fclose(fstream);
 
+	/* retrieve wsp filename */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SANAWSPDF), (void *)&entry) )	{
+		ERR_ERROR("Unable to retrieve SANTA_ANA_WIND_SPEED_FILE property. \n", ERR_EINVAL);
+		}
+	/* open file */
+	if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
+		ERR_ERROR("Unable to open SANTA_ANA_WIND_SPEED_FILE. \n", ERR_EIOFAIL);
+		}
+	/* retrieve string indicating units windspeed stored in */
+	if ( (units = GetValFromKeyStringFStreamIO(fstream, WIND_SPD_WSP_KEYWORD_UNITS, 
+			WIND_SPD_WSP_SEP_CHARS, WIND_SPD_WSP_COMMENT_CHAR)) == NULL )	{
+		fclose(fstream);
+		ERR_ERROR("Unable to determine units for SANTA_ANA_WIND_SPEED_FILE. \n", ERR_EINVAL);
+		}
+	/* create the table of values */			
+	if ( (tbls->wsp_tbl = GetDblTwoDArrayTableFStreamIO(fstream, 
+			WIND_SPD_WSP_SEP_CHARS, WIND_SPD_WSP_COMMENT_CHAR)) == NULL )	{
+		free(units);
+		fclose(fstream);
+		ERR_ERROR("Unable to parse SANTA_ANA_WIND_SPEED_FILE. \n", ERR_EFAILED);
+		}
+	/* convert values in table to mps, the last value converted is used until a windspeed is listed */
+	if ( strcmp(units, WIND_SPD_WSP_KEYWORD_MILEPHR) == 0 )	{
+		tbls->units = EnumMphVelocity;
+		}
+	else if ( strcmp(units, WIND_SPD_WSP_KEYWORD_KMPHR) == 0 )	{
+		tbls->units = EnumKmphVelocity;
+		}
+	for(i = 0; i < DBLTWODARRAY_SIZE_ROW(tbls->wsp_tbl); i++)	{
+		for(j = WIND_SPD_HR_TO_WSP_TBL_INDEX(0); j < DBLTWODARRAY_SIZE_COL(tbls->wsp_tbl); j++)	{
+			if ( DBLTWODARRAY_GET_DATA(tbls->wsp_tbl, i, j) == WIND_SPD_WSP_NO_DATA_VALUE )	{
+				continue;
+				}				
+			ConvertVelocityUnits(tbls->units, DBLTWODARRAY_GET_DATA(tbls->wsp_tbl, i, j), smps, &tbls->wsp_init);
+			DBLTWODARRAY_SET_DATA(tbls->wsp_tbl, i, j, tbls->wsp_init);
+			}
+		}
+	/* cleanup */
+	free(units);
+	fclose(fstream);
 
+	/* retrieve dfm filename */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SANADFMF), (void *)&entry) )	{
+		ERR_ERROR("Unable to retrieve SANTA_ANA_DEAD_FUEL_MOIST_FILE property. \n", ERR_EINVAL);
+		}
+	/* open file */
+	if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
+		ERR_ERROR("Unable to open file containing Santa Ana Dead Fuel Moisture. \n", ERR_EIOFAIL);
+		}
+	/* create the table of values */
+	if ( (tbls->d10h_tbl = GetDblTwoDArrayTableFStreamIO(fstream, 
+			DEAD_FUEL_MOIST_10H_SEP_CHARS, DEAD_FUEL_MOIST_10H_COMMENT_CHAR)) == NULL )	{
+		fclose(fstream);
+		ERR_ERROR("Unable to initialize Santa Ana Dead Fuel Moisture table. \n", ERR_EFAILED);
+		}
+	fclose(fstream);
+
+	return ERR_SUCCESS;
+	}
+
+void FreeSantaAnaTables(void * vptr)	{
+	SantaAnaTables * tbls = NULL;
+
+	if ( vptr != NULL )	{
+		tbls = (SantaAnaTables *) vptr;
+		if ( tbls->waz_tbl != NULL )	FreeDblTwoDArray(tbls->waz_tbl);
+		if ( tbls->wsp_tbl != NULL )	FreeDblTwoDArray(tbls->wsp_tbl);
+		if ( tbls->d10h_tbl != NULL )	FreeDblTwoDArray(tbls->d10h_tbl);
+		free(tbls);
+		}
+	tbls = NULL;
+
+	return;
+	}
+
+SantaAnaState * InitSantaAnaState()	{
+	SantaAnaState * st = NULL;
+
+	if ( (st = (SantaAnaState *) calloc(1, sizeof(SantaAnaState))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to allocate memory for SantaAnaState. \n", ERR_ENOMEM);
+		return st;
+		}
+	st->prob_sa = 0.0;
+	st->wspwaf = EnumWindAdjustAB79;
+	st->d1hfminc = 0.02;
+	st->d100hfminc = 0.02;
+
+	return st;
+	}
+
+int SetSantaAnaStateFromSimConfig(SantaAnaState * st, const SimConfig * cfg)	{
+	/* check args */
+	if ( st == NULL || cfg == NULL )	{
+		ERR_ERROR("Arguments supplied to set SantaAnaState invalid. \n", ERR_EINVAL);
+		}
+
+	st->prob_sa = 0.0;
+	st->num_days = cfg->sa_num_days;
+	st->wspwaf = cfg->wsp_waf;
+	st->d1hfminc = cfg->dfm_d1h_inc;
+	st->d100hfminc = cfg->dfm_d100h_inc;
+	if ( UNITS_FP_GT_ZERO(cfg->sa_freq_yr) )	{
+		/* daily annual probability over the fire season */
+		st->prob_sa = cfg->sa_freq_yr / FireTimerGetDaysDifftime(cfg->start_mo, cfg->start_dy, cfg->end_mo, cfg->end_dy);
+		}
+
+	return ERR_SUCCESS;
+	}
+
+int SetSantaAnaStateFromTables(SantaAnaState * st, const SantaAnaTables * tbls)	{
+	/* check args */
+	if ( st == NULL || tbls == NULL )	{
+		ERR_ERROR("Arguments supplied to set SantaAnaState invalid. \n", ERR_EINVAL);
+		}
+
+	st->tbls = tbls;
+	st->wsp = tbls->wsp_init;
+
+	return ERR_SUCCESS;
+	}
+
+int IsSantaAnaNowFromProps(SantaAnaState * st, ChHashTable * proptbl, int year, int month, int day)		{
 	/* check args */
 	if ( proptbl == NULL ) 	{
 		ERR_ERROR_CONTINUE("Arguments supplied to determine Santa Ana occurence invalid. \n", ERR_EINVAL);
 		return 0;
 		}
 
-	/* retrieve Santa Ana frequency per year */
-	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SANAFREQ), (void *)&entry) )	{
-		ERR_ERROR_CONTINUE("Unable to retrieve SANTA_ANA_FREQUENCY_PER_YEAR property. \n", ERR_EINVAL);
-		return 0;
-		}
-	sa_freq_yr = atof((char *) entry->val);		
-	
-	if( UNITS_FP_GT_ZERO(sa_freq_yr) && ((smonth != month) || (sday != day)) )	{
-		/* retrieve num days in simulation year and calculate Santa Ana probability, only done once */
-		if ( UNITS_FP_LT_ZERO(sprob_sa) )	{
-			/* find simulation start month */		
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SIMSTMO), (void *)&entry) )	{
-				ERR_ERROR_CONTINUE("Unable to retrieve SIMULATION_START_MONTH property. \n", ERR_EINVAL);
-				return 0;
-				}
-			st_mo = atoi((char *) entry->val);
-			/* find simulation start day */
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SIMSTDY), (void *)&entry) )	{
-				ERR_ERROR_CONTINUE("Unable to retrieve SIMULATION_START_DAY property. \n", ERR_EINVAL);
-				return 0;
-				}
-			st_dy = atoi((char *) entry->val);
-			/* find simulation end month */
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SIMEDMO), (void *)&entry) )	{
-				ERR_ERROR_CONTINUE("Unable to retrieve SIMULATION_END_MONTH property. \n", ERR_EINVAL);
-				return 0;
-				}
-			end_mo = atoi((char *) entry->val);
-			/* find simulation end day */
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SIMEDDY), (void *)&entry) )	{
-				ERR_ERROR_CONTINUE("Unable to retrieve SIMULATION_END_DAY property. \n", ERR_EINVAL);
-				return 0;
-				}
-			end_dy = atoi((char *) entry->val);
-			/* calculate daily annual probability */			 
-			sprob_sa = sa_freq_yr / FireTimerGetDaysDifftime(st_mo, st_dy, end_mo, end_dy);
-			}
+	if( UNITS_FP_GT_ZERO(st->prob_sa) && ((st->occ_month != month) || (st->occ_day != day)) )	{
 		/* is there an ongoing Santa Ana event */
-		if ( sis_sa_now == 1 )	{
+		if ( st->is_sa_now == 1 )	{
 			/* increment num of days that have expired during current Santa Ana */
-			sexp_sa_dy++;
-			/* retrieve duration of all Santa Anas */
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SANANUMD), (void *)&entry) )	{
-				ERR_ERROR_CONTINUE("Unable to retrieve SANTA_ANA_NUM_DAYS_DURATION property. \n", ERR_EINVAL);
-				return 0;
-				}
+			st->exp_sa_dy++;
 			/* the length of the current Santa Ana has reached the limit of its duration or a new year has started */
-			if ( atoi((char *) entry->val) == sexp_sa_dy  || syear != year )	{
-				sexp_sa_dy = 0;
-				sis_sa_now = 0;
+			if ( st->num_days == st->exp_sa_dy  || st->occ_year != year )	{
+				st->exp_sa_dy = 0;
+				st->is_sa_now = 0;
 				}
 			}
 		/* draw a uniform random number and determine if santa ana occurs */
 		else	{
 			/* Santa Ana occurs */
-			if ( randu(0.0, 1.0) < sprob_sa )	{
+			if ( RandStreamUniform(&st->rs, 0.0, 1.0) < st->prob_sa )	{
 				/* set Santa Ana flag for subsequent calls to this method */
-				sis_sa_now = 1;			
+				st->is_sa_now = 1;			
 				/* write occurence into user-specified Santa Ana event occurences file */
-				if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SANANUMD), (void *)&entry) )	{
-					ERR_ERROR_CONTINUE("Unable to retrieve SANTA_ANA_NUM_DAYS_DURATION property. \n", ERR_EINVAL);
-					return 0;
-					}			
-				if ( FireExportSantaAnaEvtTxtFile(proptbl, atoi((char *) entry->val), year, month, day) )	{
+				if ( FireExportSantaAnaEvtTxtFile(proptbl, st->num_days, year, month, day) )	{
 					ERR_ERROR_CONTINUE("Unable to insert Santa Ana event into EXPORT_SANTA_ANA_EVT_FILE. \n", ERR_EIOFAIL);
 					return 0;
 					}
 				}
 			}
 		/* set {month, day, year} for future calls */
-		smonth = month;
-		sday = day;
-		syear = year;
+		st->occ_month = month;
+		st->occ_day = day;
+		st->occ_year = year;
 		}		
 	
-	return sis_sa_now;
+	return st->is_sa_now;
 	}
 
-int GetSantaAnaEnvFromProps(ChHashTable * proptbl, int month, int day, int hour,
+int GetSantaAnaEnvFromProps(SantaAnaState * st, ChHashTable * proptbl, int month, int day, int hour,
 									double * waz, double fbedhgtm, double * wspmps,
 									double * d1hfm, double * d10hfm, double * d100hfm)		{
-	/* static variables used to store state across function calls */
-	static int smonth 				= 0;
-	static int sday 				= 0;
-	static int shour 				= 0;
-	static int srec					= 0;
-	static double swaz				= 0.0;
-	static DblTwoDArray * swaz_tbl 	= NULL;	
-	static double swsp				= 0.0;
-	static EnumUnitVelocity sunits	= EnumUnknownVelocity;	
-	static DblTwoDArray * swsp_tbl 	= NULL;
-	static double sd1hfm			= 0.0;
-	static double sd10hfm			= 0.0;
-	static double sd100hfm			= 0.0;
-	static DblTwoDArray * sd10h_tbl = NULL;
-  static EnumFireVal swspwaf = VAL_AB79;
-  static double sd1hfminc = 0.02;
-  static double sd100hfminc = 0.02;
-	/* stack variables */	
-	KeyVal * entry					= NULL;				/* key/val instances from table */	
-	FILE * fstream					= NULL;				/* file stream */
-	char * units					= NULL;
-	int i,j;
+
+	if ( st->tbls == NULL )	{
+		ERR_ERROR("Santa Ana tables not initialized. \n", ERR_EINVAL);
+		}
 												
-	if ( (smonth != month) || (sday != day) || (shour != hour) )	{
-		/* new wind azimuth table */
-		if (swaz_tbl == NULL )	{
-			*waz = swaz;		
-			/* retrieve waz filename */
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SANAWAZF), (void *)&entry) )	{
-				ERR_ERROR("Unable to retrieve SANTA_ANA_WIND_AZIMUTH_FILE property. \n", ERR_EINVAL);
-				}
-			/* open file */
-			if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
-				ERR_ERROR("Unable to open SANTA_ANA_WIND_AZIMUTH_FILE. \n", ERR_EIOFAIL);
-				}
-			/* create the table of values */
-			if ( (swaz_tbl = GetDblTwoDArrayTableFStreamIO(fstream, 
-					WIND_AZIMUTH_WAZ_SEP_CHARS, WIND_AZIMUTH_WAZ_COMMENT_CHAR)) == NULL )	{
-				fclose(fstream);
-				ERR_ERROR("Unable to parse SANTA_ANA_WIND_AZIMUTH_FILE. \n", ERR_EFAILED);
-				}
-			fclose(fstream);
-			}
-		/* new wind speed table */
-		if (swsp_tbl == NULL )	{					
-			*wspmps = swsp;		
-			/* retrieve wsp filename */
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SANAWSPDF), (void *)&entry) )	{
-				ERR_ERROR("Unable to retrieve SANTA_ANA_WIND_SPEED_FILE property. \n", ERR_EINVAL);
-				}
-			/* open file */
-			if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
-				ERR_ERROR("Unable to open SANTA_ANA_WIND_SPEED_FILE. \n", ERR_EIOFAIL);
-				}
-			/* retrieve string indicating units windspeed stored in */
-			if ( (units = GetValFromKeyStringFStreamIO(fstream, WIND_SPD_WSP_KEYWORD_UNITS, 
-					WIND_SPD_WSP_SEP_CHARS, WIND_SPD_WSP_COMMENT_CHAR)) == NULL )	{
-				fclose(fstream);
-				ERR_ERROR("Unable to determine units for SANTA_ANA_WIND_SPEED_FILE. \n", ERR_EINVAL);
-				}
-			/* create the table of values */			
-			if ( (swsp_tbl = GetDblTwoDArrayTableFStreamIO(fstream, 
-					WIND_SPD_WSP_SEP_CHARS, WIND_SPD_WSP_COMMENT_CHAR)) == NULL )	{
-				free(units);
-				fclose(fstream);
-				ERR_ERROR("Unable to parse SANTA_ANA_WIND_SPEED_FILE. \n", ERR_EFAILED);
-				}
-			/* convert values in table to mps */
-			if ( strcmp(units, WIND_SPD_WSP_KEYWORD_MILEPHR) == 0 )	{
-				sunits = EnumMphVelocity;
-				}
-			else if ( strcmp(units, WIND_SPD_WSP_KEYWORD_KMPHR) == 0 )	{
-				sunits = EnumKmphVelocity;
-				}
-			for(i = 0; i < DBLTWODARRAY_SIZE_ROW(swsp_tbl); i++)	{
-				for(j = WIND_SPD_HR_TO_WSP_TBL_INDEX(0); j < DBLTWODARRAY_SIZE_COL(swsp_tbl); j++)	{
-					if ( DBLTWODARRAY_GET_DATA(swsp_tbl, i, j) == WIND_SPD_WSP_NO_DATA_VALUE )	{
-						continue;
-						}				
-					ConvertVelocityUnits(sunits, DBLTWODARRAY_GET_DATA(swsp_tbl, i, j), smps, &swsp);
-					DBLTWODARRAY_SET_DATA(swsp_tbl, i, j, swsp);
-					}
-				}
-			/* cleanup */
-			free(units);
-			fclose(fstream);
-      /* retrieve windspeed adjustment factor */
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_WSPWAF), (void *)&entry) )	{
-        swspwaf = VAL_AB79; /* default */
-				}
-      else if ( strcmp(entry->val, GetFireVal(VAL_BHP)) == 0 ) {
-        swspwaf = VAL_BHP;
-        }	
-      else if ( strcmp(entry->val, GetFireVal(VAL_NOWAF)) == 0 ) {
-        swspwaf = VAL_NOWAF;
-        }
-			}
-		/* new dead fuel moistures table needed, only done once */
-		if (sd10h_tbl == NULL )	{
-			/* initialize returned vars in case table not created */
-			*d1hfm = sd1hfm;
-			*d10hfm = sd10hfm;
-			*d100hfm = sd100hfm;		
-			/* table of fixed values only needs to be initialized once */
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_SANADFMF), (void *)&entry) )	{
-				ERR_ERROR("Unable to retrieve SANTA_ANA_DEAD_FUEL_MOIST_FILE property. \n", ERR_EINVAL);
-				}
-			/* open fixed azimuth file */
-			if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
-				ERR_ERROR("Unable to open file containing Santa Ana Dead Fuel Moisture. \n", ERR_EIOFAIL);
-				}
-			/* create the table of values */
-			if ( (sd10h_tbl = GetDblTwoDArrayTableFStreamIO(fstream, 
-					DEAD_FUEL_MOIST_10H_SEP_CHARS, DEAD_FUEL_MOIST_10H_COMMENT_CHAR)) == NULL )	{
-				fclose(fstream);
-				ERR_ERROR("Unable to initialize Santa Ana Dead Fuel Moisture table. \n", ERR_EFAILED);
-				}
-			fclose(fstream);
-      /* obtain the dead fuel moisture increments */
-      if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_DFMD1HINC), (void *)&entry) ) {
-        sd1hfminc = 0.02; /* default */
-        }
-      else {
-        sd1hfminc = fabs(atof(entry->val)) / 100.0;
-        }
-      if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_DFMD100HINC), (void *)&entry) ) {
-        sd100hfminc = 0.02; /* default */
-        }
-      else {
-        sd100hfminc = fabs(atof(entry->val)) / 100.0;
-        }
-			}
-		
+	if ( (st->month != month) || (st->day != day) || (st->hour != hour) )	{
 		/* new record index required */
-		if ( (smonth != month) || (sday != day) )	{
-			if ( (DBLTWODARRAY_SIZE_ROW(swaz_tbl) != DBLTWODARRAY_SIZE_ROW(swsp_tbl)) 
-					&& (DBLTWODARRAY_SIZE_ROW(swsp_tbl) != DBLTWODARRAY_SIZE_ROW(sd10h_tbl)) )	{
+		if ( (st->month != month) || (st->day != day) )	{
+			if ( (DBLTWODARRAY_SIZE_ROW(st->tbls->waz_tbl) != DBLTWODARRAY_SIZE_ROW(st->tbls->wsp_tbl)) 
+					&& (DBLTWODARRAY_SIZE_ROW(st->tbls->wsp_tbl) != DBLTWODARRAY_SIZE_ROW(st->tbls->d10h_tbl)) )	{
 				ERR_ERROR("Unable to retrieve Santa Ana conditions, table record numbers unequal. \n", ERR_EINVAL);
 				}
-			srec = randi(0) % DBLTWODARRAY_SIZE_ROW(swaz_tbl);
+			st->rec = RandStreamIndex(&st->rs, DBLTWODARRAY_SIZE_ROW(st->tbls->waz_tbl));
 			}
 
 		/* new environmental variables required */
-		if ( UNITS_FP_GT_ZERO(DBLTWODARRAY_GET_DATA(swaz_tbl, srec, SANTA_ANA_HR_TO_TBL_INDEX(hour))) )
-			swaz = DBLTWODARRAY_GET_DATA(swaz_tbl, srec, SANTA_ANA_HR_TO_TBL_INDEX(hour));
-		if ( UNITS_FP_GT_ZERO(DBLTWODARRAY_GET_DATA(swsp_tbl, srec, SANTA_ANA_HR_TO_TBL_INDEX(hour))) )
-			swsp = DBLTWODARRAY_GET_DATA(swsp_tbl, srec, SANTA_ANA_HR_TO_TBL_INDEX(hour));
-		sd10hfm = DBLTWODARRAY_GET_DATA(sd10h_tbl, srec, SANTA_ANA_HR_TO_TBL_INDEX(hour)) / 100;
-		if ( !UNITS_FP_GT_ZERO(sd10hfm) ) {
-			sd10hfm = 0.01;
+		if ( UNITS_FP_GT_ZERO(DBLTWODARRAY_GET_DATA(st->tbls->waz_tbl, st->rec, SANTA_ANA_HR_TO_TBL_INDEX(hour))) )
+			st->waz = DBLTWODARRAY_GET_DATA(st->tbls->waz_tbl, st->rec, SANTA_ANA_HR_TO_TBL_INDEX(hour));
+		if ( UNITS_FP_GT_ZERO(DBLTWODARRAY_GET_DATA(st->tbls->wsp_tbl, st->rec, SANTA_ANA_HR_TO_TBL_INDEX(hour))) )
+			st->wsp = DBLTWODARRAY_GET_DATA(st->tbls->wsp_tbl, st->rec, SANTA_ANA_HR_TO_TBL_INDEX(hour));
+		st->d10hfm = DBLTWODARRAY_GET_DATA(st->tbls->d10h_tbl, st->rec, SANTA_ANA_HR_TO_TBL_INDEX(hour)) / 100;
+		if ( !UNITS_FP_GT_ZERO(st->d10hfm) ) {
+			st->d10hfm = 0.01;
       }
     /* compute d1h from d10h */
-		sd1hfm = sd10hfm - sd1hfminc;
-		if ( !UNITS_FP_GT_ZERO(sd1hfm) ) {
-			sd1hfm = 0.01;
+		st->d1hfm = st->d10hfm - st->d1hfminc;
+		if ( !UNITS_FP_GT_ZERO(st->d1hfm) ) {
+			st->d1hfm = 0.01;
       }
     /* compute d100h from d10h */
-		sd100hfm = sd10hfm + sd100hfminc;
-		if ( !UNITS_FP_GT_ZERO(sd100hfm) ) {
-			sd100hfm = 0.01;
+		st->d100hfm = st->d10hfm + st->d100hfminc;
+		if ( !UNITS_FP_GT_ZERO(st->d100hfm) ) {
+			st->d100hfm = 0.01;
       }
 				
 		/* set {month, day, hour} for future calls */
-		smonth = month;
-		sday = day;
-		shour = hour;			
+		st->month = month;
+		st->day = day;
+		st->hour = hour;			
 		}
 
-	*waz = swaz;
-  if ( swspwaf == VAL_BHP ) {
-    *wspmps = ConvertWindSpeedAtRefHgtToArbitraryHgtBHP(swsp, WIND_SPD_RAWS_REF_HGT_METERS, 2.0 * fbedhgtm);
-  } else if ( swspwaf == VAL_NOWAF ) {
-    *wspmps = swsp;
+	*waz = st->waz;
+  if ( st->wspwaf == EnumWindAdjustBHP ) {
+    *wspmps = ConvertWindSpeedAtRefHgtToArbitraryHgtBHP(st->wsp, WIND_SPD_RAWS_REF_HGT_METERS, 2.0 * fbedhgtm);
+  } else if ( st->wspwaf == EnumWindAdjustNone ) {
+    *wspmps = st->wsp;
 	} else { /* default */
-    *wspmps = ConvertWindSpeedAtRefHgtToArbitraryHgtAB79(swsp, WIND_SPD_RAWS_REF_HGT_METERS, 2.0 * fbedhgtm);
+    *wspmps = ConvertWindSpeedAtRefHgtToArbitraryHgtAB79(st->wsp, WIND_SPD_RAWS_REF_HGT_METERS, 2.0 * fbedhgtm);
   }
-	*d1hfm = sd1hfm;
-	*d10hfm = sd10hfm;
-	*d100hfm = sd100hfm;
+	*d1hfm = st->d1hfm;
+	*d10hfm = st->d10hfm;
+	*d100hfm = st->d100hfm;
 				
 	return ERR_SUCCESS;
 	}
 
+void FreeSantaAnaState(void * vptr)	{
+	SantaAnaState * st = NULL;
+
+	if ( vptr != NULL )	{
+		st = (SantaAnaState *) vptr;
+		/* tables are shared and freed by their owner */
+		free(st);
+		}
+	st = NULL;
+
+	return;
+	}
+
 /* end of SantaAna.c */
@@ -38,7 +38,8 @@
 #include "FireProp.h"
 #include "FireExport.h"
 #include "FStreamIO.h"
-#include "NLIBRand.h"
+#include "RandStream.h"
+#include "SimConfig.h"
 #include "Err.h"
 
 /*
@@ -61,7 +62,83 @@
  * STRUCTS, TYPEDEFS
  *********************************************************
  */
- 
+
+/*! Type name for SantaAnaTables_
+ *	\sa For a list of members goto SantaAnaTables_
+ */
+typedef struct SantaAnaTables_ SantaAnaTables;
+
+/*!	\struct SantaAnaTables_ SantaAna.h "SantaAna.h"
+ *	\brief tables of Santa Ana conditions read once from the files named in the simulation properties
+ *	Not modified once read, so shared by the SantaAnaState of every simulation.
+ */
+struct SantaAnaTables_	{
+	/*! table of Santa Ana wind azimuths */
+	DblTwoDArray * waz_tbl;
+	/*! table of Santa Ana windspeeds, in m/s */
+	DblTwoDArray * wsp_tbl;
+	/*! units of Santa Ana windspeeds read from file */
+	EnumUnitVelocity units;
+	/*! Santa Ana windspeed used until a windspeed greater than zero is listed, in m/s */
+	double wsp_init;
+	/*! table of Santa Ana 10 hour dead fuel moistures */
+	DblTwoDArray * d10h_tbl;
+	};
+
+/*! Type name for SantaAnaState_
+ *	\sa For a list of members goto SantaAnaState_
+ */
+typedef struct SantaAnaState_ SantaAnaState;
+
+/*!	\struct SantaAnaState_ SantaAna.h "SantaAna.h"
+ *	\brief Santa Ana occurence and the Santa Ana environment retrieved by the Santa Ana functions
+ *	Stored by FireEnv in place of function statics so each simulation owns its state.
+ */
+struct SantaAnaState_	{
+	/*! year of the last call to IsSantaAnaNowFromProps */
+	int occ_year;
+	/*! month of the last call to IsSantaAnaNowFromProps */
+	int occ_month;
+	/*! day of the last call to IsSantaAnaNowFromProps */
+	int occ_day;
+	/*! daily annual Santa Ana probability, 0 if Santa Ana events do not occur */
+	double prob_sa;
+	/*! duration of each Santa Ana event, in days */
+	int num_days;
+	/*! flag set during Santa Ana event */
+	int is_sa_now;
+	/*! counter tracking expired days during current Santa Ana */
+	int exp_sa_dy;
+	/*! month of the last call to GetSantaAnaEnvFromProps */
+	int month;
+	/*! day of the last call to GetSantaAnaEnvFromProps */
+	int day;
+	/*! hour of the last call to GetSantaAnaEnvFromProps */
+	int hour;
+	/*! record of Santa Ana tables chosen for the day of the last call */
+	int rec;
+	/*! Santa Ana wind azimuth of the last call */
+	double waz;
+	/*! Santa Ana windspeed of the last call at reference height, in m/s */
+	double wsp;
+	/*! Santa Ana 1 hour dead fuel moisture of the last call */
+	double d1hfm;
+	/*! Santa Ana 10 hour dead fuel moisture of the last call */
+	double d10hfm;
+	/*! Santa Ana 100 hour dead fuel moisture of the last call */
+	double d100hfm;
+	/*! tables shared by every simulation, NULL if Santa Ana events do not occur */
+	const SantaAnaTables * tbls;
+	/*! windspeed adjustment factor applied to Santa Ana windspeed */
+	EnumWindAdjust wspwaf;
+	/*! increment of 10 hour dead fuel moisture to 1 hour dead fuel moisture */
+	double d1hfminc;
+	/*! increment of 10 hour dead fuel moisture to 100 hour dead fuel moisture */
+	double d100hfminc;
+	/*! random numbers deciding Santa Ana occurence and choosing table records */
+	RandStream rs;
+	};
+
 /*
  *********************************************************
  * MACROS
@@ -81,23 +158,92 @@
  *********************************************************
  */
 
-/*!	\fn int IsSantaAnaNowFromProps(ChHashTable * proptbl, int year, int month, int day)
+/*! \fn SantaAnaTables * InitSantaAnaTables()
+ *	\brief Initializes an empty set of Santa Ana tables.
+ *
+ *	\sa SantaAnaTables
+ *	\retval SantaAnaTables* Ptr to initialized SantaAnaTables, or NULL if unable to allocate
+ */
+SantaAnaTables * InitSantaAnaTables();
+
+/*! \fn int SetSantaAnaTablesFromProps(SantaAnaTables * tbls, ChHashTable * proptbl)
+ *	\brief Reads the tables named by SANTA_ANA_WIND_AZIMUTH_FILE, SANTA_ANA_WIND_SPEED_FILE and
+ *	SANTA_ANA_DEAD_FUEL_MOIST_FILE, converting windspeeds to m/s.
+ *
+ *	\sa SantaAnaTables
+ *	\param tbls SantaAnaTables
+ *	\param proptbl ChHashTable of simulation properties
+ *	\retval int ERR_SUCCESS(0) if successful, an error code otherwise
+ */
+int SetSantaAnaTablesFromProps(SantaAnaTables * tbls, ChHashTable * proptbl);
+
+/*! \fn void FreeSantaAnaTables(void * vptr)
+ *	\brief Frees memory associated with SantaAnaTables structure.
+ *
+ *	Every SantaAnaState using the tables must be freed first.
+ *	\sa SantaAnaTables
+ *	\param vptr ptr to SantaAnaTables
+ */
+void FreeSantaAnaTables(void * vptr);
+
+/*! \fn SantaAnaState * InitSantaAnaState()
+ *	\brief Initializes the Santa Ana state of a simulation.
+ *
+ *	\sa SantaAnaState
+ *	\retval SantaAnaState* Ptr to initialized SantaAnaState, or NULL if unable to allocate
+ */
+SantaAnaState * InitSantaAnaState();
+
+/*! \fn void FreeSantaAnaState(void * vptr)
+ *	\brief Frees memory associated with SantaAnaState structure.
+ *
+ *	\sa SantaAnaState
+ *	\param vptr ptr to SantaAnaState
+ */
+void FreeSantaAnaState(void * vptr);
+
+/*! \fn int SetSantaAnaStateFromSimConfig(SantaAnaState * st, const SimConfig * cfg)
+ *	\brief Sets the daily Santa Ana probability, duration, windspeed adjustment factor, and dead fuel moisture increments of the Santa Ana state from SimConfig.
+ *
+ *	SANTA_ANA_FREQUENCY_PER_YEAR is converted to a daily probability relative to the length of the
+ *	fire season.  Call once before the first call to IsSantaAnaNowFromProps.
+ *	\sa SantaAnaState
+ *	\sa SimConfig
+ *	\param st SantaAnaState
+ *	\param cfg SimConfig of simulation
+ *	\retval int ERR_SUCCESS(0) if successful, an error code otherwise
+ */
+int SetSantaAnaStateFromSimConfig(SantaAnaState * st, const SimConfig * cfg);
+
+/*! \fn int SetSantaAnaStateFromTables(SantaAnaState * st, const SantaAnaTables * tbls)
+ *	\brief Links the Santa Ana state of a simulation to the shared Santa Ana tables.
+ *
+ *	Call once before the first call to GetSantaAnaEnvFromProps.  The tables must outlive the state.
+ *	\sa SantaAnaState
+ *	\sa SantaAnaTables
+ *	\param st SantaAnaState
+ *	\param tbls SantaAnaTables
+ *	\retval int ERR_SUCCESS(0) if successful, an error code otherwise
+ */
+int SetSantaAnaStateFromTables(SantaAnaState * st, const SantaAnaTables * tbls);
+
+/*!	\fn int IsSantaAnaNowFromProps(SantaAnaState * st, ChHashTable * proptbl, int year, int month, int day)
  * 	\brief Tests whether a Santa Ana event occurs during this day in the simulation.
  *
- * 	This method converts the value of the keyword SANTA_ANA_FREQUENCY_PER_YEAR to a probability
- * 	relative to the length of the fire season and uses a uniform random number generator to 
- * 	determine if a Santa Ana event occurs this day.
+ * 	This method tests the daily Santa Ana probability set by SetSantaAnaStateFromSimConfig against
+ * 	a uniform random number to determine if a Santa Ana event occurs this day.
  *	\sa ChHashTable
  * 	\sa Check the \htmlonly <a href="config_file_doc.html#SANTA_ANA">config file documentation</a> \endhtmlonly 
+ * 	\param st SantaAnaState storing the Santa Ana occurence and environment between calls
  * 	\param proptbl ChHashTable of simulation properties
  * 	\param year current year in simulation
  * 	\param month current month in simulation 
  * 	\param day current day in simulation 
  * 	\retval int Returns 1 (true) if there is a Santa Ana event this day, or 0 (false) otherwise.
  */
-int IsSantaAnaNowFromProps(ChHashTable * proptbl, int year, int month, int day);
+int IsSantaAnaNowFromProps(SantaAnaState * st, ChHashTable * proptbl, int year, int month, int day);
 
-/*!	\fn int GetSantaAnaEnvFromProps(ChHashTable * proptbl, int month, int day, int hour,
+/*!	\fn int GetSantaAnaEnvFromProps(SantaAnaState * st, ChHashTable * proptbl, int month, int day, int hour,
  									double * waz, double fbedhgtm, double * wspmps,
  									double * d1hfm, double * d10hfm, double * d100hfm)
  * 	\brief The procedure employed to mimic Santa Ana conditions during the simulation is similar
@@ -110,6 +256,7 @@ int IsSantaAnaNowFromProps(ChHashTable * proptbl, int year, int month, int day);
  * 	simulation.  For multi-day Santa Anas a new index is chosen at the start of the next day.
  *	\sa ChHashTable
  * 	\sa Check the \htmlonly <a href="config_file_doc.html#SANTA_ANA">config file documentation</a> \endhtmlonly 
+ *  \param st SantaAnaState storing the Santa Ana occurence and environment between calls
  *  \param proptbl ChHashTable of simulation properties
  *  \param month 1 based month to retrieve conditions for
  *  \param day 1 based day in month to retrieve conditions for
@@ -128,7 +275,7 @@ int IsSantaAnaNowFromProps(ChHashTable * proptbl, int year, int month, int day);
  *				// something bad happened
  *	\endcode
  */
-int GetSantaAnaEnvFromProps(ChHashTable * proptbl, int month, int day, int hour,
+int GetSantaAnaEnvFromProps(SantaAnaState * st, ChHashTable * proptbl, int month, int day, int hour,
 									double * waz, double fbedhgtm, double * wspmps,
 									double * d1hfm, double * d10hfm, double * d100hfm);
   
@@ -0,0 +1,144 @@
+/*!
+ * \file SimConfig.c
+ * \brief Simulation properties parsed and validated once when the configuration file is loaded.
+ *
+ * \author Marco Morais
+ * \date 2000-2001
+ *
+ *	HFire (Highly Optmized Tolerance Fire Spread Model) Library
+ *	Copyright (C) 2001 Marco Morais
+ *
+ *	This library is free software; you can redistribute it and/or
+ *	modify it under the terms of the GNU Lesser General Public
+ *	License as published by the Free Software Foundation; either
+ *	version 2.1 of the License, or (at your option) any later version.
+ *
+ *	This library is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *	Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public
+ *	License along with this library; if not, write to the Free Software
+ *	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "SimConfig.h"
+
+SimConfig * InitSimConfig()	{
+	SimConfig * cfg = NULL;
+
+	if ( (cfg = (SimConfig *) malloc(sizeof(SimConfig))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to allocate memory for SimConfig. \n", ERR_ENOMEM);
+		return cfg;
+		}
+	cfg->start_yr = cfg->start_mo = cfg->start_dy = cfg->start_hr = 0;
+	cfg->end_yr = cfg->end_mo = cfg->end_dy = cfg->end_hr = 0;
+	cfg->timestep_secs = 0;
+	cfg->spread_engine = EnumSpreadEngineSweep;
+	cfg->adaptive_timestep = EnumAdaptiveTimestepGlobal;
+	cfg->ell_adj = 0.0;
+	cfg->ext_type = EnumExtinctionUnknown;
+	cfg->ext_ros_enabled = 0;
+	cfg->ext_ros_mps = 0.0;
+	cfg->ext_hrs_enabled = 0;
+	cfg->ext_hrs = 0;
+	cfg->ig_type = EnumIgnitionFixed;
+	cfg->ig_freq_yr = 0.0;
+	cfg->wsp_waf = EnumWindAdjustAB79;
+	cfg->dfm_d1h_inc = 0.0;
+	cfg->dfm_d100h_inc = 0.0;
+	cfg->std_age_fixed = 0;
+	cfg->fuels_fixed_num = 0;
+	cfg->sa_freq_yr = 0.0;
+	cfg->sa_num_days = 0;
+	cfg->rng_seed_table = 0;
+	cfg->rng_seed = 0;
+	cfg->num_threads = 1;
+	cfg->tile_cache_mb = 0;
+	cfg->ros_tbl_type = EnumRosTableNone;
+	cfg->ros_tbl_entries = 0;
+	cfg->ros_tbl_moist_step = cfg->ros_tbl_wsp_step = cfg->ros_tbl_az_step = cfg->ros_tbl_slp_step = 0.0;
+	cfg->ros_tbl_max_rel_err = 0.0;
+
+	return cfg;
+	}
+
+void SimConfigDumpToStream(SimConfig * cfg, FILE * fstream)	{
+	if ( cfg == NULL || fstream == NULL )	{
+		return;
+		}
+
+	fprintf(fstream, "SIM CONFIG START: %d/%02d/%02d %02d00 END: %d/%02d/%02d %02d00 TIMESTEP: %d s \n",
+			cfg->start_yr, cfg->start_mo, cfg->start_dy, cfg->start_hr,
+			cfg->end_yr, cfg->end_mo, cfg->end_dy, cfg->end_hr, cfg->timestep_secs);
+	fprintf(fstream, "SIM CONFIG ENGINE: %s ADAPTIVE TIMESTEP: %s ELLIPSE ADJUSTMENT: %f \n",
+			(cfg->spread_engine == EnumSpreadEngineEvent) ? "EVENT" : "SWEEP",
+			(cfg->adaptive_timestep == EnumAdaptiveTimestepFire) ? "FIRE" : "GLOBAL", cfg->ell_adj);
+	fprintf(fstream, "SIM CONFIG EXTINCTION: %s ROS: ", (cfg->ext_type == EnumExtinctionReignite) ? "REIGNITE" : "CONSUME");
+	if ( cfg->ext_ros_enabled )	{
+		fprintf(fstream, "%f mps", cfg->ext_ros_mps);
+		}
+	else	{
+		fprintf(fstream, "NULL");
+		}
+	fprintf(fstream, " HOURS: ");
+	if ( cfg->ext_hrs_enabled )	{
+		fprintf(fstream, "%d \n", cfg->ext_hrs);
+		}
+	else	{
+		fprintf(fstream, "NULL \n");
+		}
+	fprintf(fstream, "SIM CONFIG IGNITION: ");
+	if ( cfg->ig_type == EnumIgnitionFixed )	{
+		fprintf(fstream, "FIXED \n");
+		}
+	else	{
+		fprintf(fstream, "%s FREQUENCY: %f \n", (cfg->ig_type == EnumIgnitionRandS) ? "RANDOM_SPATIAL" : "RANDOM_UNIFORM", cfg->ig_freq_yr);
+		}
+	fprintf(fstream, "SIM CONFIG WIND ADJUSTMENT: %s D1H INCREMENT: %f D100H INCREMENT: %f \n",
+			(cfg->wsp_waf == EnumWindAdjustBHP) ? "BHP" : ((cfg->wsp_waf == EnumWindAdjustNone) ? "NOWAF" : "AB79"),
+			cfg->dfm_d1h_inc, cfg->dfm_d100h_inc);
+	fprintf(fstream, "SIM CONFIG SANTA ANA FREQUENCY: %f DURATION: %d days \n", cfg->sa_freq_yr, cfg->sa_num_days);
+	fprintf(fstream, "SIM CONFIG SEED: ");
+	if ( cfg->rng_seed_table )	{
+		fprintf(fstream, "TABLE");
+		}
+	else	{
+		fprintf(fstream, "%d", cfg->rng_seed);
+		}
+	fprintf(fstream, " THREADS: %d \n", cfg->num_threads);
+	fprintf(fstream, "SIM CONFIG TILE CACHE: ");
+	if ( cfg->tile_cache_mb > 0 )	{
+		fprintf(fstream, "%d MB \n", cfg->tile_cache_mb);
+		}
+	else	{
+		fprintf(fstream, "NULL \n");
+		}
+	fprintf(fstream, "SIM CONFIG ROS TABLE: ");
+	if ( cfg->ros_tbl_type == EnumRosTableNone )	{
+		fprintf(fstream, "NULL \n");
+		}
+	else	{
+		fprintf(fstream, "%s ENTRIES: %d STEPS: %f %f %f %f MAX REL ERROR: %f \n",
+				(cfg->ros_tbl_type == EnumRosTableValidate) ? "VALIDATE" : "LOOKUP", cfg->ros_tbl_entries,
+				cfg->ros_tbl_moist_step, cfg->ros_tbl_wsp_step, cfg->ros_tbl_az_step, cfg->ros_tbl_slp_step,
+				cfg->ros_tbl_max_rel_err);
+		}
+
+	return;
+	}
+
+void FreeSimConfig(void * vptr)	{
+	SimConfig * cfg = NULL;
+
+	if ( vptr != NULL )	{
+		cfg = (SimConfig *) vptr;
+		free(cfg);
+		}
+	cfg = NULL;
+
+	return;
+	}
+
+/* end of SimConfig.c */
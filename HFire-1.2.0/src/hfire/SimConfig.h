@@ -0,0 +1,236 @@
+/*!
+ * \file SimConfig.h
+ * \brief Simulation properties parsed and validated once when the configuration file is loaded.
+ *
+ * \sa Check the \htmlonly <a href="config_file_doc.html">config file documentation</a> \endhtmlonly
+ * \author Marco Morais
+ * \date 2000-2001
+ *
+ *	HFire (Highly Optmized Tolerance Fire Spread Model) Library
+ *	Copyright (C) 2001 Marco Morais
+ *
+ *	This library is free software; you can redistribute it and/or
+ *	modify it under the terms of the GNU Lesser General Public
+ *	License as published by the Free Software Foundation; either
+ *	version 2.1 of the License, or (at your option) any later version.
+ *
+ *	This library is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *	Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public
+ *	License along with this library; if not, write to the Free Software
+ *	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef	SimConfig_H
+#define SimConfig_H
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "Err.h"
+
+/*
+ *********************************************************
+ * DEFINES, ENUMS
+ *********************************************************
+ */
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+enum EnumExtinctionType_	{
+	EnumExtinctionUnknown	= 0,
+	EnumExtinctionConsume	= 1,
+	EnumExtinctionReignite	= 2
+	};
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+/*! \enum EnumSpreadEngine_
+ *	\brief method used to advance the fire front through a timestep
+ */
+enum EnumSpreadEngine_	{
+	EnumSpreadEngineSweep		= 0,		/*!< fixed iterations over every burning cell */
+	EnumSpreadEngineEvent		= 1			/*!< ignitions processed in order of arrival time */
+	};
+
+/*! \enum EnumAdaptiveTimestep_
+ *	\brief scope of the maximum rate of spread used to size sweep iterations
+ */
+enum EnumAdaptiveTimestep_	{
+	EnumAdaptiveTimestepGlobal	= 0,		/*!< all fires iterate together */
+	EnumAdaptiveTimestepFire	= 1			/*!< each fire iterates independently */
+	};
+
+/*! \enum EnumIgnitionType_
+ *	\brief method used to decide when and where ignitions occur
+ */
+enum EnumIgnitionType_	{
+	EnumIgnitionFixed			= 0,		/*!< ignitions read from file on the first timestep */
+	EnumIgnitionRandU			= 1,		/*!< random ignitions uniform over the domain */
+	EnumIgnitionRandS			= 2			/*!< random ignitions weighted by a raster of probabilities */
+	};
+
+/*! \enum EnumWindAdjust_
+ *	\brief windspeed adjustment factor correcting windspeed at reference height to midflame
+ */
+enum EnumWindAdjust_	{
+	EnumWindAdjustAB79			= 0,		/*!< Albini and Baughman (1979) */
+	EnumWindAdjustBHP			= 1,		/*!< BehavePlus */
+	EnumWindAdjustNone			= 2			/*!< windspeed is used unadjusted */
+	};
+
+/*! \enum EnumRosTableType_
+ *	\brief use of the table of precomputed rates of spread
+ */
+enum EnumRosTableType_	{
+	EnumRosTableNone			= 0,		/*!< rates of spread are calculated directly */
+	EnumRosTableLookup			= 1,		/*!< rates of spread are looked up in the table */
+	EnumRosTableValidate		= 2			/*!< looked up rates of spread are compared to direct calculation */
+	};
+
+/*
+ *********************************************************
+ * STRUCTS, TYPEDEFS
+ *********************************************************
+ */
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+typedef enum EnumExtinctionType_ EnumExtinctionType;
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+/*! Type name for EnumSpreadEngine_
+ *	\sa For a list of constants goto EnumSpreadEngine_
+ */
+typedef enum EnumSpreadEngine_ EnumSpreadEngine;
+
+/*! Type name for EnumAdaptiveTimestep_
+ *	\sa For a list of constants goto EnumAdaptiveTimestep_
+ */
+typedef enum EnumAdaptiveTimestep_ EnumAdaptiveTimestep;
+
+/*! Type name for EnumIgnitionType_
+ *	\sa For a list of constants goto EnumIgnitionType_
+ */
+typedef enum EnumIgnitionType_ EnumIgnitionType;
+
+/*! Type name for EnumWindAdjust_
+ *	\sa For a list of constants goto EnumWindAdjust_
+ */
+typedef enum EnumWindAdjust_ EnumWindAdjust;
+
+/*! Type name for EnumRosTableType_
+ *	\sa For a list of constants goto EnumRosTableType_
+ */
+typedef enum EnumRosTableType_ EnumRosTableType;
+
+/*! Type name for SimConfig_
+ *	\sa For a list of members goto SimConfig_
+ */
+typedef struct SimConfig_ SimConfig;
+
+/*! \struct SimConfig_ SimConfig.h "SimConfig.h"
+ *	\brief typed copy of the simulation properties read during a run
+ *
+ *	Values are converted and range checked when the configuration file is loaded, so modules
+ *	reading them during the simulation do not retrieve or parse strings from the properties table.
+ */
+struct SimConfig_	{
+	/*! simulation start year, month, day, and hour */
+	int start_yr, start_mo, start_dy, start_hr;
+	/*! simulation end year, month, day, and hour */
+	int end_yr, end_mo, end_dy, end_hr;
+	/*! duration of simulation timestep, in seconds */
+	int timestep_secs;
+	/*! method used to advance the fire front */
+	EnumSpreadEngine spread_engine;
+	/*! scope of the adaptive iteration timestep */
+	EnumAdaptiveTimestep adaptive_timestep;
+	/*! fire ellipse adjustment factor */
+	double ell_adj;
+	/*! state of cell after extinction */
+	EnumExtinctionType ext_type;
+	/*! extinction on rate of spread enabled (1) or disabled (0) */
+	int ext_ros_enabled;
+	/*! rate of spread below which a cell is extinguished, in m/s */
+	double ext_ros_mps;
+	/*! extinction on hours burning enabled (1) or disabled (0) */
+	int ext_hrs_enabled;
+	/*! hours burning at which a cell is extinguished, at most CELL_PLANE_HOURS_MAX */
+	int ext_hrs;
+	/*! method used to decide when and where ignitions occur */
+	EnumIgnitionType ig_type;
+	/*! average number of random ignitions per year */
+	double ig_freq_yr;
+	/*! windspeed adjustment factor applied to windspeed at reference height */
+	EnumWindAdjust wsp_waf;
+	/*! increment of 10 hour dead fuel moisture to 1 hour dead fuel moisture, as a fraction */
+	double dfm_d1h_inc;
+	/*! increment of 10 hour dead fuel moisture to 100 hour dead fuel moisture, as a fraction */
+	double dfm_d100h_inc;
+	/*! stand age of every cell when STAND_AGE_TYPE is FIXED */
+	int std_age_fixed;
+	/*! fuel model of every cell when FUELS_REGROWTH_TYPE is FIXED */
+	int fuels_fixed_num;
+	/*! average number of Santa Ana events per year */
+	double sa_freq_yr;
+	/*! duration of each Santa Ana event, in days */
+	int sa_num_days;
+	/*! random number seed drawn from the seed table (1) or given by rng_seed (0) */
+	int rng_seed_table;
+	/*! random number seed, when not drawn from the seed table */
+	int rng_seed;
+	/*! number of worker threads */
+	int num_threads;
+	/*! memory used by the tiles of each TILED raster, in MB, or 0 for the default */
+	int tile_cache_mb;
+	/*! use of the table of precomputed rates of spread */
+	EnumRosTableType ros_tbl_type;
+	/*! entries of rate of spread table per fuel model */
+	int ros_tbl_entries;
+	/*! quantization steps of rate of spread table for moisture, windspeed, azimuth, and slope */
+	double ros_tbl_moist_step, ros_tbl_wsp_step, ros_tbl_az_step, ros_tbl_slp_step;
+	/*! largest relative error of rate of spread table reported in validation mode */
+	double ros_tbl_max_rel_err;
+	};
+
+/*
+ *********************************************************
+ * MACROS
+ *********************************************************
+ */
+
+/*
+ *********************************************************
+ * PUBLIC FUNCTIONS
+ *********************************************************
+ */
+
+/*! \fn SimConfig * InitSimConfig()
+ * 	\brief Initializes a SimConfig with all features disabled.
+ *
+ * 	\retval SimConfig* Ptr to SimConfig, or NULL if unable to initialize
+ */
+SimConfig * InitSimConfig();
+
+/*! \fn void SimConfigDumpToStream(SimConfig * cfg, FILE * fstream)
+ * 	\brief Writes the values of SimConfig to stream.
+ *
+ * 	\param cfg SimConfig
+ * 	\param fstream an open stream to dump to, can be stdout, stderr, or open FILE stream
+ */
+void SimConfigDumpToStream(SimConfig * cfg, FILE * fstream);
+
+/*! \fn void FreeSimConfig(void * vptr)
+ * 	\brief Frees memory associated with SimConfig structure.
+ *
+ *	\sa SimConfig
+ * 	\param vptr ptr to SimConfig
+ */
+void FreeSimConfig(void * vptr);
+
+#endif SimConfig_H		/* end of SimConfig.h */
@@ -24,35 +24,147 @@
  
 #include "StandAge.h"
 
+/* state shared with the workers counting and incrementing stand age */
+typedef struct	{
+	FireYear * fy;								/* fire ids of completed fire season */
+	GridData * std_age;							/* stand age */
+	GridDataView view;							/* stand age resolved to its data type */
+	int is_flat;								/* 1 if stand age cells are contiguous and match fire ids */
+	StandAgeYearStats * stats;					/* counts of each worker */
+}
+stand_age_job_t;
+
+static int IncrementStandAgeRows(void * arg, int worker, int begin, int end);
+
+/* clamps stand age to a bin of the age at burn histogram */
+#define STAND_AGE_HIST_BIN(age)						( ((age) < 1) ? 0 : ( ((age) > STAND_AGE_NUM_HIST_BINS) ? STAND_AGE_NUM_HIST_BINS - 1 : (int) (age) - 1 ) )
+
+/* counts and increments stand age of cells [k, kend), cells a ptr of ctype to the contiguous stand ages */
+#define STAND_AGE_YEAR_KERNEL(ctype, cells)	{										\
+			for( ; k < kend; k++)	{												\
+				id = ids[k];														\
+				if ( id == FIRE_YEAR_ID_UNBURNABLE )	{							\
+					++st->num_unburnable;											\
+					continue;														\
+				}																	\
+				age = (cells)[k];													\
+				bin = STAND_AGE_HIST_BIN(age);										\
+				if ( id == FIRE_YEAR_ID_DEFAULT )	{								\
+					++st->num_unburned;												\
+					++st->hist_unburned[bin];										\
+				}																	\
+				else	{															\
+					++st->hist_burned[bin];											\
+					if ( CELL_PLANE_WORD_SA(sana[k]) == FIRE_YEAR_CELL_BURNED_SA )	{	\
+						++st->hist_burned_sa[bin];									\
+					}																\
+				}																	\
+				if ( id > FIRE_YEAR_ID_DEFAULT )	{								\
+					(cells)[k] = (ctype) 1;											\
+				}																	\
+				else	{															\
+					++age;															\
+					(cells)[k] = (ctype) age;										\
+				}																	\
+			}																		\
+		}
+
 int IncrementStandAge(FireYear * fy, GridData * std_age)	{
-	int domain_rows;							/* size of domain rows */
-	int domain_cols;							/* size of domain columns */
-	long int age;
-	int burn;
-	int i, j;
-		
+	StandAgeYearStats stats;
+
+	return IncrementStandAgeYearStats(NULL, fy, std_age, &stats);
+}
+
+int IncrementStandAgeYearStats(ThreadPool * tp, FireYear * fy, GridData * std_age, StandAgeYearStats * stats)	{
+	stand_age_job_t job;
+	int num_workers = THREAD_POOL_NUM_WORKERS(tp);
+	int status, w, b;
+
 	/* check args */		
-	if ( fy == NULL || fy->id == NULL || std_age == NULL )	{
+	if ( fy == NULL || fy->id == NULL || fy->plane == NULL || std_age == NULL || stats == NULL
+			|| InitGridDataView(std_age, &job.view) )	{
 		ERR_ERROR("Arguments supplied to increment stand age invalid. \n", ERR_EINVAL);
 	}
+	if ( std_age->gtype == EnumBitGrid )	{
+		ERR_ERROR("Data type of stand age GridData not supported. \n", ERR_EUNIMPL);
+	}
+	job.fy = fy;
+	job.std_age = std_age;
+	job.is_flat = ( job.view.cells != NULL && job.view.nrows == INTTWODARRAY_SIZE_ROW(fy->id) 
+					&& job.view.ncols == INTTWODARRAY_SIZE_COL(fy->id) );
+	if ( (job.stats = (StandAgeYearStats *) calloc(num_workers, sizeof(StandAgeYearStats))) == NULL )	{
+		ERR_ERROR("Unable to allocate memory for stand age counts. \n", ERR_ENOMEM);
+	}
+
+	/* count and increment stand age, each worker over its own rows */
+	status = ThreadPoolParallelFor(tp, INTTWODARRAY_SIZE_ROW(fy->id), STAND_AGE_ROWS_PER_JOB, IncrementStandAgeRows, &job);
 
-	/* increment stand age */
-	domain_rows = INTTWODARRAY_SIZE_ROW(fy->id); 
-	domain_cols = INTTWODARRAY_SIZE_COL(fy->id);	
-	for(i = 0; i < domain_rows; i++)	{
-		for(j = 0; j < domain_cols; j++)	{
-			if ( FireYearGetCellIDRowCol(fy, i, j, &burn) ) {
-				ERR_ERROR("Unable to retrieve FireYear data, stand age not incremented. \n", ERR_EBADFUNC);
-      }
-			if ( burn > FIRE_YEAR_ID_DEFAULT )	{
+	/* sum counts of all workers */
+	memset(stats, 0, sizeof(StandAgeYearStats));
+	for(w = 0; w < num_workers; w++)	{
+		stats->num_unburnable += job.stats[w].num_unburnable;
+		stats->num_unburned += job.stats[w].num_unburned;
+		for(b = 0; b < STAND_AGE_NUM_HIST_BINS; b++)	{
+			stats->hist_unburned[b] += job.stats[w].hist_unburned[b];
+			stats->hist_burned[b] += job.stats[w].hist_burned[b];
+			stats->hist_burned_sa[b] += job.stats[w].hist_burned_sa[b];
+		}
+	}
+	free(job.stats);
+	if ( status )	{
+		ERR_ERROR("Unable to retrieve FireYear data, stand age not incremented. \n", status);
+	}
+	
+	return ERR_SUCCESS;
+}
+
+/* ThreadPoolFunc counting and incrementing stand age of rows [begin, end) */
+static int IncrementStandAgeRows(void * arg, int worker, int begin, int end)	{
+	stand_age_job_t * job = (stand_age_job_t *) arg;
+	StandAgeYearStats * st = &job->stats[worker];
+	const int * ids = INTTWODARRAY_GET_FLAT(job->fy->id);
+	const unsigned short * sana = job->fy->plane->cells;
+	int ncols = INTTWODARRAY_SIZE_COL(job->fy->id);
+	long int k, kend;
+	long int age = 0;
+	int id, bin;
+	int i, j;
+
+	if ( job->is_flat )	{
+		/* single pass over contiguous cells, data type resolved once */
+		k = (long int) begin * ncols;
+		kend = (long int) end * ncols;
+		GRID_DATA_VIEW_DISPATCH(&job->view, STAND_AGE_YEAR_KERNEL);
+		return ERR_SUCCESS;
+	}
+	for(i = begin; i < end; i++)	{
+		for(j = 0; j < ncols; j++)	{
+			k = (long int) i * ncols + j;
+			id = ids[k];
+			if ( id == FIRE_YEAR_ID_UNBURNABLE )	{
+				++st->num_unburnable;
+				continue;
+			}
+			GRID_DATA_GET_DATA(job->std_age, i, j, age);
+			bin = STAND_AGE_HIST_BIN(age);
+			if ( id == FIRE_YEAR_ID_DEFAULT )	{
+				++st->num_unburned;
+				++st->hist_unburned[bin];
+			}
+			else	{
+				++st->hist_burned[bin];
+				if ( CELL_PLANE_WORD_SA(sana[k]) == FIRE_YEAR_CELL_BURNED_SA )	{
+					++st->hist_burned_sa[bin];
+				}
+			}
+			if ( id > FIRE_YEAR_ID_DEFAULT )	{
 				/* cell burned, reset stand age */
-				GRID_DATA_SET_DATA(std_age, i, j, 1);
+				GRID_DATA_SET_DATA(job->std_age, i, j, 1);
 			}
-			else if ( burn != FIRE_YEAR_ID_UNBURNABLE )	{
+			else	{
 				/* cell not burned, increment stand age */				
-				GRID_DATA_GET_DATA(std_age, i, j, age);
 				++age;
-				GRID_DATA_SET_DATA(std_age, i, j, age);				
+				GRID_DATA_SET_DATA(job->std_age, i, j, age);				
 			}
 		}
 	}		
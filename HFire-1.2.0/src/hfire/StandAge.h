@@ -31,6 +31,7 @@
 
 #include "GridData.h"
 #include "FireYear.h"
+#include "ThreadPool.h"
 #include "Err.h"
 
 /*
@@ -38,12 +39,40 @@
  * DEFINES, ENUMS
  *********************************************************
  */
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+/* number of bins in the age at burn histogram, stand ages beyond the last bin are counted in it */
+#define STAND_AGE_NUM_HIST_BINS						(100)
+
+/* number of rows handed to a worker each time it requests work */
+#define STAND_AGE_ROWS_PER_JOB						(16)
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
  
 /*
  *********************************************************
  * STRUCTS, TYPEDEFS
  *********************************************************
  */
+
+/*! \struct StandAgeYearStats_ StandAge.h "StandAge.h"
+ *	\brief Counts of cells by fire id and stand age at the end of a fire season, before stand age is incremented
+ */ 
+typedef struct StandAgeYearStats_ StandAgeYearStats;
+
+struct StandAgeYearStats_	{
+	/*! number of cells with id FIRE_YEAR_ID_UNBURNABLE */
+	long int num_unburnable;
+	/*! number of cells with id FIRE_YEAR_ID_DEFAULT */
+	long int num_unburned;
+	/*! number of unburned cells by stand age, bin 0 holds age 1 */
+	long int hist_unburned[STAND_AGE_NUM_HIST_BINS];
+	/*! number of burned cells by stand age */
+	long int hist_burned[STAND_AGE_NUM_HIST_BINS];
+	/*! number of cells burned during Santa Ana by stand age */
+	long int hist_burned_sa[STAND_AGE_NUM_HIST_BINS];
+	};
  
 /*
  *********************************************************
@@ -75,4 +104,20 @@
  */	
 int IncrementStandAge(FireYear * fy, GridData * std_age);
 
+/*! \fn int IncrementStandAgeYearStats(ThreadPool * tp, FireYear * fy, GridData * std_age, StandAgeYearStats * stats)
+ *	\brief Counts cells by fire id and stand age, then increments stand age as IncrementStandAge, in a single pass over cells.
+ *
+ *	Rows are divided among the workers of tp, each counting into its own StandAgeYearStats which are 
+ *	summed once all rows are complete, so counts do not depend on the number of workers.
+ *	\sa FireYear
+ *	\sa GridData
+ *	\sa ThreadPool
+ *	\param tp workers sharing the rows of the domain, NULL to use the calling thread only
+ *	\param fy FireYear of fire perimeters for completed fire season
+ *	\param std_age raster of current stand age, values will be updated upon successful return
+ *	\param stats receives counts computed from stand age prior to increment
+ *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
+ */	
+int IncrementStandAgeYearStats(ThreadPool * tp, FireYear * fy, GridData * std_age, StandAgeYearStats * stats);
+
 #endif StandAge_H		/* end of StandAge.h */
@@ -0,0 +1,220 @@
+/*!
+ * \file TerrainDist.c
+ *
+ * \author Marco Morais
+ * \date 2000-2001
+ *
+ *	HFire (Highly Optmized Tolerance Fire Spread Model) Library
+ *	Copyright (C) 2001 Marco Morais
+ *
+ *	This library is free software; you can redistribute it and/or
+ *	modify it under the terms of the GNU Lesser General Public
+ *	License as published by the Free Software Foundation; either
+ *	version 2.1 of the License, or (at your option) any later version.
+ *
+ *	This library is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *	Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public
+ *	License along with this library; if not, write to the Free Software
+ *	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "TerrainDist.h"
+
+static unsigned short TerrainDistDoubleToHalf(double d);
+
+TerrainDist * InitTerrainDistFromGridData(GridData * elev, EnumTerrainDistType type)	{
+	TerrainDist * td = NULL;
+	float * fdata = NULL;
+	unsigned short * hdata = NULL;
+	double * elev_row[2] = {NULL, NULL};	/* elevation of row of cell, and of row south of cell */
+	double * swap_row = NULL;
+	double cellsz2, cell_elev, nbr_elev, dz, dist;
+	long int idx;
+	int i, j, k, nbr_i, nbr_j;
+
+	/* check args */
+	if ( elev == NULL || elev->ghdr == NULL )	{
+		ERR_ERROR_CONTINUE("GridData supplied to TerrainDist not initialized. \n", ERR_EINVAL);
+		return td;
+		}
+
+	if ( (td = (TerrainDist *) malloc(sizeof(TerrainDist))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to allocate memory for TerrainDist. \n", ERR_ENOMEM);
+		return td;
+		}
+	td->nrows = elev->ghdr->nrows;
+	td->ncols = elev->ghdr->ncols;
+	td->cellsz = (double) elev->ghdr->cellsize;
+	td->type = type;
+	td->data = NULL;
+
+	/* stored direction of each neighbor, either in this cell or as the opposite direction in the neighbor */
+	for(k = 0; k < EIGHTNBR_NUM_NBR_CELLS; k++)	{
+		if ( k >= EIGHTNBR_EAST && k <= EIGHTNBR_SOUTHWEST )	{
+			td->offset[k] = k - EIGHTNBR_EAST;
+			}
+		else	{
+			td->offset[k] = ((long int) egtnbr_row[k] * td->ncols + egtnbr_col[k]) * TERRAIN_DIST_NUM_STORED
+								+ ((k + 4) % EIGHTNBR_NUM_NBR_CELLS) - EIGHTNBR_EAST;
+			}
+		}
+	for(k = 0; k < 32; k++)	{
+		td->half_scale[k] = ldexp(1.0, (k == 0) ? -24 : k - 25);
+		}
+
+	if ( type == EnumTerrainDistHalf )	{
+		td->data = malloc(sizeof(unsigned short) * TERRAIN_DIST_NUM_STORED * (size_t) td->nrows * td->ncols);
+		}
+	else	{
+		td->data = malloc(sizeof(float) * TERRAIN_DIST_NUM_STORED * (size_t) td->nrows * td->ncols);
+		}
+	if ( td->data == NULL 
+			|| (elev_row[0] = (double *) malloc(sizeof(double) * td->ncols)) == NULL
+			|| (elev_row[1] = (double *) malloc(sizeof(double) * td->ncols)) == NULL )	{
+		if ( elev_row[0] != NULL )
+			free(elev_row[0]);
+		FreeTerrainDist(td);
+		ERR_ERROR_CONTINUE("Unable to allocate memory for TerrainDist data. \n", ERR_ENOMEM);
+		return NULL;
+		}
+	fdata = (float *) td->data;
+	hdata = (unsigned short *) td->data;
+
+	/* calculate distance to E, SE, S, and SW neighbors of each cell, which are in the row of cell or the next */
+	cellsz2 = td->cellsz * td->cellsz;
+	GetRowAsDblGridData(elev, 0, elev_row[1]);
+	for(i = 0; i < td->nrows; i++)	{
+		swap_row = elev_row[0];
+		elev_row[0] = elev_row[1];
+		elev_row[1] = swap_row;
+		if ( i + 1 < td->nrows )	{
+			GetRowAsDblGridData(elev, i + 1, elev_row[1]);
+			}
+		for(j = 0; j < td->ncols; j++)	{
+			cell_elev = elev_row[0][j];
+			idx = ((long int) i * td->ncols + j) * TERRAIN_DIST_NUM_STORED;
+			for(k = EIGHTNBR_EAST; k <= EIGHTNBR_SOUTHWEST; k++)	{
+				nbr_i = EIGHTNBR_ROW_INDEX_AT_AZIMUTH(i, k);
+				nbr_j = EIGHTNBR_COL_INDEX_AT_AZIMUTH(j, k);
+				nbr_elev = cell_elev;
+				if ( nbr_i >= 0 && nbr_j >= 0 && nbr_i < td->nrows && nbr_j < td->ncols )	{
+					nbr_elev = elev_row[nbr_i - i][nbr_j];
+					}
+				dz = nbr_elev - cell_elev;
+				dist = sqrt(egtnbr_dist2[k] * cellsz2 + dz * dz);
+				if ( type == EnumTerrainDistHalf )	{
+					if ( dist >= TERRAIN_DIST_HALF_MAX )	{
+						free(elev_row[0]);
+						free(elev_row[1]);
+						FreeTerrainDist(td);
+						ERR_ERROR_CONTINUE("Terrain distance exceeds range of half precision, use FLOAT. \n", ERR_ERANGE);
+						return NULL;
+						}
+					hdata[idx + k - EIGHTNBR_EAST] = TerrainDistDoubleToHalf(dist);
+					}
+				else	{
+					fdata[idx + k - EIGHTNBR_EAST] = (float) dist;
+					}
+				}
+			}
+		}
+	free(elev_row[0]);
+	free(elev_row[1]);
+
+	return td;
+	}
+
+void TerrainDistGetEightNbr(const TerrainDist * td, int i, int j, double * dist)	{
+	const float * fdata = NULL;
+	const unsigned short * hdata = NULL;
+	long int idx = ((long int) i * td->ncols + j) * TERRAIN_DIST_NUM_STORED;
+	int k, nbr_i, nbr_j;
+	int is_edge = ( i == 0 || j == 0 || i == td->nrows - 1 || j == td->ncols - 1 );
+
+	if ( td->type == EnumTerrainDistHalf )	{
+		hdata = (const unsigned short *) td->data + idx;
+		}
+	else	{
+		fdata = (const float *) td->data + idx;
+		}
+	for(k = 0; k < EIGHTNBR_NUM_NBR_CELLS; k++)	{
+		/* cells on the edge of domain use planar distance for neighbors outside domain, which are not stored */
+		if ( is_edge )	{
+			nbr_i = EIGHTNBR_ROW_INDEX_AT_AZIMUTH(i, k);
+			nbr_j = EIGHTNBR_COL_INDEX_AT_AZIMUTH(j, k);
+			if ( nbr_i < 0 || nbr_j < 0 || nbr_i >= td->nrows || nbr_j >= td->ncols )	{
+				dist[k] = sqrt(egtnbr_dist2[k]) * td->cellsz;
+				continue;
+				}
+			}
+		if ( td->type == EnumTerrainDistHalf )	{
+			dist[k] = (((hdata[td->offset[k]] >> 10) == 0) ? 0 : 1024) + (hdata[td->offset[k]] & 0x3FF);
+			dist[k] *= td->half_scale[hdata[td->offset[k]] >> 10];
+			}
+		else	{
+			dist[k] = fdata[td->offset[k]];
+			}
+		}
+
+	return;
+	}
+
+void TerrainDistDumpToStream(TerrainDist * td, FILE * fstream)	{
+	if ( td == NULL || fstream == NULL )	{
+		return;
+		}
+
+	fprintf(fstream, "TERRAIN DIST... TYPE: %s ROWS: %d COLS: %d MEMORY: %.1f MB \n",
+		(td->type == EnumTerrainDistHalf) ? "HALF" : "FLOAT", td->nrows, td->ncols,
+		TERRAIN_DIST_NUM_BYTES(td) / (1024.0 * 1024.0));
+
+	return;
+	}
+
+void FreeTerrainDist(void * vptr)	{
+	TerrainDist * td = NULL;
+
+	if ( vptr != NULL )	{
+		td = (TerrainDist *) vptr;
+		if ( td->data != NULL )	{
+			free(td->data);
+			}
+		free(td);
+		}
+	td = NULL;
+	return;
+	}
+
+/*
+ * Converts a non-negative distance less than TERRAIN_DIST_HALF_MAX to IEEE half precision,
+ * rounding to the nearest representable value.
+ */
+unsigned short TerrainDistDoubleToHalf(double d)	{
+	double m;
+	int e, mant;
+
+	if ( d <= 0.0 )	{
+		return 0;
+		}
+
+	/* d = m * 2^e with m in [0.5, 1), half stores (1 + mant / 1024) * 2^(e - 1) with biased exponent e + 14 */
+	m = frexp(d, &e);
+	e += 14;
+	if ( e <= 0 )	{
+		/* subnormal, d = mant * 2^-24 */
+		return (unsigned short) floor(ldexp(d, 24) + 0.5);
+		}
+	mant = (int) floor((2.0 * m - 1.0) * 1024.0 + 0.5);
+	if ( mant == 1024 )	{
+		mant = 0;
+		e++;
+		}
+
+	return (unsigned short) ((e << 10) | mant);
+	}
+
+/* end of TerrainDist.c */
@@ -0,0 +1,155 @@
+/*!
+ * \file TerrainDist.h
+ * \brief Precomputed distance along the ground between each cell and its neighbors.
+ *
+ * \author Marco Morais
+ * \date 2000-2001
+ *
+ *	HFire (Highly Optmized Tolerance Fire Spread Model) Library
+ *	Copyright (C) 2001 Marco Morais
+ *
+ *	This library is free software; you can redistribute it and/or
+ *	modify it under the terms of the GNU Lesser General Public
+ *	License as published by the Free Software Foundation; either
+ *	version 2.1 of the License, or (at your option) any later version.
+ *
+ *	This library is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *	Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public
+ *	License along with this library; if not, write to the Free Software
+ *	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef	TerrainDist_H
+#define TerrainDist_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+
+#include "EightNbr.h"
+#include "GridData.h"
+#include "Err.h"
+
+/*
+ *********************************************************
+ * DEFINES, ENUMS
+ *********************************************************
+ */
+
+/*! \def TERRAIN_DIST_NUM_STORED
+ *	\brief number of distances stored per cell, the remaining neighbors are stored by adjacent cells
+ */
+#define TERRAIN_DIST_NUM_STORED				(4)
+
+/*! \def TERRAIN_DIST_HALF_MAX
+ *	\brief largest distance representable in half precision
+ */
+#define TERRAIN_DIST_HALF_MAX				(65504.0)
+
+/*! \enum EnumTerrainDistType_
+ *	\brief precision used to store distances
+ */
+enum EnumTerrainDistType_	{
+	EnumTerrainDistFloat		= 0,		/*!< 32 bit IEEE single precision */
+	EnumTerrainDistHalf			= 1			/*!< 16 bit IEEE half precision */
+	};
+
+/*! Type name for EnumTerrainDistType_
+ *	\sa For a list of constants goto EnumTerrainDistType_
+ */
+typedef enum EnumTerrainDistType_ EnumTerrainDistType;
+
+/*
+ *********************************************************
+ * STRUCTS, TYPEDEFS
+ *********************************************************
+ */
+
+/*! Type name for TerrainDist_
+ *	\sa For a list of members goto TerrainDist_
+ */
+typedef struct TerrainDist_ TerrainDist;
+
+/*! \struct TerrainDist_ TerrainDist.h "TerrainDist.h"
+ *	\brief distance along the ground from each cell center to the centers of its eight neighbors
+ *
+ *	Distance is symmetric, so each cell stores only the distance to its E, SE, S, and SW neighbors.
+ *	The distance to the N, NE, W, and NW neighbors is read from the opposite direction of that neighbor.
+ */
+struct TerrainDist_	{
+	/*! number of rows in domain */
+	int nrows;
+	/*! number of columns in domain */
+	int ncols;
+	/*! cell resolution, in m */
+	double cellsz;
+	/*! precision of stored distances */
+	EnumTerrainDistType type;
+	/*! TERRAIN_DIST_NUM_STORED distances per cell, float or unsigned short depending on type */
+	void * data;
+	/*! offset of the stored distance toward each neighbor, relative to the first distance of the cell */
+	long int offset[EIGHTNBR_NUM_NBR_CELLS];
+	/*! value of a half precision exponent, used to expand stored distances */
+	double half_scale[32];
+	};
+
+/*
+ *********************************************************
+ * MACROS
+ *********************************************************
+ */
+
+/*! \def TERRAIN_DIST_NUM_BYTES
+ *	\brief memory used to store distances, in bytes
+ */
+#define TERRAIN_DIST_NUM_BYTES(td)			((double)(td)->nrows * (td)->ncols * TERRAIN_DIST_NUM_STORED \
+												* ((td)->type == EnumTerrainDistHalf ? sizeof(unsigned short) : sizeof(float)))
+
+/*
+ *********************************************************
+ * PUBLIC FUNCTIONS
+ *********************************************************
+ */
+
+/*! \fn TerrainDist * InitTerrainDistFromGridData(GridData * elev, EnumTerrainDistType type)
+ * 	\brief Calculates distance along the ground between every cell of elev and its neighbors.
+ *
+ *	Half precision is only permitted when every distance is less than TERRAIN_DIST_HALF_MAX.
+ * 	\param elev GridData of elevation values, in m
+ * 	\param type precision used to store distances
+ * 	\retval TerrainDist* Ptr to TerrainDist, or NULL if unable to initialize
+ */
+TerrainDist * InitTerrainDistFromGridData(GridData * elev, EnumTerrainDistType type);
+
+/*! \fn void TerrainDistGetEightNbr(const TerrainDist * td, int i, int j, double * dist)
+ * 	\brief Retrieves distance along the ground from cell i,j to each of its neighbors.
+ *
+ *	Neighbors outside the domain are assigned the planar distance.
+ * 	\param td TerrainDist
+ * 	\param i row of cell
+ * 	\param j column of cell
+ * 	\param dist array of EIGHTNBR_NUM_NBR_CELLS receiving distance to each neighbor, in m
+ */
+void TerrainDistGetEightNbr(const TerrainDist * td, int i, int j, double * dist);
+
+/*! \fn void TerrainDistDumpToStream(TerrainDist * td, FILE * fstream)
+ * 	\brief Writes precision and memory usage of TerrainDist to stream.
+ *
+ * 	\param td TerrainDist
+ * 	\param fstream an open stream to dump to, can be stdout, stderr, or open FILE stream
+ */
+void TerrainDistDumpToStream(TerrainDist * td, FILE * fstream);
+
+/*! \fn void FreeTerrainDist(void * vptr)
+ * 	\brief Frees memory associated with TerrainDist structure.
+ *
+ *	\sa TerrainDist
+ * 	\param vptr ptr to TerrainDist
+ */
+void FreeTerrainDist(void * vptr);
+
+#endif TerrainDist_H		/* end of TerrainDist.h */
@@ -0,0 +1,460 @@
+/*!
+ * \file WeatherStream.c
+ *
+ * \author Marco Morais
+ * \date 2000-2001
+ *
+ *	HFire (Highly Optmized Tolerance Fire Spread Model) Library
+ *	Copyright (C) 2001 Marco Morais
+ *
+ *	This library is free software; you can redistribute it and/or
+ *	modify it under the terms of the GNU Lesser General Public
+ *	License as published by the Free Software Foundation; either
+ *	version 2.1 of the License, or (at your option) any later version.
+ *
+ *	This library is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *	Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public
+ *	License along with this library; if not, write to the Free Software
+ *	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "WeatherStream.h"
+
+/*
+ *********************************************************
+ * NON PUBLIC FUNCTIONS
+ *********************************************************
+ */
+
+static int AcquireRecWeatherStream(WeatherStream * ws, int rec);
+
+static void ReleaseRecWeatherStream(WeatherStream * ws, int rec);
+
+static int ReadGridsWeatherStream(WeatherStream * ws, int rec, GridData ** grids);
+
+static void RequestWeatherStreamCursor(WeatherStreamCursor * wc, int rec);
+
+static void WaitWeatherStreamCursor(WeatherStreamCursor * wc);
+
+#ifdef USING_UNIX
+static void * LoaderMainWeatherStreamCursor(void * arg);
+#endif
+
+WeatherStream * InitWeatherStream(ChHashTable * proptbl, StrTwoDArray * tbl, int mo_col, int dy_col, int hr_col,
+									const int * file_col, int num_grids)	{
+	WeatherStream * ws = NULL;
+	int k, rec, key;
+
+	/* check args */
+	if ( tbl == NULL || file_col == NULL || num_grids < 1 || num_grids > WEATHER_STREAM_MAX_GRIDS
+			|| STRTWODARRAY_SIZE_ROW(tbl) < 1 )	{
+		if ( tbl != NULL )	{
+			FreeStrTwoDArray(tbl);
+			}
+		ERR_ERROR_CONTINUE("Arguments supplied to WeatherStream invalid. \n", ERR_EINVAL);
+		return ws;
+		}
+	for(k = 0; k < num_grids; k++)	{
+		if ( file_col[k] < 0 || file_col[k] >= STRTWODARRAY_SIZE_COL(tbl) )	{
+			FreeStrTwoDArray(tbl);
+			ERR_ERROR_CONTINUE("Atm table supplied to WeatherStream does not list rasters. \n", ERR_EINVAL);
+			return ws;
+			}
+		}
+
+	if ( (ws = (WeatherStream *) calloc(1, sizeof(WeatherStream))) == NULL )	{
+		FreeStrTwoDArray(tbl);
+		ERR_ERROR_CONTINUE("Unable to allocate memory for WeatherStream. \n", ERR_ENOMEM);
+		return ws;
+		}
+	ws->proptbl = proptbl;
+	ws->tbl = tbl;
+	ws->num_grids = num_grids;
+	for(k = 0; k < num_grids; k++)	{
+		ws->file_col[k] = file_col[k];
+		}
+#ifdef USING_UNIX
+	pthread_mutex_init(&ws->mutex, NULL);
+	pthread_cond_init(&ws->cv, NULL);
+#endif
+	if ( (ws->recs = (WeatherStreamRec *) calloc(STRTWODARRAY_SIZE_ROW(tbl), sizeof(WeatherStreamRec))) == NULL )	{
+		FreeWeatherStream(ws);
+		ERR_ERROR_CONTINUE("Unable to allocate memory for WeatherStream. \n", ERR_ENOMEM);
+		return NULL;
+		}
+
+	/* index first record of each hour, the atm table is not scanned again */
+	for(key = 0; key < WEATHER_STREAM_NUM_HOURS; key++)	{
+		ws->rec_of_hour[key] = WEATHER_STREAM_NO_REC;
+		}
+	for(rec = STRTWODARRAY_SIZE_ROW(tbl) - 1; rec >= 0; rec--)	{
+		key = WEATHER_STREAM_HOUR_KEY(atoi(STRTWODARRAY_GET_DATA(tbl, rec, mo_col)),
+					atoi(STRTWODARRAY_GET_DATA(tbl, rec, dy_col)),
+					atoi(STRTWODARRAY_GET_DATA(tbl, rec, hr_col)) / 100);
+		if ( key >= 0 )	{
+			ws->rec_of_hour[key] = rec;
+			}
+		}
+
+	return ws;
+	}
+
+void FreeWeatherStream(void * vptr)	{
+	WeatherStream * ws = NULL;
+	int k, rec;
+
+	if ( vptr != NULL )	{
+		ws = (WeatherStream *) vptr;
+#ifdef USING_UNIX
+		pthread_mutex_destroy(&ws->mutex);
+		pthread_cond_destroy(&ws->cv);
+#endif
+		if ( ws->recs != NULL )	{
+			for(rec = 0; rec < STRTWODARRAY_SIZE_ROW(ws->tbl); rec++)	{
+				for(k = 0; k < WEATHER_STREAM_MAX_GRIDS; k++)	{
+					FreeGridData(ws->recs[rec].grids[k]);
+					}
+				}
+			free(ws->recs);
+			}
+		if ( ws->tbl != NULL )	FreeStrTwoDArray(ws->tbl);
+		free(ws);
+		}
+	ws = NULL;
+
+	return;
+	}
+
+WeatherStreamCursor * InitWeatherStreamCursor(WeatherStream * ws)	{
+	WeatherStreamCursor * wc = NULL;
+
+	/* check args */
+	if ( ws == NULL )	{
+		ERR_ERROR_CONTINUE("WeatherStream not initialized. \n", ERR_EINVAL);
+		return wc;
+		}
+
+	if ( (wc = (WeatherStreamCursor *) calloc(1, sizeof(WeatherStreamCursor))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to allocate memory for WeatherStreamCursor. \n", ERR_ENOMEM);
+		return wc;
+		}
+	wc->ws = ws;
+	wc->cur_rec = WEATHER_STREAM_NO_REC;
+	wc->next_rec = WEATHER_STREAM_NO_REC;
+	wc->next_status = EnumEmptyWeatherStream;
+#ifdef USING_UNIX
+	pthread_mutex_init(&wc->mutex, NULL);
+	pthread_cond_init(&wc->cv, NULL);
+#endif
+
+	/* rasters of first record are used until an hour listed in the atm table is reached */
+	if ( AcquireRecWeatherStream(ws, 0) )	{
+		FreeWeatherStreamCursor(wc);
+		ERR_ERROR_CONTINUE("Unable to read rasters listed in atm table. \n", ERR_EINVAL);
+		return NULL;
+		}
+	wc->cur_rec = 0;
+
+#ifdef USING_UNIX
+	/* records are read synchronously if the thread cannot be started */
+	wc->has_loader = ( pthread_create(&wc->loader, NULL, LoaderMainWeatherStreamCursor, wc) == 0 );
+#endif
+
+	return wc;
+	}
+
+int WeatherStreamSeek(WeatherStreamCursor * wc, int month, int day, int hour)	{
+	WeatherStream * ws = NULL;
+	int rec, key;
+
+	/* check args */
+	if ( wc == NULL )	{
+		ERR_ERROR("WeatherStreamCursor not initialized. \n", ERR_EINVAL);
+		}
+	ws = wc->ws;
+
+	/* hours not listed keep the current rasters */
+	if ( (key = WEATHER_STREAM_HOUR_KEY(month, day, hour)) < 0
+			|| (rec = ws->rec_of_hour[key]) == WEATHER_STREAM_NO_REC || rec == wc->cur_rec )	{
+		return ERR_SUCCESS;
+		}
+
+	/* take the record held in advance if it is the one reached, otherwise acquire the record now */
+	WaitWeatherStreamCursor(wc);
+	if ( wc->next_status == EnumReadyWeatherStream && wc->next_rec == rec )	{
+		wc->next_status = EnumEmptyWeatherStream;
+		}
+	else	{
+		if ( wc->next_status == EnumReadyWeatherStream )	{
+			ReleaseRecWeatherStream(ws, wc->next_rec);
+			wc->next_status = EnumEmptyWeatherStream;
+			}
+		if ( AcquireRecWeatherStream(ws, rec) )	{
+			ERR_ERROR("Unable to read rasters listed in atm table. \n", ERR_EINVAL);
+			}
+		}
+	ReleaseRecWeatherStream(ws, wc->cur_rec);
+	wc->cur_rec = rec;
+
+	/* following record is acquired in the background */
+	if ( rec + 1 < STRTWODARRAY_SIZE_ROW(ws->tbl) )	{
+		RequestWeatherStreamCursor(wc, rec + 1);
+		}
+
+	return ERR_SUCCESS;
+	}
+
+void FreeWeatherStreamCursor(void * vptr)	{
+	WeatherStreamCursor * wc = NULL;
+
+	if ( vptr != NULL )	{
+		wc = (WeatherStreamCursor *) vptr;
+#ifdef USING_UNIX
+		if ( wc->has_loader )	{
+			WaitWeatherStreamCursor(wc);
+			pthread_mutex_lock(&wc->mutex);
+			wc->shutdown = 1;
+			pthread_cond_broadcast(&wc->cv);
+			pthread_mutex_unlock(&wc->mutex);
+			pthread_join(wc->loader, NULL);
+			}
+		pthread_mutex_destroy(&wc->mutex);
+		pthread_cond_destroy(&wc->cv);
+#endif
+		if ( wc->next_status == EnumReadyWeatherStream )	{
+			ReleaseRecWeatherStream(wc->ws, wc->next_rec);
+			}
+		if ( wc->cur_rec != WEATHER_STREAM_NO_REC )	{
+			ReleaseRecWeatherStream(wc->ws, wc->cur_rec);
+			}
+		free(wc);
+		}
+	wc = NULL;
+
+	return;
+	}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Adds a reference to the rasters of a record.  The first cursor to reach a record reads its
+ * rasters, other cursors reaching the record at the same time wait for them to be read.
+ *
+ * Arguments:
+ * ws- WeatherStream
+ * rec- record of atm table
+ *
+ * Returns:
+ * ERR_SUCCESS(0) if operation successful, an error code otherwise in which case no reference is held
+ */
+static int AcquireRecWeatherStream(WeatherStream * ws, int rec)	{
+	WeatherStreamRec * r = &ws->recs[rec];
+	int status = ERR_SUCCESS;
+
+#ifdef USING_UNIX
+	pthread_mutex_lock(&ws->mutex);
+	while ( r->status == EnumPendingWeatherStream )	{
+		pthread_cond_wait(&ws->cv, &ws->mutex);
+		}
+#endif
+	r->refs++;
+	if ( r->status == EnumReadyWeatherStream )	{
+#ifdef USING_UNIX
+		pthread_mutex_unlock(&ws->mutex);
+#endif
+		return ERR_SUCCESS;
+		}
+	r->status = EnumPendingWeatherStream;
+#ifdef USING_UNIX
+	pthread_mutex_unlock(&ws->mutex);
+#endif
+
+	/* the rasters are owned by this thread while pending */
+	status = ReadGridsWeatherStream(ws, rec, r->grids);
+
+#ifdef USING_UNIX
+	pthread_mutex_lock(&ws->mutex);
+#endif
+	if ( status )	{
+		r->refs--;
+		r->status = EnumEmptyWeatherStream;
+		}
+	else	{
+		r->status = EnumReadyWeatherStream;
+		}
+#ifdef USING_UNIX
+	pthread_cond_broadcast(&ws->cv);
+	pthread_mutex_unlock(&ws->mutex);
+#endif
+
+	return status;
+	}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Removes a reference to the rasters of a record, freeing the rasters when no cursor holds the record.
+ *
+ * Arguments:
+ * ws- WeatherStream
+ * rec- record of atm table, acquired by the caller
+ *
+ * Returns:
+ * None
+ */
+static void ReleaseRecWeatherStream(WeatherStream * ws, int rec)	{
+	WeatherStreamRec * r = &ws->recs[rec];
+	GridData * grids[WEATHER_STREAM_MAX_GRIDS];
+	int k;
+
+	for(k = 0; k < WEATHER_STREAM_MAX_GRIDS; k++)	{
+		grids[k] = NULL;
+		}
+#ifdef USING_UNIX
+	pthread_mutex_lock(&ws->mutex);
+#endif
+	if ( --r->refs == 0 )	{
+		for(k = 0; k < ws->num_grids; k++)	{
+			grids[k] = r->grids[k];
+			r->grids[k] = NULL;
+			}
+		r->status = EnumEmptyWeatherStream;
+		}
+#ifdef USING_UNIX
+	pthread_mutex_unlock(&ws->mutex);
+#endif
+	for(k = 0; k < ws->num_grids; k++)	{
+		FreeGridData(grids[k]);
+		}
+
+	return;
+	}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Reads the rasters of a record of the atm table into grids.  Rasters of different records
+ * are read concurrently.
+ *
+ * Arguments:
+ * ws- WeatherStream
+ * rec- record of atm table
+ * grids- num_grids rasters, all NULL, left NULL if unable to read every raster
+ *
+ * Returns:
+ * ERR_SUCCESS(0) if operation successful, an error code otherwise
+ */
+static int ReadGridsWeatherStream(WeatherStream * ws, int rec, GridData ** grids)	{
+	int k, status = ERR_SUCCESS;
+
+	for(k = 0; k < ws->num_grids && status == ERR_SUCCESS; k++)	{
+		if ( (grids[k] = InitGridDataFromAsciiRasterFireGridData(ws->proptbl,
+				STRTWODARRAY_GET_DATA(ws->tbl, rec, ws->file_col[k]), EnumDblGrid)) == NULL )	{
+			status = ERR_EIOFAIL;
+			}
+		}
+	if ( status )	{
+		for(k = 0; k < ws->num_grids; k++)	{
+			FreeGridData(grids[k]);
+			grids[k] = NULL;
+			}
+		}
+
+	return status;
+	}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Requests the background thread to acquire a record in advance.  Without a background
+ * thread nothing is requested.
+ *
+ * Arguments:
+ * wc- WeatherStreamCursor
+ * rec- record of atm table
+ *
+ * Returns:
+ * None
+ */
+static void RequestWeatherStreamCursor(WeatherStreamCursor * wc, int rec)	{
+#ifdef USING_UNIX
+	if ( wc->has_loader )	{
+		pthread_mutex_lock(&wc->mutex);
+		wc->next_rec = rec;
+		wc->next_status = EnumPendingWeatherStream;
+		pthread_cond_broadcast(&wc->cv);
+		pthread_mutex_unlock(&wc->mutex);
+		}
+#endif
+	return;
+	}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Waits until the background thread is done with the record requested in advance.
+ *
+ * Arguments:
+ * wc- WeatherStreamCursor
+ *
+ * Returns:
+ * None
+ */
+static void WaitWeatherStreamCursor(WeatherStreamCursor * wc)	{
+#ifdef USING_UNIX
+	if ( wc->has_loader )	{
+		pthread_mutex_lock(&wc->mutex);
+		while ( wc->next_status == EnumPendingWeatherStream )	{
+			pthread_cond_wait(&wc->cv, &wc->mutex);
+			}
+		pthread_mutex_unlock(&wc->mutex);
+		}
+#endif
+	return;
+	}
+
+#ifdef USING_UNIX
+/* main of the background thread, acquires each record requested in advance */
+static void * LoaderMainWeatherStreamCursor(void * arg)	{
+	WeatherStreamCursor * wc = (WeatherStreamCursor *) arg;
+	EnumWeatherStreamStatus status;
+	int rec;
+
+	pthread_mutex_lock(&wc->mutex);
+	while ( 1 )	{
+		while ( !wc->shutdown && wc->next_status != EnumPendingWeatherStream )	{
+			pthread_cond_wait(&wc->cv, &wc->mutex);
+			}
+		if ( wc->shutdown )	{
+			break;
+			}
+		rec = wc->next_rec;
+		pthread_mutex_unlock(&wc->mutex);
+
+		status = ( AcquireRecWeatherStream(wc->ws, rec) ) ? EnumFailedWeatherStream : EnumReadyWeatherStream;
+
+		pthread_mutex_lock(&wc->mutex);
+		wc->next_status = status;
+		pthread_cond_broadcast(&wc->cv);
+		}
+	pthread_mutex_unlock(&wc->mutex);
+
+	return NULL;
+	}
+#endif
+
+/* end of WeatherStream.c */
@@ -0,0 +1,252 @@
+/*!
+ * \file WeatherStream.h
+ * \brief Hourly series of weather rasters listed in an atm table, shared by the simulations reading it.
+ *
+ * \author Marco Morais
+ * \date 2000-2001
+ *
+ *	HFire (Highly Optmized Tolerance Fire Spread Model) Library
+ *	Copyright (C) 2001 Marco Morais
+ *
+ *	This library is free software; you can redistribute it and/or
+ *	modify it under the terms of the GNU Lesser General Public
+ *	License as published by the Free Software Foundation; either
+ *	version 2.1 of the License, or (at your option) any later version.
+ *
+ *	This library is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *	Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public
+ *	License along with this library; if not, write to the Free Software
+ *	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef	WeatherStream_H
+#define WeatherStream_H
+
+#include <stdlib.h>
+
+#ifdef USING_UNIX
+#include <pthread.h>
+#endif
+
+#include "ChHashTable.h"
+#include "StrTwoDArray.h"
+#include "GridData.h"
+#include "FireGridData.h"
+#include "Err.h"
+
+/*
+ *********************************************************
+ * DEFINES, ENUMS
+ *********************************************************
+ */
+
+/*! \def WEATHER_STREAM_MAX_GRIDS
+ *	\brief largest number of rasters listed in each record of an atm table
+ */
+#define WEATHER_STREAM_MAX_GRIDS			(2)
+
+/*! \def WEATHER_STREAM_NUM_HOURS
+ *	\brief number of month, day and hour combinations indexed, every month given 31 days
+ */
+#define WEATHER_STREAM_NUM_HOURS			(12 * 31 * 24)
+
+/*! \def WEATHER_STREAM_NO_REC
+ *	\brief record index of an hour not listed in the atm table
+ */
+#define WEATHER_STREAM_NO_REC				(-1)
+
+/*! \enum EnumWeatherStreamStatus_
+ *	\brief state of the rasters of a record
+ *	\note EnumEmptyWeatherStream rasters not held
+ *	\note EnumPendingWeatherStream rasters being read
+ *	\note EnumReadyWeatherStream rasters read
+ *	\note EnumFailedWeatherStream rasters could not be read
+ */
+enum EnumWeatherStreamStatus_	{
+	EnumEmptyWeatherStream		= 0,
+	EnumPendingWeatherStream	= 1,
+	EnumReadyWeatherStream		= 2,
+	EnumFailedWeatherStream		= 3
+	};
+
+/*
+ *********************************************************
+ * STRUCTS, TYPEDEFS
+ *********************************************************
+ */
+
+/*! Type name for EnumWeatherStreamStatus_
+ *	\sa For a list of constants goto EnumWeatherStreamStatus_
+ */
+typedef enum EnumWeatherStreamStatus_ EnumWeatherStreamStatus;
+
+/*! Type name for WeatherStreamRec_
+ *	\sa For a list of members goto WeatherStreamRec_
+ */
+typedef struct WeatherStreamRec_ WeatherStreamRec;
+
+/*!	\struct WeatherStreamRec_ WeatherStream.h "WeatherStream.h"
+ *	\brief rasters of one record of an atm table, held while any WeatherStreamCursor refers to the record
+ */
+struct WeatherStreamRec_	{
+	/*! rasters of the record, not modified while ready */
+	GridData * grids[WEATHER_STREAM_MAX_GRIDS];
+	/*! number of cursors holding the rasters */
+	int refs;
+	/*! state of the rasters, never EnumFailedWeatherStream */
+	EnumWeatherStreamStatus status;
+	};
+
+/*! Type name for WeatherStream_
+ *	\sa For a list of members goto WeatherStream_
+ */
+typedef struct WeatherStream_ WeatherStream;
+
+/*!	\struct WeatherStream_ WeatherStream.h "WeatherStream.h"
+ *	\brief atm table indexed by month, day and hour, and the rasters of the records currently in use
+ *	The WeatherStream is initialized once and shared by every simulation.  Each simulation reads
+ *	the rasters through its own WeatherStreamCursor.  The rasters of a record are read by the first
+ *	cursor reaching it, shared with the other cursors holding the record, and freed when the last
+ *	cursor moves on.
+ */
+struct WeatherStream_	{
+	/*! simulation properties used to read rasters */
+	ChHashTable * proptbl;
+	/*! contents of atm table */
+	StrTwoDArray * tbl;
+	/*! number of rasters listed in each record */
+	int num_grids;
+	/*! column of atm table listing each raster */
+	int file_col[WEATHER_STREAM_MAX_GRIDS];
+	/*! first record of each month, day and hour, WEATHER_STREAM_NO_REC if not listed */
+	int rec_of_hour[WEATHER_STREAM_NUM_HOURS];
+	/*! rasters of each record of atm table */
+	WeatherStreamRec * recs;
+#ifdef USING_UNIX
+	/*! protects refs and status of every record */
+	pthread_mutex_t mutex;
+	/*! signals a change of status of any record */
+	pthread_cond_t cv;
+#endif
+	};
+
+/*! Type name for WeatherStreamCursor_
+ *	\sa For a list of members goto WeatherStreamCursor_
+ */
+typedef struct WeatherStreamCursor_ WeatherStreamCursor;
+
+/*!	\struct WeatherStreamCursor_ WeatherStream.h "WeatherStream.h"
+ *	\brief current record of a WeatherStream in one simulation, and the next record held in advance
+ *	When the current record changes the following record is requested of a background thread,
+ *	and taken as current when the simulation reaches that hour.  Without USING_UNIX every record
+ *	is read when it is reached.
+ */
+struct WeatherStreamCursor_	{
+	/*! shared atm table and rasters */
+	WeatherStream * ws;
+	/*! current record, held by the cursor */
+	int cur_rec;
+	/*! record requested in advance, held by the cursor once ready */
+	int next_rec;
+	/*! state of next_rec */
+	EnumWeatherStreamStatus next_status;
+#ifdef USING_UNIX
+	/*! background thread acquiring the next record */
+	pthread_t loader;
+	/*! 1 if the background thread was started */
+	int has_loader;
+	/*! protects next_rec, next_status and shutdown */
+	pthread_mutex_t mutex;
+	/*! signals a change of next_status or shutdown */
+	pthread_cond_t cv;
+	/*! set when the cursor is being freed */
+	int shutdown;
+#endif
+	};
+
+/*
+ *********************************************************
+ * MACROS
+ *********************************************************
+ */
+
+/*! \def WEATHER_STREAM_HOUR_KEY
+ *	\brief index of month, day and hour in rec_of_hour, -1 if out of range
+ */
+#define WEATHER_STREAM_HOUR_KEY(month, day, hour)	( ((month) < 1 || (month) > 12 || (day) < 1 || (day) > 31	\
+														|| (hour) < 0 || (hour) > 23) ? -1							\
+														: (((month) - 1) * 31 + ((day) - 1)) * 24 + (hour) )
+
+/*! \def WEATHER_STREAM_GET_GRID
+ *	\brief raster k of the current record of a WeatherStreamCursor
+ */
+#define WEATHER_STREAM_GET_GRID(wc, k)				((wc)->ws->recs[(wc)->cur_rec].grids[(k)])
+
+/*
+ *********************************************************
+ * PUBLIC FUNCTIONS
+ *********************************************************
+ */
+
+/*! \fn WeatherStream * InitWeatherStream(ChHashTable * proptbl, StrTwoDArray * tbl, int mo_col, int dy_col, int hr_col, const int * file_col, int num_grids)
+ * 	\brief Indexes an atm table by month, day and hour.
+ *
+ *	The hour of each record is stored as hours and minutes, e.g. 1300.  The WeatherStream takes
+ *	ownership of tbl, which is freed with the WeatherStream or if the WeatherStream cannot be initialized.
+ *	No rasters are read until a WeatherStreamCursor is initialized.
+ * 	\param proptbl simulation properties used to read rasters
+ * 	\param tbl contents of atm table
+ * 	\param mo_col column of tbl storing month
+ * 	\param dy_col column of tbl storing day
+ * 	\param hr_col column of tbl storing hour
+ * 	\param file_col column of tbl storing each raster filename
+ * 	\param num_grids number of rasters in each record, at most WEATHER_STREAM_MAX_GRIDS
+ * 	\retval WeatherStream* Ptr to WeatherStream, or NULL if unable to initialize
+ */
+WeatherStream * InitWeatherStream(ChHashTable * proptbl, StrTwoDArray * tbl, int mo_col, int dy_col, int hr_col,
+									const int * file_col, int num_grids);
+
+/*! \fn void FreeWeatherStream(void * vptr)
+ * 	\brief Frees memory associated with WeatherStream structure.
+ *
+ *	Every WeatherStreamCursor of the WeatherStream must be freed first.
+ *	\sa WeatherStream
+ * 	\param vptr ptr to WeatherStream
+ */
+void FreeWeatherStream(void * vptr);
+
+/*! \fn WeatherStreamCursor * InitWeatherStreamCursor(WeatherStream * ws)
+ * 	\brief Initializes a cursor of a WeatherStream at its first record.
+ *
+ *	The rasters of the first record are used until an hour listed in the atm table is reached.
+ * 	\param ws WeatherStream, shared with other cursors
+ * 	\retval WeatherStreamCursor* Ptr to WeatherStreamCursor, or NULL if unable to initialize
+ */
+WeatherStreamCursor * InitWeatherStreamCursor(WeatherStream * ws);
+
+/*! \fn int WeatherStreamSeek(WeatherStreamCursor * wc, int month, int day, int hour)
+ * 	\brief Makes the rasters of the record listed at month, day and hour current.
+ *
+ *	Hours not listed in the atm table keep the current rasters.  The rasters of the next record
+ *	are taken from the record held in advance if ready, and the record following it is requested.
+ * 	\param wc WeatherStreamCursor
+ * 	\param month current month
+ * 	\param day current day
+ * 	\param hour current hour
+ *	\retval ERR_SUCCESS(0) if operation successful, an error code otherwise
+ */
+int WeatherStreamSeek(WeatherStreamCursor * wc, int month, int day, int hour);
+
+/*! \fn void FreeWeatherStreamCursor(void * vptr)
+ * 	\brief Stops the background thread and releases the records held by WeatherStreamCursor structure.
+ *
+ *	\sa WeatherStreamCursor
+ * 	\param vptr ptr to WeatherStreamCursor
+ */
+void FreeWeatherStreamCursor(void * vptr);
+
+#endif WeatherStream_H		/* end of WeatherStream.h */
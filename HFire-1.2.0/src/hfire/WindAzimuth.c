@@ -24,71 +24,190 @@
  
 #include "WindAzimuth.h"
 
-int GetWindAzimuthFIXEDFromProps(ChHashTable * proptbl, int month, int day, int hour,
-									double rwx, double rwy, double * waz)	{
-	/* static variables used to store state across function calls */
-	static int smonth 				= 0;
-	static int sday 				= 0;
-	static int shour 				= 0;
-	static double swaz				= 0.0;
-	static DblTwoDArray * swaz_tbl 	= NULL;
+WindAzimuthTables * InitWindAzimuthTables()	{
+	WindAzimuthTables * tbls = NULL;
+
+	if ( (tbls = (WindAzimuthTables *) calloc(1, sizeof(WindAzimuthTables))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to allocate memory for WindAzimuthTables. \n", ERR_ENOMEM);
+		return tbls;
+		}
+
+	return tbls;
+	}
+
+int SetWindAzimuthTablesFIXEDFromProps(WindAzimuthTables * tbls, ChHashTable * proptbl)	{
+	/* stack variables */
+	KeyVal * entry					= NULL;				/* key/val instances from table */
+	FILE * fstream					= NULL;				/* file stream */
+	DblTwoDArray * waz_tbl			= NULL;				/* contents of waz file */
+
+	/* retrieve waz filename */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_WAZFFILE), (void *)&entry) )	{
+		ERR_ERROR("Unable to retrieve WIND_AZIMUTH_FIXED_FILE property. \n", ERR_EINVAL);
+		}
+	/* open file */
+	if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
+		ERR_ERROR("Unable to open WIND_AZIMUTH_FIXED_FILE. \n", ERR_EIOFAIL);
+		}
+	/* create the table of values */
+	if ( (waz_tbl = GetDblTwoDArrayTableFStreamIO(fstream, 
+			WIND_AZIMUTH_WAZ_SEP_CHARS, WIND_AZIMUTH_WAZ_COMMENT_CHAR)) == NULL )	{
+		fclose(fstream);
+		ERR_ERROR("Unable to parse WIND_AZIMUTH_FIXED_FILE. \n", ERR_EFAILED);
+		}
+	fclose(fstream);
+	/* index table by month and day */
+	if ( (tbls->waz_dt = InitDateTable(waz_tbl, WIND_AZIMUTH_MO_WAZ_TBL_INDEX,
+				WIND_AZIMUTH_DY_WAZ_TBL_INDEX)) == NULL )	{
+		ERR_ERROR("Unable to index WIND_AZIMUTH_FIXED_FILE. \n", ERR_EFAILED);
+		}
+
+	return ERR_SUCCESS;
+	}
+
+int SetWindAzimuthTablesRANDHFromProps(WindAzimuthTables * tbls, ChHashTable * proptbl)	{
+	/* stack variables */
+	KeyVal * entry					= NULL;				/* key/val instances from table */
+	FILE * fstream					= NULL;				/* file stream */
+
+	/* retrieve waz filename */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_WAZHFILE), (void *)&entry) )	{
+		ERR_ERROR("Unable to retrieve WIND_AZIMUTH_HISTORICAL_FILE property. \n", ERR_EINVAL);
+		}
+	/* open file */
+	if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
+		ERR_ERROR("Unable to open WIND_AZIMUTH_HISTORICAL_FILE. \n", ERR_EIOFAIL);
+		}
+	/* create the table of values */
+	if ( (tbls->waz_tbl = GetDblTwoDArrayTableFStreamIO(fstream, 
+			WIND_AZIMUTH_WAZ_SEP_CHARS, WIND_AZIMUTH_WAZ_COMMENT_CHAR)) == NULL )	{
+		fclose(fstream);
+		ERR_ERROR("Unable to parse WIND_AZIMUTH_HISTORICAL_FILE. \n", ERR_EFAILED);
+		}
+	fclose(fstream);
+
+	return ERR_SUCCESS;
+	}
+
+int SetWindAzimuthTablesSPATIALFromProps(WindAzimuthTables * tbls, ChHashTable * proptbl)	{
 	/* stack variables */
 	KeyVal * entry					= NULL;				/* key/val instances from table */
 	FILE * fstream					= NULL;				/* file stream */
+	StrTwoDArray * atm_tbl			= NULL;				/* contents of atm file */
+	int file_col					= WIND_AZIMUTH_FILE_ATM_TBL_INDEX;
+
+	/* retriev atm filename from properties */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_WAZSPFILE), (void *)&entry) )	{
+		ERR_ERROR("Unable to retrieve WIND_AZIMUTH_SPATIAL_FILE property. \n", ERR_EINVAL);
+		}
+	/* open atm file */
+	if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
+		ERR_ERROR("Unable to open WIND_AZIMUTH_SPATIAL_FILE. \n", ERR_EIOFAIL);
+		}
+	/* retrieve units from atm file */
+	if ( IsKeyStringPresentFStreamIO(fstream, WIND_AZIMUTH_ATM_KEYWORD_ENGLISH, 
+			WIND_AZIMUTH_ATM_COMMENT_CHAR) )	{
+		}
+	else	{
+		rewind(fstream);
+		if ( IsKeyStringPresentFStreamIO(fstream, WIND_AZIMUTH_ATM_KEYWORD_METRIC, 
+				WIND_AZIMUTH_ATM_COMMENT_CHAR) )	{
+			}
+		else	{
+			fclose(fstream);
+			ERR_ERROR("Unable to retrieve units from WIND_AZIMUTH_SPATIAL_FILE. \n", ERR_EUNITS);
+			}
+		}
+	/* retrieve contents of atm file */
+	if ( (atm_tbl = GetStrTwoDArrayTableFStreamIO(fstream, WIND_AZIMUTH_ATM_SEP_CHARS, 
+				WIND_AZIMUTH_ATM_COMMENT_CHAR)) == NULL )	{
+		fclose(fstream);
+		ERR_ERROR("Unable to parse WIND_AZIMUTH_SPATIAL_FILE. \n", ERR_EINVAL);
+		}
+	/* cleanup */
+	fclose(fstream);
+	/* index atm table, rasters are read as simulations reach them */
+	if ( (tbls->waz_ws = InitWeatherStream(proptbl, atm_tbl, WIND_AZIMUTH_MO_ATM_TBL_INDEX, WIND_AZIMUTH_DY_ATM_TBL_INDEX,
+				WIND_AZIMUTH_HR_ATM_TBL_INDEX, &file_col, 1)) == NULL )	{
+		ERR_ERROR("Unable to index WIND_AZIMUTH_SPATIAL_FILE. \n", ERR_EINVAL);
+		}
+
+	return ERR_SUCCESS;
+	}
+
+void FreeWindAzimuthTables(void * vptr)	{
+	WindAzimuthTables * tbls = NULL;
+
+	if ( vptr != NULL )	{
+		tbls = (WindAzimuthTables *) vptr;
+		if ( tbls->waz_dt != NULL )		FreeDateTable(tbls->waz_dt);
+		if ( tbls->waz_tbl != NULL )	FreeDblTwoDArray(tbls->waz_tbl);
+		if ( tbls->waz_ws != NULL )		FreeWeatherStream(tbls->waz_ws);
+		free(tbls);
+		}
+	tbls = NULL;
+
+	return;
+	}
+
+WindAzimuthState * InitWindAzimuthState()	{
+	WindAzimuthState * st = NULL;
+
+	if ( (st = (WindAzimuthState *) calloc(1, sizeof(WindAzimuthState))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to allocate memory for WindAzimuthState. \n", ERR_ENOMEM);
+		return st;
+		}
+
+	return st;
+	}
+
+int SetWindAzimuthStateFromTables(WindAzimuthState * st, const WindAzimuthTables * tbls)	{
+	/* check args */
+	if ( st == NULL || tbls == NULL )	{
+		ERR_ERROR("Arguments supplied to set WindAzimuthState invalid. \n", ERR_EINVAL);
+		}
+
+	st->tbls = tbls;
+	/* rasters of the first record are read now, later records as the simulation reaches them */
+	if ( tbls->waz_ws != NULL )	{
+		if ( (st->waz_wc = InitWeatherStreamCursor(tbls->waz_ws)) == NULL )	{
+			ERR_ERROR("Unable to initialize GridData from file listed in WIND_AZIMUTH_SPATIAL_FILE. \n", ERR_EINVAL);
+			}
+		}
+
+	return ERR_SUCCESS;
+	}
+
+int GetWindAzimuthFIXEDFromProps(WindAzimuthState * st, ChHashTable * proptbl, int month, int day, int hour,
+									double rwx, double rwy, double * waz)	{
 	int i;
 
 	/* args not used in FIXED implementation */
 	rwx = rwy = 0.0;
+
+	if ( st->tbls == NULL || st->tbls->waz_dt == NULL )	{
+		ERR_ERROR("Wind azimuth table not initialized. \n", ERR_EINVAL);
+		}
 	
 	/* check to see if new wind azimuth needed */
-	if ( (smonth != month) || (sday != day) || (shour != hour) )	{
-		/* new wind azimuth table */
-		if (swaz_tbl == NULL )	{
-			*waz = swaz;		
-			/* retrieve waz filename */
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_WAZFFILE), (void *)&entry) )	{
-				ERR_ERROR("Unable to retrieve WIND_AZIMUTH_FIXED_FILE property. \n", ERR_EINVAL);
-				}
-			/* open file */
-			if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
-				ERR_ERROR("Unable to open WIND_AZIMUTH_FIXED_FILE. \n", ERR_EIOFAIL);
-				}
-			/* create the table of values */
-			if ( (swaz_tbl = GetDblTwoDArrayTableFStreamIO(fstream, 
-					WIND_AZIMUTH_WAZ_SEP_CHARS, WIND_AZIMUTH_WAZ_COMMENT_CHAR)) == NULL )	{
-				fclose(fstream);
-				ERR_ERROR("Unable to parse WIND_AZIMUTH_FIXED_FILE. \n", ERR_EFAILED);
-				}
-			fclose(fstream);
-			}
-		/* find record in table */
-		for(i = 0; i < DBLTWODARRAY_SIZE_ROW(swaz_tbl); i++)	{
-			/* find matching month and day */
-			if ( DBLTWODARRAY_GET_DATA(swaz_tbl, i, WIND_AZIMUTH_MO_WAZ_TBL_INDEX) == month 
-				 && DBLTWODARRAY_GET_DATA(swaz_tbl, i, WIND_AZIMUTH_DY_WAZ_TBL_INDEX) == day )	{
-				/* retrieve waz on that month and day */
-				swaz = DBLTWODARRAY_GET_DATA(swaz_tbl, i, WIND_AZIMUTH_HR_TO_WAZ_TBL_INDEX(hour));
-				break;
-				}
+	if ( (st->month != month) || (st->day != day) || (st->hour != hour) )	{
+		/* retrieve waz on first record of month and day */
+		if ( (i = DateTableGetRec(st->tbls->waz_dt, month, day)) != DATE_TABLE_NO_REC )	{
+			st->waz = DATE_TABLE_GET_DATA(st->tbls->waz_dt, i, WIND_AZIMUTH_HR_TO_WAZ_TBL_INDEX(hour));
 			}
 		/* set {month, day, hour} for future calls */
-		smonth = month;
-		sday = day;
-		shour = hour;
+		st->month = month;
+		st->day = day;
+		st->hour = hour;
 		}
 
-	*waz = swaz;
+	*waz = st->waz;
 
 	return ERR_SUCCESS;	
 	}
 
-int GetWindAzimuthRANDUFromProps(ChHashTable * proptbl, int month, int day, int hour,
+int GetWindAzimuthRANDUFromProps(WindAzimuthState * st, ChHashTable * proptbl, int month, int day, int hour,
 									double rwx, double rwy, double * waz)	{
-	/* static variables used to store state across function calls */
-	static int smonth 				= 0;
-	static int sday 				= 0;
-	static int shour 				= 0;
-	static double swaz				= 0.0;
 	
 	/* args not used in RANDU implementation */
 	rwx = rwy = 0.0;
@@ -98,170 +217,105 @@ int GetWindAzimuthRANDUFromProps(ChHashTable * proptbl, int month, int day, int
 		}
 
 	/* check to see if new wind azimuth needed */
-	if ( (smonth != month) || (sday != day) || (shour != hour) )	{	
+	if ( (st->month != month) || (st->day != day) || (st->hour != hour) )	{	
 		/* new wind azimuth */
-		swaz = randu(WIND_AZIMUTH_RANDU_MIN_AZ, WIND_AZIMUTH_RANDU_MAX_AZ);
+		st->waz = RandStreamUniform(&st->rs, WIND_AZIMUTH_RANDU_MIN_AZ, WIND_AZIMUTH_RANDU_MAX_AZ);
 		/* set {month, day, hour} for future calls */
-		smonth = month;
-		sday = day;
-		shour = hour;		
+		st->month = month;
+		st->day = day;
+		st->hour = hour;		
 		}
 
-	*waz = swaz;
+	*waz = st->waz;
 
 	return ERR_SUCCESS;
 	}
 
-int GetWindAzimuthRANDHFromProps(ChHashTable * proptbl, int month, int day, int hour,
+int GetWindAzimuthRANDHFromProps(WindAzimuthState * st, ChHashTable * proptbl, int month, int day, int hour,
 									double rwx, double rwy, double * waz)	{
-	/* static variables used to store state across function calls */
-	static int smonth 				= 0;
-	static int sday 				= 0;
-	static int shour 				= 0;
-	static double swaz				= 0.0;
-	static DblTwoDArray * swaz_tbl 	= NULL;
-	/* stack variables */
-	KeyVal * entry					= NULL;				/* key/val instances from table */
-	FILE * fstream					= NULL;				/* file stream */
 	int i,j;
 	
 	/* args not used in RANDH implementation */
 	rwx = rwy = 0.0;
+
+	if ( st->tbls == NULL || st->tbls->waz_tbl == NULL )	{
+		ERR_ERROR("Wind azimuth table not initialized. \n", ERR_EINVAL);
+		}
 	
 	/* check to see if new wind azimuth needed */
-	if ( (smonth != month) || (sday != day) || (shour != hour) )	{
-		/* new wind azimuth table */
-		if (swaz_tbl == NULL )	{
-			*waz = swaz;		
-			/* retrieve waz filename */
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_WAZHFILE), (void *)&entry) )	{
-				ERR_ERROR("Unable to retrieve WIND_AZIMUTH_HISTORICAL_FILE property. \n", ERR_EINVAL);
-				}
-			/* open file */
-			if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
-				ERR_ERROR("Unable to open WIND_AZIMUTH_HISTORICAL_FILE. \n", ERR_EIOFAIL);
-				}
-			/* create the table of values */
-			if ( (swaz_tbl = GetDblTwoDArrayTableFStreamIO(fstream, 
-					WIND_AZIMUTH_WAZ_SEP_CHARS, WIND_AZIMUTH_WAZ_COMMENT_CHAR)) == NULL )	{
-				fclose(fstream);
-				ERR_ERROR("Unable to parse WIND_AZIMUTH_HISTORICAL_FILE. \n", ERR_EFAILED);
-				}
-			fclose(fstream);
-			}
+	if ( (st->month != month) || (st->day != day) || (st->hour != hour) )	{
 		/* find wind azimuth from random record in table that is not NO DATA */
 		do	{
 			/* retrieve a record at random from table within range 0 to num_recs */
-			i = randi(0) % DBLTWODARRAY_SIZE_ROW(swaz_tbl);
+			i = RandStreamIndex(&st->rs, DBLTWODARRAY_SIZE_ROW(st->tbls->waz_tbl));
 			j = WIND_AZIMUTH_HR_TO_WAZ_TBL_INDEX(hour);
 			/* retrieve waz from random recno using current hour */
-			swaz = DBLTWODARRAY_GET_DATA(swaz_tbl, i, j);		
-			} while( swaz == WIND_AZIMUTH_WAZ_NO_DATA_VALUE );
+			st->waz = DBLTWODARRAY_GET_DATA(st->tbls->waz_tbl, i, j);		
+			} while( st->waz == WIND_AZIMUTH_WAZ_NO_DATA_VALUE );
 		/* set {month, day, hour} for future calls */
-		smonth = month;
-		sday = day;
-		shour = hour;
+		st->month = month;
+		st->day = day;
+		st->hour = hour;
 		}
 
-	*waz = swaz;
+	*waz = st->waz;
 
 	return ERR_SUCCESS;			
 	}
 
-int GetWindAzimuthSPATIALFromProps(ChHashTable * proptbl, int month, int day, int hour, 
+int GetWindAzimuthSPATIALFromProps(WindAzimuthState * st, ChHashTable * proptbl, int month, int day, int hour, 
 										double rwx, double rwy, double * waz)	{
-	/* static variables used to store state across function calls */
-	static int smonth 				= 0;
-	static int sday 				= 0;
-	static int shour 				= 0;
-	static StrTwoDArray * satm_tbl	= NULL;
-	static GridData * swaz_grid 	= NULL;
 	/* stack variables */
-	KeyVal * entry					= NULL;				/* key/val instances from table */
-	FILE * fstream					= NULL;				/* file stream */
 	double waz_deg = 0.0;
+	GridData * waz_grid				= NULL;				/* wind azimuth of the current hour */
 	int i,j;
 
-	/* check to see if new tables are needed */
-	if ( (smonth != month) || (sday != day) || (shour != hour) )	{
-		/* new atm tbl */
-		if (satm_tbl == NULL )	{
-			/* retriev atm filename from properties */
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_WAZSPFILE), (void *)&entry) )	{
-				ERR_ERROR("Unable to retrieve WIND_AZIMUTH_SPATIAL_FILE property. \n", ERR_EINVAL);
-				}
-			/* open atm file */
-			if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
-				ERR_ERROR("Unable to open WIND_AZIMUTH_SPATIAL_FILE. \n", ERR_EIOFAIL);
-				}
-			/* retrieve units from atm file */
-			if ( IsKeyStringPresentFStreamIO(fstream, WIND_AZIMUTH_ATM_KEYWORD_ENGLISH, 
-					WIND_AZIMUTH_ATM_COMMENT_CHAR) )	{
-				}
-			else	{
-				rewind(fstream);
-				if ( IsKeyStringPresentFStreamIO(fstream, WIND_AZIMUTH_ATM_KEYWORD_METRIC, 
-						WIND_AZIMUTH_ATM_COMMENT_CHAR) )	{
-					}
-				else	{
-					fclose(fstream);
-					ERR_ERROR("Unable to retrieve units from WIND_AZIMUTH_SPATIAL_FILE. \n", ERR_EUNITS);
-					}
-				}
-			/* retrieve contents of atm file */
-			if ( (satm_tbl = GetStrTwoDArrayTableFStreamIO(fstream, WIND_AZIMUTH_ATM_SEP_CHARS, 
-						WIND_AZIMUTH_ATM_COMMENT_CHAR)) == NULL )	{
-				fclose(fstream);
-				ERR_ERROR("Unable to parse WIND_AZIMUTH_SPATIAL_FILE. \n", ERR_EINVAL);
-				}
-			/* cleanup */
-			fclose(fstream);
-			}							
-		/* new waz grid */
-		if ( swaz_grid == NULL )	{
-			if ( (swaz_grid = InitGridDataFromAsciiRaster(STRTWODARRAY_GET_DATA(satm_tbl, 0, WIND_AZIMUTH_FILE_ATM_TBL_INDEX), 
-								EnumDblGrid)) == NULL )	{
-				ERR_ERROR("Unable to initialize GridData from file listed in WIND_AZIMUTH_SPATIAL_FILE. \n", ERR_EINVAL);
-				}
-			}
-		/* find record in atm table */
-		for(i = 0; i < DBLTWODARRAY_SIZE_ROW(satm_tbl); i++)	{
-			/* parse the atm table from strings to numbers */
-			smonth = atoi(STRTWODARRAY_GET_DATA(satm_tbl, i, WIND_AZIMUTH_MO_ATM_TBL_INDEX));
-			sday = atoi(STRTWODARRAY_GET_DATA(satm_tbl, i, WIND_AZIMUTH_DY_ATM_TBL_INDEX));
-			shour = atoi(STRTWODARRAY_GET_DATA(satm_tbl, i, WIND_AZIMUTH_HR_ATM_TBL_INDEX)) / 100;
-			/* find matching month and day and hour */
-			if ( (smonth == month) && (sday == day) && (shour == hour) )	{
-				/* free old grid */
-				FreeGridData(swaz_grid);
-				/* initialize new grid */
-				if ( (swaz_grid = InitGridDataFromAsciiRaster(STRTWODARRAY_GET_DATA(satm_tbl, i, WIND_AZIMUTH_FILE_ATM_TBL_INDEX), 
-									EnumDblGrid)) == NULL )	{
-					ERR_ERROR("Unable to initialize GridData from file listed in WIND_SPEED_SPATIAL_FILE. \n", ERR_EINVAL);
-					}
-				break;
-				}
+	if ( st->waz_wc == NULL )	{
+		ERR_ERROR("Wind azimuth rasters not initialized. \n", ERR_EINVAL);
+		}
+
+	/* check to see if new rasters are needed */
+	if ( (st->month != month) || (st->day != day) || (st->hour != hour) )	{
+		/* rasters of the hour listed in the atm table, read in the background when the previous hour was reached */
+		if ( WeatherStreamSeek(st->waz_wc, month, day, hour) )	{
+			ERR_ERROR("Unable to initialize GridData from file listed in WIND_AZIMUTH_SPATIAL_FILE. \n", ERR_EINVAL);
 			}
 		/* set {month, day, hour} for future calls */
-		smonth = month;
-		sday = day;
-		shour = hour;
+		st->month = month;
+		st->day = day;
+		st->hour = hour;
 		}
+	/* rasters of the current hour */
+	waz_grid = WEATHER_STREAM_GET_GRID(st->waz_wc, 0);
 
 	/* transform array indecies into spatial coordinates */
-	if ( CoordTransRealWorldToRaster(rwx, rwy, swaz_grid->ghdr->cellsize, swaz_grid->ghdr->cellsize,
-			COORD_TRANS_XLLCORNER_TO_XULCNTR(swaz_grid->ghdr->xllcorner, swaz_grid->ghdr->cellsize),
-			COORD_TRANS_YLLCORNER_TO_YULCNTR(swaz_grid->ghdr->yllcorner, swaz_grid->ghdr->cellsize, swaz_grid->ghdr->nrows),
+	if ( CoordTransRealWorldToRaster(rwx, rwy, waz_grid->ghdr->cellsize, waz_grid->ghdr->cellsize,
+			COORD_TRANS_XLLCORNER_TO_XULCNTR(waz_grid->ghdr->xllcorner, waz_grid->ghdr->cellsize),
+			COORD_TRANS_YLLCORNER_TO_YULCNTR(waz_grid->ghdr->yllcorner, waz_grid->ghdr->cellsize, waz_grid->ghdr->nrows),
 			&i, &j) )	{
 		ERR_ERROR("Unable to transform real world coordinates to grid indecies. \n", ERR_ESING);
 		}			
 													
 	/* retrieve wind azimuth at coordinate */
-	GRID_DATA_GET_DATA(swaz_grid, i, j, waz_deg);
+	GRID_DATA_GET_DATA(waz_grid, i, j, waz_deg);
 
 	*waz = waz_deg;
 		
 	return ERR_SUCCESS;
 	}
  
+void FreeWindAzimuthState(void * vptr)	{
+	WindAzimuthState * st = NULL;
+
+	if ( vptr != NULL )	{
+		st = (WindAzimuthState *) vptr;
+		/* tables are shared and freed by their owner */
+		if ( st->waz_wc != NULL )	FreeWeatherStreamCursor(st->waz_wc);
+		free(st);
+		}
+	st = NULL;
+
+	return;
+	}
+
 /* end of WindAzimuth.c */
@@ -32,13 +32,16 @@
 #include <math.h>
 
 #include "CoordTrans.h"
-#include "NLIBRand.h"
+#include "RandStream.h"
 #include "FireProp.h"
 #include "ChHashTable.h"
 #include "KeyVal.h"
 #include "DblTwoDArray.h"
+#include "DateTable.h"
 #include "StrTwoDArray.h"
 #include "GridData.h"
+#include "FireGridData.h"
+#include "WeatherStream.h"
 #include "FStreamIO.h"
 #include "Err.h"
 
@@ -87,7 +90,51 @@
  * STRUCTS, TYPEDEFS
  *********************************************************
  */
- 
+
+/*! Type name for WindAzimuthTables_
+ *	\sa For a list of members goto WindAzimuthTables_
+ */
+typedef struct WindAzimuthTables_ WindAzimuthTables;
+
+/*!	\struct WindAzimuthTables_ WindAzimuth.h "WindAzimuth.h"
+ *	\brief tables of wind azimuths read once from the files named in the simulation properties
+ *	Not modified once read, so shared by the WindAzimuthState of every simulation.
+ */
+struct WindAzimuthTables_	{
+	/*! table of FIXED wind azimuths indexed by month and day */
+	DateTable * waz_dt;
+	/*! table of RANDH wind azimuths */
+	DblTwoDArray * waz_tbl;
+	/*! atm table of SPATIAL wind azimuths */
+	WeatherStream * waz_ws;
+	};
+
+/*! Type name for WindAzimuthState_
+ *	\sa For a list of members goto WindAzimuthState_
+ */
+typedef struct WindAzimuthState_ WindAzimuthState;
+
+/*!	\struct WindAzimuthState_ WindAzimuth.h "WindAzimuth.h"
+ *	\brief wind azimuth retrieved by the wind azimuth functions
+ *	Stored by FireEnv in place of function statics so each simulation owns its state.
+ */
+struct WindAzimuthState_	{
+	/*! month of the last call */
+	int month;
+	/*! day of the last call */
+	int day;
+	/*! hour of the last call */
+	int hour;
+	/*! wind azimuth of the last call */
+	double waz;
+	/*! tables shared by every simulation */
+	const WindAzimuthTables * tbls;
+	/*! rasters of SPATIAL wind azimuths at the current hour */
+	WeatherStreamCursor * waz_wc;
+	/*! random numbers drawing RANDU azimuths and choosing RANDH records */
+	RandStream rs;
+	};
+
 /*
  *********************************************************
  * MACROS
@@ -107,16 +154,94 @@
  *********************************************************
  */
 
-/*!	\fn int GetWindAzimuthFIXEDFromProps(ChHashTable * proptbl, int month, int day, int hour,
+/*! \fn WindAzimuthTables * InitWindAzimuthTables()
+ *	\brief Initializes an empty set of wind azimuth tables.
+ *
+ *	\sa WindAzimuthTables
+ *	\retval WindAzimuthTables* Ptr to initialized WindAzimuthTables, or NULL if unable to allocate
+ */
+WindAzimuthTables * InitWindAzimuthTables();
+
+/*! \fn int SetWindAzimuthTablesFIXEDFromProps(WindAzimuthTables * tbls, ChHashTable * proptbl)
+ *	\brief Reads the table named by WIND_AZIMUTH_FIXED_FILE and indexes it by month and day.
+ *
+ *	\sa WindAzimuthTables
+ *	\param tbls WindAzimuthTables
+ *	\param proptbl HashTable of simulation properties
+ *	\retval int ERR_SUCCESS(0) if successful, an error code otherwise
+ */
+int SetWindAzimuthTablesFIXEDFromProps(WindAzimuthTables * tbls, ChHashTable * proptbl);
+
+/*! \fn int SetWindAzimuthTablesRANDHFromProps(WindAzimuthTables * tbls, ChHashTable * proptbl)
+ *	\brief Reads the table named by WIND_AZIMUTH_HISTORICAL_FILE.
+ *
+ *	\sa WindAzimuthTables
+ *	\param tbls WindAzimuthTables
+ *	\param proptbl HashTable of simulation properties
+ *	\retval int ERR_SUCCESS(0) if successful, an error code otherwise
+ */
+int SetWindAzimuthTablesRANDHFromProps(WindAzimuthTables * tbls, ChHashTable * proptbl);
+
+/*! \fn int SetWindAzimuthTablesSPATIALFromProps(WindAzimuthTables * tbls, ChHashTable * proptbl)
+ *	\brief Reads the atm table named by WIND_AZIMUTH_SPATIAL_FILE and indexes it by month, day and hour.
+ *
+ *	The rasters listed in the atm table are read as simulations reach them.
+ *	\sa WindAzimuthTables
+ *	\sa WeatherStream
+ *	\param tbls WindAzimuthTables
+ *	\param proptbl HashTable of simulation properties
+ *	\retval int ERR_SUCCESS(0) if successful, an error code otherwise
+ */
+int SetWindAzimuthTablesSPATIALFromProps(WindAzimuthTables * tbls, ChHashTable * proptbl);
+
+/*! \fn void FreeWindAzimuthTables(void * vptr)
+ *	\brief Frees memory associated with WindAzimuthTables structure.
+ *
+ *	Every WindAzimuthState using the tables must be freed first.
+ *	\sa WindAzimuthTables
+ *	\param vptr ptr to WindAzimuthTables
+ */
+void FreeWindAzimuthTables(void * vptr);
+
+/*! \fn WindAzimuthState * InitWindAzimuthState()
+ *	\brief Initializes the wind azimuth state of a simulation.
+ *
+ *	\sa WindAzimuthState
+ *	\retval WindAzimuthState* Ptr to initialized WindAzimuthState, or NULL if unable to allocate
+ */
+WindAzimuthState * InitWindAzimuthState();
+
+/*! \fn void FreeWindAzimuthState(void * vptr)
+ *	\brief Frees memory associated with WindAzimuthState structure.
+ *
+ *	\sa WindAzimuthState
+ *	\param vptr ptr to WindAzimuthState
+ */
+void FreeWindAzimuthState(void * vptr);
+
+/*! \fn int SetWindAzimuthStateFromTables(WindAzimuthState * st, const WindAzimuthTables * tbls)
+ *	\brief Links the wind azimuth state of a simulation to the shared wind azimuth tables.
+ *
+ *	Call once before the first call to the functions taking WindAzimuthState as argument.
+ *	The tables must outlive the state.
+ *	\sa WindAzimuthState
+ *	\sa WindAzimuthTables
+ *	\param st WindAzimuthState
+ *	\param tbls WindAzimuthTables read for the wind azimuth type of the simulation
+ *	\retval int ERR_SUCCESS(0) if successful, an error code otherwise
+ */
+int SetWindAzimuthStateFromTables(WindAzimuthState * st, const WindAzimuthTables * tbls);
+
+/*!	\fn int GetWindAzimuthFIXEDFromProps(WindAzimuthState * st, ChHashTable * proptbl, int month, int day, int hour,
 												double rwx, double rwy, double * waz)
  * 	\brief Returns a wind azimuth to be used for given {month, day, hour} of simulation.
  *
  * 	For FIXED implementations the value of keyword WIND_AZIMUTH_FIXED_FILE is used
  *	to load a DblTwoDArray of month, day, hour wind azimuth values. The supplied
  * 	arguments are used to index the table and retrieve the recorded azimuth. 
- * 	Static variables are used to ensure that the table is initialized only once and
- * 	that repeat table indexes are avoided.
+ * 	The state is used to ensure that repeat table indexes are avoided.
  * 	\sa Check the \htmlonly <a href="config_file_doc.html#WIND_AZIMUTH">config file documentation</a> \endhtmlonly
+ * 	\param st WindAzimuthState storing the wind azimuth between calls
  * 	\param proptbl HashTable of simulation properties
  * 	\param month 1 based month to retrieve azimuth for
  * 	\param day 1 based day in month to retrieve azimuth for
@@ -132,10 +257,10 @@
  *				// something bad happened
  *	\endcode
  */
-int GetWindAzimuthFIXEDFromProps(ChHashTable * proptbl, int month, int day, int hour,
+int GetWindAzimuthFIXEDFromProps(WindAzimuthState * st, ChHashTable * proptbl, int month, int day, int hour,
 									double rwx, double rwy, double * waz);
 
-/*!	\fn int GetWindAzimuthRANDUFromProps(ChHashTable * proptbl, int month, int day, int hour,
+/*!	\fn int GetWindAzimuthRANDUFromProps(WindAzimuthState * st, ChHashTable * proptbl, int month, int day, int hour,
 												double rwx, double rwy, double * waz)
  * 	\brief Returns a wind azimuth to be used for given {month, day, hour} of simulation.
  *
@@ -144,6 +269,7 @@ int GetWindAzimuthFIXEDFromProps(ChHashTable * proptbl, int month, int day, int
  * 	Static variables are used to ensure that the same wind azimuth is retrieved for
  * 	every call to this function during the same {month, day, hour}.
  * 	\sa Check the \htmlonly <a href="config_file_doc.html#WIND_AZIMUTH">config file documentation</a> \endhtmlonly
+ * 	\param st WindAzimuthState storing the wind azimuth between calls
  * 	\param proptbl HashTable of simulation properties
  * 	\param month 1 based month to retrieve azimuth for
  * 	\param day 1 based day in month to retrieve azimuth for
@@ -159,10 +285,10 @@ int GetWindAzimuthFIXEDFromProps(ChHashTable * proptbl, int month, int day, int
  *				// something bad happened
  *	\endcode
  */
-int GetWindAzimuthRANDUFromProps(ChHashTable * proptbl, int month, int day, int hour,
+int GetWindAzimuthRANDUFromProps(WindAzimuthState * st, ChHashTable * proptbl, int month, int day, int hour,
 									double rwx, double rwy, double * waz);
 
-/*!	\fn int GetWindAzimuthRANDUFromProps(ChHashTable * proptbl, int month, int day, int hour,
+/*!	\fn int GetWindAzimuthRANDHFromProps(WindAzimuthState * st, ChHashTable * proptbl, int month, int day, int hour,
 												double rwx, double rwy, double * waz)
  * 	\brief Returns a wind azimuth to be used for given {month, day, hour} of simulation.
  *
@@ -172,9 +298,9 @@ int GetWindAzimuthRANDUFromProps(ChHashTable * proptbl, int month, int day, int
  * 	at this record number and hour specified is retrieved. If the azimuth is not equal
  * 	to WIND_AZIMUTH_WAZ_NO_DATA_VALUE, then it is returned. Otherwise, the process is
  * 	repeated until a non-NO DATA value is found.
- * 	Static variables are used to ensure that the table is initialized only once and
- * 	that repeat table indexes are avoided.
+ * 	The state is used to ensure that repeat table indexes are avoided.
  * 	\sa Check the \htmlonly <a href="config_file_doc.html#WIND_AZIMUTH">config file documentation</a> \endhtmlonly
+ * 	\param st WindAzimuthState storing the wind azimuth between calls
  * 	\param proptbl HashTable of simulation properties
  * 	\param month 1 based month to retrieve azimuth for
  * 	\param day 1 based day in month to retrieve azimuth for
@@ -190,16 +316,17 @@ int GetWindAzimuthRANDUFromProps(ChHashTable * proptbl, int month, int day, int
  *				// something bad happened
  *	\endcode
  */ 
-int GetWindAzimuthRANDHFromProps(ChHashTable * proptbl, int month, int day, int hour,
+int GetWindAzimuthRANDHFromProps(WindAzimuthState * st, ChHashTable * proptbl, int month, int day, int hour,
 									double rwx, double rwy, double * waz);
 
-/*!	\fn int GetWindAzimuthSPATIALFromProps(ChHashTable * proptbl, int month, int day, int hour, 
+/*!	\fn int GetWindAzimuthSPATIALFromProps(WindAzimuthState * st, ChHashTable * proptbl, int month, int day, int hour, 
 												double rwx, double rwy, double * waz)
  * 	\brief Returns a wind azimuth to be used for given {month, day, hour} of simulation.
  *
  *	Using this option each cell in the simulation domain is assigned a unique wind azimuth
  * 	based upon index into a raster of wind azimuths
  * 	\sa Check the \htmlonly <a href="config_file_doc.html#WIND_AZIMUTH">config file documentation</a> \endhtmlonly
+ * 	\param st WindAzimuthState storing the wind azimuth between calls
  * 	\param proptbl HashTable of simulation properties
  * 	\param month 1 based month to retrieve azimuth for
  * 	\param day 1 based day in month to retrieve azimuth for
@@ -215,7 +342,7 @@ int GetWindAzimuthRANDHFromProps(ChHashTable * proptbl, int month, int day, int
  *				// something bad happened
  *	\endcode
  */ 	
-int GetWindAzimuthSPATIALFromProps(ChHashTable * proptbl, int month, int day, int hour, 
+int GetWindAzimuthSPATIALFromProps(WindAzimuthState * st, ChHashTable * proptbl, int month, int day, int hour, 
 										double rwx, double rwy, double * waz);
 
 #endif WindAzimuth_H		/* end of WindAzimuth.h */
@@ -33,395 +33,407 @@ static const EnumUnitVelocity smps = EnumMpsVelocity;
  *********************************************************
  */
 
-int GetWindSpeedMpsFIXEDFromProps(ChHashTable * proptbl, double fbedhgtm, int month, int day, int hour,
-										double rwx, double rwy, double * wspmps)		{
-	/* static variables used to store state across function calls */
-	static int smonth 				= 0;
-	static int sday 				= 0;
-	static int shour 				= 0;
-	static double swsp				= 0.0;
-	static DblTwoDArray * swsp_tbl 	= NULL;
-	static EnumUnitVelocity sunits	= EnumUnknownVelocity;	
-  static EnumFireVal swspwaf = VAL_AB79;
+WindSpdTables * InitWindSpdTables()	{
+	WindSpdTables * tbls = NULL;
+
+	if ( (tbls = (WindSpdTables *) calloc(1, sizeof(WindSpdTables))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to allocate memory for WindSpdTables. \n", ERR_ENOMEM);
+		return tbls;
+		}
+	tbls->units = EnumUnknownVelocity;
+
+	return tbls;
+	}
+
+int SetWindSpdTablesFIXEDFromProps(WindSpdTables * tbls, ChHashTable * proptbl)	{
+	/* stack variables */
+	KeyVal * entry					= NULL;				/* key/val instances from table */
+	FILE * fstream					= NULL;				/* file stream */
+	char * units					= NULL;
+	DblTwoDArray * wsp_tbl			= NULL;				/* contents of wsp file */
+	int i, j;
+
+	/* retrieve wsp filename */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_WSPDFFILE), (void *)&entry) )	{
+		ERR_ERROR("Unable to retrieve WIND_SPEED_FIXED_FILE property. \n", ERR_EINVAL);
+		}
+	/* open file */
+	if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
+		ERR_ERROR("Unable to open WIND_SPEED_FIXED_FILE. \n", ERR_EIOFAIL);
+		}
+	/* retrieve string indicating units windspeed stored in */
+	if ( (units = GetValFromKeyStringFStreamIO(fstream, WIND_SPD_WSP_KEYWORD_UNITS, 
+			WIND_SPD_WSP_SEP_CHARS, WIND_SPD_WSP_COMMENT_CHAR)) == NULL )	{
+		fclose(fstream);
+		ERR_ERROR("Unable to determine units for WIND_SPEED_FIXED_FILE. \n", ERR_EINVAL);
+		}
+	/* create the table of values */			
+	if ( (wsp_tbl = GetDblTwoDArrayTableFStreamIO(fstream, 
+			WIND_SPD_WSP_SEP_CHARS, WIND_SPD_WSP_COMMENT_CHAR)) == NULL )	{
+		free(units);
+		fclose(fstream);
+		ERR_ERROR("Unable to parse WIND_SPEED_FIXED_FILE. \n", ERR_EFAILED);
+		}
+	/* convert values in table to mps, the last value converted is used until the first date listed */
+	if ( strcmp(units, WIND_SPD_WSP_KEYWORD_MILEPHR) == 0 )	{
+		tbls->units = EnumMphVelocity;
+		}
+	else if ( strcmp(units, WIND_SPD_WSP_KEYWORD_KMPHR) == 0 )	{
+		tbls->units = EnumKmphVelocity;
+		}
+	for(i = 0; i < DBLTWODARRAY_SIZE_ROW(wsp_tbl); i++)	{
+		for(j = WIND_SPD_HR_TO_WSP_TBL_INDEX(0); j < DBLTWODARRAY_SIZE_COL(wsp_tbl); j++)	{
+			if ( DBLTWODARRAY_GET_DATA(wsp_tbl, i, j) == WIND_SPD_WSP_NO_DATA_VALUE )	{
+				continue;
+				}
+			ConvertVelocityUnits(tbls->units, DBLTWODARRAY_GET_DATA(wsp_tbl, i, j), smps, &tbls->wsp_init);
+			DBLTWODARRAY_SET_DATA(wsp_tbl, i, j, tbls->wsp_init);
+			}
+		}
+	/* cleanup */
+	free(units);
+	fclose(fstream);
+	/* index table by month and day */
+	if ( (tbls->wsp_dt = InitDateTable(wsp_tbl, WIND_SPD_MO_WSP_TBL_INDEX,
+				WIND_SPD_DY_WSP_TBL_INDEX)) == NULL )	{
+		ERR_ERROR("Unable to index WIND_SPEED_FIXED_FILE. \n", ERR_EFAILED);
+		}
+
+	return ERR_SUCCESS;
+	}
+
+int SetWindSpdTablesRANDUFromProps(WindSpdTables * tbls, ChHashTable * proptbl)	{
+	/* stack variables */
+	KeyVal * entry					= NULL;				/* key/val instances from table */	
+	ListElmt * lel					= NULL;
+
+	/* retrieve wind speed range property */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_WSPDUNIRNG), (void *)&entry) )	{
+		ERR_ERROR("Unable to retrieve WIND_SPEED_UNIFORM_RANGE property. \n", ERR_EINVAL);
+		}	
+	/* parse value into List */
+	if ( (tbls->rng_list = GetDblListFromLineFStreamIO((char *) entry->val, 
+						WIND_SPD_RNG_SEP_CHARS)) == NULL )	{
+		ERR_ERROR("Unable to retrieve min and max from WIND_SPEED_UNIFORM_RANGE. \n", ERR_EINVAL);
+		}
+	/* parse string to numbers */
+	if ( LIST_SIZE(tbls->rng_list) != 2 )	{
+		ERR_ERROR("WIND_SPEED_UNIFORM_RANGE property should contain two floating point tokens. \n", ERR_EINVAL);
+		}
+	lel = LIST_HEAD(tbls->rng_list);
+	tbls->min_rng = LIST_GET_DATA(lel);
+	lel = LIST_GET_NEXT_ELMT(lel);
+	tbls->max_rng = LIST_GET_DATA(lel);
+
+	return ERR_SUCCESS;
+	}
+
+int SetWindSpdTablesRANDHFromProps(WindSpdTables * tbls, ChHashTable * proptbl)	{
 	/* stack variables */
 	KeyVal * entry					= NULL;				/* key/val instances from table */
 	FILE * fstream					= NULL;				/* file stream */
 	char * units					= NULL;
 	int i, j;
 
+	/* retrieve wsp filename */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_WSPDHFILE), (void *)&entry) )	{
+		ERR_ERROR("Unable to retrieve WIND_SPEED_HISTORICAL_FILE property. \n", ERR_EINVAL);
+		}
+	/* open file */
+	if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
+		ERR_ERROR("Unable to open WIND_SPEED_HISTORICAL_FILE. \n", ERR_EIOFAIL);
+		}
+	/* retrieve string indicating units windspeed stored in */
+	if ( (units = GetValFromKeyStringFStreamIO(fstream, WIND_SPD_WSP_KEYWORD_UNITS, 
+			WIND_SPD_WSP_SEP_CHARS, WIND_SPD_WSP_COMMENT_CHAR)) == NULL )	{
+		fclose(fstream);
+		ERR_ERROR("Unable to determine units for WIND_SPEED_HISTORICAL_FILE. \n", ERR_EINVAL);
+		}
+	/* create the table of values */			
+	if ( (tbls->wsp_tbl = GetDblTwoDArrayTableFStreamIO(fstream, 
+			WIND_SPD_WSP_SEP_CHARS, WIND_SPD_WSP_COMMENT_CHAR)) == NULL )	{
+		free(units);
+		fclose(fstream);
+		ERR_ERROR("Unable to parse WIND_SPEED_HISTORICAL_FILE. \n", ERR_EFAILED);
+		}
+	/* convert values in table to mps */
+	if ( strcmp(units, WIND_SPD_WSP_KEYWORD_MILEPHR) == 0 )	{
+		tbls->units = EnumMphVelocity;
+		}
+	else if ( strcmp(units, WIND_SPD_WSP_KEYWORD_KMPHR) == 0 )	{
+		tbls->units = EnumKmphVelocity;
+		}
+	for(i = 0; i < DBLTWODARRAY_SIZE_ROW(tbls->wsp_tbl); i++)	{
+		for(j = WIND_SPD_HR_TO_WSP_TBL_INDEX(0); j < DBLTWODARRAY_SIZE_COL(tbls->wsp_tbl); j++)	{
+			if ( DBLTWODARRAY_GET_DATA(tbls->wsp_tbl, i, j) == WIND_SPD_WSP_NO_DATA_VALUE )	{
+				continue;
+				}				
+			ConvertVelocityUnits(tbls->units, DBLTWODARRAY_GET_DATA(tbls->wsp_tbl, i, j), smps, &tbls->wsp_init);
+			DBLTWODARRAY_SET_DATA(tbls->wsp_tbl, i, j, tbls->wsp_init);
+			}
+		}
+	/* cleanup */
+	free(units);
+	fclose(fstream);
+
+	return ERR_SUCCESS;
+	}
+
+int SetWindSpdTablesSPATIALFromProps(WindSpdTables * tbls, ChHashTable * proptbl)	{
+	/* stack variables */
+	KeyVal * entry					= NULL;				/* key/val instances from table */
+	FILE * fstream					= NULL;				/* file stream */
+	StrTwoDArray * atm_tbl			= NULL;				/* contents of atm file */
+	int file_col					= WIND_SPD_FILE_ATM_TBL_INDEX;
+
+	/* retriev atm filename from properties */
+	if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_WSPDSPFILE), (void *)&entry) )	{
+		ERR_ERROR("Unable to retrieve WIND_SPEED_SPATIAL_FILE property. \n", ERR_EINVAL);
+		}
+	/* open atm file */
+	if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
+		ERR_ERROR("Unable to open WIND_SPEED_SPATIAL_FILE. \n", ERR_EIOFAIL);
+		}
+	/* retrieve units from atm file */
+	if ( IsKeyStringPresentFStreamIO(fstream, WIND_SPD_ATM_KEYWORD_ENGLISH, 
+			WIND_SPD_ATM_COMMENT_CHAR) )	{
+		tbls->units = EnumMphVelocity;
+		}
+	else	{
+		rewind(fstream);
+		if ( IsKeyStringPresentFStreamIO(fstream, WIND_SPD_ATM_KEYWORD_METRIC, 
+				WIND_SPD_ATM_COMMENT_CHAR) )	{
+			tbls->units = EnumKmphVelocity;
+			}
+		else	{
+			fclose(fstream);
+			ERR_ERROR("Unable to retrieve units from WIND_SPEED_SPATIAL_FILE. \n", ERR_EUNITS);
+			}
+		}
+	/* retrieve contents of atm file */
+	if ( (atm_tbl = GetStrTwoDArrayTableFStreamIO(fstream, WIND_SPD_ATM_SEP_CHARS, 
+				WIND_SPD_ATM_COMMENT_CHAR)) == NULL )	{
+		fclose(fstream);
+		ERR_ERROR("Unable to parse WIND_SPEED_SPATIAL_FILE. \n", ERR_EINVAL);
+		}
+	/* cleanup */
+	fclose(fstream);
+	/* index atm table, rasters are read as simulations reach them */
+	if ( (tbls->wsp_ws = InitWeatherStream(proptbl, atm_tbl, WIND_SPD_MO_ATM_TBL_INDEX, WIND_SPD_DY_ATM_TBL_INDEX,
+				WIND_SPD_HR_ATM_TBL_INDEX, &file_col, 1)) == NULL )	{
+		ERR_ERROR("Unable to index WIND_SPEED_SPATIAL_FILE. \n", ERR_EINVAL);
+		}
+
+	return ERR_SUCCESS;
+	}
+
+void FreeWindSpdTables(void * vptr)	{
+	WindSpdTables * tbls = NULL;
+
+	if ( vptr != NULL )	{
+		tbls = (WindSpdTables *) vptr;
+		if ( tbls->wsp_dt != NULL )		FreeDateTable(tbls->wsp_dt);
+		if ( tbls->wsp_tbl != NULL )	FreeDblTwoDArray(tbls->wsp_tbl);
+		if ( tbls->wsp_ws != NULL )		FreeWeatherStream(tbls->wsp_ws);
+		if ( tbls->rng_list != NULL )	FreeList(tbls->rng_list);
+		free(tbls);
+		}
+	tbls = NULL;
+
+	return;
+	}
+
+WindSpdState * InitWindSpdState()	{
+	WindSpdState * st = NULL;
+
+	if ( (st = (WindSpdState *) calloc(1, sizeof(WindSpdState))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to allocate memory for WindSpdState. \n", ERR_ENOMEM);
+		return st;
+		}
+	st->wspwaf = EnumWindAdjustAB79;
+
+	return st;
+	}
+
+int SetWindSpdStateFromSimConfig(WindSpdState * st, const SimConfig * cfg)	{
+	/* check args */
+	if ( st == NULL || cfg == NULL )	{
+		ERR_ERROR("Arguments supplied to set WindSpdState invalid. \n", ERR_EINVAL);
+		}
+
+	st->wspwaf = cfg->wsp_waf;
+
+	return ERR_SUCCESS;
+	}
+
+int SetWindSpdStateFromTables(WindSpdState * st, const WindSpdTables * tbls)	{
+	/* check args */
+	if ( st == NULL || tbls == NULL )	{
+		ERR_ERROR("Arguments supplied to set WindSpdState invalid. \n", ERR_EINVAL);
+		}
+
+	st->tbls = tbls;
+	st->wsp = tbls->wsp_init;
+	/* rasters of the first record are read now, later records as the simulation reaches them */
+	if ( tbls->wsp_ws != NULL )	{
+		if ( (st->wsp_wc = InitWeatherStreamCursor(tbls->wsp_ws)) == NULL )	{
+			ERR_ERROR("Unable to initialize GridData from file listed in WIND_SPEED_SPATIAL_FILE. \n", ERR_EINVAL);
+			}
+		}
+
+	return ERR_SUCCESS;
+	}
+
+int GetWindSpeedMpsFIXEDFromProps(WindSpdState * st, ChHashTable * proptbl, double fbedhgtm, int month, int day, int hour,
+										double rwx, double rwy, double * wspmps)		{
+	int i;
+
 	/* args not used in FIXED implementation */
 	rwx = rwy = 0.0;
+
+	if ( st->tbls == NULL || st->tbls->wsp_dt == NULL )	{
+		ERR_ERROR("Windspeed table not initialized. \n", ERR_EINVAL);
+		}
 	
 	/* check to see if new windspeed needed */
-	if ( (smonth != month) || (sday != day) || (shour != hour) )	{
-		/* new wind speed table */
-		if (swsp_tbl == NULL )	{
-			*wspmps = swsp;
-			/* retrieve wsp filename */
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_WSPDFFILE), (void *)&entry) )	{
-				ERR_ERROR("Unable to retrieve WIND_SPEED_FIXED_FILE property. \n", ERR_EINVAL);
-				}
-			/* open file */
-			if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
-				ERR_ERROR("Unable to open WIND_SPEED_FIXED_FILE. \n", ERR_EIOFAIL);
-				}
-			/* retrieve string indicating units windspeed stored in */
-			if ( (units = GetValFromKeyStringFStreamIO(fstream, WIND_SPD_WSP_KEYWORD_UNITS, 
-					WIND_SPD_WSP_SEP_CHARS, WIND_SPD_WSP_COMMENT_CHAR)) == NULL )	{
-				fclose(fstream);
-				ERR_ERROR("Unable to determine units for WIND_SPEED_FIXED_FILE. \n", ERR_EINVAL);
-				}
-			/* create the table of values */			
-			if ( (swsp_tbl = GetDblTwoDArrayTableFStreamIO(fstream, 
-					WIND_SPD_WSP_SEP_CHARS, WIND_SPD_WSP_COMMENT_CHAR)) == NULL )	{
-				free(units);
-				fclose(fstream);
-				ERR_ERROR("Unable to parse WIND_SPEED_FIXED_FILE. \n", ERR_EFAILED);
-				}
-			/* convert values in table to mps */
-			if ( strcmp(units, WIND_SPD_WSP_KEYWORD_MILEPHR) == 0 )	{
-				sunits = EnumMphVelocity;
-				}
-			else if ( strcmp(units, WIND_SPD_WSP_KEYWORD_KMPHR) == 0 )	{
-				sunits = EnumKmphVelocity;
-				}
-			for(i = 0; i < DBLTWODARRAY_SIZE_ROW(swsp_tbl); i++)	{
-				for(j = WIND_SPD_HR_TO_WSP_TBL_INDEX(0); j < DBLTWODARRAY_SIZE_COL(swsp_tbl); j++)	{
-					if ( DBLTWODARRAY_GET_DATA(swsp_tbl, i, j) == WIND_SPD_WSP_NO_DATA_VALUE )	{
-						continue;
-						}
-					ConvertVelocityUnits(sunits, DBLTWODARRAY_GET_DATA(swsp_tbl, i, j), smps, &swsp);
-					DBLTWODARRAY_SET_DATA(swsp_tbl, i, j, swsp);
-					}
-				}
-			/* cleanup */
-			free(units);
-			fclose(fstream);
-      /* retrieve windspeed adjustment factor */
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_WSPWAF), (void *)&entry) )	{
-        swspwaf = VAL_AB79; /* default */
-				}
-      else if ( strcmp(entry->val, GetFireVal(VAL_BHP)) == 0 ) {
-        swspwaf = VAL_BHP;
-        }
-      else if ( strcmp(entry->val, GetFireVal(VAL_NOWAF)) == 0 ) {
-        swspwaf = VAL_NOWAF;
-        }
-			}
-		/* find record in table */
-		for(i = 0; i < DBLTWODARRAY_SIZE_ROW(swsp_tbl); i++)	{
-			/* find matching month and day */
-			if ( DBLTWODARRAY_GET_DATA(swsp_tbl, i, WIND_SPD_MO_WSP_TBL_INDEX) == month 
-				 && DBLTWODARRAY_GET_DATA(swsp_tbl, i, WIND_SPD_DY_WSP_TBL_INDEX) == day )	{
-				/* retrieve wsp on that month and day */
-				if ( DBLTWODARRAY_GET_DATA(swsp_tbl, i, WIND_SPD_HR_TO_WSP_TBL_INDEX(hour)) 
-						!= WIND_SPD_WSP_NO_DATA_VALUE )	{
-					swsp = DBLTWODARRAY_GET_DATA(swsp_tbl, i, WIND_SPD_HR_TO_WSP_TBL_INDEX(hour));
-					}
-				break;
-				}
+	if ( (st->month != month) || (st->day != day) || (st->hour != hour) )	{
+		/* retrieve wsp on first record of month and day, otherwise use last value */
+		if ( (i = DateTableGetRec(st->tbls->wsp_dt, month, day)) != DATE_TABLE_NO_REC
+				&& DATE_TABLE_GET_DATA(st->tbls->wsp_dt, i, WIND_SPD_HR_TO_WSP_TBL_INDEX(hour)) != WIND_SPD_WSP_NO_DATA_VALUE )	{
+			st->wsp = DATE_TABLE_GET_DATA(st->tbls->wsp_dt, i, WIND_SPD_HR_TO_WSP_TBL_INDEX(hour));
 			}
 		/* set {month, day, hour} for future calls */
-		smonth = month;
-		sday = day;
-		shour = hour;
+		st->month = month;
+		st->day = day;
+		st->hour = hour;
 		}
 	
 	/* apply windspeed reduction */
-  if ( swspwaf == VAL_BHP ) {
-    *wspmps = ConvertWindSpeedAtRefHgtToArbitraryHgtBHP(swsp, WIND_SPD_RAWS_REF_HGT_METERS, 2.0 * fbedhgtm);
-  } else if ( swspwaf == VAL_NOWAF ) {
-    *wspmps = swsp;
+  if ( st->wspwaf == EnumWindAdjustBHP ) {
+    *wspmps = ConvertWindSpeedAtRefHgtToArbitraryHgtBHP(st->wsp, WIND_SPD_RAWS_REF_HGT_METERS, 2.0 * fbedhgtm);
+  } else if ( st->wspwaf == EnumWindAdjustNone ) {
+    *wspmps = st->wsp;
 	} else { /* default */
-    *wspmps = ConvertWindSpeedAtRefHgtToArbitraryHgtAB79(swsp, WIND_SPD_RAWS_REF_HGT_METERS, 2.0 * fbedhgtm);
+    *wspmps = ConvertWindSpeedAtRefHgtToArbitraryHgtAB79(st->wsp, WIND_SPD_RAWS_REF_HGT_METERS, 2.0 * fbedhgtm);
   }
 
 	return ERR_SUCCESS;
 	}
 
-int GetWindSpeedMpsRANDUFromProps(ChHashTable * proptbl, double fbedhgtm, int month, int day, int hour,
+int GetWindSpeedMpsRANDUFromProps(WindSpdState * st, ChHashTable * proptbl, double fbedhgtm, int month, int day, int hour,
 										double rwx, double rwy, double * wspmps)		{
-	/* static variables used to store state across function calls */
-	static int smonth 				= 0;
-	static int sday 				= 0;
-	static int shour 				= 0;
-	static double swsp				= 0.0;
-	static List * rng_list			= NULL;				/* min and max args supplied to rng */
-	static double * min_rng, * max_rng;
-  static EnumFireVal swspwaf = VAL_AB79;
-	/* stack variables */
-	KeyVal * entry					= NULL;				/* key/val instances from table */	
-	ListElmt * lel					= NULL;
 
 	/* args not used in RANDU implementation */
 	rwx = rwy = 0.0;
+
+	if ( st->tbls == NULL || st->tbls->rng_list == NULL )	{
+		ERR_ERROR("Windspeed range not initialized. \n", ERR_EINVAL);
+		}
 	
 	/* check to see if new windspeed needed */	
-	if ( (smonth != month) || (sday != day) || (shour != hour) )	{
-		/* new min and max range */
-		if ( rng_list == NULL )	{
-			/* retrieve wind speed range property */
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_WSPDUNIRNG), (void *)&entry) )	{
-				ERR_ERROR("Unable to retrieve WIND_SPEED_UNIFORM_RANGE property. \n", ERR_EINVAL);
-				}	
-			/* parse value into List */
-			if ( (rng_list = GetDblListFromLineFStreamIO((char *) entry->val, 
-								WIND_SPD_RNG_SEP_CHARS)) == NULL )	{
-				ERR_ERROR("Unable to retrieve min and max from WIND_SPEED_UNIFORM_RANGE. \n", ERR_EINVAL);
-				}
-			/* parse string to numbers */
-			if ( LIST_SIZE(rng_list) != 2 )	{
-				ERR_ERROR("WIND_SPEED_UNIFORM_RANGE property should contain two floating point tokens. \n", ERR_EINVAL);
-				}
-			lel = LIST_HEAD(rng_list);
-			min_rng = LIST_GET_DATA(lel);
-			lel = LIST_GET_NEXT_ELMT(lel);
-			max_rng = LIST_GET_DATA(lel);
-      /* retrieve windspeed adjustment factor */
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_WSPWAF), (void *)&entry) )	{
-        swspwaf = VAL_AB79; /* default */
-				}
-      else if ( strcmp(entry->val, GetFireVal(VAL_BHP)) == 0 ) {
-        swspwaf = VAL_BHP;
-        }
-      else if ( strcmp(entry->val, GetFireVal(VAL_NOWAF)) == 0 ) {
-        swspwaf = VAL_NOWAF;
-        }
-			}
+	if ( (st->month != month) || (st->day != day) || (st->hour != hour) )	{
 		/* new windspeed */
-		swsp = randu(*min_rng, *max_rng);
+		st->wsp = RandStreamUniform(&st->rs, *st->tbls->min_rng, *st->tbls->max_rng);
 		/* set {month, day, hour} for future calls */
-		smonth = month;
-		sday = day;
-		shour = hour;		
+		st->month = month;
+		st->day = day;
+		st->hour = hour;		
 		}
 
 	/* apply windspeed reduction */
-  if ( swspwaf == VAL_BHP ) {
-    *wspmps = ConvertWindSpeedAtRefHgtToArbitraryHgtBHP(swsp, WIND_SPD_RAWS_REF_HGT_METERS, 2.0 * fbedhgtm);
-  } else if ( swspwaf == VAL_NOWAF ) {
-    *wspmps = swsp;
+  if ( st->wspwaf == EnumWindAdjustBHP ) {
+    *wspmps = ConvertWindSpeedAtRefHgtToArbitraryHgtBHP(st->wsp, WIND_SPD_RAWS_REF_HGT_METERS, 2.0 * fbedhgtm);
+  } else if ( st->wspwaf == EnumWindAdjustNone ) {
+    *wspmps = st->wsp;
 	} else { /* default */
-    *wspmps = ConvertWindSpeedAtRefHgtToArbitraryHgtAB79(swsp, WIND_SPD_RAWS_REF_HGT_METERS, 2.0 * fbedhgtm);
+    *wspmps = ConvertWindSpeedAtRefHgtToArbitraryHgtAB79(st->wsp, WIND_SPD_RAWS_REF_HGT_METERS, 2.0 * fbedhgtm);
   }
 				
 	return ERR_SUCCESS;
 	}
 
-int GetWindSpeedMpsRANDHFromProps(ChHashTable * proptbl, double fbedhgtm, int month, int day, int hour,
+int GetWindSpeedMpsRANDHFromProps(WindSpdState * st, ChHashTable * proptbl, double fbedhgtm, int month, int day, int hour,
 										double rwx, double rwy, double * wspmps)		{										
-	/* static variables used to store state across function calls */
-	static int smonth 				= 0;
-	static int sday 				= 0;
-	static int shour 				= 0;
-	static double swsp				= 0.0;
-	static DblTwoDArray * swsp_tbl 	= NULL;
-	static EnumUnitVelocity sunits	= EnumUnknownVelocity;	
-  static EnumFireVal swspwaf = VAL_AB79;
-	/* stack variables */
-	KeyVal * entry					= NULL;				/* key/val instances from table */
-	FILE * fstream					= NULL;				/* file stream */
-	char * units					= NULL;
 	int i, j;
 	
 	/* args not used in RANDH implementation */
 	rwx = rwy = 0.0;
+
+	if ( st->tbls == NULL || st->tbls->wsp_tbl == NULL )	{
+		ERR_ERROR("Windspeed table not initialized. \n", ERR_EINVAL);
+		}
 	
 	/* check to see if new windspeed needed */
-	if ( (smonth != month) || (sday != day) || (shour != hour) )	{
-		/* new wind speed needed */
-		if (swsp_tbl == NULL )	{
-			*wspmps = swsp;		
-			/* retrieve wsp filename */
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_WSPDHFILE), (void *)&entry) )	{
-				ERR_ERROR("Unable to retrieve WIND_SPEED_HISTORICAL_FILE property. \n", ERR_EINVAL);
-				}
-			/* open file */
-			if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
-				ERR_ERROR("Unable to open WIND_SPEED_HISTORICAL_FILE. \n", ERR_EIOFAIL);
-				}
-			/* retrieve string indicating units windspeed stored in */
-			if ( (units = GetValFromKeyStringFStreamIO(fstream, WIND_SPD_WSP_KEYWORD_UNITS, 
-					WIND_SPD_WSP_SEP_CHARS, WIND_SPD_WSP_COMMENT_CHAR)) == NULL )	{
-				fclose(fstream);
-				ERR_ERROR("Unable to determine units for WIND_SPEED_HISTORICAL_FILE. \n", ERR_EINVAL);
-				}
-			/* create the table of values */			
-			if ( (swsp_tbl = GetDblTwoDArrayTableFStreamIO(fstream, 
-					WIND_SPD_WSP_SEP_CHARS, WIND_SPD_WSP_COMMENT_CHAR)) == NULL )	{
-				free(units);
-				fclose(fstream);
-				ERR_ERROR("Unable to parse WIND_SPEED_HISTORICAL_FILE. \n", ERR_EFAILED);
-				}
-			/* convert values in table to mps */
-			if ( strcmp(units, WIND_SPD_WSP_KEYWORD_MILEPHR) == 0 )	{
-				sunits = EnumMphVelocity;
-				}
-			else if ( strcmp(units, WIND_SPD_WSP_KEYWORD_KMPHR) == 0 )	{
-				sunits = EnumKmphVelocity;
-				}
-			for(i = 0; i < DBLTWODARRAY_SIZE_ROW(swsp_tbl); i++)	{
-				for(j = WIND_SPD_HR_TO_WSP_TBL_INDEX(0); j < DBLTWODARRAY_SIZE_COL(swsp_tbl); j++)	{
-					if ( DBLTWODARRAY_GET_DATA(swsp_tbl, i, j) == WIND_SPD_WSP_NO_DATA_VALUE )	{
-						continue;
-						}				
-					ConvertVelocityUnits(sunits, DBLTWODARRAY_GET_DATA(swsp_tbl, i, j), smps, &swsp);
-					DBLTWODARRAY_SET_DATA(swsp_tbl, i, j, swsp);
-					}
-				}
-			/* cleanup */
-			free(units);
-			fclose(fstream);
-      /* retrieve windspeed adjustment factor */
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_WSPWAF), (void *)&entry) )	{
-        swspwaf = VAL_AB79; /* default */
-				}
-      else if ( strcmp(entry->val, GetFireVal(VAL_NOWAF)) == 0 ) {
-        swspwaf = VAL_NOWAF;
-        }
-      else if ( strcmp(entry->val, GetFireVal(VAL_BHP)) == 0 ) {
-        swspwaf = VAL_BHP;
-        }			
-			}
+	if ( (st->month != month) || (st->day != day) || (st->hour != hour) )	{
 		/* find wind speed from random record in table that is not NO DATA */
 		do	{
 			/* retrieve a record at random from table within range 0 to num_recs */
-			i = randi(0) % DBLTWODARRAY_SIZE_ROW(swsp_tbl);			
+			i = RandStreamIndex(&st->rs, DBLTWODARRAY_SIZE_ROW(st->tbls->wsp_tbl));			
 			j = WIND_SPD_HR_TO_WSP_TBL_INDEX(hour);
 			/* retrieve wsp from random recno using current hour */
-			swsp = DBLTWODARRAY_GET_DATA(swsp_tbl, i, j);		
-			} while( swsp == WIND_SPD_WSP_NO_DATA_VALUE );
+			st->wsp = DBLTWODARRAY_GET_DATA(st->tbls->wsp_tbl, i, j);		
+			} while( st->wsp == WIND_SPD_WSP_NO_DATA_VALUE );
 		/* set {month, day, hour} for future calls */
-		smonth = month;
-		sday = day;
-		shour = hour;
+		st->month = month;
+		st->day = day;
+		st->hour = hour;
 		}
 
 	/* apply windspeed reduction */
-  if ( swspwaf == VAL_BHP ) {
-    *wspmps = ConvertWindSpeedAtRefHgtToArbitraryHgtBHP(swsp, WIND_SPD_RAWS_REF_HGT_METERS, 2.0 * fbedhgtm);
-  } else if ( swspwaf == VAL_NOWAF ) {
-    *wspmps = swsp;
+  if ( st->wspwaf == EnumWindAdjustBHP ) {
+    *wspmps = ConvertWindSpeedAtRefHgtToArbitraryHgtBHP(st->wsp, WIND_SPD_RAWS_REF_HGT_METERS, 2.0 * fbedhgtm);
+  } else if ( st->wspwaf == EnumWindAdjustNone ) {
+    *wspmps = st->wsp;
 	} else { /* default */
-    *wspmps = ConvertWindSpeedAtRefHgtToArbitraryHgtAB79(swsp, WIND_SPD_RAWS_REF_HGT_METERS, 2.0 * fbedhgtm);
+    *wspmps = ConvertWindSpeedAtRefHgtToArbitraryHgtAB79(st->wsp, WIND_SPD_RAWS_REF_HGT_METERS, 2.0 * fbedhgtm);
   }
 
 	return ERR_SUCCESS;	
 	}
 	
-int GetWindSpeedMpsSPATIALFromProps(ChHashTable * proptbl, double fbedhgtm, int month, int day, int hour, 
+int GetWindSpeedMpsSPATIALFromProps(WindSpdState * st, ChHashTable * proptbl, double fbedhgtm, int month, int day, int hour, 
 										double rwx, double rwy, double * wspmps)		{
-	/* static variables used to store state across function calls */
-	static int smonth 				= 0;
-	static int sday 				= 0;
-	static int shour 				= 0;
-	static StrTwoDArray * satm_tbl	= NULL;
-	static EnumUnitVelocity sunits	= EnumUnknownVelocity;	
-	static GridData * swsp_grid 	= NULL;
-  static EnumFireVal swspwaf = VAL_AB79;
 	/* stack variables */
-	KeyVal * entry					= NULL;				/* key/val instances from table */
-	FILE * fstream					= NULL;				/* file stream */
-	char * units					= NULL;
 	double wsp_org_units = 0.0, wsp_mps_units = 0.0;
+	GridData * wsp_grid				= NULL;				/* wind speed of the current hour */
 	int i,j;
 
-	/* check to see if new tables are needed */
-	if ( (smonth != month) || (sday != day) || (shour != hour) )	{
-		/* new atm tbl */
-		if (satm_tbl == NULL )	{
-			/* retriev atm filename from properties */
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_WSPDSPFILE), (void *)&entry) )	{
-				ERR_ERROR("Unable to retrieve WIND_SPEED_SPATIAL_FILE property. \n", ERR_EINVAL);
-				}
-			/* open atm file */
-			if ( (fstream = fopen((char *) entry->val, "r")) == NULL )	{
-				ERR_ERROR("Unable to open WIND_SPEED_SPATIAL_FILE. \n", ERR_EIOFAIL);
-				}
-			/* retrieve units from atm file */
-			if ( IsKeyStringPresentFStreamIO(fstream, WIND_SPD_ATM_KEYWORD_ENGLISH, 
-					WIND_SPD_ATM_COMMENT_CHAR) )	{
-				sunits = EnumMphVelocity;
-				}
-			else	{
-				rewind(fstream);
-				if ( IsKeyStringPresentFStreamIO(fstream, WIND_SPD_ATM_KEYWORD_METRIC, 
-						WIND_SPD_ATM_COMMENT_CHAR) )	{
-					sunits = EnumKmphVelocity;
-					}
-				else	{
-					fclose(fstream);
-					ERR_ERROR("Unable to retrieve units from WIND_SPEED_SPATIAL_FILE. \n", ERR_EUNITS);
-					}
-				}
-			/* retrieve contents of atm file */
-			if ( (satm_tbl = GetStrTwoDArrayTableFStreamIO(fstream, WIND_SPD_ATM_SEP_CHARS, 
-						WIND_SPD_ATM_COMMENT_CHAR)) == NULL )	{
-				fclose(fstream);
-				ERR_ERROR("Unable to parse WIND_SPEED_SPATIAL_FILE. \n", ERR_EINVAL);
-				}
-			/* cleanup */
-			fclose(fstream);
-      /* retrieve windspeed adjustment factor */
-			if ( ChHashTableRetrieve(proptbl, GetFireProp(PROP_WSPWAF), (void *)&entry) )	{
-        swspwaf = VAL_AB79; /* default */
-				}
-      else if ( strcmp(entry->val, GetFireVal(VAL_BHP)) == 0 ) {
-        swspwaf = VAL_BHP;
-        }
-      else if ( strcmp(entry->val, GetFireVal(VAL_NOWAF)) == 0 ) {
-        swspwaf = VAL_NOWAF;
-        }
-			}							
-		/* new wsp grid */
-		if ( swsp_grid == NULL )	{
-			if ( (swsp_grid = InitGridDataFromAsciiRaster(STRTWODARRAY_GET_DATA(satm_tbl, 0, WIND_SPD_FILE_ATM_TBL_INDEX), 
-								EnumDblGrid)) == NULL )	{
-				ERR_ERROR("Unable to initialize GridData from file listed in WIND_SPEED_SPATIAL_FILE. \n", ERR_EINVAL);
-				}
-			}
-		/* find record in atm table */
-		for(i = 0; i < DBLTWODARRAY_SIZE_ROW(satm_tbl); i++)	{
-			/* parse the atm table from strings to numbers */
-			smonth = atoi(STRTWODARRAY_GET_DATA(satm_tbl, i, WIND_SPD_MO_ATM_TBL_INDEX));
-			sday = atoi(STRTWODARRAY_GET_DATA(satm_tbl, i, WIND_SPD_DY_ATM_TBL_INDEX));
-			shour = atoi(STRTWODARRAY_GET_DATA(satm_tbl, i, WIND_SPD_HR_ATM_TBL_INDEX)) / 100;
-			/* find matching month and day and hour */
-			if ( (smonth == month) && (sday == day) && (shour == hour) )	{
-				/* free old grid */
-				FreeGridData(swsp_grid);
-				/* initialize new grid */
-				if ( (swsp_grid = InitGridDataFromAsciiRaster(STRTWODARRAY_GET_DATA(satm_tbl, i, WIND_SPD_FILE_ATM_TBL_INDEX), 
-									EnumDblGrid)) == NULL )	{
-					ERR_ERROR("Unable to initialize GridData from file listed in WIND_SPEED_SPATIAL_FILE. \n", ERR_EINVAL);
-					}
-				break;
-				}
+	if ( st->wsp_wc == NULL )	{
+		ERR_ERROR("Windspeed rasters not initialized. \n", ERR_EINVAL);
+		}
+
+	/* check to see if new rasters are needed */
+	if ( (st->month != month) || (st->day != day) || (st->hour != hour) )	{
+		/* rasters of the hour listed in the atm table, read in the background when the previous hour was reached */
+		if ( WeatherStreamSeek(st->wsp_wc, month, day, hour) )	{
+			ERR_ERROR("Unable to initialize GridData from file listed in WIND_SPEED_SPATIAL_FILE. \n", ERR_EINVAL);
 			}
 		/* set {month, day, hour} for future calls */
-		smonth = month;
-		sday = day;
-		shour = hour;
+		st->month = month;
+		st->day = day;
+		st->hour = hour;
 		}
+	/* rasters of the current hour */
+	wsp_grid = WEATHER_STREAM_GET_GRID(st->wsp_wc, 0);
 
 	/* transform array indecies into spatial coordinates */
-	if ( CoordTransRealWorldToRaster(rwx, rwy, swsp_grid->ghdr->cellsize, swsp_grid->ghdr->cellsize,
-			COORD_TRANS_XLLCORNER_TO_XULCNTR(swsp_grid->ghdr->xllcorner, swsp_grid->ghdr->cellsize),
-			COORD_TRANS_YLLCORNER_TO_YULCNTR(swsp_grid->ghdr->yllcorner, swsp_grid->ghdr->cellsize, swsp_grid->ghdr->nrows),
+	if ( CoordTransRealWorldToRaster(rwx, rwy, wsp_grid->ghdr->cellsize, wsp_grid->ghdr->cellsize,
+			COORD_TRANS_XLLCORNER_TO_XULCNTR(wsp_grid->ghdr->xllcorner, wsp_grid->ghdr->cellsize),
+			COORD_TRANS_YLLCORNER_TO_YULCNTR(wsp_grid->ghdr->yllcorner, wsp_grid->ghdr->cellsize, wsp_grid->ghdr->nrows),
 			&i, &j) )	{
 		ERR_ERROR("Unable to transform real world coordinates to grid indecies. \n", ERR_ESING);
 		}			
 													
 	/* retrieve windspeed at coordinate */
-	GRID_DATA_GET_DATA(swsp_grid, i, j, wsp_org_units);
+	GRID_DATA_GET_DATA(wsp_grid, i, j, wsp_org_units);
 	
 	/* convert units of windspeed to meters per second */
-	ConvertVelocityUnits(sunits, wsp_org_units, smps, &wsp_mps_units);
+	ConvertVelocityUnits(st->tbls->units, wsp_org_units, smps, &wsp_mps_units);
 
 	/* apply windspeed reduction */
-  if ( swspwaf == VAL_BHP ) {
+  if ( st->wspwaf == EnumWindAdjustBHP ) {
     *wspmps = ConvertWindSpeedAtRefHgtToArbitraryHgtBHP(wsp_mps_units, WIND_SPD_RAWS_REF_HGT_METERS, 2.0 * fbedhgtm);
-  } else if ( swspwaf == VAL_NOWAF ) {
+  } else if ( st->wspwaf == EnumWindAdjustNone ) {
     *wspmps = wsp_mps_units;
 	} else { /* default */
     *wspmps = ConvertWindSpeedAtRefHgtToArbitraryHgtAB79(wsp_mps_units, WIND_SPD_RAWS_REF_HGT_METERS, 2.0 * fbedhgtm);
@@ -441,4 +453,18 @@ double ConvertWindSpeedAtRefHgtToArbitraryHgtBHP(double wsmps, double refhgtm, d
   return wsmps;
   }
 
+void FreeWindSpdState(void * vptr)	{
+	WindSpdState * st = NULL;
+
+	if ( vptr != NULL )	{
+		st = (WindSpdState *) vptr;
+		/* tables are shared and freed by their owner */
+		if ( st->wsp_wc != NULL )	FreeWeatherStreamCursor(st->wsp_wc);
+		free(st);
+		}
+	st = NULL;
+
+	return;
+	}
+
 /* end of WindSpd.c */
@@ -33,14 +33,18 @@
 
 #include "CoordTrans.h"
 #include "Units.h"
-#include "NLIBRand.h"
+#include "RandStream.h"
 #include "FireProp.h"
 #include "ChHashTable.h"
 #include "KeyVal.h"
 #include "DblTwoDArray.h"
+#include "DateTable.h"
 #include "StrTwoDArray.h"
 #include "GridData.h"
+#include "FireGridData.h"
+#include "WeatherStream.h"
 #include "FStreamIO.h"
+#include "SimConfig.h"
 #include "Err.h"
 
 /*
@@ -97,7 +101,63 @@
  * STRUCTS, TYPEDEFS
  *********************************************************
  */
- 
+
+/*! Type name for WindSpdTables_
+ *	\sa For a list of members goto WindSpdTables_
+ */
+typedef struct WindSpdTables_ WindSpdTables;
+
+/*!	\struct WindSpdTables_ WindSpd.h "WindSpd.h"
+ *	\brief tables of windspeeds read once from the files named in the simulation properties
+ *	Not modified once read, so shared by the WindSpdState of every simulation.
+ */
+struct WindSpdTables_	{
+	/*! table of FIXED windspeeds indexed by month and day, in m/s */
+	DateTable * wsp_dt;
+	/*! table of RANDH windspeeds, in m/s */
+	DblTwoDArray * wsp_tbl;
+	/*! atm table of SPATIAL windspeeds */
+	WeatherStream * wsp_ws;
+	/*! min and max of RANDU windspeeds */
+	List * rng_list;
+	/*! min of RANDU windspeeds, stored in rng_list */
+	double * min_rng;
+	/*! max of RANDU windspeeds, stored in rng_list */
+	double * max_rng;
+	/*! units of windspeeds read from file */
+	EnumUnitVelocity units;
+	/*! windspeed used before the first date listed in the FIXED table, in m/s */
+	double wsp_init;
+	};
+
+/*! Type name for WindSpdState_
+ *	\sa For a list of members goto WindSpdState_
+ */
+typedef struct WindSpdState_ WindSpdState;
+
+/*!	\struct WindSpdState_ WindSpd.h "WindSpd.h"
+ *	\brief windspeed retrieved by the windspeed functions
+ *	Stored by FireEnv in place of function statics so each simulation owns its state.
+ */
+struct WindSpdState_	{
+	/*! month of the last call */
+	int month;
+	/*! day of the last call */
+	int day;
+	/*! hour of the last call */
+	int hour;
+	/*! windspeed of the last call at reference height, in m/s */
+	double wsp;
+	/*! tables shared by every simulation */
+	const WindSpdTables * tbls;
+	/*! rasters of SPATIAL windspeeds at the current hour */
+	WeatherStreamCursor * wsp_wc;
+	/*! windspeed adjustment factor applied to windspeed */
+	EnumWindAdjust wspwaf;
+	/*! random numbers drawing RANDU windspeeds and choosing RANDH records */
+	RandStream rs;
+	};
+
 /*
  *********************************************************
  * MACROS
@@ -156,7 +216,107 @@
  *********************************************************
  */
 
-/*! \fn int GetWindSpeedMpsFIXEDFromProps(ChHashTable * proptbl, double fbedhgtm, int month, int day, int hour,
+/*! \fn WindSpdTables * InitWindSpdTables()
+ *	\brief Initializes an empty set of windspeed tables.
+ *
+ *	\sa WindSpdTables
+ *	\retval WindSpdTables* Ptr to initialized WindSpdTables, or NULL if unable to allocate
+ */
+WindSpdTables * InitWindSpdTables();
+
+/*! \fn int SetWindSpdTablesFIXEDFromProps(WindSpdTables * tbls, ChHashTable * proptbl)
+ *	\brief Reads the table named by WIND_SPEED_FIXED_FILE, converts it to m/s and indexes it by month and day.
+ *
+ *	\sa WindSpdTables
+ *	\param tbls WindSpdTables
+ *	\param proptbl ChHashTable of simulation properties
+ *	\retval int ERR_SUCCESS(0) if successful, an error code otherwise
+ */
+int SetWindSpdTablesFIXEDFromProps(WindSpdTables * tbls, ChHashTable * proptbl);
+
+/*! \fn int SetWindSpdTablesRANDUFromProps(WindSpdTables * tbls, ChHashTable * proptbl)
+ *	\brief Parses the min and max windspeed of WIND_SPEED_UNIFORM_RANGE.
+ *
+ *	\sa WindSpdTables
+ *	\param tbls WindSpdTables
+ *	\param proptbl ChHashTable of simulation properties
+ *	\retval int ERR_SUCCESS(0) if successful, an error code otherwise
+ */
+int SetWindSpdTablesRANDUFromProps(WindSpdTables * tbls, ChHashTable * proptbl);
+
+/*! \fn int SetWindSpdTablesRANDHFromProps(WindSpdTables * tbls, ChHashTable * proptbl)
+ *	\brief Reads the table named by WIND_SPEED_HISTORICAL_FILE and converts it to m/s.
+ *
+ *	\sa WindSpdTables
+ *	\param tbls WindSpdTables
+ *	\param proptbl ChHashTable of simulation properties
+ *	\retval int ERR_SUCCESS(0) if successful, an error code otherwise
+ */
+int SetWindSpdTablesRANDHFromProps(WindSpdTables * tbls, ChHashTable * proptbl);
+
+/*! \fn int SetWindSpdTablesSPATIALFromProps(WindSpdTables * tbls, ChHashTable * proptbl)
+ *	\brief Reads the atm table named by WIND_SPEED_SPATIAL_FILE and indexes it by month, day and hour.
+ *
+ *	The rasters listed in the atm table are read as simulations reach them.
+ *	\sa WindSpdTables
+ *	\sa WeatherStream
+ *	\param tbls WindSpdTables
+ *	\param proptbl ChHashTable of simulation properties
+ *	\retval int ERR_SUCCESS(0) if successful, an error code otherwise
+ */
+int SetWindSpdTablesSPATIALFromProps(WindSpdTables * tbls, ChHashTable * proptbl);
+
+/*! \fn void FreeWindSpdTables(void * vptr)
+ *	\brief Frees memory associated with WindSpdTables structure.
+ *
+ *	Every WindSpdState using the tables must be freed first.
+ *	\sa WindSpdTables
+ *	\param vptr ptr to WindSpdTables
+ */
+void FreeWindSpdTables(void * vptr);
+
+/*! \fn WindSpdState * InitWindSpdState()
+ *	\brief Initializes the windspeed state of a simulation.
+ *
+ *	\sa WindSpdState
+ *	\retval WindSpdState* Ptr to initialized WindSpdState, or NULL if unable to allocate
+ */
+WindSpdState * InitWindSpdState();
+
+/*! \fn void FreeWindSpdState(void * vptr)
+ *	\brief Frees memory associated with WindSpdState structure.
+ *
+ *	\sa WindSpdState
+ *	\param vptr ptr to WindSpdState
+ */
+void FreeWindSpdState(void * vptr);
+
+/*! \fn int SetWindSpdStateFromTables(WindSpdState * st, const WindSpdTables * tbls)
+ *	\brief Links the windspeed state of a simulation to the shared windspeed tables.
+ *
+ *	Call once before the first call to the functions taking WindSpdState as argument.
+ *	The tables must outlive the state.
+ *	\sa WindSpdState
+ *	\sa WindSpdTables
+ *	\param st WindSpdState
+ *	\param tbls WindSpdTables read for the windspeed type of the simulation
+ *	\retval int ERR_SUCCESS(0) if successful, an error code otherwise
+ */
+int SetWindSpdStateFromTables(WindSpdState * st, const WindSpdTables * tbls);
+
+/*! \fn int SetWindSpdStateFromSimConfig(WindSpdState * st, const SimConfig * cfg)
+ *	\brief Sets the windspeed adjustment factor of the windspeed state from SimConfig.
+ *
+ *	Call once before the first call to the functions taking WindSpdState as argument.
+ *	\sa WindSpdState
+ *	\sa SimConfig
+ *	\param st WindSpdState
+ *	\param cfg SimConfig of simulation
+ *	\retval int ERR_SUCCESS(0) if successful, an error code otherwise
+ */
+int SetWindSpdStateFromSimConfig(WindSpdState * st, const SimConfig * cfg);
+
+/*! \fn int GetWindSpeedMpsFIXEDFromProps(WindSpdState * st, ChHashTable * proptbl, double fbedhgtm, int month, int day, int hour,
 												double rwx, double rwy, double * wspmps)
  *	\brief retrieves time and space dependent windspeed, in m/s, at a cell
  *
@@ -164,6 +324,7 @@
  * 	based upon index into a table of historical values
  *	\sa ChHashTable
  *	\sa Check the \htmlonly <a href="config_file_doc.html#WIND_SPEED">config file documentation</a> \endhtmlonly
+ *	\param st WindSpdState storing the windspeed between calls
  *	\param proptbl ChHashTable of simulation properties
  *	\param fbedhgtm height of the fuel bed in meters
  *	\param month date to retreive windspeed for  
@@ -180,10 +341,10 @@
  *				// something bad happened
  *	\endcode
  */
-int GetWindSpeedMpsFIXEDFromProps(ChHashTable * proptbl, double fbedhgtm, int month, int day, int hour,
+int GetWindSpeedMpsFIXEDFromProps(WindSpdState * st, ChHashTable * proptbl, double fbedhgtm, int month, int day, int hour,
 										double rwx, double rwy, double * wspmps);
 
-/*! \fn int GetWindSpeedMpsRANDUFromProps(ChHashTable * proptbl, double fbedhgtm, int month, int day, int hour,
+/*! \fn int GetWindSpeedMpsRANDUFromProps(WindSpdState * st, ChHashTable * proptbl, double fbedhgtm, int month, int day, int hour,
 												double rwx, double rwy, double * wspmps)
  *	\brief retrieves time and space dependent windspeed, in m/s, at a cell
  *
@@ -191,6 +352,7 @@ int GetWindSpeedMpsFIXEDFromProps(ChHashTable * proptbl, double fbedhgtm, int mo
  * 	based upon a constrained uniform random number generating function
  *	\sa ChHashTable
  *	\sa Check the \htmlonly <a href="config_file_doc.html#WIND_SPEED">config file documentation</a> \endhtmlonly
+ *	\param st WindSpdState storing the windspeed between calls
  *	\param proptbl ChHashTable of simulation properties
  *	\param fbedhgtm height of the fuel bed in meters
  *	\param month date to retreive windspeed for  
@@ -207,10 +369,10 @@ int GetWindSpeedMpsFIXEDFromProps(ChHashTable * proptbl, double fbedhgtm, int mo
  *				// something bad happened
  *	\endcode
  */
-int GetWindSpeedMpsRANDUFromProps(ChHashTable * proptbl, double fbedhgtm, int month, int day, int hour,
+int GetWindSpeedMpsRANDUFromProps(WindSpdState * st, ChHashTable * proptbl, double fbedhgtm, int month, int day, int hour,
 										double rwx, double rwy, double * wspmps);
 
-/*! \fn int GetWindSpeedMpsRANDHFromProps(ChHashTable * proptbl, double fbedhgtm, int month, int day, int hour,
+/*! \fn int GetWindSpeedMpsRANDHFromProps(WindSpdState * st, ChHashTable * proptbl, double fbedhgtm, int month, int day, int hour,
 												double rwx, double rwy, double * wspmps)
  *	\brief retrieves time and space dependent windspeed, in m/s, at a cell
  *
@@ -218,6 +380,7 @@ int GetWindSpeedMpsRANDUFromProps(ChHashTable * proptbl, double fbedhgtm, int mo
  * 	based upon random index into a table of historical values
  *	\sa ChHashTable
  *	\sa Check the \htmlonly <a href="config_file_doc.html#WIND_SPEED">config file documentation</a> \endhtmlonly
+ *	\param st WindSpdState storing the windspeed between calls
  *	\param proptbl ChHashTable of simulation properties
  *	\param fbedhgtm height of the fuel bed in meters
  *	\param month date to retreive windspeed for  
@@ -234,10 +397,10 @@ int GetWindSpeedMpsRANDUFromProps(ChHashTable * proptbl, double fbedhgtm, int mo
  *				// something bad happened
  *	\endcode
  */
-int GetWindSpeedMpsRANDHFromProps(ChHashTable * proptbl, double fbedhgtm, int month, int day, int hour,
+int GetWindSpeedMpsRANDHFromProps(WindSpdState * st, ChHashTable * proptbl, double fbedhgtm, int month, int day, int hour,
 										double rwx, double rwy, double * wspmps);
 
-/*! \fn int GetWindSpeedMpsSPATIALFromProps(ChHashTable * proptbl, double fbedhgtm, int month, int day, int hour, 
+/*! \fn int GetWindSpeedMpsSPATIALFromProps(WindSpdState * st, ChHashTable * proptbl, double fbedhgtm, int month, int day, int hour, 
 												double rwx, double rwy, double * wspmps)
  *	\brief retrieves time and space dependent windspeed, in m/s, at a cell
  *
@@ -245,6 +408,7 @@ int GetWindSpeedMpsRANDHFromProps(ChHashTable * proptbl, double fbedhgtm, int mo
  * 	based upon index into a raster of windspeeds
  *	\sa ChHashTable
  *	\sa Check the \htmlonly <a href="config_file_doc.html#WIND_SPEED">config file documentation</a> \endhtmlonly
+ *	\param st WindSpdState storing the windspeed between calls
  *	\param proptbl ChHashTable of simulation properties
  *	\param fbedhgtm height of the fuel bed in meters
  *	\param month date to retreive windspeed for  
@@ -261,7 +425,7 @@ int GetWindSpeedMpsRANDHFromProps(ChHashTable * proptbl, double fbedhgtm, int mo
  *				// something bad happened
  *	\endcode
  */	
-int GetWindSpeedMpsSPATIALFromProps(ChHashTable * proptbl, double fbedhgtm, int month, int day, int hour, 
+int GetWindSpeedMpsSPATIALFromProps(WindSpdState * st, ChHashTable * proptbl, double fbedhgtm, int month, int day, int hour, 
 											double rwx, double rwy, double * wspmps);
 
 /*!	\fn double ConvertWindSpeedAtRefHgtToArbitraryHgtAB79(double wsmps, double refhgtm, double hgtm)
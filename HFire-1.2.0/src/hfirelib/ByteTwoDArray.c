@@ -16,6 +16,8 @@
  */
 ByteTwoDArray * InitByteTwoDArraySizeEmpty(unsigned int num_rows, unsigned int num_cols)	{
 	ByteTwoDArray * ba = NULL;
+	char * block = NULL;
+	size_t hdr;
 	int i;
 	
 	if ( num_rows < 1 || num_cols < 1 )	{
@@ -26,26 +28,18 @@ ByteTwoDArray * InitByteTwoDArraySizeEmpty(unsigned int num_rows, unsigned int n
 		ERR_ERROR_CONTINUE("Unable to initbalize array, memory allocation failed. \n", ERR_ENOMEM);
 		return ba;
 		}
-	if ( (ba->array = (unsigned char **) malloc(sizeof(unsigned char *) * num_rows)) == NULL ) {
+	/* row ptrs and elements share a single block, elements begin on an aligned boundary */
+	hdr = sizeof(unsigned char *) * num_rows + BYTETWODARRAY_ALIGN - 1;
+	if ( (block = (char *) malloc(hdr + sizeof(unsigned char) * (size_t) num_rows * num_cols)) == NULL ) {
 		ERR_ERROR_CONTINUE("Unable to initbalize array, memory allocation failed. \n", ERR_ENOMEM);
 		free(ba);
 		ba = NULL;
 		return ba;
 		}
+	ba->array = (unsigned char **) block;
+	ba->data = (unsigned char *) (block + hdr - ((size_t) (block + hdr) % BYTETWODARRAY_ALIGN));
 	for(i = 0; i < num_rows; i++)	{
-		if ( (ba->array[i] = (unsigned char *) malloc(sizeof(unsigned char) * num_cols)) == NULL )	{
-			ERR_ERROR_CONTINUE("Unable to initbalize array, memory allocation failed. \n", ERR_ENOMEM);
-			/* unwind and deallocate any rows that have been allocated to this point */
-			num_rows = i;
-			for ( i = 0; i < num_rows; i++)	{
-				free(ba->array[i]);
-				ba->array[i] = NULL;
-				}
-			free(ba->array);
-			free(ba);
-			ba = NULL;
-			return ba;			
-			}
+		ba->array[i] = ba->data + (size_t) i * num_cols;
 		}
 	ba->size_rows = num_rows;
 	ba->size_cols = num_cols;
@@ -71,20 +65,62 @@ ByteTwoDArray * InitByteTwoDArraySizeEmpty(unsigned int num_rows, unsigned int n
  * NULL if memory not able to be allocated
  */
 ByteTwoDArray * InitByteTwoDArraySizeIniValue(unsigned int num_rows, unsigned int num_cols, unsigned char initial_value)	{
-	int i, j;
 	ByteTwoDArray * ba = InitByteTwoDArraySizeEmpty(num_rows, num_cols);
 	if ( ba == NULL )	{
 		ERR_ERROR_CONTINUE("Unable to initbalize array elements to initbal value. \n", ERR_WARNING);	
 		return ba;
 		}
-	for (i = 0; i < num_rows; i++)	{
-		for (j = 0; j < num_cols; j++)	{	
-			ba->array[i][j] = initial_value;
-			}
-		}
+	memset(ba->data, initial_value, (size_t) num_rows * num_cols);
 	return ba;
 	}
 
+/*
+ * Visibility:
+ * global
+ *
+ * Description:
+ * Allocate a TwoDArray object of user specified dimensions whose elements are stored in
+ * a buffer supplied by the caller, such as a memory mapped file.  Elements are not copied,
+ * the buffer must hold num_rows * num_cols elements in row-major order and must remain
+ * valid until the TwoDArray is freed.  Freeing the TwoDArray does not free the buffer.
+ *
+ * Arguments:
+ * num_rows- number of rows in new TwoDArray
+ * num_cols- number of columns in new TwoDArray
+ * buffer- elements of the new TwoDArray
+ *
+ * Returns:
+ * pointer to TwoDArray object or NULL if memory not able to be allocated
+ */
+ByteTwoDArray * InitByteTwoDArraySizeBuffer(unsigned int num_rows, unsigned int num_cols, unsigned char * buffer)	{
+	ByteTwoDArray * da = NULL;
+	int i;
+	
+	if ( num_rows < 1 || num_cols < 1 || buffer == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to initialize array, row and col sizes must be at least 1. \n", ERR_EINVAL);
+		return da;
+		}
+	if ( (da = (ByteTwoDArray *) malloc(sizeof(ByteTwoDArray))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to initialize array, memory allocation failed. \n", ERR_ENOMEM);
+		return da;
+		}
+	/* only the row ptrs are allocated, so freeing them leaves the buffer untouched */
+	if ( (da->array = (unsigned char **) malloc(sizeof(unsigned char *) * num_rows)) == NULL ) {
+		ERR_ERROR_CONTINUE("Unable to initialize array, memory allocation failed. \n", ERR_ENOMEM);
+		free(da);
+		da = NULL;
+		return da;
+		}
+	da->data = buffer;
+	for(i = 0; i < num_rows; i++)	{
+		da->array[i] = da->data + (size_t) i * num_cols;
+		}
+	da->size_rows = num_rows;
+	da->size_cols = num_cols;
+			
+	return da;
+	}
+
 /*
  * Visibility:
  * global
@@ -112,6 +148,30 @@ unsigned char ** GetUnderlyingByteTwoDArray(ByteTwoDArray * arr)	{
 	return arr->array;
 	}
 
+/*
+ * Visibility:
+ * global
+ *
+ * Description:
+ * Retrieves the elements of the TwoDArray object as a single contiguous block.
+ * Element row,col is found at offset row * size_col + col, so bulk operations may
+ * traverse the whole array with a single index.  The block is aligned to BYTETWODARRAY_ALIGN bytes.
+ * The ptr returned is the actual underlying storage, changes made will be permanent.
+ *
+ * Arguments:
+ * arr- the TwoDArray object
+ *
+ * Returns:
+ * ptr to first element of underlying array
+ */
+unsigned char * GetFlatByteTwoDArray(ByteTwoDArray * arr)	{
+	if ( arr == NULL || arr->data == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to retrieve underlying array. \n", ERR_EINVAL);
+		return NULL;
+		}
+	return arr->data;
+	}
+
 /*
  * Visibility:
  * global
@@ -228,15 +288,9 @@ int SetDataByteTwoDArray(ByteTwoDArray * arr, unsigned int row, unsigned int col
  * None
  */	 	
 void FreeByteTwoDArray(ByteTwoDArray * arr)	{
-	int i;
 	if ( arr != NULL )	{
 		if ( arr->array != NULL )	{
-			for ( i = 0; i < arr->size_rows; i++)	{
-				if ( arr->array[i] != NULL )	{
-					free(arr->array[i]);							/* free a row in the underlying array */
-					}
-				}
-			free(arr->array);										/* free the pointers to the rows */
+			free(arr->array);										/* free the row ptrs and elements */
 			}
 		free(arr);													/* free the TwoDArray structure */
 		}
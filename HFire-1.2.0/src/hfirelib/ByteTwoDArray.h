@@ -2,6 +2,7 @@
 #define ByteTwoDArray_H
 	
 #include <stdlib.h>
+#include <string.h>
 
 #include "Err.h"
 
@@ -10,6 +11,9 @@
  * DEFINES, ENUMS
  *********************************************************
  */
+
+/* alignment in bytes of the first element of the array */
+#define BYTETWODARRAY_ALIGN							(64)
  
 /*
  *********************************************************
@@ -23,7 +27,8 @@ typedef struct ByteTwoDArray_ ByteTwoDArray;
 struct ByteTwoDArray_	{
 	int size_rows;
 	int size_cols;
-	unsigned char ** array;
+	unsigned char ** array;					/* ptrs to the first element of each row */
+	unsigned char * data;					/* elements in row-major order, contiguous */
 	}; 
 
 /*
@@ -36,9 +41,11 @@ struct ByteTwoDArray_	{
 
 #define BYTETWODARRAY_SIZE_COL(arr)	 				((arr)->size_cols)
 
-#define BYTETWODARRAY_GET_DATA(arr, row, col)		((arr)->array[(row)][(col)])
+#define BYTETWODARRAY_GET_DATA(arr, row, col)		((arr)->data[(row) * (arr)->size_cols + (col)])
+
+#define BYTETWODARRAY_SET_DATA(arr, row, col, val)	((arr)->data[(row) * (arr)->size_cols + (col)] = (val))
 
-#define BYTETWODARRAY_SET_DATA(arr, row, col, data)	((arr)->array[(row)][(col)] = (data))
+#define BYTETWODARRAY_GET_FLAT(arr)					((arr)->data)
 
 /*
  *********************************************************
@@ -50,8 +57,12 @@ ByteTwoDArray * InitByteTwoDArraySizeEmpty(unsigned int num_rows, unsigned int n
 
 ByteTwoDArray * InitByteTwoDArraySizeIniValue(unsigned int num_rows, unsigned int num_cols, unsigned char initial_value);
 
+ByteTwoDArray * InitByteTwoDArraySizeBuffer(unsigned int num_rows, unsigned int num_cols, unsigned char * buffer);
+
 unsigned char ** GetUnderlyingByteTwoDArray(ByteTwoDArray * arr);
 
+unsigned char * GetFlatByteTwoDArray(ByteTwoDArray * arr);
+
 int GetSizeColByteTwoDArray(ByteTwoDArray * arr);
 
 int GetSizeRowByteTwoDArray(ByteTwoDArray * arr);
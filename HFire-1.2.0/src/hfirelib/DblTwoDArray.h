@@ -10,6 +10,9 @@
  * DEFINES, ENUMS
  *********************************************************
  */
+
+/* alignment in bytes of the first element of the array */
+#define DBLTWODARRAY_ALIGN							(64)
  
 /*
  *********************************************************
@@ -23,7 +26,8 @@ typedef struct DblTwoDArray_ DblTwoDArray;
 struct DblTwoDArray_	{
 	int size_rows;
 	int size_cols;
-	double ** array;
+	double ** array;					/* ptrs to the first element of each row */
+	double * data;					/* elements in row-major order, contiguous */
 	}; 
 
 /*
@@ -36,9 +40,11 @@ struct DblTwoDArray_	{
 
 #define DBLTWODARRAY_SIZE_COL(arr)	 				((arr)->size_cols)
 
-#define DBLTWODARRAY_GET_DATA(arr, row, col)		((arr)->array[(row)][(col)])
+#define DBLTWODARRAY_GET_DATA(arr, row, col)		((arr)->data[(row) * (arr)->size_cols + (col)])
+
+#define DBLTWODARRAY_SET_DATA(arr, row, col, val)	((arr)->data[(row) * (arr)->size_cols + (col)] = (val))
 
-#define DBLTWODARRAY_SET_DATA(arr, row, col, data)	((arr)->array[(row)][(col)] = (data))
+#define DBLTWODARRAY_GET_FLAT(arr)					((arr)->data)
 
 /*
  *********************************************************
@@ -50,8 +56,12 @@ DblTwoDArray * InitDblTwoDArraySizeEmpty(unsigned int num_rows, unsigned int num
 
 DblTwoDArray * InitDblTwoDArraySizeIniValue(unsigned int num_rows, unsigned int num_cols, double initial_value);
 
+DblTwoDArray * InitDblTwoDArraySizeBuffer(unsigned int num_rows, unsigned int num_cols, double * buffer);
+
 double ** GetUnderlyingDblTwoDArray(DblTwoDArray * arr);
 
+double * GetFlatDblTwoDArray(DblTwoDArray * arr);
+
 int GetSizeColDblTwoDArray(DblTwoDArray * arr);
 
 int GetSizeRowDblTwoDArray(DblTwoDArray * arr);
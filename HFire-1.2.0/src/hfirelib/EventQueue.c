@@ -0,0 +1,188 @@
+#include "EventQueue.h"
+
+/*
+ *********************************************************
+ * NON PUBLIC FUNCTIONS
+ *********************************************************
+ */
+
+static int EventIsBefore(const Event * a, const Event * b);
+
+/*
+ * Visibility:
+ * global
+ *
+ * Description:
+ * Initializes an empty EventQueue.
+ * Supports insertion and removal of the earliest event in O(log N) time.
+ *
+ * Arguments:
+ * NONE.
+ *
+ * Returns:
+ * Ptr to empty EventQueue, or NULL if unable to initialize.
+ */
+EventQueue * InitEventQueue(void)	{
+	EventQueue * eq = NULL;
+
+	if ( (eq = (EventQueue *) malloc(sizeof(EventQueue))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to allocate memory for EventQueue. \n", ERR_ENOMEM);
+		return eq;
+		}
+	eq->size = 0;
+	eq->cap = EVENT_QUEUE_INI_CAPACITY;
+	if ( (eq->ev = (Event *) malloc(sizeof(Event) * eq->cap)) == NULL )	{
+		free(eq);
+		ERR_ERROR_CONTINUE("Unable to allocate memory for EventQueue events. \n", ERR_ENOMEM);
+		return NULL;
+		}
+
+	return eq;
+	}
+
+/*
+ * Visibility:
+ * global
+ *
+ * Description:
+ * Inserts an event into the queue, growing storage as necessary.
+ *
+ * Arguments:
+ * eq- EventQueue
+ * time- time at which event occurs
+ * src- identifies the object scheduling the event
+ * dst- identifies the target of the event
+ *
+ * Returns:
+ * ERR_SUCCESS (0) if event inserted, otherwise an error code.
+ */
+int EventQueuePush(EventQueue * eq, double time, int src, int dst)	{
+	Event * nev = NULL;
+	Event e;
+	int c, p;
+
+	/* check args */
+	if ( eq == NULL )	{
+		ERR_ERROR("EventQueue not initialized. \n", ERR_EINVAL);
+		}
+
+	if ( eq->size == eq->cap )	{
+		if ( (nev = (Event *) realloc(eq->ev, sizeof(Event) * eq->cap * 2)) == NULL )	{
+			ERR_ERROR("Unable to allocate memory for EventQueue events. \n", ERR_ENOMEM);
+			}
+		eq->ev = nev;
+		eq->cap *= 2;
+		}
+
+	/* sift up from the new leaf */
+	e.time = time;
+	e.src = src;
+	e.dst = dst;
+	for(c = eq->size++; c > 0; c = p)	{
+		p = (c - 1) / 2;
+		if ( !EventIsBefore(&e, &eq->ev[p]) )	{
+			break;
+			}
+		eq->ev[c] = eq->ev[p];
+		}
+	eq->ev[c] = e;
+
+	return ERR_SUCCESS;
+	}
+
+/*
+ * Visibility:
+ * global
+ *
+ * Description:
+ * Removes the earliest event from the queue.
+ *
+ * Arguments:
+ * eq- EventQueue
+ * e- receives the earliest event
+ *
+ * Returns:
+ * ERR_SUCCESS (0) if event removed, otherwise an error code.
+ */
+int EventQueuePop(EventQueue * eq, Event * e)	{
+	Event last;
+	int c, p;
+
+	/* check args */
+	if ( eq == NULL || e == NULL )	{
+		ERR_ERROR("Arguments supplied to EventQueuePop invalid. \n", ERR_EINVAL);
+		}
+	if ( eq->size == 0 )	{
+		ERR_ERROR("Unable to remove event from empty EventQueue. \n", ERR_EFAILED);
+		}
+
+	*e = eq->ev[0];
+	last = eq->ev[--eq->size];
+
+	/* sift last leaf down from the root */
+	for(p = 0; (c = 2 * p + 1) < eq->size; p = c)	{
+		if ( c + 1 < eq->size && EventIsBefore(&eq->ev[c + 1], &eq->ev[c]) )	{
+			c++;
+			}
+		if ( !EventIsBefore(&eq->ev[c], &last) )	{
+			break;
+			}
+		eq->ev[p] = eq->ev[c];
+		}
+	eq->ev[p] = last;
+
+	return ERR_SUCCESS;
+	}
+
+/*
+ * Visibility:
+ * global
+ *
+ * Description:
+ * Frees memory associated with EventQueue.
+ *
+ * Arguments:
+ * vptr- ptr to EventQueue
+ *
+ * Returns:
+ * NONE.
+ */
+void FreeEventQueue(void * vptr)	{
+	EventQueue * eq = NULL;
+
+	if ( vptr != NULL )	{
+		eq = (EventQueue *) vptr;
+		if ( eq->ev != NULL )	{
+			free(eq->ev);
+			}
+		free(eq);
+		}
+	eq = NULL;
+	return;
+	}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Orders events by time, then by src, then by dst.
+ *
+ * Arguments:
+ * a- first event
+ * b- second event
+ *
+ * Returns:
+ * 1 if a occurs before b, otherwise 0.
+ */
+static int EventIsBefore(const Event * a, const Event * b)	{
+	if ( a->time != b->time )	{
+		return a->time < b->time;
+		}
+	if ( a->src != b->src )	{
+		return a->src < b->src;
+		}
+	return a->dst < b->dst;
+	}
+
+/* end of EventQueue.c */
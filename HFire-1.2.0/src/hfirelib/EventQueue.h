@@ -0,0 +1,70 @@
+#ifndef EventQueue_H
+#define EventQueue_H
+
+#include <stdlib.h>
+
+#include "Err.h"
+
+/*
+ *********************************************************
+ * DEFINES, ENUMS
+ *********************************************************
+ */
+
+/* number of events allocated when the queue is initialized */
+#define EVENT_QUEUE_INI_CAPACITY				(1024)
+
+/*
+ *********************************************************
+ * STRUCTS, TYPEDEFS
+ *********************************************************
+ */
+
+typedef struct Event_ Event;
+
+/* events are ordered by time, ties are broken by src and then by dst so the order is reproducible */
+struct Event_	{
+	double time;						/* time at which event occurs */
+	int src;							/* identifies the object scheduling the event */
+	int dst;							/* identifies the target of the event */
+	};
+
+typedef struct EventQueue_ EventQueue;
+
+/* binary min-heap of events */
+struct EventQueue_	{
+	int size;							/* number of events in queue */
+	int cap;							/* number of events allocated */
+	Event * ev;							/* heap ordered events */
+	};
+
+/*
+ *********************************************************
+ * MACROS
+ *********************************************************
+ */
+
+#define EVENT_QUEUE_SIZE(eq)					((eq)->size)
+
+#define EVENT_QUEUE_IS_EMPTY(eq)				((eq)->size == 0)
+
+/* earliest event, valid only if queue not empty */
+#define EVENT_QUEUE_PEEK(eq)					(&((eq)->ev[0]))
+
+#define EVENT_QUEUE_CLEAR(eq)					((eq)->size = 0)
+
+/*
+ *********************************************************
+ * PUBLIC FUNCTIONS
+ *********************************************************
+ */
+
+EventQueue * InitEventQueue(void);
+
+int EventQueuePush(EventQueue * eq, double time, int src, int dst);
+
+int EventQueuePop(EventQueue * eq, Event * e);
+
+void FreeEventQueue(void * vptr);
+
+#endif EventQueue_H		/* end of EventQueue.h */
@@ -161,6 +161,7 @@ char * GetValFromKeyStringFStreamIO(FILE * fstream, const char * keystr, const c
 	char * value 		= NULL;						/* returned value as string */
 	char * line 		= NULL;						/* line read from stream */
 	char * token 		= NULL;						/* tokenizer */
+	char * next			= NULL;						/* remainder of line after token */
 	const char * cmt 	= NULL;						/* ptr used to iterate over comment chars */
 	int has_comment = 0;
 		
@@ -181,9 +182,9 @@ char * GetValFromKeyStringFStreamIO(FILE * fstream, const char * keystr, const c
 			}		
 		/* non-comment line, test if key matches searched for key */
 		if ( has_comment == 0 )	{
-			if ( (token  = strtok(line, sepchr)) != NULL  && (strcmp(token, keystr)) == 0 )	{
+			if ( (token  = GetTokenFStreamIO(line, sepchr, &next)) != NULL  && (strcmp(token, keystr)) == 0 )	{
 				/* parse value associated with key, if no value function returns NULL */
-				if ( (token = strtok(NULL, sepchr)) != NULL )	{					
+				if ( (token = GetTokenFStreamIO(NULL, sepchr, &next)) != NULL )	{					
 					if ( (value = (char *) malloc(sizeof(char) * (strlen(token) + 1))) != NULL )	{
 						strcpy(value, token);
 						}
@@ -285,6 +286,7 @@ List * GetDblListFromLineFStreamIO(const char * str, const char * sepchr)		{
 	char * mlc_str			= NULL;				/* copy of string to be parsed */
 	double * dbl_data		= NULL;				/* individual double token inserted into List */
 	char * token 			= NULL;				/* ptr used to parse out tokens */	
+	char * next				= NULL;				/* remainder of string after token */
 
 	/* check args */
 	if ( str == NULL || sepchr == NULL)	{
@@ -302,7 +304,7 @@ List * GetDblListFromLineFStreamIO(const char * str, const char * sepchr)		{
 		return dbl_list;
 		}
 	strcpy(mlc_str, str);
-	token = strtok(mlc_str, sepchr);
+	token = GetTokenFStreamIO(mlc_str, sepchr, &next);
 	do	{
 		if ( token == NULL )	{
 			break;
@@ -314,7 +316,7 @@ List * GetDblListFromLineFStreamIO(const char * str, const char * sepchr)		{
 				ERR_ERROR_CONTINUE("Problem inserting double into list. \n", ERR_EBADFUNC);
 				}
 			}
-		token = strtok(NULL, sepchr);
+		token = GetTokenFStreamIO(NULL, sepchr, &next);
 	} while(1);	
 	free(mlc_str);
 	
@@ -346,6 +348,7 @@ List * GetIntListFromLineFStreamIO(const char * str, const char * sepchr)		{
 	char * mlc_str			= NULL;				/* copy of string to be parsed */
 	int * int_data			= NULL;				/* individual int token inserted into List */
 	char * token 			= NULL;				/* ptr used to parse out tokens */
+	char * next				= NULL;				/* remainder of string after token */
 
 	/* check args */
 	if ( str == NULL || sepchr == NULL)	{
@@ -363,7 +366,7 @@ List * GetIntListFromLineFStreamIO(const char * str, const char * sepchr)		{
 		return int_list;
 		}
 	strcpy(mlc_str, str);
-	token = strtok(mlc_str, sepchr);
+	token = GetTokenFStreamIO(mlc_str, sepchr, &next);
 	do	{
 		if ( token == NULL )	{
 			break;
@@ -375,7 +378,7 @@ List * GetIntListFromLineFStreamIO(const char * str, const char * sepchr)		{
 				ERR_ERROR_CONTINUE("Problem inserting int into List. \n", ERR_EBADFUNC);
 				}
 			}
-		token = strtok(NULL, sepchr);
+		token = GetTokenFStreamIO(NULL, sepchr, &next);
 	} while(1);	
 	free(mlc_str);
 	
@@ -407,6 +410,7 @@ List * GetStrListFromLineFStreamIO(const char * str, const char * sepchr)	{
 	char * mlc_str			= NULL;				/* copy of string to be parsed */
 	char * str_data			= NULL;				/* individual string token inserted into List */
 	char * token 			= NULL;				/* ptr used to parse out tokens */
+	char * next				= NULL;				/* remainder of string after token */
 
 	/* check args */
 	if ( str == NULL || sepchr == NULL)	{
@@ -424,7 +428,7 @@ List * GetStrListFromLineFStreamIO(const char * str, const char * sepchr)	{
 		return str_list;
 		}
 	strcpy(mlc_str, str);
-	token = strtok(mlc_str, sepchr);
+	token = GetTokenFStreamIO(mlc_str, sepchr, &next);
 	do	{
 		if ( token == NULL )	{
 			break;
@@ -436,7 +440,7 @@ List * GetStrListFromLineFStreamIO(const char * str, const char * sepchr)	{
 				ERR_ERROR_CONTINUE("Problem inserting string into List. \n", ERR_EBADFUNC);
 				}
 			}
-		token = strtok(NULL, sepchr);
+		token = GetTokenFStreamIO(NULL, sepchr, &next);
 	} while(1);	
 	free(mlc_str);
 	
@@ -680,5 +684,43 @@ StrTwoDArray * GetStrTwoDArrayTableFStreamIO(FILE * fstream, const char * sepchr
 
 	return tbl;
 	}
+
+/*
+ * Visibility:
+ * global
+ *
+ * Description:
+ * Tokenizes a string as strtok does, but keeps its position in next rather than in static
+ * storage, so strings may be parsed by several threads at once.
+ *
+ * Arguments:
+ * str- string to tokenize on the first call, NULL to continue with next
+ * sepchr- array of characters to use as delimiters
+ * next- position in string after the token returned
+ *
+ * Returns:
+ * Ptr to '\0' terminated token, or NULL if no tokens remain.
+ */
+char * GetTokenFStreamIO(char * str, const char * sepchr, char ** next)	{
+	char * token = ( str != NULL ) ? str : *next;
+
+	if ( token == NULL )	{
+		return NULL;
+		}
+	token += strspn(token, sepchr);
+	if ( *token == '\0' )	{
+		*next = NULL;
+		return NULL;
+		}
+	*next = token + strcspn(token, sepchr);
+	if ( **next != '\0' )	{
+		*(*next)++ = '\0';
+		}
+	else	{
+		*next = NULL;
+		}
+
+	return token;
+	}
 		
 /* end of FStreamIO.c */
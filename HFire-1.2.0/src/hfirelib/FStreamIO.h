@@ -59,4 +59,6 @@ DblTwoDArray * GetDblTwoDArrayTableFStreamIO(FILE * fstream, const char * sepchr
 
 StrTwoDArray * GetStrTwoDArrayTableFStreamIO(FILE * fstream, const char * sepchr, const char * cmtchr);
 
+char * GetTokenFStreamIO(char * str, const char * sepchr, char ** next);
+
 #endif FStreamIO_H		/* end of FStreamIO.h */
@@ -16,6 +16,8 @@
  */
 FltTwoDArray * InitFltTwoDArraySizeEmpty(unsigned int num_rows, unsigned int num_cols)	{
 	FltTwoDArray * da = NULL;
+	char * block = NULL;
+	size_t hdr;
 	int i;
 	
 	if ( num_rows < 1 || num_cols < 1 )	{
@@ -26,26 +28,18 @@ FltTwoDArray * InitFltTwoDArraySizeEmpty(unsigned int num_rows, unsigned int num
 		ERR_ERROR_CONTINUE("Unable to initialize array, memory allocation failed. \n", ERR_ENOMEM);
 		return da;
 		}
-	if ( (da->array = (float **) malloc(sizeof(float *) * num_rows)) == NULL ) {
+	/* row ptrs and elements share a single block, elements begin on an aligned boundary */
+	hdr = sizeof(float *) * num_rows + FLTTWODARRAY_ALIGN - 1;
+	if ( (block = (char *) malloc(hdr + sizeof(float) * (size_t) num_rows * num_cols)) == NULL ) {
 		ERR_ERROR_CONTINUE("Unable to initialize array, memory allocation failed. \n", ERR_ENOMEM);
 		free(da);
 		da = NULL;
 		return da;
 		}
+	da->array = (float **) block;
+	da->data = (float *) (block + hdr - ((size_t) (block + hdr) % FLTTWODARRAY_ALIGN));
 	for(i = 0; i < num_rows; i++)	{
-		if ( (da->array[i] = (float *) malloc(sizeof(float) * num_cols)) == NULL )	{
-			ERR_ERROR_CONTINUE("Unable to initialize array, memory allocation failed. \n", ERR_ENOMEM);
-			/* unwind and deallocate any rows that have been allocated to this point */
-			num_rows = i;
-			for ( i = 0; i < num_rows; i++)	{
-				free(da->array[i]);
-				da->array[i] = NULL;
-				}
-			free(da->array);
-			free(da);
-			da = NULL;
-			return da;			
-			}
+		da->array[i] = da->data + (size_t) i * num_cols;
 		}
 	da->size_rows = num_rows;
 	da->size_cols = num_cols;
@@ -71,17 +65,62 @@ FltTwoDArray * InitFltTwoDArraySizeEmpty(unsigned int num_rows, unsigned int num
  * NULL if memory not able to be allocated
  */
 FltTwoDArray * InitFltTwoDArraySizeIniValue(unsigned int num_rows, unsigned int num_cols, float initial_value)	{
-	int i, j;
+	int i;
 	FltTwoDArray * da = InitFltTwoDArraySizeEmpty(num_rows, num_cols);
 	if ( da == NULL )	{
 		ERR_ERROR_CONTINUE("Unable to initialize array elements to initial value. \n", ERR_WARNING);	
 		return da;
 		}
-	for (i = 0; i < num_rows; i++)	{
-		for (j = 0; j < num_cols; j++)	{	
-			da->array[i][j] = initial_value;
-			}
+	for (i = 0; i < num_rows * num_cols; i++)	{
+		da->data[i] = initial_value;
+		}
+	return da;
+	}
+
+/*
+ * Visibility:
+ * global
+ *
+ * Description:
+ * Allocate a TwoDArray object of user specified dimensions whose elements are stored in
+ * a buffer supplied by the caller, such as a memory mapped file.  Elements are not copied,
+ * the buffer must hold num_rows * num_cols elements in row-major order and must remain
+ * valid until the TwoDArray is freed.  Freeing the TwoDArray does not free the buffer.
+ *
+ * Arguments:
+ * num_rows- number of rows in new TwoDArray
+ * num_cols- number of columns in new TwoDArray
+ * buffer- elements of the new TwoDArray
+ *
+ * Returns:
+ * pointer to TwoDArray object or NULL if memory not able to be allocated
+ */
+FltTwoDArray * InitFltTwoDArraySizeBuffer(unsigned int num_rows, unsigned int num_cols, float * buffer)	{
+	FltTwoDArray * da = NULL;
+	int i;
+	
+	if ( num_rows < 1 || num_cols < 1 || buffer == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to initialize array, row and col sizes must be at least 1. \n", ERR_EINVAL);
+		return da;
+		}
+	if ( (da = (FltTwoDArray *) malloc(sizeof(FltTwoDArray))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to initialize array, memory allocation failed. \n", ERR_ENOMEM);
+		return da;
+		}
+	/* only the row ptrs are allocated, so freeing them leaves the buffer untouched */
+	if ( (da->array = (float **) malloc(sizeof(float *) * num_rows)) == NULL ) {
+		ERR_ERROR_CONTINUE("Unable to initialize array, memory allocation failed. \n", ERR_ENOMEM);
+		free(da);
+		da = NULL;
+		return da;
 		}
+	da->data = buffer;
+	for(i = 0; i < num_rows; i++)	{
+		da->array[i] = da->data + (size_t) i * num_cols;
+		}
+	da->size_rows = num_rows;
+	da->size_cols = num_cols;
+			
 	return da;
 	}
 
@@ -112,6 +151,30 @@ float ** GetUnderlyingFltTwoDArray(FltTwoDArray * arr)	{
 	return arr->array;
 	}
 
+/*
+ * Visibility:
+ * global
+ *
+ * Description:
+ * Retrieves the elements of the TwoDArray object as a single contiguous block.
+ * Element row,col is found at offset row * size_col + col, so bulk operations may
+ * traverse the whole array with a single index.  The block is aligned to FLTTWODARRAY_ALIGN bytes.
+ * The ptr returned is the actual underlying storage, changes made will be permanent.
+ *
+ * Arguments:
+ * arr- the TwoDArray object
+ *
+ * Returns:
+ * ptr to first element of underlying array
+ */
+float * GetFlatFltTwoDArray(FltTwoDArray * arr)	{
+	if ( arr == NULL || arr->data == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to retrieve underlying array. \n", ERR_EINVAL);
+		return NULL;
+		}
+	return arr->data;
+	}
+
 /*
  * Visibility:
  * global
@@ -228,15 +291,9 @@ int SetDataFltTwoDArray(FltTwoDArray * arr, unsigned int row, unsigned int col,
  * None
  */	 	
 void FreeFltTwoDArray(FltTwoDArray * arr)	{
-	int i;
 	if ( arr != NULL )	{
 		if ( arr->array != NULL )	{
-			for ( i = 0; i < arr->size_rows; i++)	{
-				if ( arr->array[i] != NULL )	{
-					free(arr->array[i]);							/* free a row in the underlying array */
-					}
-				}
-			free(arr->array);										/* free the pointers to the rows */
+			free(arr->array);										/* free the row ptrs, and elements unless supplied as a buffer */
 			}
 		free(arr);													/* free the TwoDArray structure */
 		}
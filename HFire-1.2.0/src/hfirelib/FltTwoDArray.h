@@ -10,6 +10,9 @@
  * DEFINES, ENUMS
  *********************************************************
  */
+
+/* alignment in bytes of the first element of the array */
+#define FLTTWODARRAY_ALIGN							(64)
  
 /*
  *********************************************************
@@ -23,7 +26,8 @@ typedef struct FltTwoDArray_ FltTwoDArray;
 struct FltTwoDArray_	{
 	int size_rows;
 	int size_cols;
-	float ** array;
+	float ** array;					/* ptrs to the first element of each row */
+	float * data;					/* elements in row-major order, contiguous */
 	}; 
 
 /*
@@ -36,9 +40,11 @@ struct FltTwoDArray_	{
 
 #define FLTTWODARRAY_SIZE_COL(arr)	 				((arr)->size_cols)
 
-#define FLTTWODARRAY_GET_DATA(arr, row, col)		((arr)->array[(row)][(col)])
+#define FLTTWODARRAY_GET_DATA(arr, row, col)		((arr)->data[(row) * (arr)->size_cols + (col)])
+
+#define FLTTWODARRAY_SET_DATA(arr, row, col, val)	((arr)->data[(row) * (arr)->size_cols + (col)] = (val))
 
-#define FLTTWODARRAY_SET_DATA(arr, row, col, data)	((arr)->array[(row)][(col)] = (data))
+#define FLTTWODARRAY_GET_FLAT(arr)					((arr)->data)
 
 /*
  *********************************************************
@@ -50,8 +56,12 @@ FltTwoDArray * InitFltTwoDArraySizeEmpty(unsigned int num_rows, unsigned int num
 
 FltTwoDArray * InitFltTwoDArraySizeIniValue(unsigned int num_rows, unsigned int num_cols, float initial_value);
 
+FltTwoDArray * InitFltTwoDArraySizeBuffer(unsigned int num_rows, unsigned int num_cols, float * buffer);
+
 float ** GetUnderlyingFltTwoDArray(FltTwoDArray * arr);
 
+float * GetFlatFltTwoDArray(FltTwoDArray * arr);
+
 int GetSizeColFltTwoDArray(FltTwoDArray * arr);
 
 int GetSizeRowFltTwoDArray(FltTwoDArray * arr);
@@ -1,5 +1,33 @@
 #include "GridData.h"
 
+static float * MapBinaryRasterGridData(GridFileInfo * gfinfo, GridHeaderInfo * ghdr);
+static void SwapFloatGridData(float * buff, size_t n);
+
+/* buffered reader of the values in an ascii grid */
+typedef struct AsciiGridReader_ AsciiGridReader;
+struct AsciiGridReader_	{
+	FILE * fstream;					/* main file positioned after header */
+	char * buf;						/* bytes read from main file */
+	size_t len;						/* number of bytes in buf */
+	size_t pos;						/* offset in buf of next unread byte */
+	int is_eof;						/* 1 if no more bytes remain in main file */
+	double * vals;					/* values of the most recently read row */
+	int ncols;						/* number of values in a row */
+	};
+
+static AsciiGridReader * InitAsciiGridReader(GridFileInfo * gfinfo, GridHeaderInfo * ghdr);
+static int ReadRowAsciiGridReader(AsciiGridReader * rdr);
+static void FillAsciiGridReader(AsciiGridReader * rdr, size_t keep);
+static int ParseDoubleAsciiGridReader(const char * tok, size_t n, double * val);
+
+static void FreeAsciiGridReader(AsciiGridReader * rdr);
+
+static int GetElemSizeGridData(EnumGridType grid_type);
+static int GetFileStampGridData(char * fname, long int * fsize, long int * mtime);
+static void ConvertFloatGridData(const float * src, char * dst, EnumGridType grid_type, size_t n);
+static int ExportBinaryRasterAsGridTiles(char * main_fname, char * header_fname, EnumGridType grid_type,
+											char * tiles_fname, long int src_sz, long int src_mtime);
+
 /* INITIALIZATION */
 GridData * InitGridDataFromBinaryRaster(char * main_fname, char * header_fname, EnumGridType grid_type)	{
 	GridData * gd = NULL;
@@ -15,6 +43,7 @@ GridData * InitGridDataFromBinaryRaster(char * main_fname, char * header_fname,
 		ERR_ERROR_CONTINUE("Unable to initialize GridData, memory allocation failed. \n", ERR_ENOMEM);
 		return gd;
 		}		
+	gd->tiles = NULL;
 	if ( (gd->gfinfo = (GridFileInfo *) malloc(sizeof(GridFileInfo))) == NULL )	{
 		ERR_ERROR_CONTINUE("Unable to initialize GridFileInfo, memory allocation failed. \n", ERR_ENOMEM);
 		free(gd);
@@ -24,6 +53,8 @@ GridData * InitGridDataFromBinaryRaster(char * main_fname, char * header_fname,
 		
 	/* STEP 2: store main_file and header file info */
 	gd->gfinfo->gfmt = EnumBinaryGrid;
+	gd->gfinfo->map = NULL;
+	gd->gfinfo->map_sz = 0;
 	if( (gd->gfinfo->main_file = (char *) malloc(sizeof(char) * (strlen(main_fname) + 1))) != NULL
 		&& (gd->gfinfo->header_file = (char *) malloc(sizeof(char) * (strlen(header_fname) + 1))) != NULL )	{
 		strcpy(gd->gfinfo->main_file, main_fname);
@@ -127,6 +158,7 @@ GridData * InitGridDataFromAsciiRaster(char * main_fname, EnumGridType grid_type
 		ERR_ERROR_CONTINUE("Unable to initialize GridData, memory allocation failed. \n", ERR_ENOMEM);
 		return gd;
 		}		
+	gd->tiles = NULL;
 	if ( (gd->gfinfo = (GridFileInfo *) malloc(sizeof(GridFileInfo))) == NULL )	{
 		ERR_ERROR_CONTINUE("Unable to initialize GridFileInfo, memory allocation failed. \n", ERR_ENOMEM);
 		free(gd);
@@ -136,6 +168,8 @@ GridData * InitGridDataFromAsciiRaster(char * main_fname, EnumGridType grid_type
 		
 	/* STEP 2: store main_file info */
 	gd->gfinfo->gfmt = EnumAsciiGrid;
+	gd->gfinfo->map = NULL;
+	gd->gfinfo->map_sz = 0;
 	if( (gd->gfinfo->main_file = (char *) malloc(sizeof(char) * (strlen(main_fname) + 1))) != NULL )	{
 		strcpy(gd->gfinfo->main_file, main_fname);
 		}
@@ -223,6 +257,97 @@ GridData * InitGridDataFromAsciiRaster(char * main_fname, EnumGridType grid_type
 	return gd;
 	}
 	
+GridData * InitGridDataFromBinaryRasterTiles(char * main_fname, char * header_fname, EnumGridType grid_type, int cache_mb)	{
+	GridTilesHeader thdr;
+	GridData * gd 		= NULL;
+	char * tiles_fname 	= NULL;
+	long int src_sz 	= 0;
+	long int src_mtime 	= 0;
+
+	/* check args */	
+	if ( main_fname == NULL || header_fname == NULL || GetElemSizeGridData(grid_type) == 0 )	{
+		ERR_ERROR_CONTINUE("Must supply a main and header filename and data type to initialize tiled GridData. \n", ERR_EINVAL);
+		return gd;
+		}
+	if ( GetFileStampGridData(main_fname, &src_sz, &src_mtime) )	{
+		ERR_ERROR_CONTINUE("Unable to open binary raster to initialize tiled GridData. \n", ERR_EIOFAIL);
+		return gd;
+		}
+	if ( (tiles_fname = (char *) malloc(sizeof(char) * (strlen(main_fname) + strlen(GRID_TILES_EXTENSION) + 1))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to initialize grid file names, memory allocation failed. \n", ERR_ENOMEM);
+		return gd;
+		}
+	sprintf(tiles_fname, "%s%s", main_fname, GRID_TILES_EXTENSION);
+
+	/* STEP 1: tiled file is rebuilt when missing or created from a different raster */
+	if ( ReadHeaderGridTiles(tiles_fname, &thdr) || thdr.gtype != grid_type 
+			|| thdr.src_sz != src_sz || thdr.src_mtime != src_mtime )	{
+		if ( ExportBinaryRasterAsGridTiles(main_fname, header_fname, grid_type, tiles_fname, src_sz, src_mtime) )	{
+			ERR_ERROR_CONTINUE("Unable to create tiled grid file from binary raster. \n", ERR_EIOFAIL);
+			free(tiles_fname);
+			return gd;
+			}
+		}
+
+	/* STEP 2: initialize GridData with tiles in place of an array */
+	if ( (gd = (GridData *) malloc(sizeof(GridData))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to initialize GridData, memory allocation failed. \n", ERR_ENOMEM);
+		free(tiles_fname);
+		return gd;
+		}		
+	gd->gtype = grid_type;
+	gd->arr = NULL;
+	gd->gfinfo = NULL;
+	gd->ghdr = NULL;
+	if ( (gd->tiles = InitGridTilesFromFile(tiles_fname, cache_mb, &thdr)) == NULL
+			|| (gd->ghdr = InitGridHeaderInfoFromArgs(thdr.nrows, thdr.ncols, thdr.xllcorner, thdr.yllcorner,
+											thdr.cellsize, thdr.NODATA_value, IsHostMsbFirstGridData())) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to initialize tiled GridData. \n", ERR_EFAILED);
+		FreeGridData(gd);
+		gd = NULL;
+		}
+	free(tiles_fname);
+	
+	return gd;
+	}
+
+int InitGridDataView(GridData * gd, GridDataView * view)	{
+	/* check args */
+	if ( gd == NULL || gd->ghdr == NULL || view == NULL )	{
+		ERR_ERROR("Unable to initialize GridDataView, GridData not initialized. \n", ERR_EINVAL);
+		}
+
+	view->gtype = gd->gtype;
+	view->nrows = gd->ghdr->nrows;
+	view->ncols = gd->ghdr->ncols;
+	view->cells = NULL;
+	view->gd = gd;
+	/* tiled cells are retrieved through the GridData */
+	if ( gd->tiles == NULL && gd->arr != NULL )	{
+		switch(gd->gtype)	{
+			case EnumByteGrid:
+				view->cells = BYTETWODARRAY_GET_FLAT(gd->arr->ba);
+				break;
+			case EnumIntGrid:
+				view->cells = INTTWODARRAY_GET_FLAT(gd->arr->ia);
+				break;
+			case EnumLIntGrid:
+				view->cells = LINTTWODARRAY_GET_FLAT(gd->arr->lia);
+				break;
+			case EnumFltGrid:
+				view->cells = FLTTWODARRAY_GET_FLAT(gd->arr->fa);
+				break;
+			case EnumDblGrid:
+				view->cells = DBLTWODARRAY_GET_FLAT(gd->arr->da);
+				break;
+			default:
+				ERR_ERROR("Data type for GridDataView not recognized. \n", ERR_EINVAL);
+			}
+		}
+
+	return ERR_SUCCESS;
+	}
+	
 GridData * InitGridDataFromDblTwoDArray(DblTwoDArray * arr, double xll, double yll, int cellsz, int nodata)	{
 	GridData * gd			= NULL;
 	int r, c, ismsb = 0;
@@ -239,6 +364,7 @@ GridData * InitGridDataFromDblTwoDArray(DblTwoDArray * arr, double xll, double y
 		return gd;
 		}
 	gd->gfinfo = NULL;
+	gd->tiles = NULL;
 	if ( (gd->arr = (GridArray *) malloc(sizeof(GridArray))) == NULL )	{
 		ERR_ERROR_CONTINUE("Unable to allocate memory for GridArray. \n", ERR_ENOMEM);
 		free(gd);
@@ -246,12 +372,7 @@ GridData * InitGridDataFromDblTwoDArray(DblTwoDArray * arr, double xll, double y
 		return gd;
 		}
 	/* platform dependent byte-ordering */
-	#ifdef USING_UNIX
-	ismsb = 1;
-	#endif
-	#ifdef USING_PC
-	ismsb = 0;
-	#endif
+	ismsb = IsHostMsbFirstGridData();
 	if ( (gd->ghdr = InitGridHeaderInfoFromArgs(DBLTWODARRAY_SIZE_ROW(arr), DBLTWODARRAY_SIZE_COL(arr), 
 												xll, yll, cellsz, nodata, ismsb)) == NULL )	{
 		ERR_ERROR_CONTINUE("Unable to allocate memory for GridData. \n", ERR_ENOMEM);
@@ -296,6 +417,7 @@ GridData * InitGridDataFromFltTwoDArray(FltTwoDArray * arr, double xll, double y
 		return gd;
 		}
 	gd->gfinfo = NULL;
+	gd->tiles = NULL;
 	if ( (gd->arr = (GridArray *) malloc(sizeof(GridArray))) == NULL )	{
 		ERR_ERROR_CONTINUE("Unable to allocate memory for GridArray. \n", ERR_ENOMEM);
 		free(gd);
@@ -303,12 +425,7 @@ GridData * InitGridDataFromFltTwoDArray(FltTwoDArray * arr, double xll, double y
 		return gd;
 		}
 	/* platform dependent byte-ordering */
-	#ifdef USING_UNIX
-	ismsb = 1;
-	#endif
-	#ifdef USING_PC
-	ismsb = 0;
-	#endif
+	ismsb = IsHostMsbFirstGridData();
 	if ( (gd->ghdr = InitGridHeaderInfoFromArgs(FLTTWODARRAY_SIZE_ROW(arr), FLTTWODARRAY_SIZE_COL(arr), 
 												xll, yll, cellsz, nodata, ismsb)) == NULL )	{
 		ERR_ERROR_CONTINUE("Unable to allocate memory for GridData. \n", ERR_ENOMEM);
@@ -353,6 +470,7 @@ GridData * InitGridDataFromLIntTwoDArray(LIntTwoDArray * arr, double xll, double
 		return gd;
 		}
 	gd->gfinfo = NULL;
+	gd->tiles = NULL;
 	if ( (gd->arr = (GridArray *) malloc(sizeof(GridArray))) == NULL )	{
 		ERR_ERROR_CONTINUE("Unable to allocate memory for GridArray. \n", ERR_ENOMEM);
 		free(gd);
@@ -360,12 +478,7 @@ GridData * InitGridDataFromLIntTwoDArray(LIntTwoDArray * arr, double xll, double
 		return gd;
 		}
 	/* platform dependent byte-ordering */
-	#ifdef USING_UNIX
-	ismsb = 1;
-	#endif
-	#ifdef USING_PC
-	ismsb = 0;
-	#endif
+	ismsb = IsHostMsbFirstGridData();
 	if ( (gd->ghdr = InitGridHeaderInfoFromArgs(LINTTWODARRAY_SIZE_ROW(arr), LINTTWODARRAY_SIZE_COL(arr), 
 												xll, yll, cellsz, nodata, ismsb)) == NULL )	{
 		ERR_ERROR_CONTINUE("Unable to allocate memory for GridData. \n", ERR_ENOMEM);
@@ -410,6 +523,7 @@ GridData * InitGridDataFromIntTwoDArray(IntTwoDArray * arr, double xll, double y
 		return gd;
 		}
 	gd->gfinfo = NULL;
+	gd->tiles = NULL;
 	if ( (gd->arr = (GridArray *) malloc(sizeof(GridArray))) == NULL )	{
 		ERR_ERROR_CONTINUE("Unable to allocate memory for GridArray. \n", ERR_ENOMEM);
 		free(gd);
@@ -417,12 +531,7 @@ GridData * InitGridDataFromIntTwoDArray(IntTwoDArray * arr, double xll, double y
 		return gd;
 		}
 	/* platform dependent byte-ordering */
-	#ifdef USING_UNIX
-	ismsb = 1;
-	#endif
-	#ifdef USING_PC
-	ismsb = 0;
-	#endif
+	ismsb = IsHostMsbFirstGridData();
 	if ( (gd->ghdr = InitGridHeaderInfoFromArgs(INTTWODARRAY_SIZE_ROW(arr), INTTWODARRAY_SIZE_COL(arr), 
 												xll, yll, cellsz, nodata, ismsb)) == NULL )	{
 		ERR_ERROR_CONTINUE("Unable to allocate memory for GridData. \n", ERR_ENOMEM);
@@ -467,6 +576,7 @@ GridData * InitGridDataFromByteTwoDArray(ByteTwoDArray * arr, double xll, double
 		return gd;
 		}
 	gd->gfinfo = NULL;
+	gd->tiles = NULL;
 	if ( (gd->arr = (GridArray *) malloc(sizeof(GridArray))) == NULL )	{
 		ERR_ERROR_CONTINUE("Unable to allocate memory for GridArray. \n", ERR_ENOMEM);
 		free(gd);
@@ -474,12 +584,7 @@ GridData * InitGridDataFromByteTwoDArray(ByteTwoDArray * arr, double xll, double
 		return gd;
 		}
 	/* platform dependent byte-ordering */
-	#ifdef USING_UNIX
-	ismsb = 1;
-	#endif
-	#ifdef USING_PC
-	ismsb = 0;
-	#endif
+	ismsb = IsHostMsbFirstGridData();
 	if ( (gd->ghdr = InitGridHeaderInfoFromArgs(BYTETWODARRAY_SIZE_ROW(arr), BYTETWODARRAY_SIZE_COL(arr), 
 												xll, yll, cellsz, nodata, ismsb)) == NULL )	{
 		ERR_ERROR_CONTINUE("Unable to allocate memory for GridData. \n", ERR_ENOMEM);
@@ -513,6 +618,7 @@ GridHeaderInfo * InitGridHeaderInfoFromFile(GridFileInfo * gfinfo)	{
 	FILE * fstream 			= NULL;
 	char * token 			= NULL;
 	char * line 			= NULL;
+	char * cursor			= NULL;
 	int last_line_header 	= 0;
 	fpos_t last_file_pos;
 
@@ -525,6 +631,8 @@ GridHeaderInfo * InitGridHeaderInfoFromFile(GridFileInfo * gfinfo)	{
 		ERR_ERROR_CONTINUE("Memory not allocated for GridHeaderInfo. \n", ERR_ENOMEM);
 		return ghdr;
 		}
+	/* data written in byte order of host unless header states otherwise */
+	ghdr->is_msbfirst = IsHostMsbFirstGridData();
 	
 	/* open header based upon data format */
 	if ( gfinfo->gfmt == EnumAsciiGrid )	{
@@ -544,7 +652,7 @@ GridHeaderInfo * InitGridHeaderInfoFromFile(GridFileInfo * gfinfo)	{
 	while( last_line_header != 1 )	{
 		fgetpos(fstream, &last_file_pos);
 		line = GetLineFStreamIO(fstream);
-		if ( line != NULL && (token = strtok(line, GRIDDATA_HEADER_SEP_CHARS)) != NULL )	{
+		if ( line != NULL && (token = GetTokenFStreamIO(line, GRIDDATA_HEADER_SEP_CHARS, &cursor)) != NULL )	{
 			if ( token != NULL && isalpha(token[0]) == 0 )	{
 				/* 	first line of data */
 				last_line_header = 1;
@@ -553,37 +661,37 @@ GridHeaderInfo * InitGridHeaderInfoFromFile(GridFileInfo * gfinfo)	{
 				}
 			/* process keyword token */
 			else if ( strcmp(token, GRIDDATA_KEYWORD_NCOLS) == 0)	{
-				if ( (token = strtok(NULL, GRIDDATA_HEADER_SEP_CHARS)) != NULL )	{
+				if ( (token = GetTokenFStreamIO(NULL, GRIDDATA_HEADER_SEP_CHARS, &cursor)) != NULL )	{
 					ghdr->ncols = atoi(token);
 					}
 				}
 			else if ( strcmp(token, GRIDDATA_KEYWORD_NROWS) == 0)	{			
-				if ( (token = strtok(NULL, GRIDDATA_HEADER_SEP_CHARS)) != NULL )	{
+				if ( (token = GetTokenFStreamIO(NULL, GRIDDATA_HEADER_SEP_CHARS, &cursor)) != NULL )	{
 					ghdr->nrows = atoi(token);
 					}			
 				}
 			else if (strcmp(token, GRIDDATA_KEYWORD_XLLCORNER) == 0)	{
-				if ( (token = strtok(NULL, GRIDDATA_HEADER_SEP_CHARS)) != NULL )	{
+				if ( (token = GetTokenFStreamIO(NULL, GRIDDATA_HEADER_SEP_CHARS, &cursor)) != NULL )	{
 					ghdr->xllcorner = atof(token);
 					}				
 				}
 			else if (strcmp(token, GRIDDATA_KEYWORD_YLLCORNER) == 0)	{			
-				if ( (token = strtok(NULL, GRIDDATA_HEADER_SEP_CHARS)) != NULL )	{
+				if ( (token = GetTokenFStreamIO(NULL, GRIDDATA_HEADER_SEP_CHARS, &cursor)) != NULL )	{
 					ghdr->yllcorner = atof(token);
 					}
 				}
 			else if (strcmp(token, GRIDDATA_KEYWORD_CELLSIZE) == 0)	{			
-				if ( (token = strtok(NULL, GRIDDATA_HEADER_SEP_CHARS)) != NULL )	{
+				if ( (token = GetTokenFStreamIO(NULL, GRIDDATA_HEADER_SEP_CHARS, &cursor)) != NULL )	{
 					ghdr->cellsize = atoi(token);
 					}			
 				}
 			else if (strcmp(token, GRIDDATA_KEYWORD_NODATA_value) == 0)	{
-				if ( (token = strtok(NULL, GRIDDATA_HEADER_SEP_CHARS)) != NULL )	{
+				if ( (token = GetTokenFStreamIO(NULL, GRIDDATA_HEADER_SEP_CHARS, &cursor)) != NULL )	{
 					ghdr->NODATA_value = atoi(token);
 					}			
 				}
 			else if (strcmp(token, GRIDDATA_KEYWORD_BYTEORDER) == 0)	{
-				if ( (token = strtok(NULL, GRIDDATA_HEADER_SEP_CHARS)) != NULL )	{
+				if ( (token = GetTokenFStreamIO(NULL, GRIDDATA_HEADER_SEP_CHARS, &cursor)) != NULL )	{
 					if ( strcmp(token, GRIDDATA_KEYWORD_BYTEORDER_MSB) == 0 )	{
 						ghdr->is_msbfirst = 1;
 						}
@@ -601,6 +709,8 @@ GridHeaderInfo * InitGridHeaderInfoFromFile(GridFileInfo * gfinfo)	{
 		else	{
 			/* empty lines must mean header portion is over, no need to rewind when empty */
 			last_line_header = 1;
+			if ( line != NULL )
+				free(line);
 			}
 		}		/* end of while */
 		
@@ -637,6 +747,7 @@ DblTwoDArray * ImportBinaryRasterAsDblTwoDArray(GridFileInfo * gfinfo, GridHeade
 	DblTwoDArray * arr2d 	= NULL;
 	FILE * fstream 			= NULL;
 	float * fbuff 			= NULL;
+	double * row 	= NULL;
 	size_t items_read 		= 0;	
 	int r, c;	
 
@@ -660,10 +771,13 @@ DblTwoDArray * ImportBinaryRasterAsDblTwoDArray(GridFileInfo * gfinfo, GridHeade
 	
 	for( r = 0; r < ghdr->nrows; r++ )	{
  		items_read = fread((float *)fbuff, sizeof(float), ghdr->ncols, fstream);
+		if ( ghdr->is_msbfirst != IsHostMsbFirstGridData() )	{
+			SwapFloatGridData(fbuff, items_read);
+			}
+		/* rows are bounded by the header, so elements are stored without range checks */
+		row = DBLTWODARRAY_GET_FLAT(arr2d) + (size_t) r * ghdr->ncols;
  		for( c = 0; c < items_read; c++ )	{
- 			if ( SetDataDblTwoDArray(arr2d, r, c, (double) fbuff[c]) )	{ 			
-				ERR_ERROR_CONTINUE("Attempt to insert into grid past valid index. \n", ERR_EDOM);
- 				}
+			row[c] = (double) fbuff[c];
 			}
 		if ( items_read != ghdr->ncols )	{
 			ERR_ERROR_CONTINUE("Full column of data not read from grid. \n", ERR_ERANGE);
@@ -679,34 +793,33 @@ DblTwoDArray * ImportBinaryRasterAsDblTwoDArray(GridFileInfo * gfinfo, GridHeade
 
 DblTwoDArray * ImportAsciiRasterAsDblTwoDArray(GridFileInfo * gfinfo, GridHeaderInfo * ghdr)	{
 	DblTwoDArray * arr2d 	= NULL;
-	FILE * fstream 			= NULL;
-	double buff;
+	AsciiGridReader * rdr 	= NULL;
+	double * row 			= NULL;
 	int r, c;	
 
-	if ( gfinfo == NULL || ghdr == NULL || ((fstream = fopen(gfinfo->main_file, "rb")) == NULL) )	{
+	if ( gfinfo == NULL || ghdr == NULL || (rdr = InitAsciiGridReader(gfinfo, ghdr)) == NULL )	{
 		ERR_ERROR_CONTINUE("Cannot retrieve file or header information to load GRID data. \n", ERR_EINVAL);	
 		return arr2d;
 		}
  		
 	if ( (arr2d = InitDblTwoDArraySizeEmpty(ghdr->nrows, ghdr->ncols)) == NULL )	{
 		ERR_ERROR_CONTINUE("Memory not allocated for 2D array. \n", ERR_ENOMEM);
- 		fclose(fstream);
+ 		FreeAsciiGridReader(rdr);
  		return arr2d;
  		}		
 	
-	/* move to stored offset */
-	fseek(fstream, gfinfo->bytes_read, SEEK_SET);
- 	/* start populating array and reading in more data as necessary */
+ 	/* parse each row and convert directly into the array */
 	for( r = 0; r < ghdr->nrows; r++ )	{
+		if ( ReadRowAsciiGridReader(rdr) )	{
+			ERR_ERROR_CONTINUE("Full column of data not read from grid. \n", ERR_ERANGE);
+			}
+		row = DBLTWODARRAY_GET_FLAT(arr2d) + (size_t) r * ghdr->ncols;
  		for( c = 0; c < ghdr->ncols; c++ )	{
- 			if ( fscanf(fstream, "%lf ", &buff) != EOF )	{
-	 			if ( SetDataDblTwoDArray(arr2d, r, c, buff) )
-					ERR_ERROR_CONTINUE("Attempt to insert into grid past valid index. \n", ERR_EDOM);
-				}
+			row[c] = rdr->vals[c];
 			}
 		}
 
-	fclose(fstream);
+	FreeAsciiGridReader(rdr);
 	 	
  	return arr2d;
 	}
@@ -716,40 +829,44 @@ FltTwoDArray * ImportBinaryRasterAsFltTwoDArray(GridFileInfo * gfinfo, GridHeade
 	FILE * fstream 			= NULL;
 	float * fbuff 			= NULL;
 	size_t items_read 		= 0;	
-	int r, c;	
+	int r;	
 
-	if ( gfinfo == NULL || ghdr == NULL || ((fstream = fopen(gfinfo->main_file, "rb")) == NULL) )	{
+	if ( gfinfo == NULL || ghdr == NULL )	{
 		ERR_ERROR_CONTINUE("Cannot retrieve file or header information to load GRID data. \n", ERR_EINVAL);	
 		return arr2d;
 		}
 
- 	if ( (fbuff = (float *) malloc(sizeof(float) * ghdr->ncols)) == NULL )	{
-		ERR_ERROR_CONTINUE("Memory not allocated for IO buffer. \n", ERR_EIOFAIL);
- 		fclose(fstream);
- 		return arr2d;
- 		}
+	/* data in byte order of host is used in place, without copying */
+	if ( ghdr->is_msbfirst == IsHostMsbFirstGridData() && (fbuff = MapBinaryRasterGridData(gfinfo, ghdr)) != NULL )	{
+		if ( (arr2d = InitFltTwoDArraySizeBuffer(ghdr->nrows, ghdr->ncols, fbuff)) == NULL )	{
+			ERR_ERROR_CONTINUE("Memory not allocated for 2D array. \n", ERR_ENOMEM);
+			}
+		return arr2d;
+		}
+
+	if ( (fstream = fopen(gfinfo->main_file, "rb")) == NULL )	{
+		ERR_ERROR_CONTINUE("Cannot retrieve file or header information to load GRID data. \n", ERR_EINVAL);	
+		return arr2d;
+		}
  		
 	if ( (arr2d = InitFltTwoDArraySizeEmpty(ghdr->nrows, ghdr->ncols)) == NULL )	{
 		ERR_ERROR_CONTINUE("Memory not allocated for 2D array. \n", ERR_ENOMEM);
  		fclose(fstream);
- 		free(fbuff);
  		return arr2d;
  		}		
 	
+	/* read each row directly into the array */
 	for( r = 0; r < ghdr->nrows; r++ )	{
+		fbuff = FLTTWODARRAY_GET_FLAT(arr2d) + (size_t) r * ghdr->ncols;
  		items_read = fread((float *)fbuff, sizeof(float), ghdr->ncols, fstream);
- 		for( c = 0; c < items_read; c++ )	{
- 			if ( SetDataFltTwoDArray(arr2d, r, c, (float) fbuff[c]) )	{ 			
-				ERR_ERROR_CONTINUE("Attempt to insert into grid past valid index. \n", ERR_EDOM);
- 				}
+		if ( ghdr->is_msbfirst != IsHostMsbFirstGridData() )	{
+			SwapFloatGridData(fbuff, items_read);
 			}
 		if ( items_read != ghdr->ncols )	{
 			ERR_ERROR_CONTINUE("Full column of data not read from grid. \n", ERR_ERANGE);
 			}
 		} 
 
-	if ( fbuff != NULL	)
-		free(fbuff);			
 	fclose(fstream);
 	 	
  	return arr2d;
@@ -757,34 +874,33 @@ FltTwoDArray * ImportBinaryRasterAsFltTwoDArray(GridFileInfo * gfinfo, GridHeade
 	
 FltTwoDArray * ImportAsciiRasterAsFltTwoDArray(GridFileInfo * gfinfo, GridHeaderInfo * ghdr)	{
 	FltTwoDArray * arr2d 	= NULL;
-	FILE * fstream 			= NULL;
-	double buff;
+	AsciiGridReader * rdr 	= NULL;
+	float * row 			= NULL;
 	int r, c;	
 
-	if ( gfinfo == NULL || ghdr == NULL || ((fstream = fopen(gfinfo->main_file, "rb")) == NULL) )	{
+	if ( gfinfo == NULL || ghdr == NULL || (rdr = InitAsciiGridReader(gfinfo, ghdr)) == NULL )	{
 		ERR_ERROR_CONTINUE("Cannot retrieve file or header information to load GRID data. \n", ERR_EINVAL);	
 		return arr2d;
 		}
  		
 	if ( (arr2d = InitFltTwoDArraySizeEmpty(ghdr->nrows, ghdr->ncols)) == NULL )	{
 		ERR_ERROR_CONTINUE("Memory not allocated for 2D array. \n", ERR_ENOMEM);
- 		fclose(fstream);
+ 		FreeAsciiGridReader(rdr);
  		return arr2d;
  		}		
 	
-	/* move to stored offset */
-	fseek(fstream, gfinfo->bytes_read, SEEK_SET);
- 	/* start populating array and reading in more data as necessary */
+ 	/* parse each row and convert directly into the array */
 	for( r = 0; r < ghdr->nrows; r++ )	{
+		if ( ReadRowAsciiGridReader(rdr) )	{
+			ERR_ERROR_CONTINUE("Full column of data not read from grid. \n", ERR_ERANGE);
+			}
+		row = FLTTWODARRAY_GET_FLAT(arr2d) + (size_t) r * ghdr->ncols;
  		for( c = 0; c < ghdr->ncols; c++ )	{
- 			if ( fscanf(fstream, "%lf ", &buff) != EOF )	{
-	 			if ( SetDataFltTwoDArray(arr2d, r, c, (float) buff) )
-					ERR_ERROR_CONTINUE("Attempt to insert into grid past valid index. \n", ERR_EDOM);
-				}
+			row[c] = (float) rdr->vals[c];
 			}
 		}
 
-	fclose(fstream);
+	FreeAsciiGridReader(rdr);
 	 	
  	return arr2d;
 	}
@@ -793,6 +909,7 @@ LIntTwoDArray * ImportBinaryRasterAsLIntTwoDArray(GridFileInfo * gfinfo, GridHea
 	LIntTwoDArray * arr2d 	= NULL;
 	FILE * fstream 			= NULL;
 	float * fbuff 			= NULL;
+	long int * row 	= NULL;
 	size_t items_read 		= 0;	
 	int r, c;	
 
@@ -816,10 +933,13 @@ LIntTwoDArray * ImportBinaryRasterAsLIntTwoDArray(GridFileInfo * gfinfo, GridHea
 	
 	for( r = 0; r < ghdr->nrows; r++ )	{
  		items_read = fread((float *)fbuff, sizeof(float), ghdr->ncols, fstream);
+		if ( ghdr->is_msbfirst != IsHostMsbFirstGridData() )	{
+			SwapFloatGridData(fbuff, items_read);
+			}
+		/* rows are bounded by the header, so elements are stored without range checks */
+		row = LINTTWODARRAY_GET_FLAT(arr2d) + (size_t) r * ghdr->ncols;
  		for( c = 0; c < items_read; c++ )	{
- 			if ( SetDataLIntTwoDArray(arr2d, r, c, (long int) fbuff[c]) )	{
-				ERR_ERROR_CONTINUE("Attempt to insert into grid past valid index. \n", ERR_EDOM);
- 				}
+			row[c] = (long int) fbuff[c];
 			}
 		if ( items_read != ghdr->ncols )	{
 			ERR_ERROR_CONTINUE("Full column of data not read from grid. \n", ERR_ERANGE);
@@ -835,34 +955,33 @@ LIntTwoDArray * ImportBinaryRasterAsLIntTwoDArray(GridFileInfo * gfinfo, GridHea
 	
 LIntTwoDArray * ImportAsciiRasterAsLIntTwoDArray(GridFileInfo * gfinfo, GridHeaderInfo * ghdr)	{
 	LIntTwoDArray * arr2d 	= NULL;
-	FILE * fstream 			= NULL;
-	double buff;
+	AsciiGridReader * rdr 	= NULL;
+	long int * row 			= NULL;
 	int r, c;	
 
-	if ( gfinfo == NULL || ghdr == NULL || ((fstream = fopen(gfinfo->main_file, "rb")) == NULL) )	{
+	if ( gfinfo == NULL || ghdr == NULL || (rdr = InitAsciiGridReader(gfinfo, ghdr)) == NULL )	{
 		ERR_ERROR_CONTINUE("Cannot retrieve file or header information to load GRID data. \n", ERR_EINVAL);	
 		return arr2d;
 		}
  		
 	if ( (arr2d = InitLIntTwoDArraySizeEmpty(ghdr->nrows, ghdr->ncols)) == NULL )	{
 		ERR_ERROR_CONTINUE("Memory not allocated for 2D array. \n", ERR_ENOMEM);
- 		fclose(fstream);
+ 		FreeAsciiGridReader(rdr);
  		return arr2d;
  		}		
 	
-	/* move to stored offset */
-	fseek(fstream, gfinfo->bytes_read, SEEK_SET);
- 	/* start populating array and reading in more data as necessary */
+ 	/* parse each row and convert directly into the array */
 	for( r = 0; r < ghdr->nrows; r++ )	{
+		if ( ReadRowAsciiGridReader(rdr) )	{
+			ERR_ERROR_CONTINUE("Full column of data not read from grid. \n", ERR_ERANGE);
+			}
+		row = LINTTWODARRAY_GET_FLAT(arr2d) + (size_t) r * ghdr->ncols;
  		for( c = 0; c < ghdr->ncols; c++ )	{
- 			if ( fscanf(fstream, "%lf ", &buff) != EOF )	{
-	 			if ( SetDataLIntTwoDArray(arr2d, r, c, (long int) buff) )
-					ERR_ERROR_CONTINUE("Attempt to insert into grid past valid index. \n", ERR_EDOM);
-				}
+			row[c] = (long int) rdr->vals[c];
 			}
 		}
 
-	fclose(fstream);
+	FreeAsciiGridReader(rdr);
 	 	
  	return arr2d;
 	}
@@ -871,6 +990,7 @@ IntTwoDArray * ImportBinaryRasterAsIntTwoDArray(GridFileInfo * gfinfo, GridHeade
 	IntTwoDArray * arr2d 	= NULL;
 	FILE * fstream 			= NULL;
 	float * fbuff 			= NULL;
+	int * row 	= NULL;
 	size_t items_read 		= 0;	
 	int r, c;	
 
@@ -894,10 +1014,13 @@ IntTwoDArray * ImportBinaryRasterAsIntTwoDArray(GridFileInfo * gfinfo, GridHeade
 	
 	for( r = 0; r < ghdr->nrows; r++ )	{
  		items_read = fread((float *)fbuff, sizeof(float), ghdr->ncols, fstream);
+		if ( ghdr->is_msbfirst != IsHostMsbFirstGridData() )	{
+			SwapFloatGridData(fbuff, items_read);
+			}
+		/* rows are bounded by the header, so elements are stored without range checks */
+		row = INTTWODARRAY_GET_FLAT(arr2d) + (size_t) r * ghdr->ncols;
  		for( c = 0; c < items_read; c++ )	{
- 			if ( SetDataIntTwoDArray(arr2d, r, c, (int) fbuff[c]) )	{ 			
-				ERR_ERROR_CONTINUE("Attempt to insert into grid past valid index. \n", ERR_EDOM);
- 				}
+			row[c] = (int) fbuff[c];
 			}
 		if ( items_read != ghdr->ncols )	{
 			ERR_ERROR_CONTINUE("Full column of data not read from grid. \n", ERR_ERANGE);
@@ -913,34 +1036,33 @@ IntTwoDArray * ImportBinaryRasterAsIntTwoDArray(GridFileInfo * gfinfo, GridHeade
 	
 IntTwoDArray * ImportAsciiRasterAsIntTwoDArray(GridFileInfo * gfinfo, GridHeaderInfo * ghdr)	{
 	IntTwoDArray * arr2d 	= NULL;
-	FILE * fstream 			= NULL;
-	double buff;
+	AsciiGridReader * rdr 	= NULL;
+	int * row 			= NULL;
 	int r, c;	
 
-	if ( gfinfo == NULL || ghdr == NULL || ((fstream = fopen(gfinfo->main_file, "rb")) == NULL) )	{
+	if ( gfinfo == NULL || ghdr == NULL || (rdr = InitAsciiGridReader(gfinfo, ghdr)) == NULL )	{
 		ERR_ERROR_CONTINUE("Cannot retrieve file or header information to load GRID data. \n", ERR_EINVAL);	
 		return arr2d;
 		}
  		
 	if ( (arr2d = InitIntTwoDArraySizeEmpty(ghdr->nrows, ghdr->ncols)) == NULL )	{
 		ERR_ERROR_CONTINUE("Memory not allocated for 2D array. \n", ERR_ENOMEM);
- 		fclose(fstream);
+ 		FreeAsciiGridReader(rdr);
  		return arr2d;
  		}		
 	
-	/* move to stored offset */
-	fseek(fstream, gfinfo->bytes_read, SEEK_SET);
- 	/* start populating array and reading in more data as necessary */
+ 	/* parse each row and convert directly into the array */
 	for( r = 0; r < ghdr->nrows; r++ )	{
+		if ( ReadRowAsciiGridReader(rdr) )	{
+			ERR_ERROR_CONTINUE("Full column of data not read from grid. \n", ERR_ERANGE);
+			}
+		row = INTTWODARRAY_GET_FLAT(arr2d) + (size_t) r * ghdr->ncols;
  		for( c = 0; c < ghdr->ncols; c++ )	{
- 			if ( fscanf(fstream, "%lf ", &buff) != EOF )	{
-	 			if ( SetDataIntTwoDArray(arr2d, r, c, (int) buff) )
-					ERR_ERROR_CONTINUE("Attempt to insert into grid past valid index. \n", ERR_EDOM);
-				}
+			row[c] = (int) rdr->vals[c];
 			}
 		}
 
-	fclose(fstream);
+	FreeAsciiGridReader(rdr);
 	 	
  	return arr2d;
 	}
@@ -949,6 +1071,7 @@ ByteTwoDArray * ImportBinaryRasterAsByteTwoDArray(GridFileInfo * gfinfo, GridHea
 	ByteTwoDArray * arr2d 	= NULL;
 	FILE * fstream 			= NULL;
 	float * fbuff 			= NULL;
+	unsigned char * row 	= NULL;
 	size_t items_read 		= 0;	
 	int r, c;	
 
@@ -972,10 +1095,13 @@ ByteTwoDArray * ImportBinaryRasterAsByteTwoDArray(GridFileInfo * gfinfo, GridHea
 	
 	for( r = 0; r < ghdr->nrows; r++ )	{
  		items_read = fread((float *)fbuff, sizeof(float), ghdr->ncols, fstream);
+		if ( ghdr->is_msbfirst != IsHostMsbFirstGridData() )	{
+			SwapFloatGridData(fbuff, items_read);
+			}
+		/* rows are bounded by the header, so elements are stored without range checks */
+		row = BYTETWODARRAY_GET_FLAT(arr2d) + (size_t) r * ghdr->ncols;
  		for( c = 0; c < items_read; c++ )	{
- 			if ( SetDataByteTwoDArray(arr2d, r, c, (unsigned char) fbuff[c]) )	{ 			
-				ERR_ERROR_CONTINUE("Attempt to insert into grid past valid index. \n", ERR_EDOM);
- 				}
+			row[c] = (unsigned char) fbuff[c];
 			}
 		if ( items_read != ghdr->ncols )	{
 			ERR_ERROR_CONTINUE("Full column of data not read from grid. \n", ERR_ERANGE);
@@ -991,34 +1117,33 @@ ByteTwoDArray * ImportBinaryRasterAsByteTwoDArray(GridFileInfo * gfinfo, GridHea
 
 ByteTwoDArray * ImportAsciiRasterAsByteTwoDArray(GridFileInfo * gfinfo, GridHeaderInfo * ghdr)	{
 	ByteTwoDArray * arr2d 	= NULL;
-	FILE * fstream 			= NULL;
-	double buff;
+	AsciiGridReader * rdr 	= NULL;
+	unsigned char * row 			= NULL;
 	int r, c;	
 
-	if ( gfinfo == NULL || ghdr == NULL || ((fstream = fopen(gfinfo->main_file, "rb")) == NULL) )	{
+	if ( gfinfo == NULL || ghdr == NULL || (rdr = InitAsciiGridReader(gfinfo, ghdr)) == NULL )	{
 		ERR_ERROR_CONTINUE("Cannot retrieve file or header information to load GRID data. \n", ERR_EINVAL);	
 		return arr2d;
 		}
  		
 	if ( (arr2d = InitByteTwoDArraySizeEmpty(ghdr->nrows, ghdr->ncols)) == NULL )	{
 		ERR_ERROR_CONTINUE("Memory not allocated for 2D array. \n", ERR_ENOMEM);
- 		fclose(fstream);
+ 		FreeAsciiGridReader(rdr);
  		return arr2d;
  		}		
 	
-	/* move to stored offset */
-	fseek(fstream, gfinfo->bytes_read, SEEK_SET);
- 	/* start populating array and reading in more data as necessary */
+ 	/* parse each row and convert directly into the array */
 	for( r = 0; r < ghdr->nrows; r++ )	{
+		if ( ReadRowAsciiGridReader(rdr) )	{
+			ERR_ERROR_CONTINUE("Full column of data not read from grid. \n", ERR_ERANGE);
+			}
+		row = BYTETWODARRAY_GET_FLAT(arr2d) + (size_t) r * ghdr->ncols;
  		for( c = 0; c < ghdr->ncols; c++ )	{
- 			if ( fscanf(fstream, "%lf ", &buff) != EOF )	{
-	 			if ( SetDataByteTwoDArray(arr2d, r, c, (unsigned char) buff) )
-					ERR_ERROR_CONTINUE("Attempt to insert into grid past valid index. \n", ERR_EDOM);
-				}
+			row[c] = (unsigned char) rdr->vals[c];
 			}
 		}
 
-	fclose(fstream);
+	FreeAsciiGridReader(rdr);
 	 	
  	return arr2d;
 	}
@@ -1040,6 +1165,9 @@ int ExportGridDataAsBinaryRaster(GridData * gd, char * main_fname)	{
 	if ( gd == NULL || gd->ghdr == NULL || main_fname == NULL )	{
 		ERR_ERROR("Cannot retrieve file or header information to write GRID data. \n", ERR_EINVAL);
 		}
+	if ( gd->tiles != NULL )	{
+		ERR_ERROR("Tiled GRID data cannot be written as a binary raster. \n", ERR_EUNSUP);
+		}
 	if ( (header = (char *) malloc( sizeof(char) * (strlen(main_fname) + 1))) == NULL )	{
 		ERR_ERROR("Unable to write grid file names, memory allocation failed. \n", ERR_ENOMEM);
 		}
@@ -1206,6 +1334,7 @@ int ExportGridDataAsAsciiRaster(GridData * gd, char * main_fname)	{
 	int ** ibuff			= NULL;
 	unsigned char ** bbuff	= NULL;
 	int i, j, rows, cols;
+	int status = ERR_SUCCESS;
 
 	/* check args */
 	if ( gd == NULL || gd->ghdr == NULL || main_fname == NULL )	{
@@ -1226,6 +1355,55 @@ int ExportGridDataAsAsciiRaster(GridData * gd, char * main_fname)	{
 	fprintf(fstream, "%s %s %d \n", 	GRIDDATA_KEYWORD_CELLSIZE, GRIDDATA_HEADER_SEP_CHARS, gd->ghdr->cellsize);
 	fprintf(fstream, "%s %s %d \n", GRIDDATA_KEYWORD_NODATA_value,GRIDDATA_HEADER_SEP_CHARS, gd->ghdr->NODATA_value);	
 
+	/* write contents of data section of tiled grid one cell at a time */
+	if ( gd->tiles != NULL )	{
+		for( i = 0; i < gd->ghdr->nrows; i++)	{
+			for ( j = 0; j < gd->ghdr->ncols; j++ )	{
+				switch (gd->gtype)	{
+					case EnumDblGrid:	{
+						double dv = 0.0;
+						status = GridTilesGetCell(gd->tiles, i, j, &dv);
+						fprintf(fstream, "%.4lf%s", dv, GRIDDATA_HEADER_SEP_CHARS);
+						}
+						break;
+					case EnumFltGrid:	{
+						float fv = 0.0;
+						status = GridTilesGetCell(gd->tiles, i, j, &fv);
+						fprintf(fstream, "%.4f%s", fv, GRIDDATA_HEADER_SEP_CHARS);
+						}
+						break;
+					case EnumLIntGrid:	{
+						long int liv = 0;
+						status = GridTilesGetCell(gd->tiles, i, j, &liv);
+						fprintf(fstream, "%ld%s", liv, GRIDDATA_HEADER_SEP_CHARS);
+						}
+						break;
+					case EnumIntGrid:	{
+						int iv = 0;
+						status = GridTilesGetCell(gd->tiles, i, j, &iv);
+						fprintf(fstream, "%d%s", iv, GRIDDATA_HEADER_SEP_CHARS);
+						}
+						break;
+					case EnumByteGrid:	{
+						unsigned char bv = 0;
+						status = GridTilesGetCell(gd->tiles, i, j, &bv);
+						fprintf(fstream, "%u%s", bv, GRIDDATA_HEADER_SEP_CHARS);
+						}
+						break;
+					default:
+						break;
+					}
+				if ( status != ERR_SUCCESS )	{
+					fclose(fstream);
+					ERR_ERROR("Unable to read cell of tiled GridData to write GRID data. \n", ERR_EIOFAIL);
+					}
+				}
+			fprintf(fstream, "\n");
+			}
+		fclose(fstream);
+		return ERR_SUCCESS;
+		}
+
 	/* write contents of data section in main file */
  	switch (gd->gtype)	{
  		case EnumDblGrid:
@@ -1769,6 +1947,73 @@ int ExportByteTwoDArrayAsAsciiRaster(ByteTwoDArray * arr, double xll, double yll
 	return success;
 	}
 				
+/* BULK ACCESS */
+
+/* copies a row of cell values of any grid data type into vals, converted as GRID_DATA_GET_DATA would */
+#define GRIDDATA_GET_ROW_KERNEL(ctype, cells)	{										\
+			const ctype * src_ = (cells) + (size_t) row * view.ncols;						\
+			for(j = 0; j < view.ncols; j++)	{												\
+				vals[j] = src_[j];															\
+				}																			\
+			}
+
+int GetRowAsDblGridData(GridData * gd, int row, double * vals)	{
+	GridDataView view;
+	int j;
+
+	if ( InitGridDataView(gd, &view) || vals == NULL || row < 0 || row >= view.nrows )	{
+		ERR_ERROR("Unable to retrieve row of GridData. \n", ERR_EINVAL);
+		}
+	if ( view.cells == NULL )	{
+		for(j = 0; j < view.ncols; j++)	{
+			GRID_DATA_GET_DATA(gd, row, j, vals[j]);
+			}
+		}
+	else	{
+		GRID_DATA_VIEW_DISPATCH(&view, GRIDDATA_GET_ROW_KERNEL);
+		}
+
+	return ERR_SUCCESS;
+	}
+
+int GetRowAsLIntGridData(GridData * gd, int row, long int * vals)	{
+	GridDataView view;
+	int j;
+
+	if ( InitGridDataView(gd, &view) || vals == NULL || row < 0 || row >= view.nrows )	{
+		ERR_ERROR("Unable to retrieve row of GridData. \n", ERR_EINVAL);
+		}
+	if ( view.cells == NULL )	{
+		for(j = 0; j < view.ncols; j++)	{
+			GRID_DATA_GET_DATA(gd, row, j, vals[j]);
+			}
+		}
+	else	{
+		GRID_DATA_VIEW_DISPATCH(&view, GRIDDATA_GET_ROW_KERNEL);
+		}
+
+	return ERR_SUCCESS;
+	}
+
+int GetRowAsIntGridData(GridData * gd, int row, int * vals)	{
+	GridDataView view;
+	int j;
+
+	if ( InitGridDataView(gd, &view) || vals == NULL || row < 0 || row >= view.nrows )	{
+		ERR_ERROR("Unable to retrieve row of GridData. \n", ERR_EINVAL);
+		}
+	if ( view.cells == NULL )	{
+		for(j = 0; j < view.ncols; j++)	{
+			GRID_DATA_GET_DATA(gd, row, j, vals[j]);
+			}
+		}
+	else	{
+		GRID_DATA_VIEW_DISPATCH(&view, GRIDDATA_GET_ROW_KERNEL);
+		}
+
+	return ERR_SUCCESS;
+	}
+
 /* MEMORY MGT */	
 void FreeGridData(void * vptr)	{
 	GridData * gd = NULL;
@@ -1780,6 +2025,8 @@ void FreeGridData(void * vptr)	{
 			FreeGridHeaderInfo(gd->ghdr);
 		if ( gd->gfinfo != NULL )
 			FreeGridFileInfo(gd->gfinfo);
+		if ( gd->tiles != NULL )
+			FreeGridTiles(gd->tiles);
 		free(gd);
 		}
 	gd = NULL;
@@ -1838,6 +2085,10 @@ void FreeGridFileInfo(void * vptr)	{
 	GridFileInfo * gfi = NULL;
 	if ( vptr != NULL )	{
 		gfi = (GridFileInfo *) vptr;
+#ifdef USING_UNIX
+		if ( gfi->map != NULL )
+			munmap(gfi->map, gfi->map_sz);
+#endif
 		if ( gfi->main_file != NULL )
 			free(gfi->main_file);
 		if ( gfi->header_file != NULL )
@@ -1847,5 +2098,555 @@ void FreeGridFileInfo(void * vptr)	{
 	gfi = NULL;
 	return;
 	}
+
+int IsHostMsbFirstGridData(void)	{
+	unsigned int one = 1;
+	
+	/* most significant byte stored first when low address holds zero */
+	return ( *((unsigned char *) &one) == 0 );
+	}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Maps the main file of a binary raster into memory.  The mapping is private, so pages
+ * are shared with the page cache until written, and writes are never carried to the file.
+ * The mapping is stored in gfinfo and released when gfinfo is freed.
+ *
+ * Arguments:
+ * gfinfo- file information of raster
+ * ghdr- header information of raster
+ *
+ * Returns:
+ * ptr to first element of raster, or NULL if the file could not be mapped or is too short
+ */
+static float * MapBinaryRasterGridData(GridFileInfo * gfinfo, GridHeaderInfo * ghdr)	{
+#ifdef USING_UNIX
+	struct stat st;
+	void * addr 	= NULL;
+	size_t len;
+	int fd;
+
+	if ( ghdr->nrows < 1 || ghdr->ncols < 1 || (fd = open(gfinfo->main_file, O_RDONLY)) == -1 )	{
+		return NULL;
+		}
+	len = sizeof(float) * (size_t) ghdr->nrows * ghdr->ncols;
+	/* short files are left to the stream reader, which reports the missing data */
+	if ( fstat(fd, &st) == -1 || (size_t) st.st_size < len )	{
+		close(fd);
+		return NULL;
+		}
+	addr = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if ( addr == MAP_FAILED )	{
+		return NULL;
+		}
+	gfinfo->map = addr;
+	gfinfo->map_sz = len;
+
+	return (float *) addr;
+#else
+	return NULL;
+#endif
+	}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Reverses the byte order of each float in buff.
+ *
+ * Arguments:
+ * buff- floats to swap in place
+ * n- number of floats in buff
+ *
+ * Returns:
+ * None
+ */
+static void SwapFloatGridData(float * buff, size_t n)	{
+	unsigned char * b = (unsigned char *) buff;
+	unsigned char t;
+	size_t k;
+
+	for(k = 0; k < n; k++, b += sizeof(float))	{
+		t = b[0];	b[0] = b[3];	b[3] = t;
+		t = b[1];	b[1] = b[2];	b[2] = t;
+		}
+
+	return;
+	}
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Opens the main file of an ascii raster positioned after the header, which was
+ * read when the header information was retrieved.
+ *
+ * Arguments:
+ * gfinfo- file information of raster
+ * ghdr- header information of raster
+ *
+ * Returns:
+ * ptr to AsciiGridReader, or NULL if the file could not be opened or memory not allocated
+ */
+static AsciiGridReader * InitAsciiGridReader(GridFileInfo * gfinfo, GridHeaderInfo * ghdr)	{
+	AsciiGridReader * rdr = NULL;
+
+	if ( ghdr->ncols < 1 || (rdr = (AsciiGridReader *) malloc(sizeof(AsciiGridReader))) == NULL )	{
+		return NULL;
+		}
+	rdr->fstream = NULL;
+	rdr->buf = NULL;
+	rdr->len = rdr->pos = 0;
+	rdr->is_eof = 0;
+	rdr->vals = NULL;
+	rdr->ncols = ghdr->ncols;
+	if ( (rdr->fstream = fopen(gfinfo->main_file, "rb")) == NULL
+			|| fseek(rdr->fstream, gfinfo->bytes_read, SEEK_SET)
+			|| (rdr->buf = (char *) malloc(sizeof(char) * GRIDDATA_ASCII_BUFFER_SZ)) == NULL
+			|| (rdr->vals = (double *) malloc(sizeof(double) * rdr->ncols)) == NULL )	{
+		FreeAsciiGridReader(rdr);
+		return NULL;
+		}
+
+	return rdr;
+	}
+
+/* whitespace separating values, as matched by a space in a scanf format */
+#define GRIDDATA_ASCII_IS_SPACE(ch)		((ch) == ' ' || (ch) == '\n' || (ch) == '\r' || (ch) == '\t'	\
+											|| (ch) == '\v' || (ch) == '\f')
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Parses the next row of values in the raster into rdr->vals.  Values are separated by
+ * any amount of whitespace and rows need not end with a newline, so only the count of
+ * values determines where a row ends.
+ *
+ * Arguments:
+ * rdr- AsciiGridReader
+ *
+ * Returns:
+ * ERR_SUCCESS(0) if a full row was read, ERR_ERANGE if the file ended first, or
+ * ERR_EINVAL if a value could not be parsed
+ */
+static int ReadRowAsciiGridReader(AsciiGridReader * rdr)	{
+	size_t start;
+	int c = 0;
+
+	while ( c < rdr->ncols )	{
+		while ( rdr->pos < rdr->len && GRIDDATA_ASCII_IS_SPACE(rdr->buf[rdr->pos]) )	{
+			rdr->pos++;
+			}
+		if ( rdr->pos == rdr->len )	{
+			if ( rdr->is_eof )	{
+				return ERR_ERANGE;
+				}
+			FillAsciiGridReader(rdr, rdr->len);
+			continue;
+			}
+		start = rdr->pos;
+		while ( rdr->pos < rdr->len && ! GRIDDATA_ASCII_IS_SPACE(rdr->buf[rdr->pos]) )	{
+			rdr->pos++;
+			}
+		/* value may continue in the next block of the file */
+		if ( rdr->pos == rdr->len && ! rdr->is_eof )	{
+			FillAsciiGridReader(rdr, start);
+			rdr->pos = 0;
+			continue;
+			}
+		if ( ParseDoubleAsciiGridReader(rdr->buf + start, rdr->pos - start, &rdr->vals[c]) )	{
+			fprintf(stderr, "Unable to parse ascii grid value %.*s \n", (int) (rdr->pos - start), rdr->buf + start);
+			return ERR_EINVAL;
+			}
+		c++;
+		}
+
+	return ERR_SUCCESS;
+	}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Discards the bytes of the buffer before offset keep and appends bytes from the file
+ * after the remainder.  The read position is moved with the bytes kept.
+ *
+ * Arguments:
+ * rdr- AsciiGridReader
+ * keep- offset of first byte in buffer which is kept
+ *
+ * Returns:
+ * None
+ */
+static void FillAsciiGridReader(AsciiGridReader * rdr, size_t keep)	{
+	size_t got;
+
+	memmove(rdr->buf, rdr->buf + keep, rdr->len - keep);
+	rdr->len -= keep;
+	rdr->pos = ( rdr->pos > keep ) ? rdr->pos - keep : 0;
+	got = fread(rdr->buf + rdr->len, sizeof(char), GRIDDATA_ASCII_BUFFER_SZ - rdr->len, rdr->fstream);
+	if ( got == 0 )	{
+		rdr->is_eof = 1;
+		}
+	rdr->len += got;
+
+	return;
+	}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Converts a value of n characters, not null terminated, to a double.  Decimals of at
+ * most 15 significant digits scaled by at most 22 powers of ten are computed with a
+ * single multiplication or division of two exactly representable doubles, which is
+ * correctly rounded and so equal to the value returned by strtod.  All other values,
+ * including those in exponent or hexadecimal notation outside these limits, are
+ * converted by strtod.
+ *
+ * Arguments:
+ * tok- first character of value
+ * n- number of characters in value
+ * val- receives value
+ *
+ * Returns:
+ * ERR_SUCCESS(0) if all n characters were converted, ERR_EINVAL otherwise
+ */
+static int ParseDoubleAsciiGridReader(const char * tok, size_t n, double * val)	{
+	static const double exact_pow10[] = {	1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+									1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+	char str[GRIDDATA_ASCII_MAX_TOKEN_LEN + 1];
+	char * end 			= NULL;
+	const char * p 		= tok;
+	const char * last 	= tok + n;
+	double m 			= 0.0;
+	int is_neg 			= 0, ndigits = 0, nsig = 0, exp10 = 0, exp_is_neg = 0, exp_val = 0, exp_ndigits = 0;
+
+	if ( n == 0 || n > GRIDDATA_ASCII_MAX_TOKEN_LEN )	{
+		return ERR_EINVAL;
+		}
+
+	if ( *p == '-' || *p == '+' )	{
+		is_neg = ( *p == '-' );
+		p++;
+		}
+	for( ; p < last && *p >= '0' && *p <= '9'; p++, ndigits++ )	{
+		if ( nsig > 0 || *p != '0' )	{
+			m = m * 10.0 + (*p - '0');
+			nsig++;
+			}
+		}
+	if ( p < last && *p == '.' )	{
+		for( p++; p < last && *p >= '0' && *p <= '9'; p++, ndigits++ )	{
+			if ( nsig > 0 || *p != '0' )	{
+				m = m * 10.0 + (*p - '0');
+				nsig++;
+				}
+			exp10--;
+			}
+		}
+	if ( ndigits > 0 && p < last && (*p == 'e' || *p == 'E') )	{
+		p++;
+		if ( p < last && (*p == '-' || *p == '+') )	{
+			exp_is_neg = ( *p == '-' );
+			p++;
+			}
+		for( ; p < last && *p >= '0' && *p <= '9' && exp_val < 1000; p++, exp_ndigits++ )	{
+			exp_val = exp_val * 10 + (*p - '0');
+			}
+		if ( exp_ndigits == 0 )	{
+			p = tok;
+			}
+		exp10 += ( exp_is_neg ) ? -exp_val : exp_val;
+		}
+
+	/* fast path when digits and scale are exactly representable */
+	if ( p == last && ndigits > 0 && nsig <= 15 && exp10 >= -22 && exp10 <= 22 )	{
+		m = ( exp10 < 0 ) ? m / exact_pow10[-exp10] : m * exact_pow10[exp10];
+		*val = ( is_neg ) ? -m : m;
+		return ERR_SUCCESS;
+		}
+
+	memcpy(str, tok, n);
+	str[n] = '\0';
+	*val = strtod(str, &end);
+	if ( end != str + n )	{
+		return ERR_EINVAL;
+		}
+
+	return ERR_SUCCESS;
+	}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Closes the file and frees memory associated with AsciiGridReader.
+ *
+ * Arguments:
+ * rdr- AsciiGridReader
+ *
+ * Returns:
+ * None
+ */
+static void FreeAsciiGridReader(AsciiGridReader * rdr)	{
+	if ( rdr != NULL )	{
+		if ( rdr->fstream != NULL )		fclose(rdr->fstream);
+		if ( rdr->buf != NULL )			free(rdr->buf);
+		if ( rdr->vals != NULL )		free(rdr->vals);
+		free(rdr);
+		}
+
+	return;
+	}
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Size of each cell value of grid type.
+ *
+ * Arguments:
+ * grid_type- enumeration of grid data type
+ *
+ * Returns:
+ * size of cell value in bytes, or 0 if grid type is not stored as an array of values
+ */
+static int GetElemSizeGridData(EnumGridType grid_type)	{
+	switch(grid_type)	{
+		case EnumDblGrid:
+			return sizeof(double);
+		case EnumFltGrid:
+			return sizeof(float);
+		case EnumLIntGrid:
+			return sizeof(long int);
+		case EnumIntGrid:
+			return sizeof(int);
+		case EnumByteGrid:
+			return sizeof(unsigned char);
+		default:
+			break;
+		}
+
+	return 0;
+	}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Retrieves the size and modification time of a file, used to detect a tiled grid file created
+ * from an older copy of a raster.  Hosts without file status only compare size.
+ *
+ * Arguments:
+ * fname- name of file
+ * fsize- receives size of file, in bytes
+ * mtime- receives modification time of file, 0 if not available
+ *
+ * Returns:
+ * ERR_SUCCESS(0) if operation successful, an error code otherwise
+ */
+static int GetFileStampGridData(char * fname, long int * fsize, long int * mtime)	{
+#ifdef USING_UNIX
+	struct stat st;
+
+	if ( stat(fname, &st) == -1 )	{
+		return ERR_EIOFAIL;
+		}
+	*fsize = (long int) st.st_size;
+	*mtime = (long int) st.st_mtime;
+#else
+	FILE * fstream = NULL;
+
+	if ( (fstream = fopen(fname, "rb")) == NULL )	{
+		return ERR_EIOFAIL;
+		}
+	fseek(fstream, 0L, SEEK_END);
+	*fsize = ftell(fstream);
+	*mtime = 0;
+	fclose(fstream);
+#endif
+
+	return ERR_SUCCESS;
+	}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Converts floats read from a binary raster to cell values of grid type, as done when
+ * binary rasters are imported into arrays.
+ *
+ * Arguments:
+ * src- floats read from binary raster
+ * dst- receives n cell values of grid type
+ * grid_type- enumeration of grid data type
+ * n- number of values
+ *
+ * Returns:
+ * None
+ */
+static void ConvertFloatGridData(const float * src, char * dst, EnumGridType grid_type, size_t n)	{
+	size_t k;
+
+	switch(grid_type)	{
+		case EnumDblGrid:
+			for(k = 0; k < n; k++)	((double *) dst)[k] = (double) src[k];
+			break;
+		case EnumFltGrid:
+			memcpy(dst, src, sizeof(float) * n);
+			break;
+		case EnumLIntGrid:
+			for(k = 0; k < n; k++)	((long int *) dst)[k] = (long int) src[k];
+			break;
+		case EnumIntGrid:
+			for(k = 0; k < n; k++)	((int *) dst)[k] = (int) src[k];
+			break;
+		case EnumByteGrid:
+			for(k = 0; k < n; k++)	((unsigned char *) dst)[k] = (unsigned char) src[k];
+			break;
+		default:
+			break;
+		}
+
+	return;
+	}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Creates a tiled grid file from a binary raster.  The raster is read one band of tile rows at
+ * a time, so memory used is independent of the number of rows in the raster.  Tiles are written
+ * to a temporary file which is renamed once complete, so concurrent runs never read a partial file.
+ *
+ * Arguments:
+ * main_fname- name of binary raster
+ * header_fname- name of header of binary raster
+ * grid_type- enumeration of grid data type stored in tiles
+ * tiles_fname- name of tiled grid file
+ * src_sz- size of binary raster, in bytes
+ * src_mtime- modification time of binary raster
+ *
+ * Returns:
+ * ERR_SUCCESS(0) if operation successful, an error code otherwise
+ */
+static int ExportBinaryRasterAsGridTiles(char * main_fname, char * header_fname, EnumGridType grid_type,
+											char * tiles_fname, long int src_sz, long int src_mtime)	{
+	GridTilesHeader thdr;
+	GridFileInfo gfinfo;
+	char block[GRID_TILES_HEADER_SZ];
+	GridHeaderInfo * ghdr 	= NULL;
+	FILE * in_fstream 		= NULL;
+	FILE * out_fstream 		= NULL;
+	float * band 			= NULL;
+	char * tile 			= NULL;
+	char * tmp_fname 		= NULL;
+	int elem_sz 			= GetElemSizeGridData(grid_type);
+	int dim 				= GRID_TILES_DEFAULT_DIM;
+	int status 				= ERR_SUCCESS;
+	int tr, tc, r, band_rows, tile_cols;
+	size_t tile_sz, band_sz;
+
+	gfinfo.main_file = main_fname;
+	gfinfo.header_file = header_fname;
+	gfinfo.gfmt = EnumBinaryGrid;
+	gfinfo.map = NULL;
+	gfinfo.map_sz = 0;
+	if ( (ghdr = InitGridHeaderInfoFromFile(&gfinfo)) == NULL )	{
+		ERR_ERROR("Failed to retrieve grid header info. \n", ERR_EFAILED);
+		}
+	tile_sz = (size_t) dim * dim * elem_sz;
+	band_sz = (size_t) dim * ghdr->ncols;
+	if ( (band = (float *) malloc(sizeof(float) * band_sz)) == NULL
+			|| (tile = (char *) malloc(tile_sz)) == NULL
+			|| (tmp_fname = (char *) malloc(sizeof(char) * (strlen(tiles_fname) + 32))) == NULL )	{
+		free(ghdr);
+		free(band);
+		free(tile);
+		ERR_ERROR("Memory not allocated for IO buffer. \n", ERR_ENOMEM);
+		}
+#ifdef USING_UNIX
+	sprintf(tmp_fname, "%s.%ld", tiles_fname, (long int) getpid());
+#else
+	sprintf(tmp_fname, "%s.tmp", tiles_fname);
+#endif
+
+	memset(&thdr, 0, sizeof(GridTilesHeader));
+	memcpy(thdr.magic, GRID_TILES_MAGIC, sizeof(thdr.magic));
+	thdr.version = GRID_TILES_VERSION;
+	thdr.byte_order = GRID_TILES_BYTE_ORDER_MARK;
+	thdr.gtype = grid_type;
+	thdr.elem_sz = elem_sz;
+	thdr.nrows = ghdr->nrows;
+	thdr.ncols = ghdr->ncols;
+	thdr.tile_dim = dim;
+	thdr.cellsize = ghdr->cellsize;
+	thdr.NODATA_value = ghdr->NODATA_value;
+	thdr.xllcorner = ghdr->xllcorner;
+	thdr.yllcorner = ghdr->yllcorner;
+	thdr.src_sz = src_sz;
+	thdr.src_mtime = src_mtime;
+	memset(block, 0, GRID_TILES_HEADER_SZ);
+	memcpy(block, &thdr, sizeof(GridTilesHeader));
+
+	if ( (in_fstream = fopen(main_fname, "rb")) == NULL || (out_fstream = fopen(tmp_fname, "wb")) == NULL
+			|| fwrite(block, sizeof(char), GRID_TILES_HEADER_SZ, out_fstream) != GRID_TILES_HEADER_SZ )	{
+		status = ERR_EIOFAIL;
+		}
+	for(tr = 0; status == ERR_SUCCESS && tr < ghdr->nrows; tr += dim)	{
+		band_rows = ( ghdr->nrows - tr < dim ) ? ghdr->nrows - tr : dim;
+		if ( fread(band, sizeof(float), (size_t) band_rows * ghdr->ncols, in_fstream) != (size_t) band_rows * ghdr->ncols )	{
+			status = ERR_ERANGE;
+			break;
+			}
+		if ( ghdr->is_msbfirst != IsHostMsbFirstGridData() )	{
+			SwapFloatGridData(band, (size_t) band_rows * ghdr->ncols);
+			}
+		for(tc = 0; status == ERR_SUCCESS && tc < ghdr->ncols; tc += dim)	{
+			tile_cols = ( ghdr->ncols - tc < dim ) ? ghdr->ncols - tc : dim;
+			/* cells outside raster pad tiles on last row and column of tiles */
+			memset(tile, 0, tile_sz);
+			for(r = 0; r < band_rows; r++)	{
+				ConvertFloatGridData(band + (size_t) r * ghdr->ncols + tc, tile + (size_t) r * dim * elem_sz, grid_type, tile_cols);
+				}
+			if ( fwrite(tile, tile_sz, 1, out_fstream) != 1 )	{
+				status = ERR_EIOFAIL;
+				}
+			}
+		}
+
+	if ( in_fstream != NULL )	{
+		fclose(in_fstream);
+		}
+	if ( out_fstream != NULL && fclose(out_fstream) != 0 )	{
+		status = ERR_EIOFAIL;
+		}
+	if ( status == ERR_SUCCESS && rename(tmp_fname, tiles_fname) != 0 )	{
+		status = ERR_EIOFAIL;
+		}
+	if ( status != ERR_SUCCESS && out_fstream != NULL )	{
+		remove(tmp_fname);
+		}
+	free(ghdr);
+	free(band);
+	free(tile);
+	free(tmp_fname);
+
+	return status;
+	}
 					
 /* end of GridData.c */
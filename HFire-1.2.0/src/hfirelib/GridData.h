@@ -5,12 +5,20 @@
 #include <stdio.h>
 #include <string.h>
 #include <ctype.h>
+#ifdef USING_UNIX
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 #include "ByteTwoDArray.h"
 #include "IntTwoDArray.h"
 #include "LIntTwoDArray.h"
 #include "DblTwoDArray.h"
 #include "FltTwoDArray.h"
+#include "GridTiles.h"
 #include "FStreamIO.h"
 #include "Err.h"
 
@@ -46,6 +54,11 @@
 #define GRIDDATA_KEYWORD_BYTEORDER_MSB			("MSBFIRST")
 #define GRIDDATA_KEYWORD_BYTEORDER_LSB			("LSBFIRST")
 
+/* number of bytes of ascii grid read from file at once */
+#define GRIDDATA_ASCII_BUFFER_SZ				(1 << 20)
+/* longest value accepted in an ascii grid, in characters */
+#define GRIDDATA_ASCII_MAX_TOKEN_LEN			(128)
+
 /* enum used to identify the different possible grid types */
 enum EnumGridType_ { 
 	EnumBitGrid 	= 1,
@@ -86,12 +99,16 @@ typedef struct GridHeaderInfo_ GridHeaderInfo;
 /* structure used to store grid file information */
 typedef struct GridFileInfo_ GridFileInfo;
 
+/* structure used to access cells of grid data inside loops */
+typedef struct GridDataView_ GridDataView;
+
 /* structure used to store grid data */
 struct GridData_	{
 	EnumGridType 	gtype;			/* enumeration of possible grid data types */
 	GridArray 		* arr;			/* underlying two dimensional array of data */
 	GridHeaderInfo 	* ghdr;			/* structure storing header information */
 	GridFileInfo 	* gfinfo;		/* (optional) structure storing file information */
+	GridTiles		* tiles;		/* (optional) cells read from tiled file on demand, arr is NULL when set */
 	};
 
 union GridArray_	{
@@ -118,6 +135,17 @@ struct GridFileInfo_		{
 	EnumGridFormat gfmt;			/* enumeration of possible grid formats */
 	long int main_file_sz;			/* file size of main data file- for ascii files this includes header */
 	long int bytes_read;			/* number of bytes read so far from main_file */
+	void * map;						/* (optional) main_file mapped into memory, NULL if not mapped */
+	size_t map_sz;					/* (optional) number of bytes of main_file mapped into memory */
+	};
+
+/* grid data type and cell values of a GridData resolved once, rather than at each cell accessed */
+struct GridDataView_	{
+	EnumGridType gtype;				/* enumeration of possible grid data types */
+	int nrows;						/* number of rows in the dataset */
+	int ncols;						/* number of columns in the dataset */
+	void * cells;					/* cell values of gtype in row-major order, NULL if cells are tiled */
+	GridData * gd;					/* grid data viewed */
 	};
 
 /*
@@ -126,9 +154,94 @@ struct GridFileInfo_		{
  *********************************************************
  */
 
+/* retrieves cell of GridData whose cells are read from a tiled file on demand, terminates if cell cannot be read */
+#define GRID_DATA_GET_TILED_DATA(gd, row, col, data)	do	{										\
+			switch((gd)->gtype)	{																\
+				case EnumByteGrid:	{															\
+					unsigned char tv_ = 0;														\
+					if ( GridTilesGetCell((gd)->tiles, (row), (col), &tv_) != ERR_SUCCESS )		\
+						ERR_ERROR_CONTINUE("Unable to read cell of tiled GridData. \n", ERR_EIOFAIL);	\
+					(data) = tv_;																\
+					}																			\
+					break;																		\
+				case EnumIntGrid:	{															\
+					int tv_ = 0;																\
+					if ( GridTilesGetCell((gd)->tiles, (row), (col), &tv_) != ERR_SUCCESS )		\
+						ERR_ERROR_CONTINUE("Unable to read cell of tiled GridData. \n", ERR_EIOFAIL);	\
+					(data) = tv_;																\
+					}																			\
+					break;																		\
+				case EnumLIntGrid:	{															\
+					long int tv_ = 0;															\
+					if ( GridTilesGetCell((gd)->tiles, (row), (col), &tv_) != ERR_SUCCESS )		\
+						ERR_ERROR_CONTINUE("Unable to read cell of tiled GridData. \n", ERR_EIOFAIL);	\
+					(data) = tv_;																\
+					}																			\
+					break;																		\
+				case EnumFltGrid:	{															\
+					float tv_ = 0;																\
+					if ( GridTilesGetCell((gd)->tiles, (row), (col), &tv_) != ERR_SUCCESS )		\
+						ERR_ERROR_CONTINUE("Unable to read cell of tiled GridData. \n", ERR_EIOFAIL);	\
+					(data) = tv_;																\
+					}																			\
+					break;																		\
+				case EnumDblGrid:	{															\
+					double tv_ = 0;																\
+					if ( GridTilesGetCell((gd)->tiles, (row), (col), &tv_) != ERR_SUCCESS )		\
+						ERR_ERROR_CONTINUE("Unable to read cell of tiled GridData. \n", ERR_EIOFAIL);	\
+					(data) = tv_;																\
+					}																			\
+					break;																		\
+				default:																		\
+					(data) = 0;																	\
+					ERR_ERROR_CONTINUE("GridData type not supported. \n", ERR_EUNIMPL);			\
+				}																				\
+		}	while(0)
+
+/* stores cell of GridData whose cells are read from a tiled file on demand, terminates if cell cannot be written */
+#define GRID_DATA_SET_TILED_DATA(gd, row, col, data)	do	{										\
+			switch((gd)->gtype)	{																\
+				case EnumByteGrid:	{															\
+					unsigned char tv_ = (unsigned char) (data);									\
+					if ( GridTilesSetCell((gd)->tiles, (row), (col), &tv_) != ERR_SUCCESS )		\
+						ERR_ERROR_CONTINUE("Unable to write cell of tiled GridData. \n", ERR_EIOFAIL);	\
+					}																			\
+					break;																		\
+				case EnumIntGrid:	{															\
+					int tv_ = (int) (data);														\
+					if ( GridTilesSetCell((gd)->tiles, (row), (col), &tv_) != ERR_SUCCESS )		\
+						ERR_ERROR_CONTINUE("Unable to write cell of tiled GridData. \n", ERR_EIOFAIL);	\
+					}																			\
+					break;																		\
+				case EnumLIntGrid:	{															\
+					long int tv_ = (long int) (data);											\
+					if ( GridTilesSetCell((gd)->tiles, (row), (col), &tv_) != ERR_SUCCESS )		\
+						ERR_ERROR_CONTINUE("Unable to write cell of tiled GridData. \n", ERR_EIOFAIL);	\
+					}																			\
+					break;																		\
+				case EnumFltGrid:	{															\
+					float tv_ = (float) (data);													\
+					if ( GridTilesSetCell((gd)->tiles, (row), (col), &tv_) != ERR_SUCCESS )		\
+						ERR_ERROR_CONTINUE("Unable to write cell of tiled GridData. \n", ERR_EIOFAIL);	\
+					}																			\
+					break;																		\
+				case EnumDblGrid:	{															\
+					double tv_ = (double) (data);												\
+					if ( GridTilesSetCell((gd)->tiles, (row), (col), &tv_) != ERR_SUCCESS )		\
+						ERR_ERROR_CONTINUE("Unable to write cell of tiled GridData. \n", ERR_EIOFAIL);	\
+					}																			\
+					break;																		\
+				default:																		\
+					ERR_ERROR_CONTINUE("GridData type not supported. \n", ERR_EUNIMPL);			\
+				}																				\
+		}	while(0)
+
 /* implements a polymorphic type dispatch system using GridData */
 #define GRID_DATA_GET_DATA(gd, row, col, data)		do	{							\
-			switch((gd)->gtype)	{													\
+			if ( (gd)->tiles != NULL )	{											\
+				GRID_DATA_GET_TILED_DATA(gd, row, col, data);						\
+				}																	\
+			else switch((gd)->gtype)	{													\
 				case EnumByteGrid:													\
 					(data) = BYTETWODARRAY_GET_DATA((gd)->arr->ba, (row), (col));	\
 					break;															\
@@ -144,12 +257,18 @@ struct GridFileInfo_		{
 				case EnumDblGrid:													\
 					(data) = DBLTWODARRAY_GET_DATA((gd)->arr->da, (row), (col));	\
 					break;															\
+				default:															\
+					(data) = 0;														\
+					ERR_ERROR_CONTINUE("GridData type not supported. \n", ERR_EUNIMPL);	\
 				}																	\
 		}	while(0)
 
 /* implements a polymorphic type dispatch system using GridData */
 #define GRID_DATA_SET_DATA(gd, row, col, data)		do	{										\
-			switch((gd)->gtype)	{																\
+			if ( (gd)->tiles != NULL )	{														\
+				GRID_DATA_SET_TILED_DATA(gd, row, col, data);									\
+				}																				\
+			else switch((gd)->gtype)	{																\
 				case EnumByteGrid:																\
 					BYTETWODARRAY_SET_DATA((gd)->arr->ba, (row), (col), (unsigned char) (data));\
 					break;																		\
@@ -165,9 +284,71 @@ struct GridFileInfo_		{
 				case EnumDblGrid:																\
 					DBLTWODARRAY_SET_DATA((gd)->arr->da, (row), (col), (double) (data));		\
 					break;																		\
+				default:																		\
+					ERR_ERROR_CONTINUE("GridData type not supported. \n", ERR_EUNIMPL);			\
 				}																				\
 		}	while(0)
 
+/* typed access to cells of a GridDataView, valid only when gtype of the view is known and cells not tiled */
+#define GRID_DATA_VIEW_DBL(v, row, col)		(((double *) (v)->cells)[(row) * (v)->ncols + (col)])
+#define GRID_DATA_VIEW_FLT(v, row, col)		(((float *) (v)->cells)[(row) * (v)->ncols + (col)])
+#define GRID_DATA_VIEW_LINT(v, row, col)	(((long int *) (v)->cells)[(row) * (v)->ncols + (col)])
+#define GRID_DATA_VIEW_INT(v, row, col)		(((int *) (v)->cells)[(row) * (v)->ncols + (col)])
+#define GRID_DATA_VIEW_BYTE(v, row, col)	(((unsigned char *) (v)->cells)[(row) * (v)->ncols + (col)])
+
+/* 
+ * expands KERNEL(ctype, cells) once for each grid data type, with cells a ptr to the cell values of
+ * the view as ctype, so a loop inside KERNEL is compiled for each type without dispatch at each cell
+ */
+#define GRID_DATA_VIEW_DISPATCH(v, KERNEL)			do	{									\
+			switch((v)->gtype)	{															\
+				case EnumByteGrid:															\
+					KERNEL(unsigned char, ((unsigned char *) (v)->cells));					\
+					break;																	\
+				case EnumIntGrid:															\
+					KERNEL(int, ((int *) (v)->cells));										\
+					break;																	\
+				case EnumLIntGrid:															\
+					KERNEL(long int, ((long int *) (v)->cells));							\
+					break;																	\
+				case EnumFltGrid:															\
+					KERNEL(float, ((float *) (v)->cells));									\
+					break;																	\
+				case EnumDblGrid:															\
+					KERNEL(double, ((double *) (v)->cells));								\
+					break;																	\
+				default:																	\
+					ERR_ERROR_CONTINUE("GridData type not supported. \n", ERR_EUNIMPL);		\
+				}																			\
+		}	while(0)
+
+/* retrieves cell of GridDataView, for access at random cells where a KERNEL is not practical */
+#define GRID_DATA_VIEW_GET_DATA(v, row, col, data)	do	{									\
+			if ( (v)->cells == NULL )	{													\
+				GRID_DATA_GET_DATA((v)->gd, row, col, data);								\
+				}																			\
+			else switch((v)->gtype)	{														\
+				case EnumByteGrid:															\
+					(data) = GRID_DATA_VIEW_BYTE(v, row, col);								\
+					break;																	\
+				case EnumIntGrid:															\
+					(data) = GRID_DATA_VIEW_INT(v, row, col);								\
+					break;																	\
+				case EnumLIntGrid:															\
+					(data) = GRID_DATA_VIEW_LINT(v, row, col);								\
+					break;																	\
+				case EnumFltGrid:															\
+					(data) = GRID_DATA_VIEW_FLT(v, row, col);								\
+					break;																	\
+				case EnumDblGrid:															\
+					(data) = GRID_DATA_VIEW_DBL(v, row, col);								\
+					break;																	\
+				default:																	\
+					(data) = 0;																\
+					ERR_ERROR_CONTINUE("GridData type not supported. \n", ERR_EUNIMPL);		\
+				}																			\
+		}	while(0)
+
 /*
  *********************************************************
  * PUBLIC FUNCTIONS
@@ -177,6 +358,15 @@ struct GridFileInfo_		{
 /* INITIALIZATION */
 GridData * InitGridDataFromBinaryRaster			(char * main_fname, char * header_fname, EnumGridType grid_type);
 GridData * InitGridDataFromAsciiRaster			(char * main_fname, EnumGridType grid_type);
+GridData * InitGridDataFromBinaryRasterTiles	(char * main_fname, char * header_fname, EnumGridType grid_type, 
+													int cache_mb);
+
+int InitGridDataView							(GridData * gd, GridDataView * view);
+
+/* BULK ACCESS */
+int GetRowAsDblGridData							(GridData * gd, int row, double * vals);
+int GetRowAsLIntGridData						(GridData * gd, int row, long int * vals);
+int GetRowAsIntGridData							(GridData * gd, int row, int * vals);
 
 /* DATA EXPORT */
 int ExportGridDataAsBinaryRaster				(GridData * gd, char * main_fname);
@@ -222,6 +412,7 @@ GridData * InitGridDataFromByteTwoDArray		(ByteTwoDArray * arr,double xll, doubl
 GridHeaderInfo * InitGridHeaderInfoFromFile		(GridFileInfo * gfinfo);
 GridHeaderInfo * InitGridHeaderInfoFromArgs 	(int nrows, int ncols,double xll, double yll, int cellsz, int nodata,
  													int ismsb);
+int IsHostMsbFirstGridData						(void);
 
 /* DATA IMPORT */
 DblTwoDArray * ImportBinaryRasterAsDblTwoDArray	(GridFileInfo * gfinfo, GridHeaderInfo * ghdr);
@@ -0,0 +1,422 @@
+#include "GridDataCache.h"
+
+static int GetElemSizeGridDataCache(EnumGridType grid_type);
+static void * GetFlatGridDataCache(GridData * gd);
+static char * GetFilenameGridDataCache(char * main_fname, char * cache_dir);
+static GridData * ImportGridDataCache(char * main_fname, char * cache_fname, EnumGridType grid_type,
+										long int src_sz, unsigned long int src_checksum);
+static int ExportGridDataCache(GridData * gd, char * cache_fname, long int src_sz, unsigned long int src_checksum);
+
+/*
+ * Visibility:
+ * global
+ *
+ * Description:
+ * Initializes GridData from an ascii raster, using a binary cache of the raster when one exists.
+ * The cache holds the header and cell values of the raster along with the size and checksum
+ * of the ascii raster it was created from.  When these match the current ascii raster the cache
+ * is mapped into memory in place of parsing the raster, otherwise the raster is parsed and a new
+ * cache is written for use by later runs.  Caches are written to a temporary file which is
+ * renamed once complete, so concurrent runs sharing a cache directory never read a partial cache.
+ * Failure to write a cache is reported as a warning, and caching is bypassed on hosts without
+ * memory mapped files.
+ *
+ * Arguments:
+ * main_fname- name of ascii raster
+ * cache_dir- directory holding cache files, or NULL to write cache next to ascii raster
+ * grid_type- enumeration of grid data type
+ *
+ * Returns:
+ * ptr to GridData, or NULL if unable to initialize
+ */
+GridData * InitGridDataFromAsciiRasterCache(char * main_fname, char * cache_dir, EnumGridType grid_type)	{
+	GridData * gd 				= NULL;
+#ifdef USING_UNIX
+	char * cache_fname 			= NULL;
+	unsigned long int checksum 	= 0;
+	long int fsize 				= 0;
+
+	/* check args */
+	if ( main_fname == NULL )	{
+		ERR_ERROR_CONTINUE("Must supply a main filename to initialize GridData. \n", ERR_EINVAL);
+		return gd;
+		}
+
+	/* unreadable rasters are reported when parsed */
+	if ( GetElemSizeGridDataCache(grid_type) == 0
+			|| GetChecksumGridDataCache(main_fname, &fsize, &checksum)
+			|| (cache_fname = GetFilenameGridDataCache(main_fname, cache_dir)) == NULL )	{
+		return InitGridDataFromAsciiRaster(main_fname, grid_type);
+		}
+
+	if ( (gd = ImportGridDataCache(main_fname, cache_fname, grid_type, fsize, checksum)) == NULL )	{
+		if ( (gd = InitGridDataFromAsciiRaster(main_fname, grid_type)) != NULL
+				&& ExportGridDataCache(gd, cache_fname, fsize, checksum) )	{
+			err_warning("Unable to write grid cache file, raster will be parsed on next run. \n", __FILE__, __LINE__, ERR_WARNING);
+			}
+		}
+	free(cache_fname);
+#else
+	gd = InitGridDataFromAsciiRaster(main_fname, grid_type);
+#endif
+
+	return gd;
+	}
+
+/*
+ * Visibility:
+ * global
+ *
+ * Description:
+ * Computes the size and Adler-32 checksum of the contents of a file.
+ *
+ * Arguments:
+ * fname- name of file
+ * fsize- receives size of file, in bytes
+ * checksum- receives checksum of file
+ *
+ * Returns:
+ * ERR_SUCCESS(0) if operation successful, an error code otherwise
+ */
+int GetChecksumGridDataCache(char * fname, long int * fsize, unsigned long int * checksum)	{
+	FILE * fstream 			= NULL;
+	unsigned char * buff 	= NULL;
+	unsigned long int a = 1, b = 0;
+	size_t n, k, j, blk;
+
+	/* check args */
+	if ( fname == NULL || fsize == NULL || checksum == NULL )	{
+		ERR_ERROR("Arguments supplied to compute grid cache checksum not initialized. \n", ERR_EINVAL);
+		}
+	if ( (fstream = fopen(fname, "rb")) == NULL )	{
+		return ERR_EIOFAIL;
+		}
+	if ( (buff = (unsigned char *) malloc(sizeof(unsigned char) * GRIDDATA_CACHE_CHECKSUM_BUFFER_SZ)) == NULL )	{
+		fclose(fstream);
+		ERR_ERROR("Unable to allocate memory for grid cache checksum. \n", ERR_ENOMEM);
+		}
+
+	*fsize = 0;
+	while ( (n = fread(buff, sizeof(unsigned char), GRIDDATA_CACHE_CHECKSUM_BUFFER_SZ, fstream)) > 0 )	{
+		*fsize += (long int) n;
+		/* largest number of bytes summed before the sums can exceed 32 bits */
+		for(k = 0; k < n; k += blk)	{
+			blk = ( n - k < 5552 ) ? n - k : 5552;
+			for(j = k; j < k + blk; j++)	{
+				a += buff[j];
+				b += a;
+				}
+			a %= 65521UL;
+			b %= 65521UL;
+			}
+		}
+	*checksum = (b << 16) | a;
+
+	free(buff);
+	fclose(fstream);
+
+	return ERR_SUCCESS;
+	}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Size of each cell value of grid type, as stored in cache files.
+ *
+ * Arguments:
+ * grid_type- enumeration of grid data type
+ *
+ * Returns:
+ * size of cell value in bytes, or 0 if grid type cannot be cached
+ */
+static int GetElemSizeGridDataCache(EnumGridType grid_type)	{
+	switch(grid_type)	{
+		case EnumDblGrid:
+			return sizeof(double);
+		case EnumFltGrid:
+			return sizeof(float);
+		case EnumLIntGrid:
+			return sizeof(long int);
+		case EnumIntGrid:
+			return sizeof(int);
+		case EnumByteGrid:
+			return sizeof(unsigned char);
+		default:
+			break;
+		}
+
+	return 0;
+	}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Ptr to the contiguous row-major cell values of the array underlying GridData.
+ *
+ * Arguments:
+ * gd- GridData
+ *
+ * Returns:
+ * ptr to first cell value, or NULL if grid type cannot be cached
+ */
+static void * GetFlatGridDataCache(GridData * gd)	{
+	switch(gd->gtype)	{
+		case EnumDblGrid:
+			return DBLTWODARRAY_GET_FLAT(gd->arr->da);
+		case EnumFltGrid:
+			return FLTTWODARRAY_GET_FLAT(gd->arr->fa);
+		case EnumLIntGrid:
+			return LINTTWODARRAY_GET_FLAT(gd->arr->lia);
+		case EnumIntGrid:
+			return INTTWODARRAY_GET_FLAT(gd->arr->ia);
+		case EnumByteGrid:
+			return BYTETWODARRAY_GET_FLAT(gd->arr->ba);
+		default:
+			break;
+		}
+
+	return NULL;
+	}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Names the cache file of an ascii raster.  The cache is named by appending GRIDDATA_CACHE_EXTENSION
+ * to the name of the raster, and placed in cache_dir when supplied.  Rasters of the same name in
+ * different directories share a cache file in cache_dir, which is rewritten whenever the raster
+ * it was created from does not match the raster being loaded.
+ *
+ * Arguments:
+ * main_fname- name of ascii raster
+ * cache_dir- directory holding cache files, or NULL to place cache next to ascii raster
+ *
+ * Returns:
+ * name of cache file which must be freed by caller, or NULL if memory not allocated
+ */
+static char * GetFilenameGridDataCache(char * main_fname, char * cache_dir)	{
+	char * cache_fname 	= NULL;
+	char * base 		= main_fname;
+	char * sep 			= NULL;
+
+	if ( cache_dir == NULL )	{
+		if ( (cache_fname = (char *) malloc(sizeof(char) * (strlen(main_fname) + strlen(GRIDDATA_CACHE_EXTENSION) + 1))) != NULL )	{
+			sprintf(cache_fname, "%s%s", main_fname, GRIDDATA_CACHE_EXTENSION);
+			}
+		return cache_fname;
+		}
+
+	if ( (sep = strrchr(base, '/')) != NULL )	{
+		base = sep + 1;
+		}
+	if ( (sep = strrchr(base, '\\')) != NULL )	{
+		base = sep + 1;
+		}
+	if ( (cache_fname = (char *) malloc(sizeof(char) * (strlen(cache_dir) + strlen(base) + strlen(GRIDDATA_CACHE_EXTENSION) + 2))) != NULL )	{
+		sprintf(cache_fname, "%s/%s%s", cache_dir, base, GRIDDATA_CACHE_EXTENSION);
+		}
+
+	return cache_fname;
+	}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Maps a cache file into memory and initializes GridData with arrays viewing the cell values of
+ * the mapping.  The mapping is private, so cell values modified during the simulation are never
+ * carried to the cache file.  The mapping is stored in the GridFileInfo and released when the
+ * GridData is freed.
+ *
+ * Arguments:
+ * main_fname- name of ascii raster
+ * cache_fname- name of cache file
+ * grid_type- enumeration of grid data type
+ * src_sz- size of ascii raster, in bytes
+ * src_checksum- checksum of ascii raster
+ *
+ * Returns:
+ * ptr to GridData, or NULL if the cache file is missing, stale, or could not be mapped
+ */
+static GridData * ImportGridDataCache(char * main_fname, char * cache_fname, EnumGridType grid_type,
+										long int src_sz, unsigned long int src_checksum)	{
+#ifdef USING_UNIX
+	GridDataCacheHeader hdr;
+	struct stat st;
+	GridData * gd 	= NULL;
+	void * addr 	= MAP_FAILED;
+	void * data 	= NULL;
+	size_t map_sz 	= 0;
+	int elem_sz 	= GetElemSizeGridDataCache(grid_type);
+	int is_valid;
+	int fd;
+
+	if ( (fd = open(cache_fname, O_RDONLY)) == -1 )	{
+		return NULL;
+		}
+	is_valid = ( read(fd, &hdr, sizeof(GridDataCacheHeader)) == sizeof(GridDataCacheHeader)
+					&& fstat(fd, &st) == 0
+					&& memcmp(hdr.magic, GRIDDATA_CACHE_MAGIC, sizeof(hdr.magic)) == 0
+					&& hdr.version == GRIDDATA_CACHE_VERSION
+					&& hdr.byte_order == GRIDDATA_CACHE_BYTE_ORDER_MARK
+					&& hdr.gtype == grid_type
+					&& hdr.elem_sz == elem_sz
+					&& hdr.src_sz == src_sz
+					&& hdr.src_checksum == src_checksum
+					&& hdr.nrows > 0 && hdr.ncols > 0 );
+	if ( is_valid )	{
+		map_sz = GRIDDATA_CACHE_HEADER_SZ + (size_t) hdr.nrows * hdr.ncols * elem_sz;
+		if ( (size_t) st.st_size == map_sz )	{
+			addr = mmap(NULL, map_sz, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+			}
+		}
+	close(fd);
+	if ( addr == MAP_FAILED )	{
+		return NULL;
+		}
+	data = (char *) addr + GRIDDATA_CACHE_HEADER_SZ;
+
+	if ( (gd = (GridData *) malloc(sizeof(GridData))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to initialize GridData, memory allocation failed. \n", ERR_ENOMEM);
+		munmap(addr, map_sz);
+		return gd;
+		}
+	gd->gtype = grid_type;
+	gd->arr = NULL;
+	gd->ghdr = NULL;
+	gd->tiles = NULL;
+	if ( (gd->gfinfo = (GridFileInfo *) malloc(sizeof(GridFileInfo))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to initialize GridFileInfo, memory allocation failed. \n", ERR_ENOMEM);
+		munmap(addr, map_sz);
+		free(gd);
+		return NULL;
+		}
+	gd->gfinfo->gfmt = EnumAsciiGrid;
+	gd->gfinfo->header_file = NULL;
+	gd->gfinfo->main_file_sz = src_sz;
+	gd->gfinfo->bytes_read = hdr.src_bytes_read;
+	gd->gfinfo->map = addr;
+	gd->gfinfo->map_sz = map_sz;
+	if ( (gd->gfinfo->main_file = (char *) malloc(sizeof(char) * (strlen(main_fname) + 1))) == NULL
+			|| (gd->arr = (GridArray *) calloc(1, sizeof(GridArray))) == NULL
+			|| (gd->ghdr = InitGridHeaderInfoFromArgs(hdr.nrows, hdr.ncols, hdr.xllcorner, hdr.yllcorner,
+											hdr.cellsize, hdr.NODATA_value, IsHostMsbFirstGridData())) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to initialize GridData from cache, memory allocation failed. \n", ERR_ENOMEM);
+		FreeGridData(gd);
+		return NULL;
+		}
+	strcpy(gd->gfinfo->main_file, main_fname);
+
+	/* arrays view the mapping without copying */
+	switch(grid_type)	{
+		case EnumDblGrid:
+			gd->arr->da = InitDblTwoDArraySizeBuffer(hdr.nrows, hdr.ncols, (double *) data);
+			break;
+		case EnumFltGrid:
+			gd->arr->fa = InitFltTwoDArraySizeBuffer(hdr.nrows, hdr.ncols, (float *) data);
+			break;
+		case EnumLIntGrid:
+			gd->arr->lia = InitLIntTwoDArraySizeBuffer(hdr.nrows, hdr.ncols, (long int *) data);
+			break;
+		case EnumIntGrid:
+			gd->arr->ia = InitIntTwoDArraySizeBuffer(hdr.nrows, hdr.ncols, (int *) data);
+			break;
+		case EnumByteGrid:
+			gd->arr->ba = InitByteTwoDArraySizeBuffer(hdr.nrows, hdr.ncols, (unsigned char *) data);
+			break;
+		default:
+			gd->arr->da = NULL;
+			break;
+		}
+	if ( gd->arr->da == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to load array for GridData from cache. \n", ERR_EFAILED);
+		FreeGridData(gd);
+		return NULL;
+		}
+
+	return gd;
+#else
+	return NULL;
+#endif
+	}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Writes the header and cell values of GridData parsed from an ascii raster to a cache file.
+ *
+ * Arguments:
+ * gd- GridData initialized from ascii raster
+ * cache_fname- name of cache file
+ * src_sz- size of ascii raster, in bytes
+ * src_checksum- checksum of ascii raster
+ *
+ * Returns:
+ * ERR_SUCCESS(0) if operation successful, an error code otherwise
+ */
+static int ExportGridDataCache(GridData * gd, char * cache_fname, long int src_sz, unsigned long int src_checksum)	{
+#ifdef USING_UNIX
+	GridDataCacheHeader hdr;
+	char block[GRIDDATA_CACHE_HEADER_SZ];
+	FILE * fstream 		= NULL;
+	char * tmp_fname 	= NULL;
+	void * flat 		= NULL;
+	size_t ncells;
+	int is_written;
+
+	if ( (flat = GetFlatGridDataCache(gd)) == NULL )	{
+		return ERR_EINVAL;
+		}
+
+	memset(&hdr, 0, sizeof(GridDataCacheHeader));
+	memcpy(hdr.magic, GRIDDATA_CACHE_MAGIC, sizeof(hdr.magic));
+	hdr.version = GRIDDATA_CACHE_VERSION;
+	hdr.byte_order = GRIDDATA_CACHE_BYTE_ORDER_MARK;
+	hdr.gtype = gd->gtype;
+	hdr.elem_sz = GetElemSizeGridDataCache(gd->gtype);
+	hdr.nrows = gd->ghdr->nrows;
+	hdr.ncols = gd->ghdr->ncols;
+	hdr.cellsize = gd->ghdr->cellsize;
+	hdr.NODATA_value = gd->ghdr->NODATA_value;
+	hdr.xllcorner = gd->ghdr->xllcorner;
+	hdr.yllcorner = gd->ghdr->yllcorner;
+	hdr.src_sz = src_sz;
+	hdr.src_checksum = src_checksum;
+	hdr.src_bytes_read = gd->gfinfo->bytes_read;
+	memset(block, 0, GRIDDATA_CACHE_HEADER_SZ);
+	memcpy(block, &hdr, sizeof(GridDataCacheHeader));
+	ncells = (size_t) hdr.nrows * hdr.ncols;
+
+	/* temporary file is unique to this process and grid, threads may write the same cache at once */
+	if ( (tmp_fname = (char *) malloc(sizeof(char) * (strlen(cache_fname) + 48))) == NULL )	{
+		return ERR_ENOMEM;
+		}
+	sprintf(tmp_fname, "%s.%ld.%lx", cache_fname, (long int) getpid(), (unsigned long int) gd);
+	if ( (fstream = fopen(tmp_fname, "wb")) == NULL )	{
+		free(tmp_fname);
+		return ERR_EIOFAIL;
+		}
+	is_written = ( fwrite(block, sizeof(char), GRIDDATA_CACHE_HEADER_SZ, fstream) == GRIDDATA_CACHE_HEADER_SZ
+					&& fwrite(flat, hdr.elem_sz, ncells, fstream) == ncells );
+	if ( fclose(fstream) != 0 || ! is_written || rename(tmp_fname, cache_fname) != 0 )	{
+		remove(tmp_fname);
+		free(tmp_fname);
+		return ERR_EIOFAIL;
+		}
+	free(tmp_fname);
+
+	return ERR_SUCCESS;
+#else
+	return ERR_EUNSUP;
+#endif
+	}
+
+/* end of GridDataCache.c */
@@ -0,0 +1,91 @@
+#ifndef	GridDataCache_H
+#define GridDataCache_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef USING_UNIX
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "GridData.h"
+#include "Err.h"
+
+/*
+ *********************************************************
+ * DEFINES, ENUMS
+ *********************************************************
+ */
+
+/* first bytes of every cache file */
+#define GRIDDATA_CACHE_MAGIC					("HFGC")
+
+/* incremented whenever the layout of cache files changes */
+#define GRIDDATA_CACHE_VERSION					(1)
+
+/* appended to the filename of the ascii raster to name its cache file */
+#define GRIDDATA_CACHE_EXTENSION				(".gdc")
+
+/* bytes reserved at the start of cache files for the header, cell values start at this offset */
+#define GRIDDATA_CACHE_HEADER_SZ				(4096)
+
+/* number of bytes of ascii raster read at once when computing its checksum */
+#define GRIDDATA_CACHE_CHECKSUM_BUFFER_SZ		(1 << 20)
+
+/* written as an unsigned int to detect caches created on a host with different byte order */
+#define GRIDDATA_CACHE_BYTE_ORDER_MARK			(0x01020304UL)
+
+/*
+ *********************************************************
+ * STRUCTS, TYPEDEFS
+ *********************************************************
+ */
+
+typedef struct GridDataCacheHeader_ GridDataCacheHeader;
+
+/* stored in host byte order at the start of cache files */
+struct GridDataCacheHeader_	{
+	char magic[4];					/* GRIDDATA_CACHE_MAGIC */
+	int version;					/* GRIDDATA_CACHE_VERSION */
+	unsigned int byte_order;		/* GRIDDATA_CACHE_BYTE_ORDER_MARK */
+	int gtype;						/* EnumGridType of cell values */
+	int elem_sz;					/* size of each cell value, in bytes */
+	int nrows;						/* number of rows in the dataset */
+	int ncols;						/* number of columns in the dataset */
+	int cellsize;					/* cellsize in map units */
+	int NODATA_value;				/* value of cells containing NODATA */
+	double xllcorner;				/* x cordinate of lower left corner */
+	double yllcorner;				/* y coordinate of lower left corner */
+	long int src_sz;				/* size of ascii raster, in bytes */
+	unsigned long int src_checksum;	/* Adler-32 checksum of contents of ascii raster */
+	long int src_bytes_read;		/* size of header of ascii raster, in bytes */
+	};
+
+/*
+ *********************************************************
+ * MACROS
+ *********************************************************
+ */
+
+/*
+ *********************************************************
+ * PUBLIC FUNCTIONS
+ *********************************************************
+ */
+
+GridData * InitGridDataFromAsciiRasterCache(char * main_fname, char * cache_dir, EnumGridType grid_type);
+
+int GetChecksumGridDataCache(char * fname, long int * fsize, unsigned long int * checksum);
+
+/*
+ *********************************************************
+ * NON PUBLIC FUNCTIONS
+ *********************************************************
+ */
+
+#endif GridDataCache_H		/* end of GridDataCache.h */
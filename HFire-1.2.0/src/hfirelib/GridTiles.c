@@ -0,0 +1,299 @@
+#include "GridTiles.h"
+
+static char * GetSlotGridTiles(GridTiles * gt, int row, int col, int is_write);
+static int LoadTileGridTiles(GridTiles * gt, int tile);
+
+/*
+ * Visibility:
+ * global
+ *
+ * Description:
+ * Opens a tiled grid file.  No tiles are read until cells are accessed.
+ *
+ * Arguments:
+ * tiles_fname- name of tiled grid file
+ * cache_mb- memory used by tiles held in memory, in MB, at least one tile is always held
+ * hdr- receives header of tiled grid file
+ *
+ * Returns:
+ * ptr to GridTiles, or NULL if file could not be read or memory not allocated
+ */
+GridTiles * InitGridTilesFromFile(char * tiles_fname, int cache_mb, GridTilesHeader * hdr)	{
+	GridTiles * gt = NULL;
+	size_t cache_sz;
+	int i;
+
+	/* check args */
+	if ( tiles_fname == NULL || hdr == NULL || ReadHeaderGridTiles(tiles_fname, hdr) )	{
+		ERR_ERROR_CONTINUE("Unable to read header of tiled grid file. \n", ERR_EIOFAIL);
+		return gt;
+		}
+
+	if ( (gt = (GridTiles *) malloc(sizeof(GridTiles))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to initialize GridTiles, memory allocation failed. \n", ERR_ENOMEM);
+		return gt;
+		}
+#ifdef USING_UNIX
+	pthread_mutex_init(&gt->lock, NULL);
+#endif
+	gt->scratch = NULL;
+	gt->elem_sz = hdr->elem_sz;
+	gt->nrows = hdr->nrows;
+	gt->ncols = hdr->ncols;
+	gt->tile_dim = hdr->tile_dim;
+	gt->ntile_cols = (hdr->ncols + hdr->tile_dim - 1) / hdr->tile_dim;
+	gt->ntiles = gt->ntile_cols * ((hdr->nrows + hdr->tile_dim - 1) / hdr->tile_dim);
+	gt->tile_sz = (size_t) hdr->tile_dim * hdr->tile_dim * hdr->elem_sz;
+	cache_sz = (size_t) (( cache_mb > 0 ) ? cache_mb : GRID_TILES_DEFAULT_CACHE_MB) * 1024 * 1024;
+	gt->nslots = ( cache_sz / gt->tile_sz < 1 ) ? 1 : (int) (cache_sz / gt->tile_sz);
+	if ( gt->nslots > gt->ntiles )	{
+		gt->nslots = gt->ntiles;
+		}
+	gt->nused = 0;
+	gt->clock = 0;
+	gt->slot_of_tile = NULL;
+	gt->is_scratch = NULL;
+	gt->tile_of_slot = NULL;
+	gt->is_dirty = NULL;
+	gt->last_use = NULL;
+	gt->data = NULL;
+	if ( (gt->fstream = fopen(tiles_fname, "rb")) == NULL
+			|| (gt->slot_of_tile = (int *) malloc(sizeof(int) * gt->ntiles)) == NULL
+			|| (gt->is_scratch = (unsigned char *) calloc(gt->ntiles, sizeof(unsigned char))) == NULL
+			|| (gt->tile_of_slot = (int *) malloc(sizeof(int) * gt->nslots)) == NULL
+			|| (gt->is_dirty = (unsigned char *) calloc(gt->nslots, sizeof(unsigned char))) == NULL
+			|| (gt->last_use = (unsigned long int *) calloc(gt->nslots, sizeof(unsigned long int))) == NULL
+			|| (gt->data = (char *) malloc(gt->tile_sz * gt->nslots)) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to initialize GridTiles, memory allocation failed. \n", ERR_ENOMEM);
+		FreeGridTiles(gt);
+		return NULL;
+		}
+	for(i = 0; i < gt->ntiles; i++)	{
+		gt->slot_of_tile[i] = GRID_TILES_NOT_RESIDENT;
+		}
+
+	return gt;
+	}
+
+/*
+ * Visibility:
+ * global
+ *
+ * Description:
+ * Copies the value of a cell into val, reading its tile if not in memory.
+ *
+ * Arguments:
+ * gt- GridTiles
+ * row- row of cell
+ * col- col of cell
+ * val- receives elem_sz bytes of cell value
+ *
+ * Returns:
+ * ERR_SUCCESS(0) if operation successful, an error code otherwise
+ */
+int GridTilesGetCell(GridTiles * gt, int row, int col, void * val)	{
+	char * cell = NULL;
+
+#ifdef USING_UNIX
+	pthread_mutex_lock(&gt->lock);
+#endif
+	if ( (cell = GetSlotGridTiles(gt, row, col, 0)) != NULL )	{
+		memcpy(val, cell, gt->elem_sz);
+		}
+#ifdef USING_UNIX
+	pthread_mutex_unlock(&gt->lock);
+#endif
+	if ( cell == NULL )	{
+		ERR_ERROR("Unable to retrieve cell of tiled grid. \n", ERR_EFAILED);
+		}
+
+	return ERR_SUCCESS;
+	}
+
+/*
+ * Visibility:
+ * global
+ *
+ * Description:
+ * Copies val into a cell, reading its tile if not in memory.
+ *
+ * Arguments:
+ * gt- GridTiles
+ * row- row of cell
+ * col- col of cell
+ * val- elem_sz bytes of new cell value
+ *
+ * Returns:
+ * ERR_SUCCESS(0) if operation successful, an error code otherwise
+ */
+int GridTilesSetCell(GridTiles * gt, int row, int col, const void * val)	{
+	char * cell = NULL;
+
+#ifdef USING_UNIX
+	pthread_mutex_lock(&gt->lock);
+#endif
+	if ( (cell = GetSlotGridTiles(gt, row, col, 1)) != NULL )	{
+		memcpy(cell, val, gt->elem_sz);
+		}
+#ifdef USING_UNIX
+	pthread_mutex_unlock(&gt->lock);
+#endif
+	if ( cell == NULL )	{
+		ERR_ERROR("Unable to store cell of tiled grid. \n", ERR_EFAILED);
+		}
+
+	return ERR_SUCCESS;
+	}
+
+/*
+ * Visibility:
+ * global
+ *
+ * Description:
+ * Reads and validates the header of a tiled grid file.
+ *
+ * Arguments:
+ * tiles_fname- name of tiled grid file
+ * hdr- receives header
+ *
+ * Returns:
+ * ERR_SUCCESS(0) if header read and created on a host of the same byte order, an error code otherwise
+ */
+int ReadHeaderGridTiles(char * tiles_fname, GridTilesHeader * hdr)	{
+	FILE * fstream = NULL;
+	int is_valid;
+
+	if ( tiles_fname == NULL || hdr == NULL || (fstream = fopen(tiles_fname, "rb")) == NULL )	{
+		return ERR_EIOFAIL;
+		}
+	is_valid = ( fread(hdr, sizeof(GridTilesHeader), 1, fstream) == 1
+					&& memcmp(hdr->magic, GRID_TILES_MAGIC, sizeof(hdr->magic)) == 0
+					&& hdr->version == GRID_TILES_VERSION
+					&& hdr->byte_order == GRID_TILES_BYTE_ORDER_MARK
+					&& hdr->nrows > 0 && hdr->ncols > 0 && hdr->tile_dim > 0 && hdr->elem_sz > 0 );
+	fclose(fstream);
+
+	return ( is_valid ) ? ERR_SUCCESS : ERR_EINVAL;
+	}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Locates a cell in the tiles held in memory, reading its tile if necessary.  Caller holds the lock.
+ *
+ * Arguments:
+ * gt- GridTiles
+ * row- row of cell
+ * col- col of cell
+ * is_write- 1 if cell will be modified, 0 otherwise
+ *
+ * Returns:
+ * ptr to cell value, or NULL if cell is outside grid or tile could not be read
+ */
+static char * GetSlotGridTiles(GridTiles * gt, int row, int col, int is_write)	{
+	int tile, slot;
+
+	if ( row < 0 || row >= gt->nrows || col < 0 || col >= gt->ncols )	{
+		return NULL;
+		}
+	tile = (row / gt->tile_dim) * gt->ntile_cols + col / gt->tile_dim;
+	if ( (slot = gt->slot_of_tile[tile]) == GRID_TILES_NOT_RESIDENT
+			&& (slot = LoadTileGridTiles(gt, tile)) == GRID_TILES_NOT_RESIDENT )	{
+		return NULL;
+		}
+	gt->last_use[slot] = ++gt->clock;
+	if ( is_write )	{
+		gt->is_dirty[slot] = 1;
+		}
+
+	return gt->data + slot * gt->tile_sz
+			+ ((size_t) (row % gt->tile_dim) * gt->tile_dim + col % gt->tile_dim) * gt->elem_sz;
+	}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Reads a tile into a free slot, or into the slot of the least recently used tile.  A modified
+ * tile evicted from its slot is written to the scratch file, and later read from there.
+ *
+ * Arguments:
+ * gt- GridTiles
+ * tile- index of tile
+ *
+ * Returns:
+ * slot holding tile, or GRID_TILES_NOT_RESIDENT if tile could not be read
+ */
+static int LoadTileGridTiles(GridTiles * gt, int tile)	{
+	FILE * fstream 	= NULL;
+	long int offset;
+	int slot, old, k;
+
+	if ( gt->nused < gt->nslots )	{
+		slot = gt->nused++;
+		}
+	else	{
+		for(slot = 0, k = 1; k < gt->nslots; k++)	{
+			if ( gt->last_use[k] < gt->last_use[slot] )	{
+				slot = k;
+				}
+			}
+		old = gt->tile_of_slot[slot];
+		if ( gt->is_dirty[slot] )	{
+			if ( (gt->scratch == NULL && (gt->scratch = tmpfile()) == NULL)
+					|| fseek(gt->scratch, (long int) old * gt->tile_sz, SEEK_SET)
+					|| fwrite(gt->data + slot * gt->tile_sz, gt->tile_sz, 1, gt->scratch) != 1 )	{
+				return GRID_TILES_NOT_RESIDENT;
+				}
+			gt->is_scratch[old] = 1;
+			gt->is_dirty[slot] = 0;
+			}
+		gt->slot_of_tile[old] = GRID_TILES_NOT_RESIDENT;
+		}
+
+	if ( gt->is_scratch[tile] )	{
+		fstream = gt->scratch;
+		offset = (long int) tile * gt->tile_sz;
+		}
+	else	{
+		fstream = gt->fstream;
+		offset = GRID_TILES_HEADER_SZ + (long int) tile * gt->tile_sz;
+		}
+	gt->tile_of_slot[slot] = tile;
+	if ( fseek(fstream, offset, SEEK_SET) || fread(gt->data + slot * gt->tile_sz, gt->tile_sz, 1, fstream) != 1 )	{
+		/* slot is reused by the next tile read */
+		gt->last_use[slot] = 0;
+		return GRID_TILES_NOT_RESIDENT;
+		}
+	gt->slot_of_tile[tile] = slot;
+
+	return slot;
+	}
+
+void FreeGridTiles(void * vptr)	{
+	GridTiles * gt = NULL;
+
+	if ( vptr != NULL )	{
+		gt = (GridTiles *) vptr;
+		if ( gt->fstream != NULL )			fclose(gt->fstream);
+		if ( gt->scratch != NULL )			fclose(gt->scratch);
+		if ( gt->slot_of_tile != NULL )		free(gt->slot_of_tile);
+		if ( gt->is_scratch != NULL )		free(gt->is_scratch);
+		if ( gt->tile_of_slot != NULL )		free(gt->tile_of_slot);
+		if ( gt->is_dirty != NULL )			free(gt->is_dirty);
+		if ( gt->last_use != NULL )			free(gt->last_use);
+		if ( gt->data != NULL )				free(gt->data);
+#ifdef USING_UNIX
+		pthread_mutex_destroy(&gt->lock);
+#endif
+		free(gt);
+		}
+	gt = NULL;
+
+	return;
+	}
+
+/* end of GridTiles.c */
@@ -0,0 +1,131 @@
+#ifndef	GridTiles_H
+#define GridTiles_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef USING_UNIX
+#include <pthread.h>
+#endif
+
+#include "Err.h"
+
+/*
+ *********************************************************
+ * DEFINES, ENUMS
+ *********************************************************
+ */
+
+/* first bytes of every tiled grid file */
+#define GRID_TILES_MAGIC						("HFGT")
+
+/* incremented whenever the layout of tiled grid files changes */
+#define GRID_TILES_VERSION						(1)
+
+/* appended to the filename of a raster to name its tiled grid file */
+#define GRID_TILES_EXTENSION					(".gdt")
+
+/* bytes reserved at the start of tiled grid files for the header, tiles start at this offset */
+#define GRID_TILES_HEADER_SZ					(4096)
+
+/* number of rows and columns in each tile */
+#define GRID_TILES_DEFAULT_DIM					(256)
+
+/* memory used by the tiles of a single grid when no limit is supplied, in MB */
+#define GRID_TILES_DEFAULT_CACHE_MB				(64)
+
+/* written as an unsigned int to detect tiled grids created on a host with different byte order */
+#define GRID_TILES_BYTE_ORDER_MARK				(0x01020304UL)
+
+/* slot of a tile which is not held in memory */
+#define GRID_TILES_NOT_RESIDENT					(-1)
+
+/*
+ *********************************************************
+ * STRUCTS, TYPEDEFS
+ *********************************************************
+ */
+
+typedef struct GridTilesHeader_ GridTilesHeader;
+
+typedef struct GridTiles_ GridTiles;
+
+/* stored in host byte order at the start of tiled grid files */
+struct GridTilesHeader_	{
+	char magic[4];					/* GRID_TILES_MAGIC */
+	int version;					/* GRID_TILES_VERSION */
+	unsigned int byte_order;		/* GRID_TILES_BYTE_ORDER_MARK */
+	int gtype;						/* enumeration of grid data type of cell values */
+	int elem_sz;					/* size of each cell value, in bytes */
+	int nrows;						/* number of rows in the dataset */
+	int ncols;						/* number of columns in the dataset */
+	int tile_dim;					/* number of rows and columns in each tile */
+	int cellsize;					/* cellsize in map units */
+	int NODATA_value;				/* value of cells containing NODATA */
+	double xllcorner;				/* x cordinate of lower left corner */
+	double yllcorner;				/* y coordinate of lower left corner */
+	long int src_sz;				/* size of raster tiles were created from, in bytes */
+	long int src_mtime;				/* modification time of raster tiles were created from */
+	};
+
+/*
+ * Tiles are stored in the file in row-major order of tiles, and cells within each tile in
+ * row-major order.  Tiles on the last row and column of tiles are padded to full size.
+ * Tiles are read into a fixed number of slots as cells are accessed, and the least recently
+ * used tile is evicted when all slots are full.  Tiles modified while in memory are written
+ * to a private scratch file when evicted, so the tiled file is never changed.
+ */
+struct GridTiles_	{
+	FILE * fstream;					/* tiled file opened for reading */
+	FILE * scratch;					/* (optional) modified tiles evicted from memory, NULL until needed */
+	int elem_sz;					/* size of each cell value, in bytes */
+	int nrows;						/* number of rows in the dataset */
+	int ncols;						/* number of columns in the dataset */
+	int tile_dim;					/* number of rows and columns in each tile */
+	int ntile_cols;					/* number of columns of tiles */
+	int ntiles;						/* number of tiles */
+	size_t tile_sz;					/* size of each tile, in bytes */
+	int * slot_of_tile;				/* slot holding each tile, GRID_TILES_NOT_RESIDENT if not in memory */
+	unsigned char * is_scratch;		/* 1 if latest copy of each tile is in scratch file */
+	int nslots;						/* maximum number of tiles in memory */
+	int nused;						/* number of slots holding tiles */
+	int * tile_of_slot;				/* tile held by each slot */
+	unsigned char * is_dirty;		/* 1 if tile held by each slot modified since read */
+	unsigned long int * last_use;	/* value of clock at last access of each slot */
+	unsigned long int clock;		/* incremented at each access */
+	char * data;					/* cell values of tiles in memory, nslots * tile_sz bytes */
+#ifdef USING_UNIX
+	pthread_mutex_t lock;			/* serializes access, tiles may be evicted by any thread */
+#endif
+	};
+
+/*
+ *********************************************************
+ * MACROS
+ *********************************************************
+ */
+
+/*
+ *********************************************************
+ * PUBLIC FUNCTIONS
+ *********************************************************
+ */
+
+GridTiles * InitGridTilesFromFile(char * tiles_fname, int cache_mb, GridTilesHeader * hdr);
+
+int GridTilesGetCell(GridTiles * gt, int row, int col, void * val);
+
+int GridTilesSetCell(GridTiles * gt, int row, int col, const void * val);
+
+int ReadHeaderGridTiles(char * tiles_fname, GridTilesHeader * hdr);
+
+void FreeGridTiles(void * vptr);
+
+/*
+ *********************************************************
+ * NON PUBLIC FUNCTIONS
+ *********************************************************
+ */
+
+#endif GridTiles_H		/* end of GridTiles.h */
@@ -16,6 +16,8 @@
  */
 IntTwoDArray * InitIntTwoDArraySizeEmpty(unsigned int num_rows, unsigned int num_cols)	{
 	IntTwoDArray * ia = NULL;
+	char * block = NULL;
+	size_t hdr;
 	int i;
 	
 	if ( num_rows < 1 || num_cols < 1 )	{
@@ -26,26 +28,18 @@ IntTwoDArray * InitIntTwoDArraySizeEmpty(unsigned int num_rows, unsigned int num
 		ERR_ERROR_CONTINUE("Unable to initialize array, memory allocation failed. \n", ERR_ENOMEM);
 		return ia;
 		}
-	if ( (ia->array = (int **) malloc(sizeof(int *) * num_rows)) == NULL ) {
+	/* row ptrs and elements share a single block, elements begin on an aligned boundary */
+	hdr = sizeof(int *) * num_rows + INTTWODARRAY_ALIGN - 1;
+	if ( (block = (char *) malloc(hdr + sizeof(int) * (size_t) num_rows * num_cols)) == NULL ) {
 		ERR_ERROR_CONTINUE("Unable to initialize array, memory allocation failed. \n", ERR_ENOMEM);
 		free(ia);
 		ia = NULL;
 		return ia;
 		}
+	ia->array = (int **) block;
+	ia->data = (int *) (block + hdr - ((size_t) (block + hdr) % INTTWODARRAY_ALIGN));
 	for(i = 0; i < num_rows; i++)	{
-		if ( (ia->array[i] = (int *) malloc(sizeof(int) * num_cols)) == NULL )	{
-			ERR_ERROR_CONTINUE("Unable to initialize array, memory allocation failed. \n", ERR_ENOMEM);
-			/* unwind and deallocate any rows that have been allocated to this point */
-			num_rows = i;
-			for ( i = 0; i < num_rows; i++)	{
-				free(ia->array[i]);
-				ia->array[i] = NULL;
-				}
-			free(ia->array);
-			free(ia);
-			ia = NULL;
-			return ia;			
-			}
+		ia->array[i] = ia->data + (size_t) i * num_cols;
 		}
 	ia->size_rows = num_rows;
 	ia->size_cols = num_cols;
@@ -71,20 +65,65 @@ IntTwoDArray * InitIntTwoDArraySizeEmpty(unsigned int num_rows, unsigned int num
  * NULL if memory not able to be allocated
  */
 IntTwoDArray * InitIntTwoDArraySizeIniValue(unsigned int num_rows, unsigned int num_cols, int initial_value)	{
-	int i, j;
+	int i;
 	IntTwoDArray * ia = InitIntTwoDArraySizeEmpty(num_rows, num_cols);
 	if ( ia == NULL )	{
 		ERR_ERROR_CONTINUE("Unable to initialize array elements to initial value. \n", ERR_WARNING);	
 		return ia;
 		}
-	for (i = 0; i < num_rows; i++)	{
-		for (j = 0; j < num_cols; j++)	{	
-			ia->array[i][j] = initial_value;
-			}
+	for (i = 0; i < num_rows * num_cols; i++)	{
+		ia->data[i] = initial_value;
 		}
 	return ia;
 	}
 
+/*
+ * Visibility:
+ * global
+ *
+ * Description:
+ * Allocate a TwoDArray object of user specified dimensions whose elements are stored in
+ * a buffer supplied by the caller, such as a memory mapped file.  Elements are not copied,
+ * the buffer must hold num_rows * num_cols elements in row-major order and must remain
+ * valid until the TwoDArray is freed.  Freeing the TwoDArray does not free the buffer.
+ *
+ * Arguments:
+ * num_rows- number of rows in new TwoDArray
+ * num_cols- number of columns in new TwoDArray
+ * buffer- elements of the new TwoDArray
+ *
+ * Returns:
+ * pointer to TwoDArray object or NULL if memory not able to be allocated
+ */
+IntTwoDArray * InitIntTwoDArraySizeBuffer(unsigned int num_rows, unsigned int num_cols, int * buffer)	{
+	IntTwoDArray * da = NULL;
+	int i;
+	
+	if ( num_rows < 1 || num_cols < 1 || buffer == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to initialize array, row and col sizes must be at least 1. \n", ERR_EINVAL);
+		return da;
+		}
+	if ( (da = (IntTwoDArray *) malloc(sizeof(IntTwoDArray))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to initialize array, memory allocation failed. \n", ERR_ENOMEM);
+		return da;
+		}
+	/* only the row ptrs are allocated, so freeing them leaves the buffer untouched */
+	if ( (da->array = (int **) malloc(sizeof(int *) * num_rows)) == NULL ) {
+		ERR_ERROR_CONTINUE("Unable to initialize array, memory allocation failed. \n", ERR_ENOMEM);
+		free(da);
+		da = NULL;
+		return da;
+		}
+	da->data = buffer;
+	for(i = 0; i < num_rows; i++)	{
+		da->array[i] = da->data + (size_t) i * num_cols;
+		}
+	da->size_rows = num_rows;
+	da->size_cols = num_cols;
+			
+	return da;
+	}
+
 /*
  * Visibility:
  * global
@@ -113,6 +152,30 @@ IntTwoDArray * InitIntTwoDArraySizeIniValue(unsigned int num_rows, unsigned int
 	return arr->array;
 	}
 
+/*
+ * Visibility:
+ * global
+ *
+ * Description:
+ * Retrieves the elements of the TwoDArray object as a single contiguous block.
+ * Element row,col is found at offset row * size_col + col, so bulk operations may
+ * traverse the whole array with a single index.  The block is aligned to INTTWODARRAY_ALIGN bytes.
+ * The ptr returned is the actual underlying storage, changes made will be permanent.
+ *
+ * Arguments:
+ * arr- the TwoDArray object
+ *
+ * Returns:
+ * ptr to first element of underlying array
+ */
+int * GetFlatIntTwoDArray(IntTwoDArray * arr)	{
+	if ( arr == NULL || arr->data == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to retrieve underlying array. \n", ERR_EINVAL);
+		return NULL;
+		}
+	return arr->data;
+	}
+
 /*
  * Visibility:
  * global
@@ -229,15 +292,9 @@ int SetDataIntTwoDArray(IntTwoDArray * arr, unsigned int row, unsigned int col,
  * None
  */	 	
 void FreeIntTwoDArray(IntTwoDArray * arr)	{
-	int i;
 	if ( arr != NULL )	{
 		if ( arr->array != NULL )	{
-			for ( i = 0; i < arr->size_rows; i++)	{
-				if ( arr->array[i] != NULL )	{
-					free(arr->array[i]);							/* free a row in the underlying array */
-					}
-				}
-			free(arr->array);										/* free the pointers to the rows */
+			free(arr->array);										/* free the row ptrs and elements */
 			}
 		free(arr);													/* free the TwoDArray structure */
 		}
@@ -10,6 +10,9 @@
  * DEFINES, ENUMS
  *********************************************************
  */
+
+/* alignment in bytes of the first element of the array */
+#define INTTWODARRAY_ALIGN							(64)
  
 /*
  *********************************************************
@@ -23,7 +26,8 @@ typedef struct IntTwoDArray_ IntTwoDArray;
 struct IntTwoDArray_	{
 	int size_rows;
 	int size_cols;
-	int ** array;
+	int ** array;					/* ptrs to the first element of each row */
+	int * data;					/* elements in row-major order, contiguous */
 	}; 
 
 /*
@@ -36,9 +40,11 @@ struct IntTwoDArray_	{
 
 #define INTTWODARRAY_SIZE_COL(arr)	 				((arr)->size_cols)
 
-#define INTTWODARRAY_GET_DATA(arr, row, col)		((arr)->array[(row)][(col)])
+#define INTTWODARRAY_GET_DATA(arr, row, col)		((arr)->data[(row) * (arr)->size_cols + (col)])
+
+#define INTTWODARRAY_SET_DATA(arr, row, col, val)	((arr)->data[(row) * (arr)->size_cols + (col)] = (val))
 
-#define INTTWODARRAY_SET_DATA(arr, row, col, data)	((arr)->array[(row)][(col)] = (data))
+#define INTTWODARRAY_GET_FLAT(arr)					((arr)->data)
 
 /*
  *********************************************************
@@ -50,8 +56,12 @@ IntTwoDArray * InitIntTwoDArraySizeEmpty(unsigned int num_rows, unsigned int num
 
 IntTwoDArray * InitIntTwoDArraySizeIniValue(unsigned int num_rows, unsigned int num_cols, int initial_value);
 
+IntTwoDArray * InitIntTwoDArraySizeBuffer(unsigned int num_rows, unsigned int num_cols, int * buffer);
+
 int ** GetUnderlyingIntTwoDArray(IntTwoDArray * arr);
 
+int * GetFlatIntTwoDArray(IntTwoDArray * arr);
+
 int GetSizeColIntTwoDArray(IntTwoDArray * arr);
 
 int GetSizeRowIntTwoDArray(IntTwoDArray * arr);
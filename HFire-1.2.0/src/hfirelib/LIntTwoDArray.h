@@ -10,6 +10,9 @@
  * DEFINES, ENUMS
  *********************************************************
  */
+
+/* alignment in bytes of the first element of the array */
+#define LINTTWODARRAY_ALIGN							(64)
  
 /*
  *********************************************************
@@ -23,7 +26,8 @@ typedef struct LIntTwoDArray_ LIntTwoDArray;
 struct LIntTwoDArray_	{
 	int size_rows;
 	int size_cols;
-	long int ** array;
+	long int ** array;					/* ptrs to the first element of each row */
+	long int * data;					/* elements in row-major order, contiguous */
 	}; 
 
 /*
@@ -36,9 +40,11 @@ struct LIntTwoDArray_	{
 
 #define LINTTWODARRAY_SIZE_COL(arr)	 				((arr)->size_cols)
 
-#define LINTTWODARRAY_GET_DATA(arr, row, col)		((arr)->array[(row)][(col)])
+#define LINTTWODARRAY_GET_DATA(arr, row, col)		((arr)->data[(row) * (arr)->size_cols + (col)])
+
+#define LINTTWODARRAY_SET_DATA(arr, row, col, val)	((arr)->data[(row) * (arr)->size_cols + (col)] = (val))
 
-#define LINTTWODARRAY_SET_DATA(arr, row, col, data)	((arr)->array[(row)][(col)] = (data))
+#define LINTTWODARRAY_GET_FLAT(arr)					((arr)->data)
 
 /*
  *********************************************************
@@ -50,8 +56,12 @@ LIntTwoDArray * InitLIntTwoDArraySizeEmpty(unsigned int num_rows, unsigned int n
 
 LIntTwoDArray * InitLIntTwoDArraySizeIniValue(unsigned int num_rows, unsigned int num_cols, long int initial_value);
 
+LIntTwoDArray * InitLIntTwoDArraySizeBuffer(unsigned int num_rows, unsigned int num_cols, long int * buffer);
+
 long int ** GetUnderlyingLIntTwoDArray(LIntTwoDArray * arr);
 
+long int * GetFlatLIntTwoDArray(LIntTwoDArray * arr);
+
 int GetSizeColLIntTwoDArray(LIntTwoDArray * arr);
 
 int GetSizeRowLIntTwoDArray(LIntTwoDArray * arr);
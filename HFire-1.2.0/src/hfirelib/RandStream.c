@@ -0,0 +1,284 @@
+#include "RandStream.h"
+
+/* multipliers and key increments of the Philox-4x32 bijection */
+#define RAND_STREAM_M0							(0xD2511F53UL)
+#define RAND_STREAM_M1							(0xCD9E8D57UL)
+#define RAND_STREAM_W0							(0x9E3779B9UL)
+#define RAND_STREAM_W1							(0xBB67AE85UL)
+
+#define RAND_STREAM_MASK32						(0xFFFFFFFFUL)
+
+/* 2^-32 */
+#define RAND_STREAM_INV_2POW32					(1.0 / 4294967296.0)
+
+/* block index of the counter reserved for deriving child streams, never reached by draws */
+#define RAND_STREAM_SPLIT_BLK					(0xFFFFFFFFUL)
+
+/*
+ *********************************************************
+ * NON PUBLIC FUNCTIONS
+ *********************************************************
+ */
+
+static void MulHiLoRandStream(unsigned long a, unsigned long b, unsigned long * hi, unsigned long * lo);
+
+static void BlockRandStream(const unsigned long key[2], const unsigned long ctr[4], unsigned long out[4]);
+
+/*
+ * Visibility:
+ * global
+ *
+ * Description:
+ * Initializes the root stream of a seed.  Every seed gives a different root stream, streams used
+ * during a simulation are split from the root stream.
+ *
+ * Arguments:
+ * seed- seed of stream
+ * rs- initialized stream
+ *
+ * Returns:
+ * ERR_SUCCESS (0) if stream initialized, otherwise an error code.
+ */
+int InitRandStream(long int seed, RandStream * rs)	{
+	unsigned long useed = (unsigned long) seed;
+
+	if ( rs == NULL )	{
+		ERR_ERROR("Arguments supplied to RandStream invalid. \n", ERR_EINVAL);
+		}
+
+	rs->key[0] = useed & RAND_STREAM_MASK32;
+#if ULONG_MAX > 0xFFFFFFFFUL
+	rs->key[1] = (useed >> 16 >> 16) & RAND_STREAM_MASK32;
+#else
+	rs->key[1] = 0;
+#endif
+	rs->id[0] = rs->id[1] = 0;
+	rs->blk[0] = rs->blk[1] = 0;
+	rs->num_out = 0;
+
+	return ERR_SUCCESS;
+	}
+
+/*
+ * Visibility:
+ * global
+ *
+ * Description:
+ * Initializes child stream id of parent.  The key and id of the child are the first block of the
+ * parent at a counter never used for draws, so children with different ids, and children of
+ * different parents, are independent of each other and of the parent.  The parent is not modified,
+ * so splitting does not depend on the numbers drawn from the parent or on the order children are split.
+ *
+ * Arguments:
+ * parent- stream to split
+ * id- identifies the child among the children of parent
+ * rs- initialized child stream
+ *
+ * Returns:
+ * ERR_SUCCESS (0) if stream initialized, otherwise an error code.
+ */
+int InitRandStreamSplit(const RandStream * parent, unsigned long id, RandStream * rs)	{
+	unsigned long ctr[4];
+	unsigned long out[4];
+
+	if ( parent == NULL || rs == NULL )	{
+		ERR_ERROR("Arguments supplied to split RandStream invalid. \n", ERR_EINVAL);
+		}
+
+	ctr[0] = id & RAND_STREAM_MASK32;
+	ctr[1] = RAND_STREAM_SPLIT_BLK;
+	ctr[2] = parent->id[0];
+	ctr[3] = parent->id[1];
+	BlockRandStream(parent->key, ctr, out);
+
+	rs->key[0] = out[0];
+	rs->key[1] = out[1];
+	rs->id[0] = out[2];
+	rs->id[1] = out[3];
+	rs->blk[0] = rs->blk[1] = 0;
+	rs->num_out = 0;
+
+	return ERR_SUCCESS;
+	}
+
+/*
+ * Visibility:
+ * global
+ *
+ * Description:
+ * Draws the next 32 bit word of the stream, computing the next block once every
+ * RAND_STREAM_BLOCK_WORDS draws.
+ *
+ * Arguments:
+ * rs- stream
+ *
+ * Returns:
+ * Uniformly distributed integer in [0, 2^32).
+ */
+unsigned long RandStreamNextWord(RandStream * rs)	{
+	unsigned long ctr[4];
+
+	if ( rs->num_out == 0 )	{
+		ctr[0] = rs->blk[0];
+		ctr[1] = rs->blk[1];
+		ctr[2] = rs->id[0];
+		ctr[3] = rs->id[1];
+		BlockRandStream(rs->key, ctr, rs->out);
+		rs->num_out = RAND_STREAM_BLOCK_WORDS;
+		/* 64 bit increment of block index */
+		rs->blk[0] = (rs->blk[0] + 1) & RAND_STREAM_MASK32;
+		if ( rs->blk[0] == 0 )	{
+			rs->blk[1] = (rs->blk[1] + 1) & RAND_STREAM_MASK32;
+			}
+		}
+
+	return rs->out[RAND_STREAM_BLOCK_WORDS - rs->num_out--];
+	}
+
+/*
+ * Visibility:
+ * global
+ *
+ * Description:
+ * Draws a real number uniformly distributed over the interval [a,b).
+ *
+ * Arguments:
+ * rs- stream
+ * a- lower limit on value of random number
+ * b- upper limit on value of random number
+ *
+ * Returns:
+ * Random number.
+ */
+double RandStreamUniform(RandStream * rs, double a, double b)	{
+	return a + (b - a) * ((double) RandStreamNextWord(rs) * RAND_STREAM_INV_2POW32);
+	}
+
+/*
+ * Visibility:
+ * global
+ *
+ * Description:
+ * Draws a real number with a Gaussian distribution using the Box-Muller transform.
+ *
+ * Arguments:
+ * rs- stream
+ * m- mean
+ * s- standard deviation, s > 0
+ *
+ * Returns:
+ * Random number.
+ */
+double RandStreamGauss(RandStream * rs, double m, double s)	{
+	double x1, x2;
+
+	/* x1 in (0,1] so its log is finite */
+	x1 = ((double) RandStreamNextWord(rs) + 1.0) * RAND_STREAM_INV_2POW32;
+	x2 = (double) RandStreamNextWord(rs) * RAND_STREAM_INV_2POW32;
+
+	return m + s * sqrt(-2.0 * log(x1)) * cos(2.0 * 3.14159265358979323846 * x2);
+	}
+
+/*
+ * Visibility:
+ * global
+ *
+ * Description:
+ * Draws an index uniformly distributed over [0,n), such as a random row of a table.
+ *
+ * Arguments:
+ * rs- stream
+ * n- number of indices, n > 0
+ *
+ * Returns:
+ * Random index, or 0 if n < 1.
+ */
+long int RandStreamIndex(RandStream * rs, long int n)	{
+	long int i;
+
+	if ( n < 1 )	{
+		return 0;
+		}
+	i = (long int) ((double) n * ((double) RandStreamNextWord(rs) * RAND_STREAM_INV_2POW32));
+
+	return ( i < n ) ? i : n - 1;
+	}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Computes the high and low 32 bits of the 64 bit product of two 32 bit words.
+ *
+ * Arguments:
+ * a- first word
+ * b- second word
+ * hi- high 32 bits of product
+ * lo- low 32 bits of product
+ *
+ * Returns:
+ * NONE.
+ */
+static void MulHiLoRandStream(unsigned long a, unsigned long b, unsigned long * hi, unsigned long * lo)	{
+#if ULONG_MAX > 0xFFFFFFFFUL
+	unsigned long p = a * b;
+
+	*hi = p >> 32;
+	*lo = p & RAND_STREAM_MASK32;
+#else
+	/* product assembled from 16 bit halves when unsigned long has only 32 bits */
+	unsigned long a0 = a & 0xFFFFUL, a1 = a >> 16;
+	unsigned long b0 = b & 0xFFFFUL, b1 = b >> 16;
+	unsigned long p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+	unsigned long mid = (p00 >> 16) + (p01 & 0xFFFFUL) + (p10 & 0xFFFFUL);
+
+	*hi = (p11 + (p01 >> 16) + (p10 >> 16) + (mid >> 16)) & RAND_STREAM_MASK32;
+	*lo = ((mid << 16) | (p00 & 0xFFFFUL)) & RAND_STREAM_MASK32;
+#endif
+
+	return;
+	}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Evaluates the Philox-4x32 bijection of a 128 bit counter under a 64 bit key (Salmon et al. 2011,
+ * Parallel Random Numbers: As Easy as 1, 2, 3).
+ *
+ * Arguments:
+ * key- 64 bit key, two 32 bit words
+ * ctr- 128 bit counter, four 32 bit words
+ * out- four 32 bit words of block
+ *
+ * Returns:
+ * NONE.
+ */
+static void BlockRandStream(const unsigned long key[2], const unsigned long ctr[4], unsigned long out[4])	{
+	unsigned long k0 = key[0], k1 = key[1];
+	unsigned long c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3];
+	unsigned long hi0, lo0, hi1, lo1;
+	int r;
+
+	for(r = 0; r < RAND_STREAM_NUM_ROUNDS; r++)	{
+		MulHiLoRandStream(RAND_STREAM_M0, c0, &hi0, &lo0);
+		MulHiLoRandStream(RAND_STREAM_M1, c2, &hi1, &lo1);
+		c0 = hi1 ^ c1 ^ k0;
+		c1 = lo1;
+		c2 = hi0 ^ c3 ^ k1;
+		c3 = lo0;
+		k0 = (k0 + RAND_STREAM_W0) & RAND_STREAM_MASK32;
+		k1 = (k1 + RAND_STREAM_W1) & RAND_STREAM_MASK32;
+		}
+
+	out[0] = c0;
+	out[1] = c1;
+	out[2] = c2;
+	out[3] = c3;
+
+	return;
+	}
+
+/* end of RandStream.c */
@@ -0,0 +1,70 @@
+#ifndef RandStream_H
+#define RandStream_H
+
+#include <stdlib.h>
+#include <math.h>
+#include <limits.h>
+
+#include "Err.h"
+
+/*
+ *********************************************************
+ * DEFINES, ENUMS
+ *********************************************************
+ */
+
+/* number of 32 bit words produced by each evaluation of the counter based generator */
+#define RAND_STREAM_BLOCK_WORDS					(4)
+
+/* number of rounds of the Philox-4x32 bijection, 10 passes the published statistical test batteries */
+#define RAND_STREAM_NUM_ROUNDS					(10)
+
+/*
+ *********************************************************
+ * STRUCTS, TYPEDEFS
+ *********************************************************
+ */
+
+typedef struct RandStream_ RandStream;
+
+/*
+ * Stream of random numbers computed from a key and a counter rather than from the previous number.
+ * Word k of block n of a stream is a fixed function of its key, its id, and n, so a stream may be
+ * split into independent child streams without drawing from it and the numbers drawn from one stream
+ * never depend on how many numbers were drawn from any other stream.  A RandStream is a small value
+ * which is copied or embedded in the structure that owns it, each stream must be drawn from by one
+ * thread at a time.
+ */
+struct RandStream_	{
+	unsigned long key[2];						/* 64 bit key, children derive their own key from the parent */
+	unsigned long id[2];						/* 64 bit id of stream, the high words of the counter */
+	unsigned long blk[2];						/* 64 bit index of the next block, the low words of the counter */
+	unsigned long out[RAND_STREAM_BLOCK_WORDS];	/* words of the current block */
+	int num_out;								/* number of words of out not yet drawn */
+	};
+
+/*
+ *********************************************************
+ * MACROS
+ *********************************************************
+ */
+
+/*
+ *********************************************************
+ * PUBLIC FUNCTIONS
+ *********************************************************
+ */
+
+int InitRandStream(long int seed, RandStream * rs);
+
+int InitRandStreamSplit(const RandStream * parent, unsigned long id, RandStream * rs);
+
+unsigned long RandStreamNextWord(RandStream * rs);
+
+double RandStreamUniform(RandStream * rs, double a, double b);
+
+double RandStreamGauss(RandStream * rs, double m, double s);
+
+long int RandStreamIndex(RandStream * rs, long int n);
+
+#endif RandStream_H		/* end of RandStream.h */
@@ -16,6 +16,8 @@
  */
 StrTwoDArray * InitStrTwoDArraySizeEmpty(unsigned int num_rows, unsigned int num_cols)	{
 	StrTwoDArray * sa = NULL;
+	char * block = NULL;
+	size_t hdr;
 	int i;
 	
 	if ( num_rows < 1 || num_cols < 1 )	{
@@ -26,26 +28,21 @@ StrTwoDArray * InitStrTwoDArraySizeEmpty(unsigned int num_rows, unsigned int num
 		ERR_ERROR_CONTINUE("Unable to initialize array, memory allocation failed. \n", ERR_ENOMEM);
 		return sa;
 		}
-	if ( (sa->array = (char ***) malloc(sizeof(char **) * num_rows)) == NULL ) {
+	/* row ptrs and elements share a single block, elements begin on an aligned boundary */
+	hdr = sizeof(char **) * num_rows + STRTWODARRAY_ALIGN - 1;
+	if ( (block = (char *) malloc(hdr + sizeof(char *) * (size_t) num_rows * num_cols)) == NULL ) {
 		ERR_ERROR_CONTINUE("Unable to initialize array, memory allocation failed. \n", ERR_ENOMEM);
 		free(sa);
 		sa = NULL;
 		return sa;
 		}
+	sa->array = (char ***) block;
+	sa->data = (char **) (block + hdr - ((size_t) (block + hdr) % STRTWODARRAY_ALIGN));
 	for(i = 0; i < num_rows; i++)	{
-		if ( (sa->array[i] = (char **) malloc(sizeof(char *) * num_cols)) == NULL )	{
-			ERR_ERROR_CONTINUE("Unable to initialize array, memory allocation failed. \n", ERR_ENOMEM);
-			/* unwind and deallocate any rows that have been allocated to this point */
-			num_rows = i;
-			for ( i = 0; i < num_rows; i++)	{
-				free(sa->array[i]);
-				sa->array[i] = NULL;
-				}
-			free(sa->array);
-			free(sa);
-			sa = NULL;
-			return sa;			
-			}
+		sa->array[i] = sa->data + (size_t) i * num_cols;
+		}
+	for(i = 0; i < num_rows * num_cols; i++)	{
+		sa->data[i] = NULL;
 		}
 	sa->size_rows = num_rows;
 	sa->size_cols = num_cols;
@@ -116,6 +113,30 @@ char *** GetUnderlyingStrTwoDArray(StrTwoDArray * arr)	{
 	return arr->array;
 	}
 
+/*
+ * Visibility:
+ * global
+ *
+ * Description:
+ * Retrieves the elements of the TwoDArray object as a single contiguous block.
+ * Element row,col is found at offset row * size_col + col, so bulk operations may
+ * traverse the whole array with a single index.  The block is aligned to STRTWODARRAY_ALIGN bytes.
+ * The ptr returned is the actual underlying storage, changes made will be permanent.
+ *
+ * Arguments:
+ * arr- the TwoDArray object
+ *
+ * Returns:
+ * ptr to first element of underlying array
+ */
+char ** GetFlatStrTwoDArray(StrTwoDArray * arr)	{
+	if ( arr == NULL || arr->data == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to retrieve underlying array. \n", ERR_EINVAL);
+		return NULL;
+		}
+	return arr->data;
+	}
+
 /*
  * Visibility:
  * global
@@ -241,20 +262,15 @@ int SetDataStrTwoDArray(StrTwoDArray * arr, unsigned int row, unsigned int col,
  * None
  */	 	
 void FreeStrTwoDArray(StrTwoDArray * arr)	{
-	int i,j;
+	int i;
 	if ( arr != NULL )	{
 		if ( arr->array != NULL )	{
-			for ( i = 0; i < arr->size_rows; i++)	{
-				for( j = 0; j < arr->size_cols; j++)	{
-					if ( arr->array[i][j] != NULL )	{
-						free(arr->array[i][j]);						/* free a cell in the underlying array */
-						}
-					}
-				if ( arr->array[i] != NULL )	{
-					free(arr->array[i]);							/* free a row in the underlying array */
+			for ( i = 0; i < arr->size_rows * arr->size_cols; i++)	{
+				if ( arr->data[i] != NULL )	{
+					free(arr->data[i]);								/* free a cell in the underlying array */
 					}
 				}
-			free(arr->array);										/* free the pointers to the rows */
+			free(arr->array);										/* free the row ptrs and elements */
 			}
 		free(arr);													/* free the TwoDArray structure */
 		}
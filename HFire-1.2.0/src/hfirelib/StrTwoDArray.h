@@ -11,6 +11,9 @@
  * DEFINES, ENUMS
  *********************************************************
  */
+
+/* alignment in bytes of the first element of the array */
+#define STRTWODARRAY_ALIGN							(64)
  
 /*
  *********************************************************
@@ -24,7 +27,8 @@ typedef struct StrTwoDArray_ StrTwoDArray;
 struct StrTwoDArray_	{
 	int size_rows;
 	int size_cols;
-	char *** array;
+	char *** array;					/* ptrs to the first element of each row */
+	char ** data;					/* elements in row-major order, contiguous */
 	}; 
 
 /*
@@ -37,10 +41,12 @@ struct StrTwoDArray_	{
 
 #define STRTWODARRAY_SIZE_COL(arr)	 				((arr)->size_cols)
 
-#define STRTWODARRAY_GET_DATA(arr, row, col)		((arr)->array[(row)][(col)])
+#define STRTWODARRAY_GET_DATA(arr, row, col)		((arr)->data[(row) * (arr)->size_cols + (col)])
 
 #define STRTWODARRAY_SET_DATA(arr, row, col, data)	(SetDataStrTwoDArray((arr), (row), (col), (data)))
 
+#define STRTWODARRAY_GET_FLAT(arr)					((arr)->data)
+
 /*
  *********************************************************
  * PUBLIC FUNCTIONS
@@ -53,6 +59,8 @@ StrTwoDArray * InitStrTwoDArraySizeIniValue(unsigned int num_rows, unsigned int
 
 char *** GetUnderlyingStrTwoDArray(StrTwoDArray * arr);
 
+char ** GetFlatStrTwoDArray(StrTwoDArray * arr);
+
 int GetSizeColStrTwoDArray(StrTwoDArray * arr);
 
 int GetSizeRowStrTwoDArray(StrTwoDArray * arr);
@@ -0,0 +1,326 @@
+#include "ThreadPool.h"
+
+/*
+ *********************************************************
+ * NON PUBLIC FUNCTIONS
+ *********************************************************
+ */
+
+static void ThreadPoolRunJob(ThreadPool * tp, int worker);
+
+#ifdef USING_UNIX
+static void * ThreadPoolWorkerMain(void * vptr);
+
+/* argument handed to each worker thread when it is created */
+typedef struct	{
+	ThreadPool * tp;
+	int worker;
+	} ThreadPoolWorkerArg;
+#endif
+
+/*
+ * Visibility:
+ * global
+ *
+ * Description:
+ * Initializes a pool of workers used to apply a function over a range of items.
+ * The thread calling ThreadPoolParallelFor always acts as worker 0, so a pool
+ * of num_workers creates num_workers - 1 additional threads.  When compiled
+ * without USING_UNIX or when num_workers is 1 no threads are created and all
+ * work is executed by the calling thread.
+ *
+ * Arguments:
+ * num_workers- number of workers, must be between 1 and THREAD_POOL_MAX_WORKERS
+ *
+ * Returns:
+ * Ptr to initialized ThreadPool, or NULL if unable to initialize.
+ */
+ThreadPool * InitThreadPool(int num_workers)	{
+	ThreadPool * tp = NULL;
+#ifdef USING_UNIX
+	ThreadPoolWorkerArg * warg = NULL;
+	int i;
+#endif
+
+	/* check args */
+	if ( num_workers < 1 || num_workers > THREAD_POOL_MAX_WORKERS )	{
+		ERR_ERROR_CONTINUE("Number of workers supplied to ThreadPool is out of range. \n", ERR_EINVAL);
+		return tp;
+		}
+
+	if ( (tp = (ThreadPool *) malloc(sizeof(ThreadPool))) == NULL )	{
+		ERR_ERROR_CONTINUE("Unable to allocate memory for ThreadPool. \n", ERR_ENOMEM);
+		return tp;
+		}
+
+	tp->func = NULL;
+	tp->arg = NULL;
+	tp->num_items = tp->grain = tp->next_item = 0;
+	tp->status = ERR_SUCCESS;
+
+#ifdef USING_UNIX
+	tp->num_workers = 1;
+	tp->threads = NULL;
+	tp->generation = 0;
+	tp->num_busy = 0;
+	tp->shutdown = 0;
+	pthread_mutex_init(&tp->mutex, NULL);
+	pthread_cond_init(&tp->work_cv, NULL);
+	pthread_cond_init(&tp->done_cv, NULL);
+
+	if ( num_workers > 1 )	{
+		if ( (tp->threads = (pthread_t *) malloc(sizeof(pthread_t) * (num_workers - 1))) == NULL )	{
+			ERR_ERROR_CONTINUE("Unable to allocate memory for ThreadPool threads. \n", ERR_ENOMEM);
+			FreeThreadPool(tp);
+			return NULL;
+			}
+		for(i = 1; i < num_workers; i++)	{
+			if ( (warg = (ThreadPoolWorkerArg *) malloc(sizeof(ThreadPoolWorkerArg))) == NULL )	{
+				ERR_ERROR_CONTINUE("Unable to allocate memory for ThreadPool worker. \n", ERR_ENOMEM);
+				FreeThreadPool(tp);
+				return NULL;
+				}
+			warg->tp = tp;
+			warg->worker = i;
+			if ( pthread_create(&tp->threads[i - 1], NULL, ThreadPoolWorkerMain, warg) != 0 )	{
+				free(warg);
+				ERR_ERROR_CONTINUE("Unable to create ThreadPool worker thread. \n", ERR_EFAILED);
+				FreeThreadPool(tp);
+				return NULL;
+				}
+			tp->num_workers = i + 1;
+			}
+		}
+#else
+	/* threads unavailable on this platform, run serially */
+	tp->num_workers = 1;
+#endif
+
+	return tp;
+	}
+
+/*
+ * Visibility:
+ * global
+ *
+ * Description:
+ * Applies func over the items [0, num_items) using every worker in the pool and
+ * returns once all items have been processed.  Items are handed out in contiguous
+ * blocks of grain items, so the worker processing any particular item is not fixed.
+ * Results written by func must therefore depend only upon the item and not upon
+ * the worker, which is supplied so that func may select per-worker scratch storage.
+ * A NULL ThreadPool is valid and executes all items on the calling thread.
+ *
+ * Arguments:
+ * tp- ThreadPool to execute the job, or NULL
+ * num_items- number of items in the job
+ * grain- number of items per block, if less than 1 THREAD_POOL_DEFAULT_GRAIN is used
+ * func- function applied to each block of items
+ * arg- argument supplied to func
+ *
+ * Returns:
+ * ERR_SUCCESS (0) if all calls to func were successful, otherwise the first
+ * error code returned by func.
+ */
+int ThreadPoolParallelFor(ThreadPool * tp, int num_items, int grain, ThreadPoolFunc func, void * arg)	{
+	/* check args */
+	if ( func == NULL )	{
+		ERR_ERROR("Function supplied to ThreadPool not initialized. \n", ERR_EINVAL);
+		}
+	if ( num_items < 1 )	{
+		return ERR_SUCCESS;
+		}
+	if ( grain < 1 )	{
+		grain = THREAD_POOL_DEFAULT_GRAIN;
+		}
+
+	/* small jobs and single worker pools are run on the calling thread */
+	if ( tp == NULL || tp->num_workers < 2 || num_items <= grain )	{
+		return func(arg, 0, 0, num_items);
+		}
+
+#ifdef USING_UNIX
+	/* post the job */
+	pthread_mutex_lock(&tp->mutex);
+	tp->func = func;
+	tp->arg = arg;
+	tp->num_items = num_items;
+	tp->grain = grain;
+	tp->next_item = 0;
+	tp->status = ERR_SUCCESS;
+	tp->num_busy = tp->num_workers - 1;
+	tp->generation++;
+	pthread_cond_broadcast(&tp->work_cv);
+	pthread_mutex_unlock(&tp->mutex);
+
+	/* calling thread participates as worker 0 */
+	ThreadPoolRunJob(tp, 0);
+
+	/* wait for remaining workers */
+	pthread_mutex_lock(&tp->mutex);
+	while ( tp->num_busy > 0 )	{
+		pthread_cond_wait(&tp->done_cv, &tp->mutex);
+		}
+	tp->func = NULL;
+	tp->arg = NULL;
+	pthread_mutex_unlock(&tp->mutex);
+
+	return tp->status;
+#else
+	tp->func = func;
+	tp->arg = arg;
+	tp->num_items = num_items;
+	tp->grain = grain;
+	tp->next_item = 0;
+	tp->status = ERR_SUCCESS;
+	ThreadPoolRunJob(tp, 0);
+	return tp->status;
+#endif
+	}
+
+/*
+ * Visibility:
+ * global
+ *
+ * Description:
+ * Stops all worker threads and frees memory associated with ThreadPool.
+ *
+ * Arguments:
+ * vptr- ptr to ThreadPool
+ *
+ * Returns:
+ * NONE.
+ */
+void FreeThreadPool(void * vptr)	{
+	ThreadPool * tp = NULL;
+#ifdef USING_UNIX
+	int i;
+#endif
+
+	if ( vptr != NULL )	{
+		tp = (ThreadPool *) vptr;
+#ifdef USING_UNIX
+		/* signal workers to exit and wait for them */
+		pthread_mutex_lock(&tp->mutex);
+		tp->shutdown = 1;
+		pthread_cond_broadcast(&tp->work_cv);
+		pthread_mutex_unlock(&tp->mutex);
+		for(i = 1; i < tp->num_workers; i++)	{
+			pthread_join(tp->threads[i - 1], NULL);
+			}
+		if ( tp->threads != NULL )	{
+			free(tp->threads);
+			}
+		pthread_cond_destroy(&tp->done_cv);
+		pthread_cond_destroy(&tp->work_cv);
+		pthread_mutex_destroy(&tp->mutex);
+#endif
+		free(tp);
+		}
+	tp = NULL;
+	return;
+	}
+
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Repeatedly claims the next block of items in the current job and applies the job
+ * function to it until all items are claimed.
+ *
+ * Arguments:
+ * tp- ThreadPool with a posted job
+ * worker- index of the worker executing the job
+ *
+ * Returns:
+ * NONE.
+ */
+static void ThreadPoolRunJob(ThreadPool * tp, int worker)	{
+	int begin, end, status;
+
+	for( ; ; )	{
+		/* claim the next block of items */
+#ifdef USING_UNIX
+		pthread_mutex_lock(&tp->mutex);
+#endif
+		begin = tp->next_item;
+		end = begin + tp->grain;
+		if ( end > tp->num_items )	{
+			end = tp->num_items;
+			}
+		tp->next_item = end;
+#ifdef USING_UNIX
+		pthread_mutex_unlock(&tp->mutex);
+#endif
+		if ( begin >= end )	{
+			break;
+			}
+
+		/* process block and remember the first failure */
+		if ( (status = tp->func(tp->arg, worker, begin, end)) != ERR_SUCCESS )	{
+#ifdef USING_UNIX
+			pthread_mutex_lock(&tp->mutex);
+#endif
+			if ( tp->status == ERR_SUCCESS )	{
+				tp->status = status;
+				}
+#ifdef USING_UNIX
+			pthread_mutex_unlock(&tp->mutex);
+#endif
+			}
+		}
+
+	return;
+	}
+
+#ifdef USING_UNIX
+/*
+ * Visibility:
+ * local
+ *
+ * Description:
+ * Entry point of each worker thread, waits for jobs to be posted and executes them
+ * until the pool is freed.
+ *
+ * Arguments:
+ * vptr- ptr to ThreadPoolWorkerArg, freed by this function
+ *
+ * Returns:
+ * NULL.
+ */
+static void * ThreadPoolWorkerMain(void * vptr)	{
+	ThreadPoolWorkerArg * warg = (ThreadPoolWorkerArg *) vptr;
+	ThreadPool * tp = warg->tp;
+	int worker = warg->worker;
+	unsigned long seen = 0;					/* no jobs are posted before all workers are created */
+
+	free(warg);
+
+	pthread_mutex_lock(&tp->mutex);
+	for( ; ; )	{
+		/* wait for a new job or shutdown */
+		while ( tp->shutdown == 0 && tp->generation == seen )	{
+			pthread_cond_wait(&tp->work_cv, &tp->mutex);
+			}
+		if ( tp->shutdown )	{
+			break;
+			}
+		seen = tp->generation;
+		pthread_mutex_unlock(&tp->mutex);
+
+		ThreadPoolRunJob(tp, worker);
+
+		/* signal the caller when the last worker finishes */
+		pthread_mutex_lock(&tp->mutex);
+		if ( --tp->num_busy == 0 )	{
+			pthread_cond_signal(&tp->done_cv);
+			}
+		}
+	pthread_mutex_unlock(&tp->mutex);
+
+	return NULL;
+	}
+#endif
+
+/* end of ThreadPool.c */
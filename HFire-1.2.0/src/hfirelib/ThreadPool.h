@@ -0,0 +1,74 @@
+#ifndef ThreadPool_H
+#define ThreadPool_H
+
+#include <stdlib.h>
+
+#ifdef USING_UNIX
+#include <pthread.h>
+#endif
+
+#include "Err.h"
+
+/*
+ *********************************************************
+ * DEFINES, ENUMS
+ *********************************************************
+ */
+
+/* upper limit on the number of workers in a pool */
+#define THREAD_POOL_MAX_WORKERS					(256)
+
+/* default number of items handed to a worker each time it requests work */
+#define THREAD_POOL_DEFAULT_GRAIN				(64)
+
+/*
+ *********************************************************
+ * STRUCTS, TYPEDEFS
+ *********************************************************
+ */
+
+/* function executed by a worker over the half-open range of items [begin, end) */
+typedef int (*ThreadPoolFunc)(void * arg, int worker, int begin, int end);
+
+typedef struct ThreadPool_ ThreadPool;
+
+struct ThreadPool_	{
+	int num_workers;					/* number of workers, including the calling thread */
+	ThreadPoolFunc func;				/* function applied to the current job */
+	void * arg;							/* argument supplied to func */
+	int num_items;						/* number of items in the current job */
+	int grain;							/* number of items handed out per request */
+	int next_item;						/* next item not yet handed to a worker */
+	int status;							/* first error code returned by func during the current job */
+#ifdef USING_UNIX
+	pthread_t * threads;				/* worker threads, num_workers - 1 of them */
+	pthread_mutex_t mutex;				/* protects all members below and the job members above */
+	pthread_cond_t work_cv;				/* signals workers that a job was posted or pool is closing */
+	pthread_cond_t done_cv;				/* signals the caller that all workers finished the job */
+	unsigned long generation;			/* incremented each time a job is posted */
+	int num_busy;						/* number of worker threads still running the current job */
+	int shutdown;						/* set when the pool is being freed */
+#endif
+	};
+
+/*
+ *********************************************************
+ * MACROS
+ *********************************************************
+ */
+
+#define THREAD_POOL_NUM_WORKERS(tp)				((tp) != NULL ? (tp)->num_workers : 1)
+
+/*
+ *********************************************************
+ * PUBLIC FUNCTIONS
+ *********************************************************
+ */
+
+ThreadPool * InitThreadPool(int num_workers);
+
+int ThreadPoolParallelFor(ThreadPool * tp, int num_items, int grain, ThreadPoolFunc func, void * arg);
+
+void FreeThreadPool(void * vptr);
+
+#endif ThreadPool_H		/* end of ThreadPool.h */